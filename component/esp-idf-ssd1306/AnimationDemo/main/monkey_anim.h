@@ -0,0 +1,372 @@
+// Generated by mkanim. Do not edit.
+// 'monkey10.pbm', 128x64px
+// 'monkey09.pbm', 128x64px
+// 'monkey08.pbm', 128x64px
+// 'monkey07.pbm', 128x64px
+// 'monkey06.pbm', 128x64px
+// 'monkey05.pbm', 128x64px
+// 'monkey04.pbm', 128x64px
+// 'monkey03.pbm', 128x64px
+// 'monkey02.pbm', 128x64px
+// 'monkey01.pbm', 128x64px
+#include "ssd1306_anim.h"
+
+const uint8_t monkey_data[] = {
+// frame 0 keyframe
+0x01,0xff,0xa2,0xff,0x44,0x1f,0x0f,0xcf,0xe7,0xf7,0x82,0x13,0x48,0xe3,0xf1,0xf9,
+0xf9,0xf3,0xe7,0x87,0x0f,0x1f,0x8b,0xff,0x40,0x7f,0x82,0x3f,0x82,0x1f,0x46,0x0f,
+0x07,0x3b,0x79,0x7d,0x7e,0xfe,0x87,0xff,0x46,0xf7,0xf6,0xf4,0xe0,0x01,0x0f,0x1f,
+0xa2,0xff,0xc0,0x99,0xff,0x44,0xf7,0x07,0x0f,0x1f,0x3f,0x82,0x7f,0x4c,0x7d,0x78,
+0x20,0x03,0x07,0x18,0x38,0x3e,0x1c,0x3c,0x3c,0x3d,0x7f,0x82,0x3f,0x44,0x0c,0x00,
+0x0f,0x3f,0x7f,0x85,0xff,0x41,0x07,0x03,0x04,0x41,0x80,0xc0,0x82,0xe0,0x43,0x80,
+0x20,0xf0,0xfc,0x89,0xff,0x42,0x7f,0x7e,0x7c,0x01,0x40,0xcc,0x86,0xff,0x83,0x7f,
+0x41,0x3f,0x3f,0x84,0x7f,0x90,0xff,0xc0,0x92,0xff,0x47,0xcf,0x8f,0x8f,0x0f,0x0f,
+0x07,0x03,0x03,0x02,0x42,0xc0,0xe0,0xe0,0x82,0xf0,0x83,0xf8,0x82,0xf0,0x82,0xfc,
+0x4e,0xfe,0xff,0xff,0x87,0x1f,0x3f,0xff,0xfe,0xfe,0xfc,0xf8,0xf1,0xe1,0x87,0x03,
+0x07,0x4c,0x07,0xff,0xff,0x7f,0x7f,0x7c,0x78,0x79,0x73,0xf3,0xe7,0xe4,0xe4,0x82,
+0xe0,0x50,0xf0,0xf8,0xfc,0xfc,0xfe,0xfe,0xbf,0x07,0x03,0x30,0x38,0x3c,0x1c,0x1e,
+0x1e,0x3e,0x7e,0x85,0xfe,0x47,0x7c,0xfc,0xf8,0xf8,0xf0,0x03,0x07,0x7f,0x8b,0xff,
+0xc0,0x93,0xff,0x43,0x1f,0x0f,0x07,0x82,0x82,0x80,0x02,0x47,0x07,0x1f,0x3f,0x7f,
+0x7f,0xff,0xe3,0xc1,0x84,0x81,0x82,0x83,0x48,0xc7,0xef,0xff,0xff,0xfe,0xfc,0x80,
+0x03,0x7f,0x84,0xff,0x40,0xdc,0x08,0x41,0x01,0x01,0x07,0x82,0x01,0x45,0x03,0x07,
+0x0f,0x1f,0x3f,0x7f,0x82,0xff,0x43,0xfe,0xfc,0xfc,0x7c,0x06,0x4c,0x0f,0xff,0xff,
+0xcf,0x0f,0x7c,0x78,0x70,0x73,0x63,0x01,0x00,0xf8,0x8b,0xff,0xc0,0x9a,0xff,0x40,
+0xfe,0x01,0x47,0xf8,0xfc,0xfc,0xfe,0xe6,0xc7,0xc3,0xc3,0x84,0x83,0x82,0x87,0x85,
+0xff,0x40,0x7f,0x01,0x83,0xff,0x41,0x3f,0x07,0x1b,0x45,0x01,0x01,0x03,0x31,0xe0,
+0x80,0x02,0x4f,0x80,0x80,0xc0,0xe0,0xf0,0xfc,0xf3,0xe7,0xcf,0xce,0xce,0xc4,0xe0,
+0xf0,0xfe,0xfe,0x8d,0xff,0xc0,0x9b,0xff,0x47,0xfe,0xfc,0xf8,0xf3,0x73,0x33,0x83,
+0xe3,0x82,0xf3,0x44,0x7f,0x3f,0xbf,0xbf,0xdf,0x84,0xff,0x4f,0x3f,0x07,0x01,0x00,
+0xc0,0xe2,0xe7,0xe3,0xf3,0xf0,0xf8,0xfc,0xfc,0xf0,0xe0,0x80,0x01,0x40,0x40,0x82,
+0xc0,0x40,0x80,0x0d,0x42,0x0c,0x88,0x80,0x04,0x43,0x07,0x1f,0x3f,0x3f,0x9d,0xff,
+0xc0,0x9f,0xff,0x52,0xfc,0xe0,0xc7,0x8f,0xc7,0x83,0x81,0x18,0x38,0x3f,0xbf,0xbf,
+0x9f,0xcf,0xe3,0xe1,0xf0,0xf8,0xfc,0x86,0xff,0x85,0x7f,0x43,0xff,0xfc,0xf8,0xc0,
+0x01,0x45,0x01,0x03,0x03,0x06,0x06,0x0e,0x82,0xfc,0x47,0xf8,0xf8,0x7c,0x7c,0x3c,
+0xbc,0x3e,0x3e,0x82,0x3f,0x44,0x7c,0x78,0x30,0x60,0x40,0x03,0x46,0x01,0x03,0x03,
+0x07,0x87,0x8f,0x8f,0x83,0x3f,0x91,0xff,0xc0,0xb2,0xff,0x47,0x07,0xf3,0xf9,0xf8,
+0xbc,0x3c,0x1c,0x0c,0x82,0xfe,0x47,0xfc,0x3c,0x10,0x01,0x07,0x0f,0x1f,0x1e,0x05,
+0x46,0x01,0x07,0xff,0xff,0xfc,0x02,0x67,0x85,0x6f,0x45,0x2f,0x0f,0x0f,0x8f,0xef,
+0xef,0x8c,0xff,0x44,0x7e,0x7c,0x30,0x03,0x0f,0x8e,0xff,0xc0,
+// frame 1 keyframe
+0x01,0xff,0xa2,0xff,0x43,0x7f,0x3f,0x9f,0xdf,0x83,0xcf,0x83,0xef,0x44,0xcf,0xcf,
+0x9f,0x1f,0x7f,0x88,0xff,0x42,0x7f,0x3f,0x1f,0x83,0x0f,0x45,0x1f,0x1f,0x0f,0x1f,
+0x3f,0x3f,0x84,0x7f,0x42,0x3f,0x3f,0xbf,0x83,0x3f,0x40,0x7f,0xa8,0xff,0xc0,0x98,
+0xff,0x55,0x1f,0x1f,0x07,0x0f,0x3f,0xff,0xff,0x7f,0x7f,0x63,0x00,0x1c,0x1f,0x3f,
+0x73,0x79,0xf8,0xf2,0xf3,0xe3,0xff,0xff,0x82,0x7f,0x42,0x3d,0x00,0xcf,0x85,0xff,
+0x40,0x1f,0x06,0x41,0x80,0xc0,0x05,0x43,0x80,0xc0,0xe0,0xf2,0x86,0xff,0x44,0x7e,
+0x70,0x01,0x07,0x1f,0x84,0xff,0x43,0x7f,0x7f,0x3f,0xbf,0x82,0x9f,0x41,0xdf,0xdf,
+0x85,0xcf,0x43,0x9f,0x9f,0x3f,0x7f,0x8c,0xff,0xc0,0x90,0xff,0x44,0xbf,0x3f,0x3f,
+0x1f,0x1f,0x82,0x0f,0x03,0x41,0xc0,0xc0,0x83,0xe0,0x40,0xc0,0x84,0xe0,0x51,0xf0,
+0xf8,0xf8,0xfc,0xfc,0xcc,0x1c,0x3e,0x7e,0xfe,0xfc,0xfc,0xf9,0xf3,0xe3,0xc7,0x07,
+0x06,0x07,0x5d,0x0f,0x1f,0x3c,0x30,0x03,0x0f,0x3e,0x7e,0x67,0x0f,0x1f,0x1f,0x3f,
+0x7f,0x7f,0xff,0x7f,0x33,0x07,0x0f,0x0c,0x80,0xc0,0xf0,0x1d,0x0f,0x0d,0x0c,0x0e,
+0x3e,0x8a,0xff,0x40,0xdf,0x83,0xcf,0x42,0x8f,0x00,0x71,0x8b,0xff,0xc0,0x92,0xff,
+0x43,0xfe,0x7c,0x3c,0x18,0x04,0x4a,0x1e,0x1f,0x7f,0x7f,0xff,0xef,0x87,0x87,0x07,
+0x07,0x03,0x83,0x07,0x41,0x0f,0xbf,0x82,0xff,0x44,0xfe,0xfc,0x01,0x01,0x3f,0x83,
+0xff,0x40,0xf8,0x1a,0x42,0x0e,0x1f,0x3f,0x82,0xff,0x40,0x18,0x05,0x41,0x03,0x0f,
+0x82,0xcf,0x44,0x9f,0x9f,0x1f,0x3f,0x3f,0x84,0x39,0x41,0x31,0x80,0x8c,0xff,0xc0,
+0x93,0xff,0x41,0xfc,0xfc,0x83,0xfe,0x47,0x1c,0xe0,0xf0,0xf8,0xfc,0xfc,0xfe,0xcf,
+0x82,0x87,0x41,0x07,0x87,0x82,0x83,0x41,0x87,0x87,0x85,0xff,0x01,0x40,0x78,0x83,
+0xff,0x41,0x7f,0x01,0x17,0x40,0x80,0x03,0x4b,0x01,0x03,0x07,0x0c,0x18,0x18,0x10,
+0x30,0x60,0x70,0xf0,0xfe,0x9b,0xff,0xc0,0x99,0xff,0x51,0xf0,0xe3,0xc7,0xc7,0xcf,
+0xcf,0x9f,0x1f,0x1f,0xcf,0xcf,0xff,0xff,0x7f,0x3f,0xbf,0xbf,0x9f,0x83,0xff,0x4e,
+0x7f,0x07,0x00,0x90,0x9e,0x8f,0xcf,0xc7,0xe3,0xe0,0xf8,0xfc,0xfc,0xf8,0xf0,0x82,
+0xe0,0x40,0xc0,0x02,0x82,0xc0,0x41,0x80,0x80,0x06,0x47,0x80,0x00,0x03,0x06,0x0c,
+0x9c,0xf8,0xf0,0x82,0xe0,0x43,0xc0,0xc0,0x80,0x80,0x07,0x41,0x01,0xfd,0x82,0xfc,
+0x44,0xf8,0xf9,0x43,0x07,0x0f,0x8c,0xff,0xc0,0x9e,0xff,0x65,0xf7,0xe0,0x80,0x0f,
+0x1f,0x3f,0x7f,0x5c,0x00,0x01,0x73,0x33,0x3f,0x3f,0x1f,0x8f,0x83,0xc0,0xe0,0xf8,
+0xff,0xff,0x7f,0x7f,0x3f,0x3f,0x9f,0x8f,0xcf,0xef,0xe7,0xef,0xcf,0x8f,0x1f,0x3f,
+0x3f,0x18,0x02,0x82,0x01,0x43,0x03,0x07,0x1f,0xfe,0x8b,0xff,0x83,0x7f,0x82,0x3f,
+0x47,0x3e,0x3f,0x3e,0xbc,0x9c,0xcc,0xe0,0xf8,0x85,0xff,0x01,0x40,0x86,0x8c,0xff,
+0xc0,0xa2,0xff,0x89,0xfe,0x86,0xff,0x42,0x81,0x38,0xfe,0x82,0xff,0x43,0xef,0xe3,
+0x81,0x3f,0x82,0xff,0x41,0x7c,0x30,0x01,0x40,0x60,0x83,0xe0,0x43,0xf0,0xf8,0xfc,
+0xfc,0x8b,0xff,0x45,0xf1,0x00,0x0e,0x0f,0xcf,0xcf,0x82,0xdf,0x41,0x9f,0x9f,0x84,
+0xff,0x82,0x7f,0x44,0x3f,0x1f,0x08,0x80,0xc0,0x8d,0xff,0xc0,
+// frame 2 keyframe
+0x01,0xff,0xa2,0xff,0x84,0x7f,0x42,0xff,0x7f,0x7f,0xbf,0xff,0x94,0xff,0xc0,0x9c,
+0xff,0x53,0x0f,0x07,0xf3,0xf9,0xf8,0x3c,0x9c,0x9e,0x8e,0x06,0x26,0x76,0xfe,0xfe,
+0xfc,0xf8,0xf0,0x01,0x03,0x1f,0x84,0xff,0x41,0x7f,0x0f,0x82,0x07,0x43,0x03,0x03,
+0x01,0x01,0x08,0x44,0x01,0x03,0x07,0x0f,0x1f,0x8e,0xff,0x8e,0x7f,0x94,0xff,0xc0,
+0x91,0xff,0x42,0x7f,0x3f,0x03,0x02,0x82,0x0f,0x40,0x07,0x01,0x52,0x02,0x07,0x07,
+0x03,0x07,0x07,0x87,0x8f,0xcf,0xde,0x9f,0x8f,0x8f,0x87,0x87,0x81,0x00,0x10,0x3f,
+0x82,0x7f,0x40,0x1f,0x06,0x48,0x08,0x04,0x06,0x07,0x07,0x87,0xe3,0xf3,0xf3,0x84,
+0xf0,0x4e,0xe0,0xe0,0xf0,0xe2,0x07,0x0f,0x1f,0xff,0x7f,0x1f,0xcf,0xe7,0x63,0x3b,
+0x39,0x82,0x1c,0x42,0x1e,0x3e,0x3e,0x86,0xfe,0x4c,0x3e,0x3e,0x3f,0x3e,0x9e,0x80,
+0xc0,0xe1,0xef,0xef,0x8f,0x0f,0x7f,0x8c,0xff,0xc0,0x89,0xff,0x46,0x3f,0x1f,0x1f,
+0x0f,0x07,0x01,0x01,0x04,0x45,0xf0,0xf8,0xfc,0xfe,0xff,0xff,0x82,0x7f,0x4d,0x7e,
+0x7c,0x7c,0x38,0x7f,0x7f,0xff,0xff,0xfd,0xf3,0xc3,0x87,0x0f,0x1f,0x83,0xff,0x42,
+0xfc,0xf0,0x40,0x09,0x44,0x18,0xf8,0xc0,0xc0,0xd9,0x86,0xff,0x43,0x7f,0xff,0xff,
+0x7f,0x03,0x45,0x03,0x00,0x01,0x03,0x03,0x02,0x05,0x84,0x03,0x41,0x01,0x01,0x02,
+0x41,0x80,0xf0,0x86,0xff,0x01,0x8c,0xff,0xc0,0x90,0xff,0x00,0x4b,0x80,0xc0,0xc0,
+0x00,0x01,0x07,0x87,0xc7,0xef,0xfc,0xf8,0x78,0x85,0x70,0x42,0x78,0x78,0xfd,0x83,
+0xff,0x43,0xfe,0x00,0x01,0x7f,0x83,0xff,0x40,0xf8,0x0b,0x48,0x01,0x03,0x03,0x01,
+0x01,0x04,0x07,0x07,0x03,0x07,0x40,0xe0,0x84,0xfe,0x43,0x3c,0x0c,0x06,0x04,0x83,
+0x06,0x87,0xfe,0x00,0x44,0x7f,0xff,0xff,0x1f,0x1f,0x82,0xff,0x43,0xfb,0x70,0x00,
+0x06,0x8b,0xff,0xc0,0x93,0xff,0x44,0xc1,0x8c,0x1e,0x1f,0x3f,0x82,0x7f,0x42,0x7c,
+0x7c,0x78,0x85,0xf8,0x41,0xfc,0xfe,0x84,0xff,0x4f,0x0c,0x00,0x60,0xff,0xff,0x7f,
+0x3f,0x07,0x80,0xf0,0xe0,0xe0,0xc0,0xc0,0x80,0x80,0x09,0x83,0x80,0x01,0x45,0xc0,
+0x80,0xc0,0x80,0x86,0x83,0x82,0x01,0x40,0x81,0x03,0x43,0x80,0xc0,0xe0,0xf8,0x88,
+0xff,0x01,0x4a,0xff,0x3f,0x38,0x70,0x67,0x67,0x63,0x21,0x80,0xc0,0xfe,0x8b,0xff,
+0xc0,0x99,0xff,0x44,0xfe,0xfe,0x3e,0x00,0xb0,0x83,0xff,0x44,0x07,0x03,0x19,0xf9,
+0xfd,0x82,0xff,0x47,0x7f,0x08,0x00,0xf0,0xf8,0xfc,0xfe,0xfe,0x87,0xff,0x53,0x3f,
+0xc7,0xc3,0x8f,0x1f,0x3f,0x7c,0x7c,0x3c,0x39,0x13,0x03,0xe7,0xe7,0x0f,0x4f,0xe0,
+0x80,0x0f,0x7f,0x98,0xff,0x48,0xf1,0xe7,0xc7,0xc7,0xe4,0xe0,0xe0,0xf0,0xf8,0x8e,
+0xff,0xc0,0x9c,0xff,0x48,0xf8,0xf3,0xf7,0xf7,0xef,0xe0,0xe0,0xf0,0xf2,0x82,0xf3,
+0x43,0xf9,0xf8,0xf8,0xfe,0x8d,0xff,0x44,0xf8,0xf0,0xe7,0xc7,0xcf,0x82,0xce,0x44,
+0xe6,0xe0,0xe0,0xe3,0xe3,0x82,0xf0,0x42,0xf1,0xf8,0xfc,0xb1,0xff,0xc0,
+// frame 3 keyframe
+0x01,0xff,0x9c,0xff,0x49,0x7f,0x1f,0xcf,0xe7,0xf7,0xf3,0x73,0x33,0x13,0x59,0x82,
+0xfb,0x44,0xf3,0xc7,0x8f,0x9f,0x3f,0xb2,0xff,0x4c,0x7f,0x1f,0x07,0x07,0x73,0x73,
+0xf7,0xe7,0xcf,0x8f,0x1f,0x3f,0x7f,0x90,0xff,0xc0,0x93,0xff,0x40,0xcf,0x83,0x1f,
+0x4b,0x3f,0x7f,0xff,0xff,0x7b,0x70,0x63,0x67,0x07,0x18,0x3c,0x3e,0x82,0x3c,0x40,
+0x3d,0x83,0x3f,0x40,0x03,0x01,0x83,0x7f,0xab,0xff,0x40,0x0f,0x06,0x83,0xff,0x46,
+0xfe,0xfc,0xe0,0x81,0x03,0x07,0x8f,0x8c,0xff,0xc0,0x8e,0xff,0x46,0x7f,0x3f,0x3f,
+0x1f,0x0f,0x0f,0x02,0x01,0x43,0x80,0xe0,0xf0,0xf0,0x89,0xf8,0x42,0xfc,0xfe,0xfe,
+0x82,0xff,0x42,0xcf,0x1f,0x3e,0x82,0xfe,0x47,0xf8,0xf8,0xe1,0xc1,0x07,0x1f,0x3f,
+0x3f,0x83,0x1f,0x83,0x0f,0x82,0x07,0x82,0x27,0x47,0x23,0x63,0x67,0x47,0x43,0xc3,
+0x8f,0x8f,0x82,0x07,0x41,0x0f,0x1f,0x87,0x3f,0x41,0x0f,0x03,0x06,0x45,0x3e,0xff,
+0xff,0xef,0x87,0x1f,0x83,0x3f,0x42,0x08,0x00,0x80,0x8c,0xff,0xc0,0x90,0xff,0x41,
+0x3f,0x06,0x04,0x49,0x01,0x0f,0x1f,0x3f,0x7f,0xff,0xff,0xf3,0xe3,0xc1,0x84,0x81,
+0x42,0x83,0x07,0x8f,0x83,0xff,0x43,0xf0,0x00,0x0f,0x3f,0x83,0xff,0x40,0xfe,0x05,
+0x86,0x20,0x00,0x42,0x40,0xc0,0xc0,0x05,0x42,0x03,0x7f,0xfe,0x03,0x83,0x80,0x00,
+0x40,0x80,0x02,0x83,0x80,0x4f,0xe0,0xfc,0xfe,0xf8,0xf0,0xe1,0xc0,0x81,0x83,0x87,
+0xc6,0xe6,0xe2,0xf0,0xf8,0xfc,0x8d,0xff,0xc0,0x90,0xff,0x41,0xfe,0xfe,0x82,0xff,
+0x44,0x0e,0x00,0xf8,0xfc,0xfe,0x82,0xff,0x40,0xe3,0x82,0xc3,0x84,0x83,0x40,0x87,
+0x86,0xff,0x42,0x1c,0x00,0xe0,0x83,0xff,0x40,0x1f,0x0b,0x43,0x20,0x30,0x1e,0x03,
+0x04,0x44,0x80,0xc0,0x38,0x0e,0x07,0x03,0x84,0xff,0x40,0x5f,0x84,0x07,0x40,0x27,
+0x83,0xe7,0x40,0xef,0x85,0xcf,0x82,0x9f,0x42,0x3f,0x3f,0x7f,0x8d,0xff,0xc0,0x96,
+0xff,0x41,0xfc,0xfc,0x83,0xf9,0x48,0x19,0x03,0xe3,0xe3,0xfb,0x3f,0x3f,0xdf,0xdf,
+0x86,0xff,0x4c,0x3f,0x07,0x80,0xc0,0xe7,0xe3,0xf3,0xf1,0xf0,0xf8,0xf8,0xf0,0x20,
+0x01,0x43,0x3c,0x3c,0x1c,0xee,0x87,0xfe,0x45,0xfc,0xfc,0xf8,0xf0,0xe1,0x01,0x03,
+0x48,0x10,0x1c,0x0f,0x1f,0x1f,0x3f,0x7f,0x3f,0x1c,0x06,0x4f,0x07,0x7f,0x7f,0xff,
+0xff,0xfd,0xf9,0x99,0x99,0x13,0x33,0x33,0x03,0x01,0xf0,0xfc,0x8d,0xff,0xc0,0x9c,
+0xff,0x48,0xf0,0xe0,0xc7,0xcf,0x87,0x83,0x90,0x98,0x99,0x82,0x9f,0x45,0x8f,0xcf,
+0xe3,0xe0,0xf0,0xfc,0x8a,0xff,0x59,0xfe,0xe0,0x86,0x9e,0xbe,0xbf,0x3f,0x1f,0x5f,
+0xff,0x7f,0x7f,0x3f,0x1f,0x7f,0x3f,0x3f,0x8f,0xc3,0xc0,0xf8,0xff,0xfe,0xfc,0xf8,
+0xf0,0x83,0xe0,0x82,0xc0,0x82,0xe0,0x42,0xf0,0xf0,0xf8,0x82,0xfe,0x82,0xfc,0x41,
+0xf8,0xf9,0x82,0xf3,0x42,0xf0,0xf0,0xf8,0x90,0xff,0xc0,0xbf,0xff,0x41,0xff,0xff,
+0x86,0xfe,0xb6,0xff,0xc0,
+// frame 4 keyframe
+0x01,0xff,0x98,0xff,0x41,0x7f,0x7f,0x85,0xff,0x53,0x1f,0x07,0xe1,0xf9,0xfc,0x3c,
+0x9c,0x8e,0x0e,0x26,0x36,0x7e,0xfe,0xfe,0xfc,0xf9,0xf1,0xc3,0x07,0x7f,0xa4,0xff,
+0x43,0x1f,0x07,0x03,0x33,0x82,0x39,0x43,0x79,0x79,0xf9,0xf9,0x85,0xf1,0x45,0xe3,
+0xe7,0xc7,0x0f,0x3f,0x7f,0x8e,0xff,0xc0,0x97,0xff,0x40,0x5f,0x02,0x4a,0x0f,0x0f,
+0x1f,0x1f,0x0f,0x0e,0x00,0x07,0x07,0x0c,0x0e,0x82,0x0f,0x4c,0x8f,0xce,0xce,0xef,
+0xcf,0xcf,0xc7,0xc3,0x81,0x18,0x3f,0x7f,0x7f,0x85,0xff,0x42,0x7f,0x1f,0x0f,0x84,
+0x07,0x50,0x0f,0x8b,0x7b,0x7b,0x73,0xb3,0x33,0x07,0x27,0x77,0x6f,0xef,0xcf,0xdf,
+0xbf,0xbf,0x7f,0x83,0xff,0x41,0xfe,0xf8,0x07,0x40,0xe7,0x82,0xff,0x43,0x3f,0x3f,
+0x7f,0x7f,0x82,0xff,0x40,0x7e,0x01,0x40,0x1f,0x8c,0xff,0xc0,0x8f,0xff,0x45,0xf7,
+0xe3,0xe3,0xe1,0xe1,0xc1,0x04,0x42,0xe0,0xfc,0xfc,0x83,0xfe,0x83,0x7e,0x41,0x7c,
+0x7f,0x85,0xff,0x43,0xf3,0xc7,0x0f,0x7f,0x82,0xff,0x46,0xfe,0xfc,0xf0,0x01,0x03,
+0x1f,0x3f,0x06,0x42,0x06,0x0f,0x0f,0x01,0x40,0x02,0x84,0x07,0x02,0x4a,0x01,0x03,
+0x03,0x19,0x1c,0x1f,0x1f,0x0f,0x07,0x03,0x01,0x05,0x4f,0x80,0xf8,0xc3,0x83,0x07,
+0x73,0x43,0x46,0x0c,0x0c,0x8c,0xc4,0xe0,0xf0,0xf8,0xfe,0x8d,0xff,0xc0,0x92,0xff,
+0x46,0xbf,0x83,0xc0,0xe0,0xe0,0xc0,0x80,0x01,0x47,0x03,0x87,0x8f,0xdf,0xff,0xfc,
+0x78,0x70,0x82,0x60,0x83,0xe0,0x40,0xf1,0x83,0xff,0x42,0xf8,0x00,0x07,0x84,0xff,
+0x40,0xfe,0x0b,0x43,0x40,0xc0,0x80,0x80,0x0c,0x40,0x40,0x83,0xc0,0x82,0xe0,0x43,
+0xf0,0xf8,0xfc,0xfe,0x83,0xff,0x84,0xfe,0x94,0xff,0xc0,0x98,0xff,0x42,0x80,0x08,
+0x3f,0x82,0x7f,0x41,0xff,0xf8,0x82,0xf0,0x84,0xe0,0x41,0xf1,0xf3,0x85,0xff,0x01,
+0x47,0xff,0xff,0x7f,0x7f,0x0f,0x03,0x80,0x80,0x02,0x43,0x30,0xe0,0xc0,0x80,0x04,
+0x46,0x01,0x03,0x07,0x0e,0x3c,0xf0,0x80,0x06,0x41,0xe0,0xf8,0xa8,0xff,0xc0,0x9a,
+0xff,0x83,0xfe,0x40,0x3e,0x01,0x47,0xf0,0xff,0xff,0xcf,0x07,0x03,0x7b,0xfb,0x84,
+0xff,0x43,0x7f,0x01,0x80,0xf0,0x82,0xfc,0x41,0x7e,0x7f,0x83,0x3f,0x46,0x7e,0x7e,
+0x78,0x38,0x3f,0x1f,0x07,0x07,0x45,0x80,0xe0,0xff,0xff,0xc0,0x80,0x04,0x48,0x01,
+0x07,0x07,0x0f,0x0f,0x1f,0x3f,0x7f,0x7f,0xa0,0xff,0xc0,0x9e,0xff,0x48,0xfe,0xf8,
+0xf1,0xe7,0xe7,0xc7,0xc3,0xe0,0xe0,0x82,0xe7,0x4a,0xf7,0xf3,0xfb,0xfd,0xfe,0x3e,
+0xdf,0xe7,0xc3,0x89,0x1c,0x82,0xfe,0x84,0xff,0x44,0xfe,0xfe,0xfc,0xf0,0xe0,0x01,
+0x44,0x78,0xfc,0xfc,0xfe,0xfe,0x88,0xff,0x4a,0xfe,0xfe,0xfc,0xf8,0xf8,0xf0,0xe0,
+0xe0,0xc0,0xc0,0x80,0x02,0x48,0x01,0x03,0x03,0x07,0x07,0x0f,0x0f,0x1f,0x3f,0x83,
+0x7f,0x91,0xff,0xc0,0xae,0xff,0x4a,0xfe,0xfc,0xf9,0xf1,0xf3,0xc3,0xcb,0x9f,0x9f,
+0x1f,0x1f,0x82,0xff,0x48,0x7f,0x3f,0x3f,0x1f,0x8f,0xc7,0xc0,0xe0,0xf8,0x8f,0xff,
+0x49,0x3f,0x3f,0x9f,0xcf,0x4f,0x6f,0x27,0xa7,0xe6,0xe6,0x83,0xf0,0x84,0xe0,0x46,
+0xf0,0xf0,0x7c,0x7c,0x1c,0x80,0xe0,0x8f,0xff,0xc0,
+// frame 5 keyframe
+0x01,0xff,0x99,0xff,0x43,0x3f,0x1f,0x0f,0x1f,0x82,0xff,0x4c,0xc3,0x80,0x3e,0xff,
+0xef,0xc3,0xc1,0xf0,0xe0,0xe0,0xc6,0xee,0xfe,0x82,0xff,0x44,0xfe,0xfe,0x78,0x01,
+0x83,0x87,0xff,0x86,0x7f,0x82,0xff,0x48,0x3f,0x3f,0x1f,0x9f,0x9f,0x1f,0x3f,0xbf,
+0xff,0x85,0x7f,0x82,0xff,0x46,0x3f,0x3f,0x0f,0x67,0x67,0x73,0x73,0x83,0xf9,0x82,
+0xf8,0x49,0xfc,0xf8,0xf9,0xf1,0xf1,0xc3,0x03,0x0f,0x1f,0xbf,0x8d,0xff,0xc0,0x91,
+0xff,0x41,0xc7,0x87,0x84,0x07,0x40,0x03,0x03,0x5e,0x83,0xc3,0xc1,0xc1,0xc0,0xe0,
+0xe0,0xc0,0xc0,0x80,0xe0,0xf0,0xf0,0xf1,0xf9,0xfd,0x1d,0x3c,0x7c,0xf8,0xf8,0xf0,
+0xf3,0xf7,0xc7,0x87,0x0f,0x3f,0x3f,0x0f,0x03,0x05,0x41,0xe0,0xc0,0x01,0x50,0x08,
+0x3e,0x1e,0x9f,0x8f,0xcf,0xe6,0xe0,0x01,0x07,0xcf,0xef,0xcf,0xc7,0x02,0x00,0xe0,
+0x82,0xff,0x41,0xfc,0xf0,0x03,0x4f,0x01,0x07,0x0f,0x0f,0xff,0xff,0x7f,0x2f,0x1f,
+0x3f,0x7f,0xff,0x7f,0x7e,0x00,0xf8,0x8e,0xff,0xc0,0x92,0xff,0x42,0x7f,0x3e,0x08,
+0x05,0x41,0x3f,0x7f,0x82,0xff,0x41,0x8f,0x0f,0x84,0x07,0x82,0x0f,0x48,0x1f,0x3f,
+0xff,0xff,0xfc,0xf0,0xc1,0x07,0x7f,0x84,0xff,0x40,0xf8,0x08,0x41,0x01,0x01,0x04,
+0x43,0x01,0x03,0x03,0x01,0x02,0x82,0x01,0x42,0x0d,0x0c,0x0c,0x85,0x0f,0x05,0x47,
+0xe0,0xf8,0xf1,0xe1,0xc0,0xc2,0xc7,0xce,0x82,0xcc,0x42,0xe4,0xe0,0xf7,0x8e,0xff,
+0xc0,0x92,0xff,0x40,0xf8,0x84,0xfc,0x4a,0x10,0x00,0x80,0xe0,0xf0,0xf1,0xfb,0x1b,
+0x1f,0x0f,0x0f,0x82,0x0e,0x44,0x0c,0x1c,0x1c,0x3c,0x7e,0x85,0xff,0x01,0x40,0xcf,
+0x83,0xff,0x40,0x7f,0x1f,0x40,0xe0,0x83,0xf0,0x82,0xf8,0x40,0xfe,0x9c,0xff,0xc0,
+0x98,0xff,0x52,0xfc,0xf0,0xe3,0xc7,0xcf,0xcf,0x8f,0x9f,0x0f,0x0e,0x8e,0xce,0xfe,
+0x7c,0x7c,0x7e,0x3e,0x3e,0x7e,0x84,0xff,0x40,0x0b,0x01,0x4d,0x1f,0x9f,0x8f,0xcf,
+0xc1,0xe0,0xf0,0xf0,0xe0,0xc0,0x80,0xcc,0xf8,0xe0,0x05,0x43,0x07,0x0e,0xf0,0xc0,
+0x0b,0x41,0x60,0xf0,0xa5,0xff,0xc0,0x9e,0xff,0x53,0xe9,0xc0,0x00,0x3e,0x7f,0x7f,
+0x1f,0x18,0xc0,0xe7,0xe7,0xff,0x7f,0x3f,0x1f,0x0f,0x07,0x81,0xc0,0xf8,0x82,0xff,
+0x86,0x7f,0x85,0xff,0x40,0x7c,0x06,0x4b,0x5f,0xfc,0xf8,0xf8,0xfc,0xfc,0xf0,0xf0,
+0xe0,0xc0,0xc0,0x80,0x03,0x48,0x03,0x03,0x07,0x0f,0x1f,0x1f,0x3f,0x7f,0x7f,0x9b,
+0xff,0xc0,0xa1,0xff,0x40,0xfe,0x88,0xfc,0x4b,0x3c,0x4e,0xe7,0xe7,0xc7,0x83,0x81,
+0x81,0x80,0x80,0xce,0xce,0x83,0xfe,0x45,0xfc,0xfc,0xf8,0xc1,0x01,0x01,0x01,0x40,
+0x80,0x83,0xc0,0x42,0xe0,0xf0,0xf8,0x8a,0xff,0x45,0x7f,0x7e,0x7c,0x7c,0x38,0x38,
+0x06,0x48,0x01,0x01,0x03,0x07,0x07,0x0f,0x0f,0x3f,0x7f,0x92,0xff,0xc0,0xab,0xff,
+0x47,0xf8,0xf0,0xc1,0x03,0x33,0x79,0xfd,0xff,0x82,0x7f,0x85,0xff,0x46,0x7f,0x7f,
+0x3f,0x02,0x80,0x80,0xe6,0x90,0xff,0x01,0x59,0x46,0x66,0x67,0x33,0x27,0xb2,0xb2,
+0xfe,0xfe,0xff,0xfe,0xfe,0xfc,0xfc,0xf8,0xf0,0xe0,0xe0,0xf0,0x70,0x78,0x78,0x30,
+0x01,0x03,0xcf,0x8e,0xff,0xc0,
+// frame 6 keyframe
+0x01,0xff,0xa1,0xff,0x47,0x7f,0x3f,0x9f,0xdf,0xcf,0x4f,0x67,0x67,0x82,0xe7,0x43,
+0xef,0xcf,0x9f,0x3f,0xa3,0xff,0x47,0x7f,0x0f,0x0f,0x37,0x7f,0x7f,0x7b,0x7b,0x83,
+0xfb,0x83,0xf9,0x82,0xfb,0x82,0xf9,0x83,0xf3,0x45,0xe7,0xe7,0xc7,0x0f,0x1f,0x7f,
+0x8a,0xff,0xc0,0x96,0xff,0x45,0x7f,0x1f,0x0f,0x1f,0xff,0xff,0x82,0x7f,0x40,0x01,
+0x01,0x42,0x3e,0x6f,0x61,0x82,0xf0,0x41,0xe3,0xe7,0x83,0x7f,0x42,0x0f,0x00,0xc2,
+0x8d,0xff,0x82,0x7f,0x40,0x3f,0x82,0x1f,0x43,0x3f,0x3f,0x7f,0x7f,0x88,0xff,0x43,
+0xfd,0xe0,0xc0,0x80,0x05,0x56,0x03,0x07,0x1f,0x3f,0x3f,0x7f,0x7f,0xff,0xbf,0x3f,
+0x3b,0x33,0x33,0x63,0x67,0x47,0x47,0x07,0x07,0x87,0xc3,0xf0,0xfc,0x8a,0xff,0xc0,
+0x8d,0xff,0x42,0xf3,0x83,0x03,0x84,0x07,0x40,0x01,0x02,0x41,0xc0,0xc0,0x83,0xe0,
+0x40,0xc0,0x84,0xe0,0x48,0xf0,0xf8,0xfc,0xfc,0xec,0xdc,0x3e,0x7e,0x7e,0x82,0xfc,
+0x47,0xf9,0xf3,0xf3,0xc7,0x07,0x0f,0x3f,0x3f,0x82,0x1f,0x45,0x0f,0x0c,0x8c,0x8c,
+0x84,0x84,0x82,0x8c,0x84,0x0c,0x40,0x0e,0x83,0x0f,0x42,0x07,0x0f,0x0f,0x82,0x1f,
+0x42,0x3f,0x1f,0x1f,0x08,0x47,0x80,0xfe,0xfe,0xfc,0xf9,0xf9,0xf3,0xf3,0x83,0xf0,
+0x41,0xf8,0xfe,0x8f,0xff,0xc0,0x8f,0xff,0x42,0x1f,0x1e,0x0c,0x05,0x46,0x1f,0x3f,
+0x7f,0xff,0xff,0xcf,0x87,0x82,0x07,0x40,0x03,0x83,0x07,0x41,0x0f,0xbf,0x82,0xff,
+0x44,0xfe,0xec,0x01,0x03,0x3f,0x83,0xff,0x40,0xf8,0x02,0x82,0x40,0x00,0x83,0x80,
+0x00,0x82,0x01,0x46,0x03,0x03,0x06,0x0e,0xfc,0xf8,0x20,0x09,0x41,0x20,0xe0,0x82,
+0xf0,0x45,0xf8,0xf8,0xfc,0xfc,0xfe,0xfe,0x9d,0xff,0xc0,0x94,0xff,0x4e,0xfe,0xfc,
+0x1c,0xe0,0xf0,0xf8,0xfc,0xfc,0xfe,0xcf,0x87,0x87,0x07,0x07,0x87,0x82,0x83,0x41,
+0x87,0xc7,0x85,0xff,0x01,0x40,0xf8,0x83,0xff,0x40,0x7f,0x08,0x42,0xe0,0xff,0x3f,
+0x04,0x43,0xc0,0xfe,0xff,0x07,0x0b,0xa7,0xff,0xc0,0x96,0xff,0x42,0xf0,0xe7,0xc7,
+0x82,0xcf,0x44,0xdf,0xdf,0x9f,0x0f,0x8f,0x84,0xff,0x43,0x7f,0x3f,0xbf,0xbf,0x82,
+0xff,0x40,0x07,0x01,0x50,0x86,0x8f,0xcf,0xc7,0xe1,0xf0,0x78,0x3c,0x9f,0xcf,0xc6,
+0xe6,0xe4,0xe0,0xf3,0xf7,0xf1,0x82,0xf0,0x45,0xe0,0xe0,0xe8,0x0f,0x0f,0x81,0x84,
+0x80,0x43,0xc0,0xc0,0x80,0x80,0x03,0x42,0x03,0x07,0x07,0x82,0x1f,0x41,0x3f,0x3f,
+0x83,0x7f,0x83,0xff,0x83,0x7f,0x47,0x3f,0x3f,0x1f,0x9f,0x1f,0x3f,0x3f,0x7f,0x8b,
+0xff,0xc0,0x9e,0xff,0x42,0xf0,0xc0,0x9f,0x83,0x7f,0x55,0x0c,0x00,0x73,0x73,0x7f,
+0x7f,0x3f,0x8f,0xc1,0xc0,0xf0,0xff,0xff,0x0f,0x67,0xf3,0xf8,0xc0,0xc0,0xe1,0xf1,
+0xfc,0x8a,0xff,0x40,0x7f,0x01,0x8a,0xff,0x44,0xfe,0xfe,0xfc,0xfc,0xf8,0x82,0xf0,
+0x83,0xe0,0x86,0xc0,0x03,0x41,0xe0,0xfe,0x82,0xff,0x40,0xfe,0x01,0x40,0x01,0x8a,
+0xff,0xc0,0xa2,0xff,0x88,0xfe,0x86,0xff,0x47,0xfe,0xfc,0xf9,0xf9,0xfb,0xfb,0xf3,
+0xe7,0x82,0xcf,0x42,0xc7,0xe3,0xc7,0x82,0xcf,0x45,0xe3,0xe3,0xe0,0xf8,0xfc,0xfe,
+0x92,0xff,0x4e,0x3f,0x1f,0x1f,0x4f,0x0f,0x0f,0x07,0x67,0x63,0x73,0xf1,0xf8,0xfc,
+0xfc,0xfe,0x83,0xff,0x41,0x7f,0x1f,0x01,0x40,0xf8,0x8a,0xff,0xc0,
+// frame 7 keyframe
+0x01,0xff,0x9f,0xff,0x82,0x7f,0x40,0x3f,0x83,0x7f,0xbf,0xff,0x97,0xff,0xc0,0x98,
+0xff,0x4b,0x7f,0x07,0xc3,0xf1,0xfc,0x3c,0x1e,0x0e,0x06,0x26,0x3e,0x3e,0x82,0xfe,
+0x42,0xfc,0xe1,0x07,0x8d,0xff,0x45,0x7f,0x3f,0x1f,0x0f,0x07,0x07,0x82,0x03,0x41,
+0x01,0x81,0x04,0x44,0x01,0x03,0x07,0x1f,0x1f,0x85,0xff,0x47,0x3f,0x9f,0xdf,0xcf,
+0xe7,0xf7,0xf3,0xf3,0x82,0xf9,0x86,0xfc,0x45,0x3d,0x3d,0x39,0x01,0x03,0x63,0x93,
+0xff,0xc0,0x8f,0xff,0x41,0x1f,0x01,0x02,0x40,0x01,0x82,0x0f,0x5e,0x0e,0x04,0x01,
+0x07,0x07,0x04,0x02,0x07,0x07,0x06,0x8e,0x8e,0xce,0x9f,0x9f,0x8f,0x8f,0x80,0x8e,
+0x8f,0x1f,0x1f,0x3f,0x7f,0x7f,0xff,0xff,0x1f,0x0f,0x07,0x01,0x03,0x49,0xc0,0xe0,
+0x78,0x38,0x0c,0x06,0xc7,0xe3,0xf3,0xf2,0x84,0xf0,0x4d,0xe0,0xe0,0xf0,0xe3,0x07,
+0x0f,0x3f,0x3f,0xfc,0xe0,0xc3,0x87,0x07,0x07,0x84,0x03,0x46,0x07,0x0f,0x7f,0xff,
+0xff,0xf7,0xf7,0x83,0xe7,0x44,0xcf,0x06,0xa0,0xf0,0xfc,0x91,0xff,0xc0,0x88,0xff,
+0x45,0xfc,0xf8,0xf0,0xf0,0xe0,0xc0,0x04,0x4e,0xe0,0xf8,0xfc,0xfe,0xfe,0xff,0xff,
+0x7f,0x7f,0x7e,0x7e,0x7c,0x38,0x3e,0x7f,0x82,0xff,0x45,0xf9,0xf3,0x83,0x0f,0x1f,
+0x3f,0x82,0xff,0x42,0xfe,0xf0,0x60,0x0c,0x43,0x18,0xf8,0xc0,0xc1,0x86,0xff,0x44,
+0x7f,0x7f,0xff,0xff,0x7f,0x04,0x44,0x01,0x01,0x03,0x03,0x02,0x05,0x40,0xe0,0x84,
+0xfc,0x4e,0xf8,0x7c,0x79,0x3d,0x3c,0x1e,0x0f,0xcf,0xc7,0xe7,0xe7,0xf7,0xf7,0x07,
+0x1f,0x8b,0xff,0xc0,0x8c,0xff,0x4e,0xcf,0xc7,0xc1,0xc0,0xe0,0xc0,0x80,0x00,0x03,
+0x87,0xcf,0xc7,0xfd,0xf8,0x78,0x86,0x70,0x41,0x78,0x79,0x84,0xff,0x42,0x60,0x00,
+0x3f,0x83,0xff,0x40,0xf8,0x0e,0x48,0x01,0x03,0x03,0x01,0x01,0x04,0x07,0x07,0x03,
+0x01,0x40,0x01,0x01,0x48,0x80,0xe0,0xfe,0x7c,0x3c,0x3c,0x38,0x38,0x18,0x01,0x43,
+0x08,0x0c,0x0e,0x0e,0x83,0x07,0x42,0x03,0x01,0x01,0x04,0x42,0xc0,0xc0,0xf8,0x84,
+0xff,0x42,0xd1,0x00,0x03,0x8a,0xff,0xc0,0x91,0xff,0x44,0xe1,0x80,0x1e,0x1f,0x3f,
+0x82,0x7f,0x42,0x7c,0x7c,0x78,0x85,0xf8,0x41,0xfc,0xfe,0x84,0xff,0x40,0xfe,0x01,
+0x82,0xff,0x4c,0x7f,0x0f,0x80,0xe0,0xf8,0xf8,0xf0,0xe0,0xe0,0xc0,0xc0,0x80,0x80,
+0x09,0x83,0x80,0x00,0x44,0x40,0xc0,0xe0,0xc1,0xc1,0x84,0xc0,0x43,0xe0,0xc0,0xc0,
+0xe0,0x85,0xf0,0x41,0xf8,0xf8,0x82,0xfc,0x49,0xfe,0xff,0xff,0xf2,0x00,0x7f,0xff,
+0xff,0x0f,0x0f,0x82,0xff,0x43,0xfc,0x30,0x00,0x87,0x89,0xff,0xc0,0x97,0xff,0x82,
+0xfe,0x42,0xe8,0x10,0xfc,0x83,0xff,0x43,0xc7,0x03,0x3b,0x7f,0x82,0xff,0x41,0x7f,
+0x3f,0x01,0x44,0xf0,0xfc,0xfc,0xfe,0xfe,0x89,0xff,0x52,0x1f,0xc3,0xc3,0x8f,0x1f,
+0x3f,0x7c,0x7c,0x38,0x39,0x13,0x03,0xe7,0xc7,0x0f,0xee,0xc0,0x00,0x1f,0x99,0xff,
+0x4b,0x80,0xe0,0xff,0x9f,0x18,0x30,0x73,0x33,0x11,0x00,0xc0,0xe2,0x8a,0xff,0xc0,
+0x9b,0xff,0x45,0xfc,0xf3,0xf7,0xf7,0xe7,0xe7,0x82,0xf0,0x46,0xf3,0xf3,0xf1,0xf9,
+0xf8,0xf8,0xfe,0x8f,0xff,0x44,0xf8,0xf1,0xe7,0xc7,0xcf,0x82,0xce,0x4a,0xe6,0xe0,
+0xe0,0xe3,0xf3,0xf0,0xf0,0xf1,0xf1,0xf8,0xfc,0x99,0xff,0x48,0xfc,0xf1,0xe3,0xe7,
+0xe3,0xf2,0xf0,0xf0,0xfc,0x8d,0xff,0xc0,
+// frame 8 keyframe
+0x01,0xff,0x9c,0xff,0x49,0x1f,0x8f,0xc7,0xe7,0xf3,0xf3,0x73,0x33,0xb3,0xbb,0x82,
+0xf3,0x44,0xe7,0xc7,0x9f,0x1f,0x7f,0x89,0xff,0x42,0x3f,0x3f,0x1f,0x84,0x0f,0x84,
+0x07,0x82,0x0f,0x44,0xc7,0xe7,0xf3,0xf3,0xf1,0x84,0xf8,0x47,0xec,0xe5,0xc1,0xc3,
+0x03,0x07,0x0f,0x1f,0xa4,0xff,0xc0,0x93,0xff,0x40,0xbf,0x82,0x07,0x40,0xdf,0x83,
+0xff,0x51,0x70,0x67,0x1f,0x3f,0x79,0x78,0x7e,0x7c,0x78,0x79,0x71,0x77,0x7f,0x7f,
+0x3f,0x1f,0x00,0xe0,0x86,0xff,0x41,0x0f,0x03,0x06,0x40,0xe0,0x84,0xf0,0x45,0xe0,
+0xc0,0x80,0x07,0x3f,0x7f,0x87,0xff,0x44,0x7f,0x7b,0xf3,0xf7,0xc0,0x01,0x40,0xfe,
+0x89,0xff,0x49,0x3f,0x3f,0xdf,0xdf,0x9f,0x9f,0xbf,0x3f,0x7f,0x7f,0x90,0xff,0xc0,
+0x8b,0xff,0x42,0x9f,0x9f,0x1f,0x82,0x0f,0x42,0x07,0x07,0x03,0x01,0x42,0xc0,0xe0,
+0xf1,0x88,0xf0,0x40,0xf8,0x82,0xfc,0x4d,0xfe,0xfe,0xde,0x1e,0x3e,0xfe,0xfe,0xfc,
+0xf8,0xf0,0xe0,0xc3,0x8f,0x0f,0x08,0x42,0x1c,0x1f,0x0f,0x83,0x03,0x82,0x01,0x02,
+0x82,0x01,0x04,0x40,0x20,0x82,0xf0,0x42,0xf8,0xfc,0xfe,0x83,0xff,0x83,0x7f,0x42,
+0x3f,0x1f,0x01,0x01,0x41,0x01,0x7b,0x84,0xff,0x44,0xfc,0xf0,0xc1,0x07,0x1f,0x8c,
+0xff,0xc0,0x8e,0xff,0x41,0x3f,0x06,0x04,0x42,0x0f,0x1f,0x3f,0x83,0xff,0x42,0xe7,
+0x83,0x83,0x83,0x03,0x43,0x07,0x07,0x0f,0x9f,0x82,0xff,0x43,0xfc,0xc0,0x01,0x3f,
+0x84,0xff,0x40,0xf8,0x1f,0x43,0x01,0x17,0xff,0xe0,0x84,0x80,0x82,0xc0,0x46,0xe0,
+0xe0,0xf0,0xf0,0x10,0x08,0xfc,0x88,0xff,0x44,0xfe,0xc0,0x00,0x0f,0x3f,0x89,0xff,
+0xc0,0x8d,0xff,0x82,0xfc,0x82,0xfe,0x4b,0x0c,0x60,0xf8,0xfc,0xfc,0xfe,0xfe,0xe7,
+0xc7,0x87,0x87,0x83,0x84,0x07,0x40,0x0f,0x86,0xff,0x01,0x40,0xf1,0x83,0xff,0x40,
+0x3f,0x19,0x42,0x78,0xc0,0x80,0x04,0x40,0x01,0x82,0x03,0x45,0x01,0x01,0x03,0x03,
+0x01,0xf8,0x84,0xff,0x42,0x3e,0x00,0x01,0x82,0x7f,0x49,0xff,0xe1,0x01,0x0f,0x1f,
+0x1f,0x8f,0xe0,0xe0,0xfc,0x89,0xff,0xc0,0x93,0xff,0x42,0xfc,0xf8,0xf9,0x82,0xf3,
+0x4b,0x73,0x13,0x83,0xc3,0xe7,0xff,0x7f,0x3f,0xbf,0x9f,0xff,0xdf,0x84,0xff,0x49,
+0x3f,0x03,0x80,0xc0,0xc7,0xe7,0xe7,0xe3,0xf1,0xfc,0x82,0xfe,0x4c,0xf8,0xf8,0xf0,
+0xe0,0xe0,0xe8,0xc8,0xd8,0x90,0xb0,0x30,0x30,0x70,0x82,0x60,0x41,0xc0,0xe0,0x85,
+0xc0,0x82,0xe3,0x42,0xf2,0xfe,0xfe,0x85,0xfc,0x40,0xe0,0x01,0x40,0xfc,0x85,0xff,
+0x4a,0xe0,0xc0,0x80,0x18,0x38,0xf0,0xf0,0xf8,0xfc,0xfe,0xfe,0x8e,0xff,0xc0,0x99,
+0xff,0x52,0xf1,0xe0,0xc7,0x9f,0x9f,0x0f,0x02,0x30,0x31,0x33,0x3f,0x3f,0x1f,0x9f,
+0xcf,0xc3,0xe0,0xf0,0xfd,0x86,0xff,0x51,0x7f,0x3f,0x3f,0x9f,0xdf,0x0f,0x07,0x07,
+0x03,0x03,0x07,0x87,0xe3,0xe7,0xc7,0xce,0xc6,0x80,0x03,0x82,0x01,0x41,0x03,0x87,
+0x8d,0xff,0x50,0xe0,0xc0,0x8f,0x1f,0x7f,0xff,0xff,0x7f,0x7f,0x63,0x47,0x0f,0x0f,
+0x0e,0x80,0xc1,0xe3,0x91,0xff,0xc0,0xb3,0xff,0x53,0xf0,0x80,0x0f,0x3f,0x3f,0x7f,
+0x73,0x73,0x71,0x60,0x00,0x0f,0x1f,0x1f,0x0f,0x47,0xe3,0xff,0xff,0xfe,0x02,0x41,
+0xfe,0xfe,0x93,0xff,0x42,0xfc,0xf8,0xf9,0x82,0xf8,0x82,0xfe,0x95,0xff,0xc0,
+// frame 9 keyframe
+0x01,0xff,0x9f,0xff,0x45,0x3f,0x1f,0x1f,0x8f,0xcf,0xcf,0x83,0x67,0x46,0xe7,0xe7,
+0xef,0xcf,0x0f,0x1f,0x3f,0x8c,0xff,0x42,0x7f,0x7f,0x3f,0x84,0x1f,0x53,0x3f,0x1f,
+0x4f,0xf3,0xfb,0xf9,0xfd,0xfc,0xfc,0xfd,0xfc,0xfd,0xfd,0xf9,0xd9,0xd9,0x91,0x03,
+0x7f,0x7f,0xa5,0xff,0xc0,0x94,0xff,0x44,0x0f,0x0f,0x1f,0x3f,0x7f,0x83,0xff,0x4a,
+0xf3,0xc0,0x1c,0x1e,0x7f,0x7b,0xf1,0xfc,0x7c,0xf8,0xf3,0x84,0xff,0x42,0x7f,0x00,
+0xc0,0x87,0xff,0x42,0x7f,0x1f,0x01,0x05,0x41,0x80,0x80,0x82,0xc0,0x42,0x80,0x06,
+0x7f,0x8b,0xff,0x44,0xfd,0xf2,0x30,0x00,0x0e,0x85,0xff,0x82,0x7f,0x85,0x3f,0x82,
+0x7f,0x92,0xff,0xc0,0x8d,0xff,0x42,0x7f,0x3f,0x3f,0x82,0x1f,0x41,0x0f,0x0e,0x03,
+0x41,0x80,0xc1,0x82,0xe1,0x84,0xe0,0x54,0xc0,0xc0,0xf0,0xf0,0xf8,0xfc,0xfc,0xfe,
+0x3e,0x7c,0xfc,0xfc,0xf8,0xf9,0xf1,0xe3,0xc7,0x07,0x3f,0xff,0x1f,0x08,0x41,0xff,
+0xff,0x83,0x7f,0x46,0x7e,0x7c,0x78,0x78,0x71,0x70,0x70,0x82,0xe4,0x52,0xe1,0xc1,
+0xc3,0xe7,0xe7,0xe3,0xf0,0xf8,0xf8,0xff,0x0f,0x07,0x11,0x1c,0x0c,0x0e,0x1e,0x3e,
+0x7e,0x83,0xff,0x82,0xfe,0x47,0xfc,0xf8,0xf1,0xe1,0x03,0x0f,0x1f,0x7f,0x8b,0xff,
+0xc0,0x8e,0xff,0x44,0xfe,0x7e,0x1e,0x0e,0x04,0x04,0x42,0x04,0x1f,0x7f,0x83,0xff,
+0x40,0x87,0x82,0x07,0x4c,0x0f,0x0f,0x07,0x0f,0x0f,0x1f,0x9f,0xff,0xff,0xfc,0xe0,
+0x03,0x3f,0x84,0xff,0x40,0xf8,0x0a,0x40,0x01,0x0d,0x46,0x01,0x01,0x07,0x0f,0x1f,
+0x3f,0x7f,0x84,0xff,0x40,0x78,0x07,0x4d,0x03,0xcf,0xff,0xff,0x7f,0x7f,0xff,0xe7,
+0xc7,0xcf,0x0f,0x0f,0xc0,0xc0,0x8b,0xff,0xc0,0x8e,0xff,0x50,0xfc,0xfc,0xfe,0xfe,
+0xff,0xff,0xfe,0xfe,0x3c,0x00,0xe0,0xf0,0xf8,0xf8,0xfc,0x9f,0x8f,0x82,0x07,0x40,
+0x06,0x83,0x0e,0x41,0x1e,0xbf,0x84,0xff,0x42,0x1c,0x00,0xc1,0x83,0xff,0x41,0x7f,
+0x0c,0x20,0x57,0x01,0x03,0x07,0x0c,0x18,0x00,0x40,0xc0,0x80,0x80,0xc0,0xe0,0xf0,
+0xe0,0xe1,0xc3,0x8f,0x9e,0x8c,0xc0,0xc0,0xfc,0xfc,0xfe,0x8e,0xff,0xc0,0x96,0xff,
+0x50,0xfe,0xf8,0xf1,0xe3,0xe7,0xe7,0x67,0x0f,0x8f,0xcf,0xef,0xfe,0x7e,0xbf,0xbe,
+0xbe,0xbf,0x85,0xff,0x4d,0x3f,0x00,0x80,0xc7,0xcf,0xcf,0xe7,0xe1,0xf0,0xf8,0xf0,
+0xc0,0xc0,0x80,0x03,0x82,0x80,0x00,0x40,0x80,0x0b,0x48,0x01,0x07,0x0e,0x18,0x70,
+0xc0,0xc0,0x00,0x80,0x05,0x48,0x01,0x03,0x03,0x07,0x0f,0x1f,0x1f,0x3f,0x7f,0x96,
+0xff,0xc0,0x9c,0xff,0x52,0xe0,0xc7,0x1f,0x3f,0x1f,0x08,0x60,0x77,0x77,0x7f,0x7f,
+0x3f,0x3f,0x1f,0xcf,0xe3,0xf0,0xfc,0xfe,0x89,0xff,0x83,0x7f,0x4a,0x7e,0x3e,0x7c,
+0x7c,0x71,0x70,0x61,0x01,0x03,0x03,0x02,0x82,0x06,0x42,0x0e,0x3e,0xfc,0x83,0xfe,
+0x4e,0x3e,0x3f,0xbf,0xbf,0xdf,0xdf,0xcf,0xcf,0xee,0xee,0xec,0x6c,0x60,0xe0,0xe0,
+0x83,0xf0,0x40,0xf8,0x82,0xfc,0x47,0xfe,0xfe,0xfc,0xfd,0xf9,0xf1,0x03,0x0f,0x8d,
+0xff,0xc0,0xa0,0xff,0x87,0xfe,0x89,0xff,0x4a,0xdf,0x03,0x61,0xf9,0xfc,0xfe,0x9e,
+0x9e,0x9f,0x07,0x1e,0x82,0xfe,0x40,0xf8,0x01,0x40,0x80,0x02,0x40,0xc0,0x82,0xe0,
+0x41,0xf0,0xfe,0x84,0xff,0x50,0xfc,0xfd,0xc5,0x81,0xb9,0x19,0x1d,0x9d,0xdc,0xce,
+0xce,0xee,0xe7,0xff,0x7f,0x3f,0x3f,0x83,0x1f,0x49,0x9f,0x8f,0xcf,0xcf,0xe7,0xe7,
+0xf3,0xf1,0xfc,0xfe,0x8d,0xff,0xc0,
+};
+
+const uint32_t monkey_offsets[] = {
+0, 524, 1064, 1558, 2043, 2565, 3083, 3624, 4176, 4719, 
+};
+
+const ssd1306_anim_t monkey = {
+	.width = 128,
+	.pages = 8,
+	.frames = 10,
+	.loop = false,
+	.offsets = monkey_offsets,
+	.data = monkey_data,
+};
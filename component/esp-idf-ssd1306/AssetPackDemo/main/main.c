@@ -0,0 +1,102 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+
+#include "ssd1306.h"
+#include "ssd1306_assets.h"
+
+/*
+ You have to set this config value with menuconfig
+ CONFIG_INTERFACE
+
+ for i2c
+ CONFIG_MODEL
+ CONFIG_SDA_GPIO
+ CONFIG_SCL_GPIO
+ CONFIG_RESET_GPIO
+
+ for SPI
+ CONFIG_CS_GPIO
+ CONFIG_DC_GPIO
+ CONFIG_RESET_GPIO
+*/
+
+#define TAG "SSD1306"
+
+void app_main(void)
+{
+	SSD1306_t dev;
+
+#if CONFIG_I2C_INTERFACE
+	ESP_LOGI(TAG, "INTERFACE is i2c");
+	ESP_LOGI(TAG, "CONFIG_SDA_GPIO=%d",CONFIG_SDA_GPIO);
+	ESP_LOGI(TAG, "CONFIG_SCL_GPIO=%d",CONFIG_SCL_GPIO);
+	ESP_LOGI(TAG, "CONFIG_RESET_GPIO=%d",CONFIG_RESET_GPIO);
+	i2c_master_init(&dev, CONFIG_SDA_GPIO, CONFIG_SCL_GPIO, CONFIG_RESET_GPIO);
+#endif // CONFIG_I2C_INTERFACE
+
+#if CONFIG_SPI_INTERFACE
+	ESP_LOGI(TAG, "INTERFACE is SPI");
+	ESP_LOGI(TAG, "CONFIG_MOSI_GPIO=%d",CONFIG_MOSI_GPIO);
+	ESP_LOGI(TAG, "CONFIG_SCLK_GPIO=%d",CONFIG_SCLK_GPIO);
+	ESP_LOGI(TAG, "CONFIG_CS_GPIO=%d",CONFIG_CS_GPIO);
+	ESP_LOGI(TAG, "CONFIG_DC_GPIO=%d",CONFIG_DC_GPIO);
+	ESP_LOGI(TAG, "CONFIG_RESET_GPIO=%d",CONFIG_RESET_GPIO);
+	spi_master_init(&dev, CONFIG_MOSI_GPIO, CONFIG_SCLK_GPIO, CONFIG_CS_GPIO, CONFIG_DC_GPIO, CONFIG_RESET_GPIO);
+#endif // CONFIG_SPI_INTERFACE
+
+#if 0
+#if CONFIG_FLIP
+	dev._flip = true;
+	ESP_LOGW(TAG, "Flip upside down");
+#endif
+#endif
+
+#if CONFIG_SSD1306_128x64
+	ESP_LOGI(TAG, "Panel is 128x64");
+	ssd1306_init(&dev, 128, 64);
+#endif // CONFIG_SSD1306_128x64
+#if CONFIG_SSD1306_128x32
+	ESP_LOGE(TAG, "Panel is 128x32. This demo cannot be run.");
+	while(1) { vTaskDelay(1); }
+#endif // CONFIG_SSD1306_128x32
+	ssd1306_contrast(&dev, 0xff);
+
+	// The pack is read in place from the flash. Nothing is copied to RAM.
+	ssd1306_assets_t assets;
+	if (ssd1306_assets_mount(&assets, "assets") == false) {
+		ESP_LOGE(TAG, "Asset partition not found. Flash it with idf.py flash");
+		while(1) { vTaskDelay(1); }
+	}
+	for (int i=0;i<assets.count;i++) {
+		ESP_LOGI(TAG, "%-15s format=%d %dx%d %"PRIu32" bytes", assets.index[i].name, assets.index[i].format,
+			assets.index[i].width, assets.index[i].height, assets.index[i].size);
+	}
+
+	ssd1306_clear_screen(&dev, false);
+	const char * names[] = {"cat_000", "cat_090", "cat_180", "cat_270"};
+	for (int i=0;i<4;i++) {
+		ssd1306_image_t image;
+		if (ssd1306_assets_image(&assets, names[i], &image) == false) continue;
+		ssd1306_image_draw(&dev, &image, 0, (i % 2) * 64);
+		ssd1306_flush(&dev);
+		vTaskDelay(100);
+	}
+
+	ssd1306_anim_t anim;
+	if (ssd1306_assets_anim(&assets, "cat_spin", &anim) == false) {
+		while(1) { vTaskDelay(1); }
+	}
+	ssd1306_clear_screen(&dev, false);
+	ssd1306_anim_player_t player;
+	ssd1306_anim_init(&player, &anim, 0, 32);
+	while (1) {
+		ssd1306_anim_next(&dev, &player);
+		ssd1306_flush(&dev);
+		vTaskDelay(10);
+	}
+}
@@ -79,12 +79,32 @@
 #include <limits.h>
 #include <errno.h>
 
+#include "../tools/page_rle.h"
+
 #define VERSION "4"			///< version of this application
+#define SUBSET_SIZE 0x110000		///< number of unicode code points
+#define GLYPH_RLE 0x02			///< same as SSD1306_IMAGE_RLE
+#define GLYPH_HASH 4096			///< hash buckets to find duplicate glyphs
 
 //////////////////////////////////////////////////////////////////////////////
 
 int Outline;				///< true generate outlined font
 int SmartMatrix;			// modify output to be used in the SmartMatrix library
+int Rle;				///< true run-length code page-major glyphs
+unsigned char *Subset;			///< encodings to convert, NULL for all
+
+///
+///	Page-major glyph already written, to share identical glyphs.
+///
+struct glyph {
+	struct glyph *next;		///< next glyph with the same hash
+	unsigned hash;			///< hash of the record
+	unsigned offset;		///< offset of the record in the font
+	int size;			///< size of the record
+	unsigned char *record;		///< metrics and data
+};
+
+struct glyph *GlyphHash[GLYPH_HASH];	///< written glyphs by hash
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -171,6 +191,32 @@ void Header(FILE * out, const char *name, int fontboundingbox_width, int fontbou
 	"%d,\n", fontboundingbox_height);
 }
 
+///
+///	Print header of page-major font for c file.
+///
+///	@param out	file stream for output
+///	@param name	font variable name in C source file
+///
+void PageHeader(FILE * out, const char *name, int fontboundingbox_width, int fontboundingbox_height)
+{
+	fprintf(out,
+	"// Created from bdf2c Version %s, (c) 2009, 2010 by Lutz Sammer\n"
+	"//\tLicense AGPLv3: GNU Affero General Public License version 3\n"
+	,VERSION);
+
+	fprintf(out,
+	"// page-major glyphs for each encoding\n"
+	"const unsigned char __%s_pages__[] = {\n", name);
+
+	fprintf(out,
+	"// fontboundingbox_width\n"
+	"%d,\n", fontboundingbox_width);
+
+	fprintf(out,
+	"// fontboundingbox_height\n"
+	"%d,\n", fontboundingbox_height);
+}
+
 ///
 ///	Print width table for c file
 ///
@@ -213,6 +259,91 @@ void EncodingTable(FILE * out, const char *name,
 	}
 }
 
+///
+///	Compare two index entries by encoding.
+///
+static int CompareEncoding(const void *a, const void *b)
+{
+	const unsigned *x = a;
+	const unsigned *y = b;
+
+	return (x[0] > y[0]) - (x[0] < y[0]);
+}
+
+///
+///	Print glyph index for c file.
+///
+///	Dense encodings get a direct table, so a glyph is found with one
+///	array access. Sparse encodings get a table sorted by encoding for
+///	binary search.
+///
+///	@param out		file stream for output
+///	@param name		font variable name in C source file
+///	@param encoding_table	encoding table read from BDF file
+///	@param offset_table	offset of each character in the bitmap
+///	@param chars		number of characters in the tables
+///
+void IndexTable(FILE * out, const char *name,
+	const unsigned *encoding_table, const unsigned *offset_table, int chars)
+{
+	unsigned *pairs;
+	unsigned first;
+	unsigned last;
+	int i;
+	int n;
+
+	pairs = malloc(chars * 2 * sizeof(*pairs));
+	if (!pairs) {
+	fprintf(stderr, "Out of memory\n");
+	exit(-1);
+	}
+	for (i = 0; i < chars; ++i) {
+	pairs[i * 2] = encoding_table[i];
+	pairs[i * 2 + 1] = offset_table[i];
+	}
+	qsort(pairs, chars, 2 * sizeof(*pairs), CompareEncoding);
+	// The first glyph of the same encoding is used
+	n = 0;
+	for (i = 0; i < chars; ++i) {
+	if (n && pairs[(n - 1) * 2] == pairs[i * 2]) continue;
+	pairs[n * 2] = pairs[i * 2];
+	pairs[n * 2 + 1] = pairs[i * 2 + 1];
+	++n;
+	}
+	first = n ? pairs[0] : 0;
+	last = n ? pairs[(n - 1) * 2] : 0;
+
+	fprintf(out, "\n");
+	fprintf(out,
+	"// glyph index for each encoding\n"
+	"const unsigned int __%s_index__[] = {\n", name);
+	if (n && last - first + 1 <= (unsigned)n * 2) {
+	// Direct table. The offset is 0 when there is no glyph.
+	unsigned count = last - first + 1;
+	fprintf(out, "// direct, first encoding, number of encodings\n");
+	fprintf(out, "0,%u,%u,\n", first, count);
+	for (i = 0; i < n; ++i) {
+		while (first < pairs[i * 2]) {
+		fprintf(out, "0,");
+		if (++first % 16 == 0) fprintf(out, "\n");
+		}
+		fprintf(out, "%u,", pairs[i * 2 + 1]);
+		if (++first % 16 == 0) fprintf(out, "\n");
+	}
+	if (first % 16) fprintf(out, "\n");
+	} else {
+	// Sorted table of encoding and offset
+	fprintf(out, "// sorted, 0, number of glyphs\n");
+	fprintf(out, "1,0,%d,\n", n);
+	for (i = 0; i < n; ++i) {
+		fprintf(out, "%u,%u,", pairs[i * 2], pairs[i * 2 + 1]);
+		if (i % 8 == 7 || i == n - 1) fprintf(out, "\n");
+	}
+	}
+	fprintf(out, "};\n");
+	free(pairs);
+}
+
 ///
 ///	Print footer for c file.
 ///
@@ -244,8 +375,9 @@ void Footer(FILE * out, const char *name, int width, int height, int chars)
 ///
 ///	Dump character.
 ///
+///	@returns number of bytes of the bitmap
 ///
-void DumpCharacter(FILE * out, unsigned char *bitmap, int fontwidth, int fontheight, int fontyoffset, int charheight, int charyoffset, int flag)
+int DumpCharacter(FILE * out, unsigned char *bitmap, int fontwidth, int fontheight, int fontyoffset, int charheight, int charyoffset, int flag)
 {
 	int x;
 	int y;
@@ -332,6 +464,7 @@ void DumpCharacter(FILE * out, unsigned char *bitmap, int fontwidth, int fonthei
 #endif
 	} // end y
 	fprintf(out, "\n");
+	return num_data;
 	} // end flag
 
 	if (flag == 2) {
@@ -391,6 +524,242 @@ void DumpCharacter(FILE * out, unsigned char *bitmap, int fontwidth, int fonthei
 	} // end y
 	} // end flag
 
+	return 0;
+}
+
+///
+///	Write character in the SSD1306 page layout.
+///
+///	The glyph box is written once for each of the 8 vertical alignments.
+///	Alignment a puts the top row of the box at bit (y + a) % 8 of page
+///	(y + a) / 8. Each alignment has the pages down to the bottom row of
+///	the box, and each page has one byte for each column, bit0 at the top.
+///	With -r each page is run-length coded when it makes the glyph smaller.
+///	A glyph identical to one already written isn't written again.
+///
+///	@param out	file stream for output
+///	@param charname	character name for the comment
+///	@param offset	offset of the next glyph in the font, updated
+///	@param bitmap	character bitmap, one row after another
+///	@param stride	bytes of each row in bitmap
+///	@param advance	advance of the character
+///	@param x	left column of the glyph box in the font bounding box
+///	@param width	width of the glyph box
+///	@param y	top row of the glyph box in the font bounding box
+///	@param height	height of the glyph box
+///
+///	@returns offset of the glyph in the font
+///
+unsigned WritePageGlyph(FILE * out, const char *charname, unsigned *offset,
+	const unsigned char *bitmap, int stride, int advance, int x, int width,
+	int y, int height)
+{
+	buffer_t raw = { 0 };
+	buffer_t packed = { 0 };
+	buffer_t record = { 0 };
+	buffer_t *data;
+	int ends[2][8];
+	int *end;
+	unsigned char row[256];
+	unsigned char flags;
+	unsigned hash;
+	struct glyph *glyph;
+	int a;
+	int i;
+	int c;
+	int page;
+	int line;
+
+	for (a = 0; a < 8 && width > 0 && height > 0; ++a) {
+	for (page = (y + a) / 8; page <= (y + a + height - 1) / 8; ++page) {
+		memset(row, 0, width);
+		for (i = 0; i < height; ++i) {
+			if ((y + a + i) / 8 != page) continue;
+			for (c = 0; c < width; ++c) {
+				if (bitmap[i * stride + c / 8] & (0x80 >> c % 8)) {
+				row[c] |= 1 << ((y + a + i) % 8);
+				}
+			}
+		}
+		for (c = 0; c < width; ++c) {
+			buffer_put(&raw, row[c]);
+		}
+		rle_encode_page(&packed, row, width);
+	}
+	ends[0][a] = raw.size;
+	ends[1][a] = packed.size;
+	}
+
+	// The runtime decodes a page into a row of the panel width
+	flags = 0;
+	data = &raw;
+	end = ends[0];
+	if (Rle && width <= 128 && packed.size < raw.size) {
+	flags = GLYPH_RLE;
+	data = &packed;
+	end = ends[1];
+	}
+
+	// advance, x, width, y, height, flags and data of 8 alignments
+	buffer_put(&record, advance);
+	buffer_put(&record, x);
+	buffer_put(&record, width);
+	buffer_put(&record, y);
+	buffer_put(&record, height);
+	buffer_put(&record, flags);
+	for (i = 0; i < data->size; ++i) {
+	buffer_put(&record, data->data[i]);
+	}
+	free(raw.data);
+	free(packed.data);
+
+	// FNV-1a
+	hash = 2166136261u;
+	for (i = 0; i < record.size; ++i) {
+	hash = (hash ^ record.data[i]) * 16777619u;
+	}
+	for (glyph = GlyphHash[hash % GLYPH_HASH]; glyph; glyph = glyph->next) {
+	if (glyph->hash == hash && glyph->size == record.size
+		&& !memcmp(glyph->record, record.data, record.size)) {
+		fprintf(out, "// '%s' same as %u\n", charname, glyph->offset);
+		free(record.data);
+		return glyph->offset;
+	}
+	}
+	glyph = malloc(sizeof(*glyph));
+	if (!glyph) {
+	fprintf(stderr, "Out of memory\n");
+	exit(-1);
+	}
+	glyph->hash = hash;
+	glyph->offset = *offset;
+	glyph->size = record.size;
+	glyph->record = record.data;
+	glyph->next = GlyphHash[hash % GLYPH_HASH];
+	GlyphHash[hash % GLYPH_HASH] = glyph;
+
+	fprintf(out, "// '%s'\n", charname);
+	fprintf(out, "%d,%d,%d,%d,%d,%d,\n", advance, x, width, y, height, flags);
+	// One line for each alignment
+	line = 0;
+	for (i = 6; i < record.size; ++i) {
+	fprintf(out, "0x%02x,", record.data[i]);
+	if (i - 6 + 1 == end[line]) {
+		fprintf(out, "\n");
+		++line;
+	}
+	}
+	*offset += record.size;
+	return glyph->offset;
+}
+
+///
+///	Add encodings to the subset.
+///
+///	@param first	first encoding
+///	@param last	last encoding
+///
+void SubsetAdd(unsigned first, unsigned last)
+{
+	if (!Subset) {
+	Subset = calloc(SUBSET_SIZE / 8, 1);
+	if (!Subset) {
+		fprintf(stderr, "Out of memory\n");
+		exit(-1);
+	}
+	}
+	for (; first <= last && first < SUBSET_SIZE; ++first) {
+	Subset[first / 8] |= 1 << (first % 8);
+	}
+}
+
+///
+///	Parse encoding list like 32-126,0x3000-0x30ff,0x4e00.
+///
+///	@param list	comma separated encodings and ranges
+///
+void SubsetList(const char *list)
+{
+	char *p;
+	unsigned first;
+	unsigned last;
+
+	while (*list) {
+	first = strtoul(list, &p, 0);
+	last = first;
+	if (p == list) {
+		fprintf(stderr, "Bad encoding list '%s'\n", list);
+		exit(-1);
+	}
+	if (*p == '-') {
+		list = p + 1;
+		last = strtoul(list, &p, 0);
+		if (p == list) {
+		fprintf(stderr, "Bad encoding list '%s'\n", list);
+		exit(-1);
+		}
+	}
+	SubsetAdd(first, last);
+	list = p;
+	if (*list == ',') ++list;
+	}
+}
+
+///
+///	Add the characters in the string literals of a source file.
+///
+///	The strings are UTF-8. Escape sequences are skipped.
+///
+///	@param path	source file
+///
+void SubsetSource(const char *path)
+{
+	FILE *in;
+	int c;
+	int quoted;
+	unsigned code;
+	int more;
+
+	if (!(in = fopen(path, "r"))) {
+	fprintf(stderr, "Can't open file '%s': %s\n", path, strerror(errno));
+	exit(-1);
+	}
+	quoted = 0;
+	more = 0;
+	code = 0;
+	while ((c = fgetc(in)) != EOF) {
+	if (!quoted) {
+		if (c == '"') quoted = 1;
+		// Skip character literal like '"'
+		if (c == '\'') {
+		while ((c = fgetc(in)) != EOF && c != '\'' && c != '\n') {
+			if (c == '\\') fgetc(in);
+		}
+		}
+		continue;
+	}
+	if (c == '"' || c == '\n') {
+		quoted = 0;
+	} else if (c == '\\') {
+		fgetc(in);
+	} else if (more && (c & 0xC0) == 0x80) {
+		code = code << 6 | (c & 0x3F);
+		if (--more == 0) SubsetAdd(code, code);
+	} else if (c < 0x80) {
+		more = 0;
+		if (c >= ' ') SubsetAdd(c, c);
+	} else if ((c & 0xE0) == 0xC0) {
+		code = c & 0x1F;
+		more = 1;
+	} else if ((c & 0xF0) == 0xE0) {
+		code = c & 0x0F;
+		more = 2;
+	} else if ((c & 0xF8) == 0xF0) {
+		code = c & 0x07;
+		more = 3;
+	}
+	}
+	fclose(in);
 }
 
 ///
@@ -525,7 +894,8 @@ void dump(char * text, unsigned char *dt, int n)
 ///
 void ReadBdf(FILE * bdf, FILE * out, const char *name, int flag)
 {
-	char linebuf[1024];
+	char *linebuf;
+	size_t linesize;
 	char *s;
 	char *p;
 	int fontboundingbox_width;
@@ -546,8 +916,13 @@ void ReadBdf(FILE * bdf, FILE * out, const char *name, int flag)
 	int width;
 	int _bbx;
 	int _width;
+	int advance = 0;
+	int glyph_y = 0;
+	int selected;
 	unsigned *width_table;
 	unsigned *encoding_table;
+	unsigned *offset_table;
+	unsigned offset;
 	unsigned char *bitmap;
 
 	fontboundingbox_width = 0;
@@ -555,13 +930,15 @@ void ReadBdf(FILE * bdf, FILE * out, const char *name, int flag)
 	fontboundingbox_xoff = 0;
 	fontboundingbox_yoff = 0;
 	chars = 0;
+	linebuf = NULL;
+	linesize = 0;
 
 	for (;;) {
-		if (!fgets(linebuf, sizeof(linebuf), bdf)) {	// EOF
+		if (getline(&linebuf, &linesize, bdf) < 0) {	// EOF
 			break;
 		}
 		if (!(s = strtok(linebuf, " \t\n\r"))) {	// empty line
-			break;
+			continue;
 		}
 		// printf("token:%s\n", s);
 		if (!strcasecmp(s, "FONTBOUNDINGBOX")) {
@@ -602,6 +979,10 @@ void ReadBdf(FILE * bdf, FILE * out, const char *name, int flag)
 	fprintf(stderr, "Need to know the number of characters\n");
 	exit(-1);
 	}
+	if (Outline && flag == 3) {
+	fprintf(stderr, "Outline isn't supported for page-major glyphs\n");
+	exit(-1);
+	}
 	if (Outline) {			// Reserve space for outline border
 	fontboundingbox_width++;
 	fontboundingbox_height++;
@@ -619,13 +1000,12 @@ void ReadBdf(FILE * bdf, FILE * out, const char *name, int flag)
 	fprintf(stderr, "Out of memory\n");
 	exit(-1);
 	}
-	/*	FIXME: needed for proportional fonts.
-	   offset_table = malloc(chars * sizeof(*offset_table));
-	   if (!offset_table) {
-	   fprintf(stderr, "Out of memory\n");
-	   exit(-1);
-	   }
-	 */
+	// Offset of each character in the bitmap for the glyph index
+	offset_table = malloc(chars * sizeof(*offset_table));
+	if (!offset_table) {
+	fprintf(stderr, "Out of memory\n");
+	exit(-1);
+	}
 	size_t bitmap_size = ((fontboundingbox_width + 7) / 8) * fontboundingbox_height;
 	bitmap = malloc(bitmap_size);
 	//malloc(((fontboundingbox_width + 7) / 8) * fontboundingbox_height);
@@ -635,6 +1015,8 @@ void ReadBdf(FILE * bdf, FILE * out, const char *name, int flag)
 	}
 
 	if (flag == 1) Header(out, name, fontboundingbox_width, fontboundingbox_height);
+	if (flag == 3) PageHeader(out, name, fontboundingbox_width, fontboundingbox_height);
+	offset = 2;			// fontboundingbox_width and fontboundingbox_height
 
 	scanline = -1;
 	n = 0;
@@ -644,18 +1026,19 @@ void ReadBdf(FILE * bdf, FILE * out, const char *name, int flag)
 	bbw = 0;
 	bbh = 0;
 	width = INT_MIN;
+	selected = 0;
 	strcpy(charname, "unknown character");
 	for (;;) {
-	if (!fgets(linebuf, sizeof(linebuf), bdf)) {	// EOF
+	if (getline(&linebuf, &linesize, bdf) < 0) {	// EOF
 		break;
 	}
 	if (!(s = strtok(linebuf, " \t\n\r"))) {	// empty line
-		break;
+		continue;
 	}
 	// printf("token:%s\n", s);
 	if (!strcasecmp(s, "STARTCHAR")) {
 		p = strtok(NULL, " \t\n\r");
-		strcpy(charname, p);
+		snprintf(charname, sizeof(charname), "%s", p ? p : "unknown character");
 	} else if (!strcasecmp(s, "ENCODING")) {
 		p = strtok(NULL, " \t\n\r");
 		encoding = atoi(p);
@@ -672,7 +1055,10 @@ void ReadBdf(FILE * bdf, FILE * out, const char *name, int flag)
 		p = strtok(NULL, " \t\n\r");
 		bby = atoi(p);
 	} else if (!strcasecmp(s, "BITMAP")) {
-		if (encoding >= 0 && encoding < 256) {
+		// Page-major glyphs have no encoding in the record, so unicode is fine
+		selected = encoding >= 0 && (encoding < 256 || flag == 3)
+			&& (!Subset || (encoding < SUBSET_SIZE && Subset[encoding / 8] & (1 << encoding % 8)));
+		if (selected) {
 		_width = width - fontboundingbox_xoff;
 #if 0
 		fprintf(out, "// %3d $%02x '%s'\n", encoding, encoding, charname);
@@ -687,6 +1073,8 @@ void ReadBdf(FILE * bdf, FILE * out, const char *name, int flag)
 			fprintf(stderr, "character width not specified\n");
 		exit(-1);
 		}
+		// DWIDTH is the advance of the page-major glyph
+		advance = width;
 		//
 		//	Adjust width based on bounding box
 		//
@@ -712,6 +1100,15 @@ void ReadBdf(FILE * bdf, FILE * out, const char *name, int flag)
 		if (flag == 1) {
 			fprintf(out, "// '%s'\n", charname);
 			fprintf(out, "%3d,%d,%d,%d,%d,%d,", encoding, _width, bbw, bbh, bbx, bby);
+		} else if (flag == 3) {
+			// The glyph box from the upper left corner of the font bounding box
+			glyph_y = fontboundingbox_height + fontboundingbox_yoff - bby - bbh;
+			if (bbx - fontboundingbox_xoff < 0 || glyph_y < 0 || advance < 0 || advance > 255
+				|| bbx - fontboundingbox_xoff > 255 || glyph_y > 255 || bbw > 255 || bbh > 255
+				|| bbw > fontboundingbox_width || bbh > fontboundingbox_height) {
+				fprintf(stderr, "'%s' is outside of the font bounding box\n", charname);
+				exit(-1);
+			}
 		} else {
 			fprintf(out, "// width=%d fontboundingbox_xoff=%d\n", width, fontboundingbox_xoff);
 			fprintf(out, "// bbx=%d _bbx=%d\n", bbx, _bbx);
@@ -721,6 +1118,7 @@ void ReadBdf(FILE * bdf, FILE * out, const char *name, int flag)
 
 		width_table[n] = width;
 		encoding_table[n] = encoding;
+		offset_table[n] = offset;
 		++n;
 		if (Outline) {		// Leave first row empty
 		scanline = 1;
@@ -730,7 +1128,12 @@ void ReadBdf(FILE * bdf, FILE * out, const char *name, int flag)
 		memset(bitmap, 0, bitmap_size);
 		}
 	} else if (!strcasecmp(s, "ENDCHAR")) {
-		if (encoding >= 0 && encoding < 256) {
+		if (selected && flag == 3) {
+		// The same glyph is shared
+		offset_table[n - 1] = WritePageGlyph(out, charname, &offset, bitmap,
+			(fontboundingbox_width + 7) / 8, advance, bbx - fontboundingbox_xoff,
+			bbw, glyph_y, bbh);
+		} else if (selected) {
 		if (_bbx) {
 			//dump("Befor RotateBitmap", bitmap, bitmap_size);
 			RotateBitmap(bitmap, _bbx, fontboundingbox_width,
@@ -743,21 +1146,26 @@ void ReadBdf(FILE * bdf, FILE * out, const char *name, int flag)
 			OutlineCharacter(bitmap, fontboundingbox_width,
 				fontboundingbox_height);
 		}
-		DumpCharacter(out, bitmap, fontboundingbox_width,
+		// encoding, width, bbw, bbh, bbx, bby, num_data, y_start, y_end and data
+		offset += 9 + DumpCharacter(out, bitmap, fontboundingbox_width,
 		fontboundingbox_height, fontboundingbox_yoff, bbh, bby, flag);
 		}
 		scanline = -1;
 		width = INT_MIN;
+		selected = 0;
 	} else if (!strcasecmp(s, "ENDFONT")) {
 		if (flag == 1) {
 			Last(out);
 			fprintf(out, "};\n");
 		}
+		if (flag == 3) {
+			fprintf(out, "};\n");
+		}
 	} else {
-		if (scanline >= 0) {
+		if (scanline >= 0 && scanline < fontboundingbox_height) {
 		p = s;
 		j = 0;
-		while (*p) {
+		while (*p && j < (fontboundingbox_width + 7) / 8) {
 			i = Hex2Int(p);
 			++p;
 			if (*p) {
@@ -784,8 +1192,10 @@ void ReadBdf(FILE * bdf, FILE * out, const char *name, int flag)
 	if(!SmartMatrix)
 		WidthTable(out, name, width_table, chars);
 #endif
-	// FIXME: Output offset table for proportional font.
-	// OffsetTable(out, name, offset_table, chars);
+	free(linebuf);
+	// Output glyph index for constant time lookup
+	if (flag == 1 || flag == 3)
+		IndexTable(out, name, encoding_table, offset_table, n);
 	// Output encoding table for utf-8 support
 #if 0
 	EncodingTable(out, name, encoding_table, chars);
@@ -813,6 +1223,10 @@ void PrintUsage(void)
 	printf("Usage: bdf2c [OPTIONs]\n"
 	"\t-h or -?\tPrints this short page on stdout\n"
 	"\t-b\tRead bdf file from stdin, write to stdout\n"
+	"\t-p\tRead bdf file from stdin, write page-major glyphs to stdout\n"
+	"\t-r\tRun-length code page-major glyphs (place it before -p)\n"
+	"\t-u list\tConvert only these encodings, like 32-126,0x3000 (place it before -b)\n"
+	"\t-S file\tConvert only the characters in the strings of this source (place it before -b)\n"
 	"\t-c\tCreate font header on stdout\n"
 	"\t-C file\tCreate font header file\n"
 	"\t-n name\tName of c font variable (place it before -b)\n"
@@ -836,13 +1250,16 @@ int main(int argc, char *const argv[])
 	//	Parse arguments.
 	//
 	for (;;) {
-	switch (getopt(argc, argv, "bBcC:n:hOs?-")) {
+	switch (getopt(argc, argv, "bBcC:n:hOprsu:S:?-")) {
 		case 'b':			// bdf file name
 		ReadBdf(stdin, stdout, name, 1);
 		continue;
 		case 'B':			// bdf file name
 		ReadBdf(stdin, stdout, name, 2);
 		continue;
+		case 'p':			// bdf file name
+		ReadBdf(stdin, stdout, name, 3);
+		continue;
 		case 'c':			// create header file
 		CreateFontHeaderFile(stdout);
 		break;
@@ -868,6 +1285,15 @@ int main(int argc, char *const argv[])
 		case 's':
 		SmartMatrix = 1;
 		continue;
+		case 'r':
+		Rle = 1;
+		continue;
+		case 'u':			// encodings to convert
+		SubsetList(optarg);
+		continue;
+		case 'S':			// source file of strings to convert
+		SubsetSource(optarg);
+		continue;
 
 		case EOF:
 		break;
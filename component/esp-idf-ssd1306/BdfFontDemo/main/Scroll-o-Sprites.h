@@ -479,3 +479,25 @@ unsigned char __Scroll_o_Sprites_bitmap__[] = {
 // EOF
 0,0,0,0,0,0,0,0,0
 };
+
+// glyph index for each encoding
+const unsigned int __Scroll_o_Sprites_index__[] = {
+// direct, first encoding, number of encodings
+0,1,242,
+2,43,84,125,166,207,248,289,0,0,0,0,0,0,0,
+330,371,412,453,494,535,576,617,658,699,740,781,822,863,904,945,
+986,1027,1068,1109,1150,1191,1232,1273,1314,1355,1396,1437,1478,1519,1560,1601,
+1642,1683,1724,1765,1806,1847,1888,1929,1970,2011,2052,2093,2134,2175,2216,2257,
+2298,2339,2380,2421,2462,2503,2544,2585,2626,2667,2708,2749,2790,2831,2872,2913,
+2954,2995,3036,3077,3118,3159,3200,3241,3282,3323,3364,3405,3446,3487,3528,3569,
+3610,3651,3692,3733,3774,3815,3856,3897,3938,3979,4020,4061,4102,4143,4184,4225,
+4266,4307,4348,4389,4430,4471,4512,4553,4594,4635,4676,4717,4758,4799,4840,4881,
+4922,4963,5004,5045,5086,5127,5168,5209,5250,5291,5332,5373,5414,5455,5496,5537,
+5578,5619,5660,5701,5742,5783,5824,5865,5906,5947,5988,6029,6070,6111,6152,6193,
+6234,6275,6316,6357,6398,6439,6480,6521,6562,6603,6644,6685,6726,6767,6808,6849,
+6890,6931,6972,7013,7054,7095,7136,7177,7218,7259,7300,7341,7382,7423,7464,7505,
+7546,7587,7628,7669,7710,7751,7792,7833,7874,7915,7956,7997,8038,8079,8120,8161,
+8202,8243,8284,8325,8366,8407,8448,8489,8530,8571,8612,8653,8694,8735,8776,8817,
+8858,8899,8940,8981,9022,9063,9104,9145,9186,9227,9268,9309,9350,9391,9432,9473,
+9514,9555,9596,
+};
@@ -25,3 +25,10 @@ unsigned char __battery_bitmap__[] = {
 // EOF
 0,0,0,0,0,0,0,0,0
 };
+
+// glyph index for each encoding
+const unsigned int __battery_index__[] = {
+// direct, first encoding, number of encodings
+0,48,8,
+2,47,92,137,182,227,272,317,
+};
@@ -73,3 +73,11 @@ unsigned char __emoticons_bitmap__[] = {
 // EOF
 0,0,0,0,0,0,0,0,0
 };
+
+// glyph index for each encoding
+const unsigned int __emoticons_index__[] = {
+// direct, first encoding, number of encodings
+0,32,32,
+2,74,146,218,290,362,434,506,578,650,722,734,746,758,770,782,
+794,866,938,1010,1082,1154,1226,1298,1370,1382,1394,1406,1418,1430,1442,1454,
+};
@@ -7,6 +7,7 @@
 #include "esp_log.h"
 
 #include "ssd1306.h"
+#include "ssd1306_image.h"
 #include "ncenR12.h"
 #include "timR12.h"
 #include "emoticons.h"
@@ -42,35 +43,54 @@ typedef struct {
 	unsigned char y_end;
 } BDF_FONT_t;
 
-esp_err_t load_bitmap_font(unsigned char *font, int encoding, unsigned char *bitmap, BDF_FONT_t *bdf_font)
+// Glyph index made by bdf2c
+#define BDF_INDEX_DIRECT 0 // first encoding, number of encodings, offset of each encoding
+#define BDF_INDEX_SORTED 1 // 0, number of glyphs, pairs of encoding and offset
+
+// Returns the offset of the encoding in the font, or 0 when there is no glyph.
+int find_bitmap_font(const unsigned int *font_index, int encoding)
 {
-	ESP_LOGI(tag, "encoding=%d", encoding);
-	int index = 2;
-	while (1) {
-		ESP_LOGD(tag, "font[%d]=%d size=%d", index, font[index], font[index+6]);
-		if (font[index+6] == 0) break;
-		if (font[index] == encoding) {
-			bdf_font->encoding = font[index];
-			bdf_font->width = font[index+1];
-			bdf_font->bbw = font[index+2];
-			bdf_font->bbh = font[index+3];
-			bdf_font->bbx = font[index+4];
-			bdf_font->bby = font[index+5];
-			bdf_font->num_data = font[index+6];
-			bdf_font->y_start = font[index+7];
-			bdf_font->y_end = font[index+8];
-			for (int i=0;i<font[index+6];i++) {
-				ESP_LOGD(tag, "font[%d]=0x%x", index+9+i, font[index+9+i]);
-				bitmap[i] = font[index+9+i];
-			}
-			return ESP_OK;
+	int first = font_index[1];
+	int count = font_index[2];
+	const unsigned int *table = &font_index[3];
+	if (font_index[0] == BDF_INDEX_DIRECT) {
+		if (encoding < first || encoding >= first + count) return 0;
+		return table[encoding - first];
+	}
+	int low = 0;
+	int high = count - 1;
+	while (low <= high) {
+		int mid = (low + high) / 2;
+		if (table[mid*2] == encoding) return table[mid*2+1];
+		if (table[mid*2] > encoding) {
+			high = mid - 1;
+		} else {
+			low = mid + 1;
 		}
-		index = index + font[index+6] + 9;;
-	} // end while
-	return ESP_ERR_NOT_FOUND;
+	}
+	return 0;
+}
+
+esp_err_t load_bitmap_font(unsigned char *font, const unsigned int *font_index, int encoding, unsigned char *bitmap, BDF_FONT_t *bdf_font)
+{
+	ESP_LOGD(tag, "encoding=%d", encoding);
+	int index = find_bitmap_font(font_index, encoding);
+	if (index == 0) return ESP_ERR_NOT_FOUND;
+	ESP_LOGD(tag, "font[%d]=%d size=%d", index, font[index], font[index+6]);
+	bdf_font->encoding = font[index];
+	bdf_font->width = font[index+1];
+	bdf_font->bbw = font[index+2];
+	bdf_font->bbh = font[index+3];
+	bdf_font->bbx = font[index+4];
+	bdf_font->bby = font[index+5];
+	bdf_font->num_data = font[index+6];
+	bdf_font->y_start = font[index+7];
+	bdf_font->y_end = font[index+8];
+	memcpy(bitmap, &font[index+9], font[index+6]);
+	return ESP_OK;
 }
 
-esp_err_t show_bdf_font_text(SSD1306_t * dev, unsigned char *font, char *text, int xpos, int ypos)
+esp_err_t show_bdf_font_text(SSD1306_t * dev, unsigned char *font, const unsigned int *font_index, char *text, int xpos, int ypos)
 {
 	int fontboundingbox_width = font[0];
 	int fontboundingbox_height = font[1];
@@ -86,8 +106,8 @@ esp_err_t show_bdf_font_text(SSD1306_t * dev, unsigned char *font, char *text, i
 	int _xpos = xpos;
 	for (int i=0;i<strlen(text);i++) {
 		memset(bitmap, 0, bitmap_size);
-		int ch = text[i];
-		esp_err_t err = load_bitmap_font(font, ch, bitmap, &bdf_font);
+		int ch = (unsigned char)text[i];
+		esp_err_t err = load_bitmap_font(font, font_index, ch, bitmap, &bdf_font);
 		if (err != ESP_OK) {
 			ESP_LOGE(tag, "font not found [%d]", ch);
 			continue;
@@ -107,7 +127,135 @@ esp_err_t show_bdf_font_text(SSD1306_t * dev, unsigned char *font, char *text, i
 	return ESP_OK;
 }
 
-esp_err_t show_bdf_font_code(SSD1306_t * dev, unsigned char *font, int code, int xpos, int ypos)
+// Page-major glyph made by bdf2c -p.
+// advance, x, width, y, height, flags, then the columns of the glyph box for 8 vertical alignments.
+// With SSD1306_IMAGE_RLE in flags, every page is run-length coded (bdf2c -r).
+#define PAGE_FONT_HEADER 6
+
+// Number of pages of the glyph box when its top row is at bit (y + align) % 8
+int page_font_pages(int y, int height, int align)
+{
+	return ((y + align + height - 1) >> 3) - ((y + align) >> 3) + 1;
+}
+
+// Skip one run-length coded page
+const unsigned char * page_font_skip(const unsigned char *src)
+{
+	while (1) {
+		unsigned char run = *src++;
+		unsigned char type = run & 0xC0;
+		if (type == SSD1306_RLE_END) return src;
+		if (type == SSD1306_RLE_LITERAL) src = src + (run & 0x3F) + 1;
+		if (type == SSD1306_RLE_REPEAT) src++;
+	}
+}
+
+// OR the glyph at font[index] into the internal buffer, and return the advance.
+// There is no bit operation, the columns of the alignment of ypos are just copied.
+int draw_page_font(SSD1306_t * dev, const unsigned char *font, int index, int xpos, int ypos)
+{
+	int advance = font[index];
+	int x = font[index+1];
+	int width = font[index+2];
+	int y = font[index+3];
+	int height = font[index+4];
+	bool rle = (font[index+5] & SSD1306_IMAGE_RLE) != 0;
+	if (width == 0 || height == 0) return advance;
+
+	// Skip the alignments before this one
+	int align = ypos & 7;
+	const unsigned char *data = &font[index+PAGE_FONT_HEADER];
+	for (int _align=0;_align<align;_align++) {
+		if (rle) {
+			for (int _page=0;_page<page_font_pages(y, height, _align);_page++) data = page_font_skip(data);
+		} else {
+			data = data + width * page_font_pages(y, height, _align);
+		}
+	}
+
+	int seg = xpos + x;
+	int start = 0;
+	int end = width;
+	if (seg < 0) start = -seg;
+	if (seg + end > dev->_width) end = dev->_width - seg;
+	if (start >= end) return advance;
+
+	int page = (ypos >> 3) + ((y + align) >> 3);
+	int pages = page_font_pages(y, height, align);
+	uint8_t row[128];
+	for (int _page=0;_page<pages;_page++) {
+		int dpage = page + _page;
+		const unsigned char *segs = data;
+		if (rle) {
+			data = ssd1306_rle_decode(data, row, width);
+			if (data == NULL) {
+				ESP_LOGE(tag, "broken glyph index=%d", index);
+				break;
+			}
+			segs = row;
+		} else {
+			data = data + width;
+		}
+		if (dpage < 0 || dpage >= dev->_pages) continue;
+		uint8_t *dst = dev->_page[dpage]._segs;
+		if (dev->_flip) {
+			for (int i=start;i<end;i++) dst[seg+i] |= ssd1306_rotate_byte(segs[i]);
+		} else {
+			for (int i=start;i<end;i++) dst[seg+i] |= segs[i];
+		}
+		ssd1306_mark_dirty(dev, dpage, seg + start, end - start);
+	}
+	return advance;
+}
+
+// Decode one UTF-8 character of text into code, and return the number of bytes.
+int utf8_decode(const char *text, int *code)
+{
+	const unsigned char *src = (const unsigned char *)text;
+	int length = 1;
+	*code = src[0];
+	if ((src[0] & 0xE0) == 0xC0) {
+		*code = src[0] & 0x1F;
+		length = 2;
+	} else if ((src[0] & 0xF0) == 0xE0) {
+		*code = src[0] & 0x0F;
+		length = 3;
+	} else if ((src[0] & 0xF8) == 0xF0) {
+		*code = src[0] & 0x07;
+		length = 4;
+	}
+	for (int i=1;i<length;i++) {
+		// Broken sequence. Take the lead byte as it is.
+		if ((src[i] & 0xC0) != 0x80) {
+			*code = src[0];
+			return 1;
+		}
+		*code = (*code << 6) | (src[i] & 0x3F);
+	}
+	return length;
+}
+
+// text is UTF-8, so fonts converted from unicode BDF files can be used.
+esp_err_t show_page_font_text(SSD1306_t * dev, const unsigned char *font, const unsigned int *font_index, char *text, int xpos, int ypos)
+{
+	int _xpos = xpos;
+	int i = 0;
+	while (text[i] != 0) {
+		int ch;
+		i = i + utf8_decode(&text[i], &ch);
+		int index = find_bitmap_font(font_index, ch);
+		if (index == 0) {
+			ESP_LOGE(tag, "font not found [%d]", ch);
+			continue;
+		}
+		_xpos = _xpos + draw_page_font(dev, font, index, _xpos, ypos);
+	}
+	// Send only the changed columns
+	ssd1306_flush(dev);
+	return ESP_OK;
+}
+
+esp_err_t show_bdf_font_code(SSD1306_t * dev, unsigned char *font, const unsigned int *font_index, int code, int xpos, int ypos)
 {
 	int fontboundingbox_width = font[0];
 	int fontboundingbox_height = font[1];
@@ -121,7 +269,7 @@ esp_err_t show_bdf_font_code(SSD1306_t * dev, unsigned char *font, int code, int
 	}
 	BDF_FONT_t bdf_font;
 	memset(bitmap, 0, bitmap_size);
-	esp_err_t err = load_bitmap_font(font, code, bitmap, &bdf_font);
+	esp_err_t err = load_bitmap_font(font, font_index, code, bitmap, &bdf_font);
 	if (err != ESP_OK) {
 		ESP_LOGE(tag, "font not found [%d]", code);
 		return err;
@@ -178,9 +326,9 @@ void app_main(void)
 	while (1) {
 		ssd1306_clear_screen(&dev, false);
 		ssd1306_contrast(&dev, 0xff);
-		show_bdf_font_text(&dev, __ncenR12_bitmap__, "Hello World", 0, 0); // You can change font file
+		show_page_font_text(&dev, __ncenR12_pages__, __ncenR12_index__, "Hello World", 0, 0); // You can change font file
 #if CONFIG_SSD1306_128x64
-		show_bdf_font_text(&dev, __timR12_bitmap__, "Hello World", 0, 32); // You can change font file
+		show_page_font_text(&dev, __timR12_pages__, __timR12_index__, "Hello World", 0, 32); // You can change font file
 #endif
 		vTaskDelay(500);
 
@@ -190,13 +338,13 @@ void app_main(void)
 		ssd1306_contrast(&dev, 0xff);
 		int xpos = 0;
 		for (int code=161;code<170;code++) {
-			show_bdf_font_code(&dev, __ncenR12_bitmap__, code, xpos, 0);
+			show_page_font_text(&dev, __ncenR12_pages__, __ncenR12_index__, (char[]){code, 0}, xpos, 0);
 			xpos = xpos + 12;
 		}
 #if CONFIG_SSD1306_128x64
 		xpos = 0;
 		for (int code=181;code<190;code++) {
-			show_bdf_font_code(&dev, __ncenR12_bitmap__, code, xpos, 32);
+			show_page_font_text(&dev, __ncenR12_pages__, __ncenR12_index__, (char[]){code, 0}, xpos, 32);
 			xpos = xpos + 12;
 		}
 #endif
@@ -205,35 +353,35 @@ void app_main(void)
 
 		ssd1306_clear_screen(&dev, false);
 		ssd1306_contrast(&dev, 0xff);
-		show_bdf_font_code(&dev, __emoticons_bitmap__, 32, 0, 5);
-		show_bdf_font_code(&dev, __emoticons_bitmap__, 33, 24, 5);
-		show_bdf_font_code(&dev, __emoticons_bitmap__, 34, 48, 5);
-		show_bdf_font_code(&dev, __emoticons_bitmap__, 35, 72, 5);
-		show_bdf_font_code(&dev, __emoticons_bitmap__, 36, 96, 5);
+		show_bdf_font_code(&dev, __emoticons_bitmap__, __emoticons_index__, 32, 0, 5);
+		show_bdf_font_code(&dev, __emoticons_bitmap__, __emoticons_index__, 33, 24, 5);
+		show_bdf_font_code(&dev, __emoticons_bitmap__, __emoticons_index__, 34, 48, 5);
+		show_bdf_font_code(&dev, __emoticons_bitmap__, __emoticons_index__, 35, 72, 5);
+		show_bdf_font_code(&dev, __emoticons_bitmap__, __emoticons_index__, 36, 96, 5);
 #if CONFIG_SSD1306_128x64
-		show_bdf_font_code(&dev, __emoticons_bitmap__, 48, 0, 37);
-		show_bdf_font_code(&dev, __emoticons_bitmap__, 49, 24, 37);
-		show_bdf_font_code(&dev, __emoticons_bitmap__, 50, 48, 37);
-		show_bdf_font_code(&dev, __emoticons_bitmap__, 51, 72, 37);
-		show_bdf_font_code(&dev, __emoticons_bitmap__, 52, 96, 37);
+		show_bdf_font_code(&dev, __emoticons_bitmap__, __emoticons_index__, 48, 0, 37);
+		show_bdf_font_code(&dev, __emoticons_bitmap__, __emoticons_index__, 49, 24, 37);
+		show_bdf_font_code(&dev, __emoticons_bitmap__, __emoticons_index__, 50, 48, 37);
+		show_bdf_font_code(&dev, __emoticons_bitmap__, __emoticons_index__, 51, 72, 37);
+		show_bdf_font_code(&dev, __emoticons_bitmap__, __emoticons_index__, 52, 96, 37);
 #endif
 		vTaskDelay(500);
 
 		ssd1306_clear_screen(&dev, false);
 		ssd1306_contrast(&dev, 0xff);
-		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, 57, 0, 5);
-		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, 69, 20, 5);
-		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, 70, 40, 5);
-		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, 81, 60, 5);
-		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, 88, 80, 5);
-		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, 93, 100, 5);
+		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, __Scroll_o_Sprites_index__, 57, 0, 5);
+		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, __Scroll_o_Sprites_index__, 69, 20, 5);
+		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, __Scroll_o_Sprites_index__, 70, 40, 5);
+		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, __Scroll_o_Sprites_index__, 81, 60, 5);
+		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, __Scroll_o_Sprites_index__, 88, 80, 5);
+		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, __Scroll_o_Sprites_index__, 93, 100, 5);
 #if CONFIG_SSD1306_128x64
-		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, 1, 0, 37);
-		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, 6, 20, 37);
-		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, 26, 40, 37);
-		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, 27, 60, 37);
-		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, 33, 80, 37);
-		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, 46, 100, 37);
+		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, __Scroll_o_Sprites_index__, 1, 0, 37);
+		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, __Scroll_o_Sprites_index__, 6, 20, 37);
+		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, __Scroll_o_Sprites_index__, 26, 40, 37);
+		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, __Scroll_o_Sprites_index__, 27, 60, 37);
+		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, __Scroll_o_Sprites_index__, 33, 80, 37);
+		show_bdf_font_code(&dev, __Scroll_o_Sprites_bitmap__, __Scroll_o_Sprites_index__, 46, 100, 37);
 #endif
 		vTaskDelay(500);
 	}
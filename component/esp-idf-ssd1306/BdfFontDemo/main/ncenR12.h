@@ -1,395 +1,1933 @@
 // Created from bdf2c Version 4, (c) 2009, 2010 by Lutz Sammer
 //	License AGPLv3: GNU Affero General Public License version 3
-// character bitmap for each encoding
-unsigned char __ncenR12_bitmap__[] = {
+// page-major glyphs for each encoding
+const unsigned char __ncenR12_pages__[] = {
 // fontboundingbox_width
 21,
 // fontboundingbox_height
 26,
 // 'char0'
-  0,16,13,11,0,0,36,9,20,0x2a,0xaa,0x00,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x00,0x00,0x20,0x02,0x00,0x00,0x00,0x00,0x2a,0xaa,0x00,0x00,0x00,0x00,
+14,2,13,9,11,0,
+0xaa,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0xaa,0x0a,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x0a,
+0x54,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x54,0x15,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x15,
+0xa8,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0xa8,0x2a,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x2a,
+0x50,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x50,0x55,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x55,
+0xa0,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xa0,0xaa,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xaa,
+0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0xaa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,
+0x55,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x55,0x05,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x05,
 // 'space'
- 32,7,1,1,1,0,6,19,20,0x00,0x00,0x00,0x00,0x00,0x00,
+4,3,1,19,1,0,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 // 'exclam'
- 33,8,2,12,1,0,39,8,20,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
+5,3,2,8,12,0,
+0xff,0x1f,0x0d,0x0c,
+0xfe,0x3e,0x1b,0x18,
+0xfc,0x7c,0x37,0x30,
+0xf8,0xf8,0x6f,0x60,
+0xf0,0xf0,0xdf,0xc1,
+0xe0,0xe0,0xbf,0x83,0x01,0x01,
+0xc0,0xc0,0x7f,0x07,0x03,0x03,
+0x80,0x80,0xff,0x0f,0x06,0x06,
 // 'quotedbl'
- 34,9,4,4,1,8,15,8,12,0x12,0x00,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,
+6,3,4,8,4,0,
+0x0f,0x00,0x00,0x0f,
+0x1e,0x00,0x00,0x1e,
+0x3c,0x00,0x00,0x3c,
+0x78,0x00,0x00,0x78,
+0xf0,0x00,0x00,0xf0,
+0xe0,0x00,0x00,0xe0,0x01,0x00,0x00,0x01,
+0xc0,0x00,0x00,0xc0,0x03,0x00,0x00,0x03,
+0x80,0x00,0x00,0x80,0x07,0x00,0x00,0x07,
 // 'numbersign'
- 35,11,8,12,0,0,39,8,20,0x04,0x80,0x00,0x04,0x80,0x00,0x04,0x80,0x00,0x04,0x80,0x00,0x1f,0xc0,0x00,0x09,0x00,0x00,0x09,0x00,0x00,0x3f,0x80,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,
+9,2,8,8,12,0,
+0x80,0x90,0xf0,0x9f,0x90,0xf0,0x9f,0x10,0x00,0x0f,0x00,0x00,0x0f,0x00,0x00,0x00,
+0x00,0x20,0xe0,0x3e,0x20,0xe0,0x3e,0x20,0x01,0x1f,0x01,0x01,0x1f,0x01,0x01,0x00,
+0x00,0x40,0xc0,0x7c,0x40,0xc0,0x7c,0x40,0x02,0x3e,0x03,0x02,0x3e,0x03,0x02,0x00,
+0x00,0x80,0x80,0xf8,0x80,0x80,0xf8,0x80,0x04,0x7c,0x07,0x04,0x7c,0x07,0x04,0x00,
+0x00,0x00,0x00,0xf0,0x00,0x00,0xf0,0x00,0x08,0xf9,0x0f,0x09,0xf9,0x0f,0x09,0x01,
+0x00,0x00,0x00,0xe0,0x00,0x00,0xe0,0x00,0x10,0xf2,0x1e,0x13,0xf2,0x1e,0x13,0x02,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0xc0,0x00,0x00,0xc0,0x00,0x20,0xe4,0x3c,0x27,0xe4,0x3c,0x27,0x04,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x00,
+0x00,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x40,0xc8,0x78,0x4f,0xc8,0x78,0x4f,0x08,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x00,
 // 'dollar'
- 36,12,7,15,1,-2,48,7,22,0x02,0x00,0x00,0x02,0x00,0x00,0x07,0x80,0x00,0x0a,0x40,0x00,0x12,0xc0,0x00,0x12,0xc0,0x00,0x1e,0x00,0x00,0x0f,0x80,0x00,0x03,0xc0,0x00,0x1a,0x40,0x00,0x1a,0x40,0x00,0x12,0x80,0x00,0x0f,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+9,3,7,7,15,0,
+0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x38,0x64,0x62,0xff,0xc2,0xda,0x9c,0x07,0x0b,0x08,0x3f,0x08,0x04,0x03,
+0x70,0xc8,0xc4,0xff,0x84,0xb4,0x38,0x0e,0x16,0x10,0x7f,0x11,0x09,0x07,
+0xe0,0x90,0x88,0xfe,0x08,0x68,0x70,0x1c,0x2d,0x21,0xff,0x23,0x13,0x0e,
+0xc0,0x20,0x10,0xfc,0x10,0xd0,0xe0,0x39,0x5b,0x43,0xff,0x46,0x26,0x1c,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+0x80,0x40,0x20,0xf8,0x20,0xa0,0xc0,0x73,0xb6,0x86,0xff,0x8c,0x4d,0x39,0x00,0x00,0x00,0x03,0x00,0x00,0x00,
+0x00,0x80,0x40,0xf0,0x40,0x40,0x80,0xe7,0x6c,0x0c,0xff,0x18,0x9b,0x73,0x00,0x01,0x01,0x07,0x01,0x00,0x00,
+0x00,0x00,0x80,0xe0,0x80,0x80,0x00,0xce,0xd9,0x18,0xff,0x30,0x36,0xe7,0x01,0x02,0x02,0x0f,0x02,0x01,0x00,
+0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x9c,0xb2,0x31,0xff,0x61,0x6d,0xce,0x03,0x05,0x04,0x1f,0x04,0x02,0x01,
 // 'percent'
- 37,17,12,12,1,0,39,8,20,0x07,0x10,0x00,0x0c,0xf0,0x00,0x08,0xa0,0x00,0x18,0xa0,0x00,0x11,0x40,0x00,0x11,0x5c,0x00,0x0e,0xb2,0x00,0x00,0xa2,0x00,0x01,0x62,0x00,0x01,0x44,0x00,0x02,0x44,0x00,0x02,0x38,0x00,0x00,0x00,0x00,
+14,3,12,8,12,0,
+0x38,0x4e,0x43,0x41,0x31,0xce,0x32,0xce,0x63,0x20,0x20,0xc0,0x00,0x00,0x00,0x0c,0x03,0x00,0x07,0x09,0x08,0x08,0x06,0x01,
+0x70,0x9c,0x86,0x82,0x62,0x9c,0x64,0x9c,0xc6,0x40,0x40,0x80,0x00,0x00,0x00,0x18,0x06,0x01,0x0e,0x13,0x10,0x10,0x0c,0x03,
+0xe0,0x38,0x0c,0x04,0xc4,0x38,0xc8,0x38,0x8c,0x80,0x80,0x00,0x00,0x01,0x01,0x31,0x0c,0x03,0x1c,0x27,0x21,0x20,0x18,0x07,
+0xc0,0x70,0x18,0x08,0x88,0x70,0x90,0x70,0x18,0x00,0x00,0x00,0x01,0x02,0x02,0x62,0x19,0x06,0x39,0x4e,0x43,0x41,0x31,0x0e,
+0x80,0xe0,0x30,0x10,0x10,0xe0,0x20,0xe0,0x30,0x00,0x00,0x00,0x03,0x04,0x04,0xc4,0x33,0x0c,0x73,0x9c,0x86,0x82,0x62,0x1c,
+0x00,0xc0,0x60,0x20,0x20,0xc0,0x40,0xc0,0x60,0x00,0x00,0x00,0x07,0x09,0x08,0x88,0x66,0x19,0xe6,0x39,0x0c,0x04,0xc4,0x38,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x80,0xc0,0x40,0x40,0x80,0x80,0x80,0xc0,0x00,0x00,0x00,0x0e,0x13,0x10,0x10,0xcc,0x33,0xcc,0x73,0x18,0x08,0x88,0x70,0x00,0x00,0x00,0x03,0x00,0x00,0x01,0x02,0x02,0x02,0x01,0x00,
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x1c,0x27,0x21,0x20,0x98,0x67,0x99,0xe7,0x31,0x10,0x10,0xe0,0x00,0x00,0x00,0x06,0x01,0x00,0x03,0x04,0x04,0x04,0x03,0x00,
 // 'ampersand'
- 38,15,12,12,0,0,39,8,20,0x07,0x80,0x00,0x0c,0xc0,0x00,0x0c,0x40,0x00,0x0c,0xc0,0x00,0x06,0x80,0x00,0x07,0x3c,0x00,0x0b,0x18,0x00,0x19,0x90,0x00,0x31,0xa0,0x00,0x30,0xe4,0x00,0x39,0xe4,0x00,0x1f,0x38,0x00,0x00,0x00,0x00,
+13,2,12,8,12,2,
+0x00,0x4a,0x80,0xce,0x3f,0x71,0xe1,0x9b,0x0e,0x20,0xe0,0x60,0x20,0xc0,0x4b,0x07,0x0f,0x0c,0x08,0x08,0x0d,0x07,0x06,0x0f,0x08,0x08,0x06,0xc0,
+0x01,0x49,0x9c,0x7e,0xe2,0xc2,0x36,0x1c,0x40,0xc0,0xc0,0x40,0xc0,0x4b,0x0e,0x1f,0x19,0x10,0x10,0x1b,0x0f,0x0c,0x1e,0x11,0x10,0x0c,0xc0,
+0x01,0x45,0x38,0xfc,0xc4,0x84,0x6c,0x38,0x83,0x80,0xc0,0x4b,0x1c,0x3e,0x33,0x20,0x21,0x37,0x1e,0x18,0x3c,0x23,0x21,0x18,0xc0,
+0x01,0x45,0x70,0xf8,0x88,0x08,0xd8,0x70,0xc0,0x4b,0x38,0x7c,0x66,0x41,0x43,0x6f,0x3c,0x30,0x79,0x47,0x43,0x31,0xc0,
+0x01,0x45,0xe0,0xf0,0x10,0x10,0xb0,0xe0,0xc0,0x4b,0x70,0xf8,0xcc,0x83,0x87,0xde,0x79,0x60,0xf2,0x8e,0x86,0x62,0xc0,
+0x01,0x45,0xc0,0xe0,0x20,0x20,0x60,0xc0,0xc0,0x4b,0xe0,0xf0,0x99,0x07,0x0e,0xbc,0xf3,0xc1,0xe4,0x1c,0x0c,0xc4,0xc0,0x00,0x84,0x01,0x01,0x82,0x01,0xc0,
+0x01,0x45,0x80,0xc0,0x40,0x40,0xc0,0x80,0xc0,0x4b,0xc0,0xe0,0x33,0x0f,0x1c,0x78,0xe6,0x83,0xc8,0x38,0x18,0x88,0xc0,0x4b,0x01,0x03,0x03,0x02,0x02,0x03,0x01,0x01,0x03,0x02,0x02,0x01,0xc0,
+0x02,0x83,0x80,0xc0,0x4b,0x80,0xc0,0x67,0x1f,0x38,0xf0,0xcd,0x07,0x90,0x70,0x30,0x10,0xc0,0x4b,0x03,0x07,0x06,0x04,0x04,0x06,0x03,0x03,0x07,0x04,0x04,0x03,0xc0,
 // 'quotesingle'
- 39,6,1,4,1,8,15,8,12,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+3,3,1,8,4,0,
+0x0f,
+0x1e,
+0x3c,
+0x78,
+0xf0,
+0xe0,0x01,
+0xc0,0x03,
+0x80,0x07,
 // 'parenleft'
- 40,9,4,14,1,-2,45,8,22,0x02,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+6,3,4,8,14,0,
+0xf0,0x0c,0x02,0x01,0x03,0x0c,0x10,0x20,
+0xe0,0x18,0x04,0x02,0x07,0x18,0x20,0x40,
+0xc0,0x30,0x08,0x04,0x0f,0x30,0x40,0x80,
+0x80,0x60,0x10,0x08,0x1f,0x60,0x80,0x00,0x00,0x00,0x00,0x01,
+0x00,0xc0,0x20,0x10,0x3f,0xc0,0x00,0x00,0x00,0x00,0x01,0x02,
+0x00,0x80,0x40,0x20,0x7e,0x81,0x00,0x00,0x00,0x01,0x02,0x04,
+0x00,0x00,0x80,0x40,0xfc,0x03,0x00,0x00,0x00,0x03,0x04,0x08,
+0x00,0x00,0x00,0x80,0xf8,0x06,0x01,0x00,0x01,0x06,0x08,0x10,
 // 'parenright'
- 41,8,4,14,0,-2,45,8,22,0x20,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
+6,2,4,8,14,0,
+0x01,0x02,0x0c,0xf0,0x20,0x10,0x0c,0x03,
+0x02,0x04,0x18,0xe0,0x40,0x20,0x18,0x07,
+0x04,0x08,0x30,0xc0,0x80,0x40,0x30,0x0f,
+0x08,0x10,0x60,0x80,0x00,0x80,0x60,0x1f,0x01,0x00,0x00,0x00,
+0x10,0x20,0xc0,0x00,0x00,0x00,0xc0,0x3f,0x02,0x01,0x00,0x00,
+0x20,0x40,0x80,0x00,0x00,0x00,0x81,0x7e,0x04,0x02,0x01,0x00,
+0x40,0x80,0x00,0x00,0x00,0x00,0x03,0xfc,0x08,0x04,0x03,0x00,
+0x80,0x00,0x00,0x00,0x00,0x01,0x06,0xf8,0x10,0x08,0x06,0x01,
 // 'asterisk'
- 42,10,7,7,0,5,24,8,15,0x04,0x00,0x00,0x15,0x00,0x00,0x35,0x80,0x00,0x0e,0x00,0x00,0x35,0x80,0x00,0x15,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,7,0,
+0x14,0x36,0x08,0x7f,0x08,0x36,0x14,
+0x28,0x6c,0x10,0xfe,0x10,0x6c,0x28,
+0x50,0xd8,0x20,0xfc,0x20,0xd8,0x50,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+0xa0,0xb0,0x40,0xf8,0x40,0xb0,0xa0,0x00,0x01,0x00,0x03,0x00,0x01,0x00,
+0x40,0x60,0x80,0xf0,0x80,0x60,0x40,0x01,0x03,0x00,0x07,0x00,0x03,0x01,
+0x80,0xc0,0x00,0xe0,0x00,0xc0,0x80,0x02,0x06,0x01,0x0f,0x01,0x06,0x02,
+0x00,0x80,0x00,0xc0,0x00,0x80,0x00,0x05,0x0d,0x02,0x1f,0x02,0x0d,0x05,
+0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x0a,0x1b,0x04,0x3f,0x04,0x1b,0x0a,
 // 'plus'
- 43,13,7,9,1,0,30,11,20,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x1f,0xc0,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+10,3,7,11,9,2,
+0x82,0x80,0x40,0xf8,0x82,0x80,0xc0,0x02,0x40,0x0f,0xc0,
+0x02,0x40,0xf0,0xc0,0x82,0x01,0x40,0x1f,0x82,0x01,0xc0,
+0x02,0x40,0xe0,0xc0,0x82,0x02,0x40,0x3f,0x82,0x02,0xc0,
+0x02,0x40,0xc0,0xc0,0x82,0x04,0x40,0x7f,0x82,0x04,0xc0,
+0x02,0x40,0x80,0xc0,0x82,0x08,0x40,0xff,0x82,0x08,0xc0,
+0x82,0x10,0x40,0xff,0x82,0x10,0xc0,0x02,0x40,0x01,0xc0,
+0x82,0x20,0x40,0xfe,0x82,0x20,0xc0,0x02,0x40,0x03,0xc0,
+0x82,0x40,0x40,0xfc,0x82,0x40,0xc0,0x02,0x40,0x07,0xc0,
 // 'comma'
- 44,7,2,5,1,-3,18,18,23,0x18,0x00,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+4,3,2,18,5,0,
+0x4c,0x3c,
+0x98,0x78,
+0x30,0xf0,0x01,0x00,
+0x60,0xe0,0x02,0x01,
+0xc0,0xc0,0x04,0x03,
+0x80,0x80,0x09,0x07,
+0x13,0x0f,
+0x26,0x1e,
 // 'hyphen'
- 45,7,4,1,0,3,6,16,17,0x3c,0x00,0x00,0x00,0x00,0x00,
+5,2,4,16,1,2,
+0x83,0x01,0xc0,
+0x83,0x02,0xc0,
+0x83,0x04,0xc0,
+0x83,0x08,0xc0,
+0x83,0x10,0xc0,
+0x83,0x20,0xc0,
+0x83,0x40,0xc0,
+0x83,0x80,0xc0,
 // 'period'
- 46,7,2,2,1,0,9,18,20,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
+4,3,2,18,2,0,
+0x0c,0x0c,
+0x18,0x18,
+0x30,0x30,
+0x60,0x60,
+0xc0,0xc0,
+0x80,0x80,0x01,0x01,
+0x03,0x03,
+0x06,0x06,
 // 'slash'
- 47,7,5,12,0,0,39,8,20,0x02,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
+5,2,5,8,12,0,
+0x00,0x80,0x60,0x1c,0x03,0x0c,0x03,0x00,0x00,0x00,
+0x00,0x00,0xc0,0x38,0x06,0x18,0x07,0x00,0x00,0x00,
+0x00,0x00,0x80,0x70,0x0c,0x30,0x0e,0x01,0x00,0x00,
+0x00,0x00,0x00,0xe0,0x18,0x60,0x1c,0x03,0x00,0x00,
+0x00,0x00,0x00,0xc0,0x30,0xc0,0x38,0x06,0x01,0x00,
+0x00,0x00,0x00,0x80,0x60,0x80,0x70,0x0c,0x03,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0xc0,0x00,0xe0,0x18,0x07,0x00,0x03,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x80,0x00,0xc0,0x30,0x0e,0x01,0x06,0x01,0x00,0x00,0x00,
 // 'zero'
- 48,11,8,12,0,0,39,8,20,0x0f,0x00,0x00,0x19,0x80,0x00,0x10,0x80,0x00,0x30,0xc0,0x00,0x30,0xc0,0x00,0x30,0xc0,0x00,0x30,0xc0,0x00,0x30,0xc0,0x00,0x30,0xc0,0x00,0x10,0x80,0x00,0x19,0x80,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,
+9,2,8,8,12,0,
+0xf8,0xfe,0x03,0x01,0x01,0x03,0xfe,0xf8,0x01,0x07,0x0c,0x08,0x08,0x0c,0x07,0x01,
+0xf0,0xfc,0x06,0x02,0x02,0x06,0xfc,0xf0,0x03,0x0f,0x18,0x10,0x10,0x18,0x0f,0x03,
+0xe0,0xf8,0x0c,0x04,0x04,0x0c,0xf8,0xe0,0x07,0x1f,0x30,0x20,0x20,0x30,0x1f,0x07,
+0xc0,0xf0,0x18,0x08,0x08,0x18,0xf0,0xc0,0x0f,0x3f,0x60,0x40,0x40,0x60,0x3f,0x0f,
+0x80,0xe0,0x30,0x10,0x10,0x30,0xe0,0x80,0x1f,0x7f,0xc0,0x80,0x80,0xc0,0x7f,0x1f,
+0x00,0xc0,0x60,0x20,0x20,0x60,0xc0,0x00,0x3f,0xff,0x80,0x00,0x00,0x80,0xff,0x3f,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,
+0x00,0x80,0xc0,0x40,0x40,0xc0,0x80,0x00,0x7e,0xff,0x00,0x00,0x00,0x00,0xff,0x7e,0x00,0x01,0x03,0x02,0x02,0x03,0x01,0x00,
+0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0xfc,0xff,0x01,0x00,0x00,0x01,0xff,0xfc,0x00,0x03,0x06,0x04,0x04,0x06,0x03,0x00,
 // 'one'
- 49,12,6,12,1,0,39,8,20,0x02,0x00,0x00,0x1e,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x1f,0x80,0x00,0x00,0x00,0x00,
+9,3,6,8,12,0,
+0x02,0x02,0xfe,0xff,0x00,0x00,0x08,0x08,0x0f,0x0f,0x08,0x08,
+0x04,0x04,0xfc,0xfe,0x00,0x00,0x10,0x10,0x1f,0x1f,0x10,0x10,
+0x08,0x08,0xf8,0xfc,0x00,0x00,0x20,0x20,0x3f,0x3f,0x20,0x20,
+0x10,0x10,0xf0,0xf8,0x00,0x00,0x40,0x40,0x7f,0x7f,0x40,0x40,
+0x20,0x20,0xe0,0xf0,0x00,0x00,0x80,0x80,0xff,0xff,0x80,0x80,
+0x40,0x40,0xc0,0xe0,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,
+0x80,0x80,0x80,0xc0,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x02,0x02,0x03,0x03,0x02,0x02,
+0x00,0x00,0x00,0x80,0x00,0x00,0x01,0x01,0xff,0xff,0x00,0x00,0x04,0x04,0x07,0x07,0x04,0x04,
 // 'two'
- 50,12,7,12,1,0,39,8,20,0x07,0x00,0x00,0x08,0x80,0x00,0x10,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x01,0x80,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x04,0x40,0x00,0x08,0x40,0x00,0x1f,0xc0,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,
+9,3,7,8,12,0,
+0x1c,0x1a,0x01,0x81,0x61,0x3e,0x1c,0x0c,0x0e,0x0d,0x0c,0x0c,0x0c,0x0f,
+0x38,0x34,0x02,0x02,0xc2,0x7c,0x38,0x18,0x1c,0x1a,0x19,0x18,0x18,0x1e,
+0x70,0x68,0x04,0x04,0x84,0xf8,0x70,0x30,0x38,0x34,0x32,0x31,0x30,0x3c,
+0xe0,0xd0,0x08,0x08,0x08,0xf0,0xe0,0x60,0x70,0x68,0x64,0x63,0x61,0x78,
+0xc0,0xa0,0x10,0x10,0x10,0xe0,0xc0,0xc1,0xe1,0xd0,0xc8,0xc6,0xc3,0xf1,
+0x80,0x40,0x20,0x20,0x20,0xc0,0x80,0x83,0xc3,0xa0,0x90,0x8c,0x87,0xe3,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+0x00,0x80,0x40,0x40,0x40,0x80,0x00,0x07,0x86,0x40,0x20,0x18,0x0f,0xc7,0x03,0x03,0x03,0x03,0x03,0x03,0x03,
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x0e,0x0d,0x80,0x40,0x30,0x1f,0x8e,0x06,0x07,0x06,0x06,0x06,0x06,0x07,
 // 'three'
- 51,12,7,12,1,0,39,8,20,0x0f,0x00,0x00,0x11,0x80,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x01,0x80,0x00,0x07,0x00,0x00,0x01,0x80,0x00,0x00,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x11,0x80,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,
+9,3,7,8,12,0,
+0x0e,0x0d,0x21,0x21,0x73,0xde,0x8c,0x07,0x0b,0x08,0x08,0x0c,0x07,0x03,
+0x1c,0x1a,0x42,0x42,0xe6,0xbc,0x18,0x0e,0x16,0x10,0x10,0x18,0x0f,0x07,
+0x38,0x34,0x84,0x84,0xcc,0x78,0x30,0x1c,0x2c,0x20,0x20,0x31,0x1f,0x0e,
+0x70,0x68,0x08,0x08,0x98,0xf0,0x60,0x38,0x58,0x41,0x41,0x63,0x3e,0x1c,
+0xe0,0xd0,0x10,0x10,0x30,0xe0,0xc0,0x70,0xb0,0x82,0x82,0xc7,0x7d,0x38,
+0xc0,0xa0,0x20,0x20,0x60,0xc0,0x80,0xe1,0x61,0x04,0x04,0x8e,0xfb,0x71,0x00,0x01,0x01,0x01,0x01,0x00,0x00,
+0x80,0x40,0x40,0x40,0xc0,0x80,0x00,0xc3,0xc3,0x08,0x08,0x1c,0xf7,0xe3,0x01,0x02,0x02,0x02,0x03,0x01,0x00,
+0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x87,0x86,0x10,0x10,0x39,0xef,0xc6,0x03,0x05,0x04,0x04,0x06,0x03,0x01,
 // 'four'
- 52,11,8,12,0,0,39,8,20,0x01,0x00,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x0b,0x00,0x00,0x0b,0x00,0x00,0x13,0x00,0x00,0x13,0x00,0x00,0x23,0x00,0x00,0x3f,0xc0,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,
+9,2,8,8,12,0,
+0x80,0x60,0x18,0x04,0xfe,0xff,0x00,0x00,0x01,0x01,0x09,0x09,0x0f,0x0f,0x09,0x09,
+0x00,0xc0,0x30,0x08,0xfc,0xfe,0x00,0x00,0x03,0x02,0x12,0x12,0x1f,0x1f,0x12,0x12,
+0x00,0x80,0x60,0x10,0xf8,0xfc,0x00,0x00,0x06,0x05,0x24,0x24,0x3f,0x3f,0x24,0x24,
+0x00,0x00,0xc0,0x20,0xf0,0xf8,0x00,0x00,0x0c,0x0b,0x48,0x48,0x7f,0x7f,0x48,0x48,
+0x00,0x00,0x80,0x40,0xe0,0xf0,0x00,0x00,0x18,0x16,0x91,0x90,0xff,0xff,0x90,0x90,
+0x00,0x00,0x00,0x80,0xc0,0xe0,0x00,0x00,0x30,0x2c,0x23,0x20,0xff,0xff,0x20,0x20,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,
+0x00,0x00,0x00,0x00,0x80,0xc0,0x00,0x00,0x60,0x58,0x46,0x41,0xff,0xff,0x40,0x40,0x00,0x00,0x02,0x02,0x03,0x03,0x02,0x02,
+0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0xc0,0xb0,0x8c,0x82,0xff,0xff,0x80,0x80,0x00,0x00,0x04,0x04,0x07,0x07,0x04,0x04,
 // 'five'
- 53,12,7,12,1,0,39,8,20,0x0f,0xc0,0x00,0x0f,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x0f,0x00,0x00,0x19,0x80,0x00,0x10,0xc0,0x00,0x00,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x11,0x80,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,
+9,3,7,8,12,0,
+0x60,0x3f,0x13,0x13,0x33,0xe1,0xc1,0x07,0x0b,0x08,0x08,0x0c,0x07,0x03,
+0xc0,0x7e,0x26,0x26,0x66,0xc2,0x82,0x0e,0x16,0x10,0x10,0x18,0x0f,0x07,
+0x80,0xfc,0x4c,0x4c,0xcc,0x84,0x04,0x1d,0x2c,0x20,0x20,0x30,0x1f,0x0f,
+0x00,0xf8,0x98,0x98,0x98,0x08,0x08,0x3b,0x59,0x40,0x40,0x61,0x3f,0x1e,
+0x00,0xf0,0x30,0x30,0x30,0x10,0x10,0x76,0xb3,0x81,0x81,0xc3,0x7e,0x3c,
+0x00,0xe0,0x60,0x60,0x60,0x20,0x20,0xec,0x67,0x02,0x02,0x86,0xfc,0x78,0x00,0x01,0x01,0x01,0x01,0x00,0x00,
+0x00,0xc0,0xc0,0xc0,0xc0,0x40,0x40,0xd8,0xcf,0x04,0x04,0x0c,0xf8,0xf0,0x01,0x02,0x02,0x02,0x03,0x01,0x00,
+0x00,0x80,0x80,0x80,0x80,0x80,0x80,0xb0,0x9f,0x09,0x09,0x19,0xf0,0xe0,0x03,0x05,0x04,0x04,0x06,0x03,0x01,
 // 'six'
- 54,11,8,12,0,0,39,8,20,0x0f,0x00,0x00,0x19,0x80,0x00,0x11,0x80,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x3f,0x00,0x00,0x39,0x80,0x00,0x30,0xc0,0x00,0x30,0xc0,0x00,0x30,0xc0,0x00,0x19,0x80,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,
+9,2,8,8,12,0,
+0xf8,0xfe,0x63,0x21,0x21,0x67,0xc6,0x80,0x03,0x07,0x0c,0x08,0x08,0x0c,0x07,0x03,
+0xf0,0xfc,0xc6,0x42,0x42,0xce,0x8c,0x00,0x07,0x0f,0x18,0x10,0x10,0x18,0x0f,0x07,
+0xe0,0xf8,0x8c,0x84,0x84,0x9c,0x18,0x00,0x0f,0x1f,0x31,0x20,0x20,0x31,0x1f,0x0e,
+0xc0,0xf0,0x18,0x08,0x08,0x38,0x30,0x00,0x1f,0x3f,0x63,0x41,0x41,0x63,0x3e,0x1c,
+0x80,0xe0,0x30,0x10,0x10,0x70,0x60,0x00,0x3f,0x7f,0xc6,0x82,0x82,0xc6,0x7c,0x38,
+0x00,0xc0,0x60,0x20,0x20,0xe0,0xc0,0x00,0x7f,0xff,0x8c,0x04,0x04,0x8c,0xf8,0x70,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,
+0x00,0x80,0xc0,0x40,0x40,0xc0,0x80,0x00,0xfe,0xff,0x18,0x08,0x08,0x19,0xf1,0xe0,0x00,0x01,0x03,0x02,0x02,0x03,0x01,0x00,
+0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0xfc,0xff,0x31,0x10,0x10,0x33,0xe3,0xc0,0x01,0x03,0x06,0x04,0x04,0x06,0x03,0x01,
 // 'seven'
- 55,12,7,12,1,0,39,8,20,0x1f,0xc0,0x00,0x1f,0xc0,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,
+9,3,7,8,12,2,
+0x46,0x0f,0x03,0x03,0xc3,0x33,0x0f,0x03,0xc0,0x01,0x41,0x0e,0x0f,0xc0,
+0x46,0x1e,0x06,0x06,0x86,0x66,0x1e,0x06,0xc0,0x01,0x41,0x1c,0x1f,0xc0,
+0x40,0x3c,0x82,0x0c,0x42,0xcc,0x3c,0x0c,0xc0,0x01,0x41,0x38,0x3f,0xc0,
+0x40,0x78,0x82,0x18,0x42,0x98,0x78,0x18,0xc0,0x01,0x42,0x70,0x7e,0x01,0xc0,
+0x40,0xf0,0x83,0x30,0x41,0xf0,0x30,0xc0,0x01,0x42,0xe0,0xfc,0x03,0xc0,
+0x40,0xe0,0x83,0x60,0x41,0xe0,0x60,0xc0,0x45,0x01,0x00,0xc0,0xf8,0x06,0x01,0xc0,0x01,0x41,0x01,0x01,0xc0,
+0x86,0xc0,0xc0,0x45,0x03,0x00,0x80,0xf0,0x0c,0x03,0xc0,0x01,0x41,0x03,0x03,0xc0,
+0x86,0x80,0xc0,0x46,0x07,0x01,0x01,0xe1,0x19,0x07,0x01,0xc0,0x01,0x41,0x07,0x07,0xc0,
 // 'eight'
- 56,11,8,12,0,0,39,8,20,0x0f,0x00,0x00,0x19,0x80,0x00,0x10,0x80,0x00,0x18,0x80,0x00,0x1d,0x80,0x00,0x0f,0x00,0x00,0x1b,0x80,0x00,0x31,0xc0,0x00,0x30,0xc0,0x00,0x30,0xc0,0x00,0x19,0x80,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,
+9,2,8,8,12,0,
+0x80,0xde,0x7b,0x31,0x61,0xf3,0xde,0x80,0x03,0x07,0x0c,0x08,0x08,0x0c,0x07,0x03,
+0x00,0xbc,0xf6,0x62,0xc2,0xe6,0xbc,0x00,0x07,0x0f,0x18,0x10,0x10,0x19,0x0f,0x07,
+0x00,0x78,0xec,0xc4,0x84,0xcc,0x78,0x00,0x0e,0x1f,0x31,0x20,0x21,0x33,0x1f,0x0e,
+0x00,0xf0,0xd8,0x88,0x08,0x98,0xf0,0x00,0x1c,0x3e,0x63,0x41,0x43,0x67,0x3e,0x1c,
+0x00,0xe0,0xb0,0x10,0x10,0x30,0xe0,0x00,0x38,0x7d,0xc7,0x83,0x86,0xcf,0x7d,0x38,
+0x00,0xc0,0x60,0x20,0x20,0x60,0xc0,0x00,0x70,0xfb,0x8f,0x06,0x0c,0x9e,0xfb,0x70,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,
+0x00,0x80,0xc0,0x40,0x40,0xc0,0x80,0x00,0xe0,0xf7,0x1e,0x0c,0x18,0x3c,0xf7,0xe0,0x00,0x01,0x03,0x02,0x02,0x03,0x01,0x00,
+0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0xc0,0xef,0x3d,0x18,0x30,0x79,0xef,0xc0,0x01,0x03,0x06,0x04,0x04,0x06,0x03,0x01,
 // 'nine'
- 57,11,8,12,0,0,39,8,20,0x0f,0x00,0x00,0x19,0x80,0x00,0x30,0xc0,0x00,0x30,0xc0,0x00,0x30,0xc0,0x00,0x19,0xc0,0x00,0x0f,0xc0,0x00,0x00,0xc0,0x00,0x00,0xc0,0x00,0x18,0x80,0x00,0x19,0x80,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+9,2,8,8,12,0,
+0x1c,0x3e,0x63,0x41,0x41,0x63,0xfe,0xfc,0x00,0x06,0x0e,0x08,0x08,0x04,0x07,0x01,
+0x38,0x7c,0xc6,0x82,0x82,0xc6,0xfc,0xf8,0x00,0x0c,0x1c,0x10,0x10,0x08,0x0f,0x03,
+0x70,0xf8,0x8c,0x04,0x04,0x8c,0xf8,0xf0,0x00,0x18,0x39,0x21,0x21,0x11,0x1f,0x07,
+0xe0,0xf0,0x18,0x08,0x08,0x18,0xf0,0xe0,0x00,0x31,0x73,0x42,0x42,0x23,0x3f,0x0f,
+0xc0,0xe0,0x30,0x10,0x10,0x30,0xe0,0xc0,0x01,0x63,0xe6,0x84,0x84,0x46,0x7f,0x1f,
+0x80,0xc0,0x60,0x20,0x20,0x60,0xc0,0x80,0x03,0xc7,0xcc,0x08,0x08,0x8c,0xff,0x3f,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,
+0x00,0x80,0xc0,0x40,0x40,0xc0,0x80,0x00,0x07,0x8f,0x98,0x10,0x10,0x18,0xff,0x7f,0x00,0x01,0x03,0x02,0x02,0x01,0x01,0x00,
+0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x0e,0x1f,0x31,0x20,0x20,0x31,0xff,0xfe,0x00,0x03,0x07,0x04,0x04,0x02,0x03,0x00,
 // 'colon'
- 58,7,2,8,1,0,27,12,20,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
+4,3,2,12,8,0,
+0x30,0x30,0x0c,0x0c,
+0x60,0x60,0x18,0x18,
+0xc0,0xc0,0x30,0x30,
+0x80,0x80,0x61,0x61,
+0xc3,0xc3,
+0x86,0x86,0x01,0x01,
+0x0c,0x0c,0x03,0x03,
+0x18,0x18,0x06,0x06,
 // 'semicolon'
- 59,7,2,11,1,-3,36,12,23,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+4,3,2,12,11,0,
+0x30,0x30,0x4c,0x3c,
+0x60,0x60,0x98,0x78,
+0xc0,0xc0,0x30,0xf0,0x01,0x00,
+0x80,0x80,0x61,0xe1,0x02,0x01,
+0xc3,0xc3,0x04,0x03,
+0x86,0x86,0x09,0x07,
+0x0c,0x0c,0x13,0x0f,
+0x18,0x18,0x26,0x1e,
 // 'less'
- 60,13,8,8,1,0,27,12,20,0x00,0x60,0x00,0x01,0x80,0x00,0x06,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x06,0x00,0x00,0x01,0x80,0x00,0x00,0x60,0x00,0x00,0x00,0x00,
+10,3,8,12,8,0,
+0x80,0x80,0x40,0x40,0x20,0x20,0x10,0x10,0x01,0x01,0x02,0x02,0x04,0x04,0x08,0x08,
+0x00,0x00,0x80,0x80,0x40,0x40,0x20,0x20,0x03,0x03,0x04,0x04,0x08,0x08,0x10,0x10,
+0x00,0x00,0x00,0x00,0x80,0x80,0x40,0x40,0x06,0x06,0x09,0x09,0x10,0x10,0x20,0x20,
+0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x0c,0x0c,0x12,0x12,0x21,0x21,0x40,0x40,
+0x18,0x18,0x24,0x24,0x42,0x42,0x81,0x81,
+0x30,0x30,0x48,0x48,0x84,0x84,0x02,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,
+0x60,0x60,0x90,0x90,0x08,0x08,0x04,0x04,0x00,0x00,0x00,0x00,0x01,0x01,0x02,0x02,
+0xc0,0xc0,0x20,0x20,0x10,0x10,0x08,0x08,0x00,0x00,0x01,0x01,0x02,0x02,0x04,0x04,
 // 'equal'
- 61,13,8,4,1,2,15,14,18,0x1f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0x00,0x00,0x00,
+10,3,8,14,4,2,
+0x87,0x40,0xc0,0x87,0x02,0xc0,
+0x87,0x80,0xc0,0x87,0x04,0xc0,
+0x87,0x09,0xc0,
+0x87,0x12,0xc0,
+0x87,0x24,0xc0,
+0x87,0x48,0xc0,
+0x87,0x90,0xc0,
+0x87,0x20,0xc0,0x87,0x01,0xc0,
 // 'greater'
- 62,12,8,8,0,0,27,12,20,0x30,0x00,0x00,0x0c,0x00,0x00,0x03,0x00,0x00,0x00,0xc0,0x00,0x00,0xc0,0x00,0x03,0x00,0x00,0x0c,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
+10,2,8,12,8,0,
+0x10,0x10,0x20,0x20,0x40,0x40,0x80,0x80,0x08,0x08,0x04,0x04,0x02,0x02,0x01,0x01,
+0x20,0x20,0x40,0x40,0x80,0x80,0x00,0x00,0x10,0x10,0x08,0x08,0x04,0x04,0x03,0x03,
+0x40,0x40,0x80,0x80,0x00,0x00,0x00,0x00,0x20,0x20,0x10,0x10,0x09,0x09,0x06,0x06,
+0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x40,0x21,0x21,0x12,0x12,0x0c,0x0c,
+0x81,0x81,0x42,0x42,0x24,0x24,0x18,0x18,
+0x02,0x02,0x84,0x84,0x48,0x48,0x30,0x30,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x04,0x04,0x08,0x08,0x90,0x90,0x60,0x60,0x02,0x02,0x01,0x01,0x00,0x00,0x00,0x00,
+0x08,0x08,0x10,0x10,0x20,0x20,0xc0,0xc0,0x04,0x04,0x02,0x02,0x01,0x01,0x00,0x00,
 // 'question'
- 63,9,7,12,0,0,39,8,20,0x0e,0x00,0x00,0x13,0x00,0x00,0x39,0x80,0x00,0x11,0x80,0x00,0x01,0x80,0x00,0x03,0x00,0x00,0x06,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,
+7,2,7,8,12,0,
+0x04,0x0e,0x05,0xc1,0x63,0x3e,0x1c,0x00,0x00,0x0c,0x0d,0x00,0x00,0x00,
+0x08,0x1c,0x0a,0x82,0xc6,0x7c,0x38,0x00,0x00,0x18,0x1b,0x00,0x00,0x00,
+0x10,0x38,0x14,0x04,0x8c,0xf8,0x70,0x00,0x00,0x30,0x37,0x01,0x00,0x00,
+0x20,0x70,0x28,0x08,0x18,0xf0,0xe0,0x00,0x00,0x60,0x6e,0x03,0x01,0x00,
+0x40,0xe0,0x50,0x10,0x30,0xe0,0xc0,0x00,0x00,0xc0,0xdc,0x06,0x03,0x01,
+0x80,0xc0,0xa0,0x20,0x60,0xc0,0x80,0x00,0x01,0x80,0xb8,0x0c,0x07,0x03,0x00,0x00,0x01,0x01,0x00,0x00,0x00,
+0x00,0x80,0x40,0x40,0xc0,0x80,0x00,0x01,0x03,0x01,0x70,0x18,0x0f,0x07,0x00,0x00,0x03,0x03,0x00,0x00,0x00,
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x02,0x07,0x02,0xe0,0x31,0x1f,0x0e,0x00,0x00,0x06,0x06,0x00,0x00,0x00,
 // 'at'
- 64,14,13,13,-1,-1,42,8,21,0x03,0xc0,0x00,0x0c,0x30,0x00,0x10,0x08,0x00,0x23,0x68,0x00,0x26,0xc8,0x00,0x4c,0x48,0x00,0x4c,0xc8,0x00,0x48,0x90,0x00,0x4d,0x90,0x00,0x26,0x64,0x00,0x20,0x08,0x00,0x18,0x30,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,
+13,1,13,8,13,2,
+0x4b,0xe0,0x18,0x04,0xe2,0x72,0x19,0x09,0xd1,0x79,0x0a,0x82,0x7c,0xc0,0x4c,0x01,0x06,0x08,0x09,0x13,0x12,0x11,0x11,0x12,0x0a,0x09,0x04,0x02,0xc0,
+0x4b,0xc0,0x30,0x08,0xc4,0xe4,0x32,0x12,0xa2,0xf2,0x14,0x04,0xf8,0xc0,0x4c,0x03,0x0c,0x10,0x13,0x26,0x24,0x22,0x23,0x24,0x14,0x13,0x08,0x04,0xc0,
+0x4b,0x80,0x60,0x10,0x88,0xc8,0x64,0x24,0x44,0xe4,0x28,0x08,0xf0,0xc0,0x4c,0x07,0x18,0x20,0x27,0x4d,0x48,0x44,0x47,0x49,0x28,0x26,0x11,0x08,0xc0,
+0x00,0x4a,0xc0,0x20,0x10,0x90,0xc8,0x48,0x88,0xc8,0x50,0x10,0xe0,0xc0,0x4c,0x0f,0x30,0x40,0x4f,0x9b,0x90,0x88,0x8e,0x93,0x50,0x4c,0x23,0x10,0xc0,
+0x00,0x4a,0x80,0x40,0x20,0x20,0x90,0x90,0x10,0x90,0xa0,0x20,0xc0,0xc0,0x4c,0x1e,0x61,0x80,0x9e,0x37,0x21,0x10,0x1d,0x27,0xa0,0x98,0x47,0x20,0xc0,0x03,0x84,0x01,0xc0,
+0x01,0x42,0x80,0x40,0x40,0x83,0x20,0x42,0x40,0x40,0x80,0xc0,0x4c,0x3c,0xc3,0x00,0x3c,0x6e,0x43,0x21,0x3a,0x4f,0x41,0x30,0x8f,0x40,0xc0,0x01,0x41,0x01,0x01,0x84,0x02,0x41,0x01,0x01,0xc0,
+0x02,0x41,0x80,0x80,0x83,0x40,0x41,0x80,0x80,0xc0,0x4c,0x78,0x86,0x01,0x78,0xdc,0x86,0x42,0x74,0x9e,0x82,0x60,0x1f,0x80,0xc0,0x00,0x42,0x01,0x02,0x02,0x84,0x04,0x42,0x02,0x02,0x01,0xc0,
+0x04,0x83,0x80,0xc0,0x4b,0xf0,0x0c,0x02,0xf1,0xb9,0x0c,0x84,0xe8,0x3c,0x05,0xc1,0x3e,0xc0,0x00,0x4b,0x03,0x04,0x04,0x09,0x09,0x08,0x08,0x09,0x05,0x04,0x02,0x01,0xc0,
 // 'A'
- 65,14,11,12,0,0,39,8,20,0x01,0x00,0x00,0x01,0x00,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x05,0x80,0x00,0x04,0xc0,0x00,0x04,0xc0,0x00,0x0f,0xe0,0x00,0x08,0x60,0x00,0x10,0x60,0x00,0x10,0x30,0x00,0x3c,0xf8,0x00,0x00,0x00,0x00,
+12,2,11,8,12,2,
+0x01,0x46,0x80,0xf0,0x8c,0x9f,0xfc,0xe0,0x80,0xc0,0x43,0x08,0x0e,0x09,0x08,0x01,0x44,0x08,0x0b,0x0f,0x0c,0x08,0xc0,
+0x02,0x44,0xe0,0x18,0x3e,0xf8,0xc0,0xc0,0x4a,0x10,0x1c,0x13,0x11,0x01,0x01,0x11,0x17,0x1f,0x18,0x10,0xc0,
+0x02,0x44,0xc0,0x30,0x7c,0xf0,0x80,0xc0,0x4a,0x20,0x38,0x26,0x23,0x02,0x02,0x23,0x2f,0x3e,0x30,0x20,0xc0,
+0x02,0x43,0x80,0x60,0xf8,0xe0,0xc0,0x4a,0x40,0x70,0x4c,0x47,0x04,0x04,0x47,0x5f,0x7c,0x60,0x40,0xc0,
+0x03,0x42,0xc0,0xf0,0xc0,0xc0,0x4a,0x80,0xe0,0x98,0x8f,0x08,0x09,0x8f,0xbe,0xf8,0xc0,0x80,0xc0,
+0x03,0x42,0x80,0xe0,0x80,0xc0,0x00,0x48,0xc0,0x30,0x1e,0x11,0x13,0x1f,0x7c,0xf0,0x80,0xc0,0x83,0x01,0x01,0x84,0x01,0xc0,
+0x04,0x40,0xc0,0xc0,0x00,0x47,0x80,0x60,0x3c,0x23,0x27,0x3f,0xf8,0xe0,0xc0,0x43,0x02,0x03,0x02,0x02,0x01,0x44,0x02,0x02,0x03,0x03,0x02,0xc0,
+0x04,0x40,0x80,0xc0,0x01,0x46,0xc0,0x78,0x46,0x4f,0x7e,0xf0,0xc0,0xc0,0x43,0x04,0x07,0x04,0x04,0x01,0x44,0x04,0x05,0x07,0x06,0x04,0xc0,
 // 'B'
- 66,14,11,12,0,0,39,8,20,0x3f,0xe0,0x00,0x0c,0x70,0x00,0x0c,0x30,0x00,0x0c,0x30,0x00,0x0c,0x60,0x00,0x0f,0xf0,0x00,0x0c,0x38,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x30,0x00,0x3f,0xe0,0x00,0x00,0x00,0x00,
+12,2,11,8,12,0,
+0x01,0x01,0xff,0xff,0x21,0x21,0x21,0x33,0x7f,0xee,0xc0,0x08,0x08,0x0f,0x0f,0x08,0x08,0x08,0x08,0x0c,0x07,0x03,
+0x02,0x02,0xfe,0xfe,0x42,0x42,0x42,0x66,0xfe,0xdc,0x80,0x10,0x10,0x1f,0x1f,0x10,0x10,0x10,0x10,0x18,0x0f,0x07,
+0x04,0x04,0xfc,0xfc,0x84,0x84,0x84,0xcc,0xfc,0xb8,0x00,0x20,0x20,0x3f,0x3f,0x20,0x20,0x20,0x20,0x31,0x1f,0x0f,
+0x08,0x08,0xf8,0xf8,0x08,0x08,0x08,0x98,0xf8,0x70,0x00,0x40,0x40,0x7f,0x7f,0x41,0x41,0x41,0x41,0x63,0x3f,0x1e,
+0x10,0x10,0xf0,0xf0,0x10,0x10,0x10,0x30,0xf0,0xe0,0x00,0x80,0x80,0xff,0xff,0x82,0x82,0x82,0x83,0xc7,0x7e,0x3c,
+0x20,0x20,0xe0,0xe0,0x20,0x20,0x20,0x60,0xe0,0xc0,0x00,0x00,0x00,0xff,0xff,0x04,0x04,0x04,0x06,0x8f,0xfd,0x78,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,
+0x40,0x40,0xc0,0xc0,0x40,0x40,0x40,0xc0,0xc0,0x80,0x00,0x00,0x00,0xff,0xff,0x08,0x08,0x08,0x0c,0x1f,0xfb,0xf0,0x02,0x02,0x03,0x03,0x02,0x02,0x02,0x02,0x03,0x01,0x00,
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0xff,0xff,0x10,0x10,0x10,0x19,0x3f,0xf7,0xe0,0x04,0x04,0x07,0x07,0x04,0x04,0x04,0x04,0x06,0x03,0x01,
 // 'C'
- 67,15,10,12,1,0,39,8,20,0x03,0xe8,0x00,0x0e,0x18,0x00,0x0c,0x08,0x00,0x1c,0x08,0x00,0x18,0x08,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1c,0x08,0x00,0x0c,0x08,0x00,0x0e,0x10,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,
+12,3,10,8,12,0,
+0xf8,0xfe,0x0e,0x03,0x01,0x01,0x01,0x01,0x02,0x1f,0x01,0x07,0x07,0x0c,0x08,0x08,0x08,0x08,0x04,0x03,
+0xf0,0xfc,0x1c,0x06,0x02,0x02,0x02,0x02,0x04,0x3e,0x03,0x0f,0x0e,0x18,0x10,0x10,0x10,0x10,0x08,0x06,
+0xe0,0xf8,0x38,0x0c,0x04,0x04,0x04,0x04,0x08,0x7c,0x07,0x1f,0x1c,0x30,0x20,0x20,0x20,0x20,0x10,0x0c,
+0xc0,0xf0,0x70,0x18,0x08,0x08,0x08,0x08,0x10,0xf8,0x0f,0x3f,0x38,0x60,0x40,0x40,0x40,0x40,0x20,0x18,
+0x80,0xe0,0xe0,0x30,0x10,0x10,0x10,0x10,0x20,0xf0,0x1f,0x7f,0x70,0xc0,0x80,0x80,0x80,0x80,0x40,0x31,
+0x00,0xc0,0xc0,0x60,0x20,0x20,0x20,0x20,0x40,0xe0,0x3f,0xff,0xe1,0x80,0x00,0x00,0x00,0x00,0x80,0x63,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x00,0x00,
+0x00,0x80,0x80,0xc0,0x40,0x40,0x40,0x40,0x80,0xc0,0x7e,0xff,0xc3,0x00,0x00,0x00,0x00,0x00,0x00,0xc7,0x00,0x01,0x01,0x03,0x02,0x02,0x02,0x02,0x01,0x00,
+0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x80,0xfc,0xff,0x87,0x01,0x00,0x00,0x00,0x00,0x01,0x8f,0x00,0x03,0x03,0x06,0x04,0x04,0x04,0x04,0x02,0x01,
 // 'D'
- 68,15,12,12,0,0,39,8,20,0x3f,0xc0,0x00,0x0c,0x70,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x0c,0x00,0x0c,0x0c,0x00,0x0c,0x0c,0x00,0x0c,0x0c,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x70,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,
+13,2,12,8,12,0,
+0x01,0x01,0xff,0xff,0x01,0x01,0x01,0x03,0x02,0x0e,0xfc,0xf0,0x08,0x08,0x0f,0x0f,0x08,0x08,0x08,0x0c,0x04,0x07,0x03,0x00,
+0x02,0x02,0xfe,0xfe,0x02,0x02,0x02,0x06,0x04,0x1c,0xf8,0xe0,0x10,0x10,0x1f,0x1f,0x10,0x10,0x10,0x18,0x08,0x0e,0x07,0x01,
+0x04,0x04,0xfc,0xfc,0x04,0x04,0x04,0x0c,0x08,0x38,0xf0,0xc0,0x20,0x20,0x3f,0x3f,0x20,0x20,0x20,0x30,0x10,0x1c,0x0f,0x03,
+0x08,0x08,0xf8,0xf8,0x08,0x08,0x08,0x18,0x10,0x70,0xe0,0x80,0x40,0x40,0x7f,0x7f,0x40,0x40,0x40,0x60,0x20,0x38,0x1f,0x07,
+0x10,0x10,0xf0,0xf0,0x10,0x10,0x10,0x30,0x20,0xe0,0xc0,0x00,0x80,0x80,0xff,0xff,0x80,0x80,0x80,0xc0,0x40,0x70,0x3f,0x0f,
+0x20,0x20,0xe0,0xe0,0x20,0x20,0x20,0x60,0x40,0xc0,0x80,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x80,0x80,0xe1,0x7f,0x1e,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,
+0x40,0x40,0xc0,0xc0,0x40,0x40,0x40,0xc0,0x80,0x80,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0xc3,0xff,0x3c,0x02,0x02,0x03,0x03,0x02,0x02,0x02,0x03,0x01,0x01,0x00,0x00,
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x01,0x01,0x87,0xfe,0x78,0x04,0x04,0x07,0x07,0x04,0x04,0x04,0x06,0x02,0x03,0x01,0x00,
 // 'E'
- 69,14,10,12,0,0,39,8,20,0x3f,0xf0,0x00,0x0c,0x30,0x00,0x0c,0x10,0x00,0x0c,0x90,0x00,0x0c,0x80,0x00,0x0f,0x80,0x00,0x0d,0x80,0x00,0x0c,0x80,0x00,0x0c,0x90,0x00,0x0c,0x10,0x00,0x0c,0x30,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,
+12,2,10,8,12,0,
+0x01,0x01,0xff,0xff,0x21,0x61,0xf9,0x01,0x03,0x0f,0x08,0x08,0x0f,0x0f,0x08,0x08,0x09,0x08,0x0c,0x0f,
+0x02,0x02,0xfe,0xfe,0x42,0xc2,0xf2,0x02,0x06,0x1e,0x10,0x10,0x1f,0x1f,0x10,0x10,0x13,0x10,0x18,0x1e,
+0x04,0x04,0xfc,0xfc,0x84,0x84,0xe4,0x04,0x0c,0x3c,0x20,0x20,0x3f,0x3f,0x20,0x21,0x27,0x20,0x30,0x3c,
+0x08,0x08,0xf8,0xf8,0x08,0x08,0xc8,0x08,0x18,0x78,0x40,0x40,0x7f,0x7f,0x41,0x43,0x4f,0x40,0x60,0x78,
+0x10,0x10,0xf0,0xf0,0x10,0x10,0x90,0x10,0x30,0xf0,0x80,0x80,0xff,0xff,0x82,0x86,0x9f,0x80,0xc0,0xf0,
+0x20,0x20,0xe0,0xe0,0x20,0x20,0x20,0x20,0x60,0xe0,0x00,0x00,0xff,0xff,0x04,0x0c,0x3f,0x00,0x80,0xe1,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+0x40,0x40,0xc0,0xc0,0x40,0x40,0x40,0x40,0xc0,0xc0,0x00,0x00,0xff,0xff,0x08,0x18,0x7e,0x00,0x00,0xc3,0x02,0x02,0x03,0x03,0x02,0x02,0x02,0x02,0x03,0x03,
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0xff,0xff,0x10,0x30,0xfc,0x00,0x01,0x87,0x04,0x04,0x07,0x07,0x04,0x04,0x04,0x04,0x06,0x07,
 // 'F'
- 70,13,10,12,0,0,39,8,20,0x3f,0xf0,0x00,0x0c,0x30,0x00,0x0c,0x10,0x00,0x0c,0x90,0x00,0x0c,0x80,0x00,0x0f,0x80,0x00,0x0d,0x80,0x00,0x0c,0x80,0x00,0x0c,0x80,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,
+11,2,10,8,12,2,
+0x49,0x01,0x01,0xff,0xff,0x21,0x61,0xf9,0x01,0x03,0x0f,0xc0,0x46,0x08,0x08,0x0f,0x0f,0x08,0x08,0x01,0xc0,
+0x49,0x02,0x02,0xfe,0xfe,0x42,0xc2,0xf2,0x02,0x06,0x1e,0xc0,0x46,0x10,0x10,0x1f,0x1f,0x10,0x10,0x03,0xc0,
+0x49,0x04,0x04,0xfc,0xfc,0x84,0x84,0xe4,0x04,0x0c,0x3c,0xc0,0x46,0x20,0x20,0x3f,0x3f,0x20,0x21,0x07,0xc0,
+0x49,0x08,0x08,0xf8,0xf8,0x08,0x08,0xc8,0x08,0x18,0x78,0xc0,0x46,0x40,0x40,0x7f,0x7f,0x41,0x43,0x0f,0xc0,
+0x49,0x10,0x10,0xf0,0xf0,0x10,0x10,0x90,0x10,0x30,0xf0,0xc0,0x46,0x80,0x80,0xff,0xff,0x82,0x86,0x1f,0xc0,
+0x43,0x20,0x20,0xe0,0xe0,0x83,0x20,0x41,0x60,0xe0,0xc0,0x01,0x44,0xff,0xff,0x04,0x0c,0x3f,0x01,0x40,0x01,0xc0,0x85,0x01,0xc0,
+0x43,0x40,0x40,0xc0,0xc0,0x83,0x40,0x41,0xc0,0xc0,0xc0,0x01,0x44,0xff,0xff,0x08,0x18,0x7e,0x01,0x40,0x03,0xc0,0x45,0x02,0x02,0x03,0x03,0x02,0x02,0xc0,
+0x89,0x80,0xc0,0x01,0x47,0xff,0xff,0x10,0x30,0xfc,0x00,0x01,0x07,0xc0,0x45,0x04,0x04,0x07,0x07,0x04,0x04,0xc0,
 // 'G'
- 71,16,11,12,1,0,39,8,20,0x03,0xe8,0x00,0x0e,0x18,0x00,0x0c,0x08,0x00,0x1c,0x08,0x00,0x18,0x08,0x00,0x18,0x00,0x00,0x18,0x7c,0x00,0x18,0x18,0x00,0x1c,0x18,0x00,0x0c,0x18,0x00,0x0e,0x38,0x00,0x03,0xc8,0x00,0x00,0x00,0x00,
+13,3,11,8,12,0,
+0xf8,0xfe,0x0e,0x03,0x01,0x01,0x41,0x41,0xc2,0xdf,0x40,0x01,0x07,0x07,0x0c,0x08,0x08,0x08,0x04,0x07,0x0f,0x00,
+0xf0,0xfc,0x1c,0x06,0x02,0x02,0x82,0x82,0x84,0xbe,0x80,0x03,0x0f,0x0e,0x18,0x10,0x10,0x10,0x08,0x0f,0x1f,0x00,
+0xe0,0xf8,0x38,0x0c,0x04,0x04,0x04,0x04,0x08,0x7c,0x00,0x07,0x1f,0x1c,0x30,0x20,0x20,0x21,0x11,0x1f,0x3f,0x01,
+0xc0,0xf0,0x70,0x18,0x08,0x08,0x08,0x08,0x10,0xf8,0x00,0x0f,0x3f,0x38,0x60,0x40,0x40,0x42,0x22,0x3e,0x7e,0x02,
+0x80,0xe0,0xe0,0x30,0x10,0x10,0x10,0x10,0x20,0xf0,0x00,0x1f,0x7f,0x70,0xc0,0x80,0x80,0x84,0x44,0x7c,0xfd,0x04,
+0x00,0xc0,0xc0,0x60,0x20,0x20,0x20,0x20,0x40,0xe0,0x00,0x3f,0xff,0xe1,0x80,0x00,0x00,0x08,0x88,0xf8,0xfb,0x08,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x01,0x00,
+0x00,0x80,0x80,0xc0,0x40,0x40,0x40,0x40,0x80,0xc0,0x00,0x7e,0xff,0xc3,0x00,0x00,0x00,0x10,0x10,0xf0,0xf7,0x10,0x00,0x01,0x01,0x03,0x02,0x02,0x02,0x01,0x01,0x03,0x00,
+0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x80,0x00,0xfc,0xff,0x87,0x01,0x00,0x00,0x20,0x20,0xe1,0xef,0x20,0x00,0x03,0x03,0x06,0x04,0x04,0x04,0x02,0x03,0x07,0x00,
 // 'H'
- 72,16,13,12,0,0,39,8,20,0x3f,0x7e,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0f,0xf8,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x3f,0x7e,0x00,0x00,0x00,0x00,
+14,2,13,8,12,0,
+0x01,0x01,0xff,0xff,0x21,0x21,0x20,0x21,0x21,0xff,0xff,0x01,0x01,0x08,0x08,0x0f,0x0f,0x08,0x08,0x00,0x08,0x08,0x0f,0x0f,0x08,0x08,
+0x02,0x02,0xfe,0xfe,0x42,0x42,0x40,0x42,0x42,0xfe,0xfe,0x02,0x02,0x10,0x10,0x1f,0x1f,0x10,0x10,0x00,0x10,0x10,0x1f,0x1f,0x10,0x10,
+0x04,0x04,0xfc,0xfc,0x84,0x84,0x80,0x84,0x84,0xfc,0xfc,0x04,0x04,0x20,0x20,0x3f,0x3f,0x20,0x20,0x00,0x20,0x20,0x3f,0x3f,0x20,0x20,
+0x08,0x08,0xf8,0xf8,0x08,0x08,0x00,0x08,0x08,0xf8,0xf8,0x08,0x08,0x40,0x40,0x7f,0x7f,0x41,0x41,0x01,0x41,0x41,0x7f,0x7f,0x40,0x40,
+0x10,0x10,0xf0,0xf0,0x10,0x10,0x00,0x10,0x10,0xf0,0xf0,0x10,0x10,0x80,0x80,0xff,0xff,0x82,0x82,0x02,0x82,0x82,0xff,0xff,0x80,0x80,
+0x20,0x20,0xe0,0xe0,0x20,0x20,0x00,0x20,0x20,0xe0,0xe0,0x20,0x20,0x00,0x00,0xff,0xff,0x04,0x04,0x04,0x04,0x04,0xff,0xff,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x01,0x01,0x01,
+0x40,0x40,0xc0,0xc0,0x40,0x40,0x00,0x40,0x40,0xc0,0xc0,0x40,0x40,0x00,0x00,0xff,0xff,0x08,0x08,0x08,0x08,0x08,0xff,0xff,0x00,0x00,0x02,0x02,0x03,0x03,0x02,0x02,0x00,0x02,0x02,0x03,0x03,0x02,0x02,
+0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0xff,0xff,0x10,0x10,0x10,0x10,0x10,0xff,0xff,0x00,0x00,0x04,0x04,0x07,0x07,0x04,0x04,0x00,0x04,0x04,0x07,0x07,0x04,0x04,
 // 'I'
- 73,9,6,12,0,0,39,8,20,0x3f,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,
+7,2,6,8,12,0,
+0x01,0x01,0xff,0xff,0x01,0x01,0x08,0x08,0x0f,0x0f,0x08,0x08,
+0x02,0x02,0xfe,0xfe,0x02,0x02,0x10,0x10,0x1f,0x1f,0x10,0x10,
+0x04,0x04,0xfc,0xfc,0x04,0x04,0x20,0x20,0x3f,0x3f,0x20,0x20,
+0x08,0x08,0xf8,0xf8,0x08,0x08,0x40,0x40,0x7f,0x7f,0x40,0x40,
+0x10,0x10,0xf0,0xf0,0x10,0x10,0x80,0x80,0xff,0xff,0x80,0x80,
+0x20,0x20,0xe0,0xe0,0x20,0x20,0x00,0x00,0xff,0xff,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,
+0x40,0x40,0xc0,0xc0,0x40,0x40,0x00,0x00,0xff,0xff,0x00,0x00,0x02,0x02,0x03,0x03,0x02,0x02,
+0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0xff,0xff,0x00,0x00,0x04,0x04,0x07,0x07,0x04,0x04,
 // 'J'
- 74,11,9,12,0,0,39,8,20,0x07,0xe0,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x11,0x80,0x00,0x39,0x80,0x00,0x31,0x80,0x00,0x21,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,
+9,2,9,8,12,2,
+0x00,0x47,0x80,0x00,0x01,0x01,0xff,0xff,0x01,0x01,0xc0,0x46,0x07,0x0b,0x09,0x08,0x08,0x07,0x03,0xc0,
+0x02,0x45,0x02,0x02,0xfe,0xfe,0x02,0x02,0xc0,0x46,0x0e,0x17,0x12,0x10,0x10,0x0f,0x07,0xc0,
+0x02,0x45,0x04,0x04,0xfc,0xfc,0x04,0x04,0xc0,0x46,0x1c,0x2e,0x24,0x20,0x20,0x1f,0x0f,0xc0,
+0x02,0x45,0x08,0x08,0xf8,0xf8,0x08,0x08,0xc0,0x46,0x38,0x5c,0x48,0x40,0x40,0x3f,0x1f,0xc0,
+0x02,0x45,0x10,0x10,0xf0,0xf0,0x10,0x10,0xc0,0x46,0x70,0xb8,0x90,0x80,0x80,0x7f,0x3f,0xc0,
+0x02,0x45,0x20,0x20,0xe0,0xe0,0x20,0x20,0xc0,0x42,0xe0,0x70,0x20,0x01,0x41,0xff,0x7f,0xc0,0x00,0x83,0x01,0xc0,
+0x02,0x45,0x40,0x40,0xc0,0xc0,0x40,0x40,0xc0,0x42,0xc0,0xe0,0x40,0x01,0x41,0xff,0xff,0xc0,0x40,0x01,0x83,0x02,0x40,0x01,0xc0,
+0x02,0x85,0x80,0xc0,0x42,0x80,0xc0,0x80,0x01,0x41,0xff,0xff,0xc0,0x41,0x03,0x05,0x82,0x04,0x41,0x03,0x01,0xc0,
 // 'K'
- 75,15,12,12,0,0,39,8,20,0x3f,0x7c,0x00,0x0c,0x30,0x00,0x0c,0x20,0x00,0x0c,0x40,0x00,0x0c,0x80,0x00,0x0d,0x80,0x00,0x0e,0xc0,0x00,0x0c,0xe0,0x00,0x0c,0x60,0x00,0x0c,0x30,0x00,0x0c,0x38,0x00,0x3f,0x7c,0x00,0x00,0x00,0x00,
+13,2,12,8,12,0,
+0x01,0x01,0xff,0xff,0x41,0x21,0xf0,0xc9,0x87,0x03,0x01,0x01,0x08,0x08,0x0f,0x0f,0x08,0x08,0x00,0x09,0x0f,0x0e,0x0c,0x08,
+0x02,0x02,0xfe,0xfe,0x82,0x42,0xe0,0x92,0x0e,0x06,0x02,0x02,0x10,0x10,0x1f,0x1f,0x10,0x10,0x01,0x13,0x1f,0x1c,0x18,0x10,
+0x04,0x04,0xfc,0xfc,0x04,0x84,0xc0,0x24,0x1c,0x0c,0x04,0x04,0x20,0x20,0x3f,0x3f,0x21,0x20,0x03,0x27,0x3e,0x38,0x30,0x20,
+0x08,0x08,0xf8,0xf8,0x08,0x08,0x80,0x48,0x38,0x18,0x08,0x08,0x40,0x40,0x7f,0x7f,0x42,0x41,0x07,0x4e,0x7c,0x70,0x60,0x40,
+0x10,0x10,0xf0,0xf0,0x10,0x10,0x00,0x90,0x70,0x30,0x10,0x10,0x80,0x80,0xff,0xff,0x84,0x82,0x0f,0x9c,0xf8,0xe0,0xc0,0x80,
+0x20,0x20,0xe0,0xe0,0x20,0x20,0x00,0x20,0xe0,0x60,0x20,0x20,0x00,0x00,0xff,0xff,0x08,0x04,0x1e,0x39,0xf0,0xc0,0x80,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x01,0x01,
+0x40,0x40,0xc0,0xc0,0x40,0x40,0x00,0x40,0xc0,0xc0,0x40,0x40,0x00,0x00,0xff,0xff,0x10,0x08,0x3c,0x72,0xe1,0x80,0x00,0x00,0x02,0x02,0x03,0x03,0x02,0x02,0x00,0x02,0x03,0x03,0x03,0x02,
+0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0xff,0xff,0x20,0x10,0x78,0xe4,0xc3,0x01,0x00,0x00,0x04,0x04,0x07,0x07,0x04,0x04,0x00,0x04,0x07,0x07,0x06,0x04,
 // 'L'
- 76,13,10,12,0,0,39,8,20,0x3f,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x10,0x00,0x0c,0x10,0x00,0x0c,0x10,0x00,0x0c,0x30,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,
+11,2,10,8,12,2,
+0x45,0x01,0x01,0xff,0xff,0x01,0x01,0x02,0x40,0x80,0xc0,0x43,0x08,0x08,0x0f,0x0f,0x83,0x08,0x41,0x0c,0x0f,0xc0,
+0x45,0x02,0x02,0xfe,0xfe,0x02,0x02,0xc0,0x43,0x10,0x10,0x1f,0x1f,0x83,0x10,0x41,0x18,0x1f,0xc0,
+0x45,0x04,0x04,0xfc,0xfc,0x04,0x04,0xc0,0x43,0x20,0x20,0x3f,0x3f,0x83,0x20,0x41,0x30,0x3e,0xc0,
+0x45,0x08,0x08,0xf8,0xf8,0x08,0x08,0xc0,0x43,0x40,0x40,0x7f,0x7f,0x83,0x40,0x41,0x60,0x7c,0xc0,
+0x45,0x10,0x10,0xf0,0xf0,0x10,0x10,0xc0,0x43,0x80,0x80,0xff,0xff,0x83,0x80,0x41,0xc0,0xf8,0xc0,
+0x45,0x20,0x20,0xe0,0xe0,0x20,0x20,0xc0,0x01,0x41,0xff,0xff,0x03,0x41,0x80,0xf0,0xc0,0x89,0x01,0xc0,
+0x45,0x40,0x40,0xc0,0xc0,0x40,0x40,0xc0,0x01,0x41,0xff,0xff,0x04,0x40,0xe0,0xc0,0x43,0x02,0x02,0x03,0x03,0x83,0x02,0x41,0x03,0x03,0xc0,
+0x85,0x80,0xc0,0x01,0x41,0xff,0xff,0x04,0x40,0xc0,0xc0,0x43,0x04,0x04,0x07,0x07,0x83,0x04,0x41,0x06,0x07,0xc0,
 // 'M'
- 77,18,15,12,0,0,39,8,20,0x3e,0x0f,0x80,0x0e,0x0e,0x00,0x0e,0x0e,0x00,0x0b,0x16,0x00,0x0b,0x16,0x00,0x0b,0x96,0x00,0x09,0xa6,0x00,0x09,0xa6,0x00,0x08,0xe6,0x00,0x08,0xc6,0x00,0x08,0xc6,0x00,0x3e,0x4f,0x80,0x00,0x00,0x00,
+16,2,15,8,12,2,
+0x4e,0x01,0x01,0xff,0x07,0x3f,0xf8,0xe0,0x00,0xc0,0x38,0x07,0xff,0xff,0x01,0x01,0xc0,0x4e,0x08,0x08,0x0f,0x08,0x08,0x00,0x07,0x0f,0x01,0x00,0x08,0x0f,0x0f,0x08,0x08,0xc0,
+0x4e,0x02,0x02,0xfe,0x0e,0x7e,0xf0,0xc0,0x00,0x80,0x70,0x0e,0xfe,0xfe,0x02,0x02,0xc0,0x4e,0x10,0x10,0x1f,0x10,0x10,0x01,0x0f,0x1e,0x03,0x00,0x10,0x1f,0x1f,0x10,0x10,0xc0,
+0x46,0x04,0x04,0xfc,0x1c,0xfc,0xe0,0x80,0x01,0x45,0xe0,0x1c,0xfc,0xfc,0x04,0x04,0xc0,0x4e,0x20,0x20,0x3f,0x20,0x20,0x03,0x1f,0x3c,0x07,0x00,0x20,0x3f,0x3f,0x20,0x20,0xc0,
+0x45,0x08,0x08,0xf8,0x38,0xf8,0xc0,0x02,0x45,0xc0,0x38,0xf8,0xf8,0x08,0x08,0xc0,0x4e,0x40,0x40,0x7f,0x40,0x41,0x07,0x3f,0x78,0x0e,0x01,0x40,0x7f,0x7f,0x40,0x40,0xc0,
+0x45,0x10,0x10,0xf0,0x70,0xf0,0x80,0x02,0x45,0x80,0x70,0xf0,0xf0,0x10,0x10,0xc0,0x4e,0x80,0x80,0xff,0x80,0x83,0x0f,0x7e,0xf0,0x1c,0x03,0x80,0xff,0xff,0x80,0x80,0xc0,
+0x41,0x20,0x20,0x82,0xe0,0x04,0x82,0xe0,0x41,0x20,0x20,0xc0,0x01,0x4a,0xff,0x00,0x07,0x1f,0xfc,0xe0,0x38,0x07,0x00,0xff,0xff,0xc0,0x84,0x01,0x01,0x40,0x01,0x01,0x84,0x01,0xc0,
+0x41,0x40,0x40,0x82,0xc0,0x04,0x82,0xc0,0x41,0x40,0x40,0xc0,0x01,0x4a,0xff,0x01,0x0f,0x3e,0xf8,0xc0,0x70,0x0e,0x01,0xff,0xff,0xc0,0x47,0x02,0x02,0x03,0x02,0x02,0x00,0x01,0x03,0x01,0x44,0x02,0x03,0x03,0x02,0x02,0xc0,
+0x84,0x80,0x04,0x84,0x80,0xc0,0x01,0x4a,0xff,0x03,0x1f,0x7c,0xf0,0x80,0xe0,0x1c,0x03,0xff,0xff,0xc0,0x47,0x04,0x04,0x07,0x04,0x04,0x00,0x03,0x07,0x01,0x44,0x04,0x07,0x07,0x04,0x04,0xc0,
 // 'N'
- 78,15,13,12,0,0,39,8,20,0x3c,0x3e,0x00,0x0e,0x08,0x00,0x0f,0x08,0x00,0x0b,0x08,0x00,0x0b,0x88,0x00,0x09,0xc8,0x00,0x08,0xe8,0x00,0x08,0x68,0x00,0x08,0x38,0x00,0x08,0x38,0x00,0x08,0x18,0x00,0x3e,0x08,0x00,0x00,0x00,0x00,
+13,2,13,8,12,2,
+0x4c,0x01,0x01,0xff,0x07,0x1e,0x3c,0x70,0xe0,0xc1,0x01,0xff,0x01,0x01,0xc0,0x44,0x08,0x08,0x0f,0x08,0x08,0x02,0x42,0x03,0x07,0x0f,0xc0,
+0x4c,0x02,0x02,0xfe,0x0e,0x3c,0x78,0xe0,0xc0,0x82,0x02,0xfe,0x02,0x02,0xc0,0x44,0x10,0x10,0x1f,0x10,0x10,0x01,0x43,0x01,0x07,0x0e,0x1f,0xc0,
+0x4c,0x04,0x04,0xfc,0x1c,0x78,0xf0,0xc0,0x80,0x04,0x04,0xfc,0x04,0x04,0xc0,0x4a,0x20,0x20,0x3f,0x20,0x20,0x00,0x01,0x03,0x0f,0x1c,0x3f,0xc0,
+0x4c,0x08,0x08,0xf8,0x38,0xf0,0xe0,0x80,0x00,0x08,0x08,0xf8,0x08,0x08,0xc0,0x4a,0x40,0x40,0x7f,0x40,0x40,0x01,0x03,0x07,0x1e,0x38,0x7f,0xc0,
+0x45,0x10,0x10,0xf0,0x70,0xe0,0xc0,0x01,0x44,0x10,0x10,0xf0,0x10,0x10,0xc0,0x4a,0x80,0x80,0xff,0x80,0x81,0x03,0x07,0x0e,0x3c,0x70,0xff,0xc0,
+0x45,0x20,0x20,0xe0,0xe0,0xc0,0x80,0x01,0x44,0x20,0x20,0xe0,0x20,0x20,0xc0,0x01,0x48,0xff,0x00,0x03,0x07,0x0e,0x1c,0x78,0xe0,0xff,0xc0,0x84,0x01,0x04,0x40,0x01,0xc0,
+0x44,0x40,0x40,0xc0,0xc0,0x80,0x02,0x44,0x40,0x40,0xc0,0x40,0x40,0xc0,0x01,0x48,0xff,0x01,0x07,0x0f,0x1c,0x38,0xf0,0xc0,0xff,0xc0,0x44,0x02,0x02,0x03,0x02,0x02,0x03,0x41,0x01,0x03,0xc0,
+0x83,0x80,0x03,0x84,0x80,0xc0,0x01,0x48,0xff,0x03,0x0f,0x1e,0x38,0x70,0xe0,0x80,0xff,0xc0,0x44,0x04,0x04,0x07,0x04,0x04,0x02,0x42,0x01,0x03,0x07,0xc0,
 // 'O'
- 79,16,11,12,1,0,39,8,20,0x01,0xc0,0x00,0x06,0x30,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x06,0x30,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,
+13,3,11,8,12,0,
+0xf0,0xfc,0x0e,0x02,0x01,0x01,0x01,0x02,0x0e,0xfc,0xf0,0x00,0x03,0x07,0x04,0x08,0x08,0x08,0x04,0x07,0x03,0x00,
+0xe0,0xf8,0x1c,0x04,0x02,0x02,0x02,0x04,0x1c,0xf8,0xe0,0x01,0x07,0x0e,0x08,0x10,0x10,0x10,0x08,0x0e,0x07,0x01,
+0xc0,0xf0,0x38,0x08,0x04,0x04,0x04,0x08,0x38,0xf0,0xc0,0x03,0x0f,0x1c,0x10,0x20,0x20,0x20,0x10,0x1c,0x0f,0x03,
+0x80,0xe0,0x70,0x10,0x08,0x08,0x08,0x10,0x70,0xe0,0x80,0x07,0x1f,0x38,0x20,0x40,0x40,0x40,0x20,0x38,0x1f,0x07,
+0x00,0xc0,0xe0,0x20,0x10,0x10,0x10,0x20,0xe0,0xc0,0x00,0x0f,0x3f,0x70,0x40,0x80,0x80,0x80,0x40,0x70,0x3f,0x0f,
+0x00,0x80,0xc0,0x40,0x20,0x20,0x20,0x40,0xc0,0x80,0x00,0x1e,0x7f,0xe1,0x80,0x00,0x00,0x00,0x80,0xe1,0x7f,0x1e,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x80,0x80,0x40,0x40,0x40,0x80,0x80,0x00,0x00,0x3c,0xff,0xc3,0x00,0x00,0x00,0x00,0x00,0xc3,0xff,0x3c,0x00,0x00,0x01,0x01,0x02,0x02,0x02,0x01,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x78,0xfe,0x87,0x01,0x00,0x00,0x00,0x01,0x87,0xfe,0x78,0x00,0x01,0x03,0x02,0x04,0x04,0x04,0x02,0x03,0x01,0x00,
 // 'P'
- 80,13,11,12,0,0,39,8,20,0x3f,0xe0,0x00,0x0c,0x30,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x30,0x00,0x0f,0xe0,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,
+11,2,11,8,12,2,
+0x43,0x01,0x01,0xff,0xff,0x83,0x41,0x42,0x63,0x3e,0x1c,0xc0,0x45,0x08,0x08,0x0f,0x0f,0x08,0x08,0xc0,
+0x43,0x02,0x02,0xfe,0xfe,0x83,0x82,0x42,0xc6,0x7c,0x38,0xc0,0x45,0x10,0x10,0x1f,0x1f,0x10,0x10,0xc0,
+0x43,0x04,0x04,0xfc,0xfc,0x83,0x04,0x42,0x8c,0xf8,0x70,0xc0,0x45,0x20,0x20,0x3f,0x3f,0x21,0x21,0x82,0x01,0xc0,
+0x43,0x08,0x08,0xf8,0xf8,0x83,0x08,0x42,0x18,0xf0,0xe0,0xc0,0x49,0x40,0x40,0x7f,0x7f,0x42,0x42,0x02,0x02,0x03,0x01,0xc0,
+0x43,0x10,0x10,0xf0,0xf0,0x83,0x10,0x42,0x30,0xe0,0xc0,0xc0,0x4a,0x80,0x80,0xff,0xff,0x84,0x84,0x04,0x04,0x06,0x03,0x01,0xc0,
+0x43,0x20,0x20,0xe0,0xe0,0x83,0x20,0x42,0x60,0xc0,0x80,0xc0,0x01,0x41,0xff,0xff,0x83,0x08,0x42,0x0c,0x07,0x03,0xc0,0x85,0x01,0xc0,
+0x43,0x40,0x40,0xc0,0xc0,0x83,0x40,0x41,0xc0,0x80,0xc0,0x01,0x41,0xff,0xff,0x83,0x10,0x42,0x18,0x0f,0x07,0xc0,0x45,0x02,0x02,0x03,0x03,0x02,0x02,0xc0,
+0x88,0x80,0xc0,0x01,0x41,0xff,0xff,0x83,0x20,0x42,0x31,0x1f,0x0e,0xc0,0x45,0x04,0x04,0x07,0x07,0x04,0x04,0xc0,
 // 'Q'
- 81,16,11,15,1,-3,48,8,23,0x01,0xc0,0x00,0x06,0x30,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x19,0x8c,0x00,0x0a,0x48,0x00,0x0e,0x78,0x00,0x06,0x70,0x00,0x01,0xe0,0x00,0x00,0x68,0x00,0x00,0x68,0x00,0x00,0x30,0x00,0x00,0x00,0x00,
+13,3,11,8,15,0,
+0xf0,0xfc,0x0e,0x02,0x81,0x81,0x01,0x02,0x0e,0xfc,0xf0,0x00,0x03,0x06,0x07,0x08,0x08,0x3f,0x7e,0x46,0x33,0x00,
+0xe0,0xf8,0x1c,0x04,0x02,0x02,0x02,0x04,0x1c,0xf8,0xe0,0x01,0x07,0x0c,0x0e,0x11,0x11,0x7e,0xfc,0x8c,0x67,0x01,
+0xc0,0xf0,0x38,0x08,0x04,0x04,0x04,0x08,0x38,0xf0,0xc0,0x03,0x0f,0x18,0x1c,0x22,0x22,0xfc,0xf8,0x18,0xcf,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,
+0x80,0xe0,0x70,0x10,0x08,0x08,0x08,0x10,0x70,0xe0,0x80,0x07,0x1f,0x30,0x38,0x44,0x44,0xf8,0xf0,0x30,0x9f,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x02,0x01,0x00,
+0x00,0xc0,0xe0,0x20,0x10,0x10,0x10,0x20,0xe0,0xc0,0x00,0x0f,0x3f,0x60,0x70,0x88,0x88,0xf0,0xe0,0x60,0x3f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x07,0x04,0x03,0x00,
+0x00,0x80,0xc0,0x40,0x20,0x20,0x20,0x40,0xc0,0x80,0x00,0x1e,0x7f,0xc1,0xe0,0x10,0x10,0xe0,0xc0,0xc1,0x7f,0x1e,0x00,0x00,0x00,0x00,0x01,0x01,0x07,0x0f,0x08,0x06,0x00,
+0x00,0x00,0x80,0x80,0x40,0x40,0x40,0x80,0x80,0x00,0x00,0x3c,0xff,0x83,0xc0,0x20,0x20,0xc0,0x80,0x83,0xff,0x3c,0x00,0x00,0x01,0x01,0x02,0x02,0x0f,0x1f,0x11,0x0c,0x00,
+0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x78,0xfe,0x07,0x81,0x40,0x40,0x80,0x01,0x07,0xfe,0x78,0x00,0x01,0x03,0x03,0x04,0x04,0x1f,0x3f,0x23,0x19,0x00,
 // 'R'
- 82,14,12,12,0,0,39,8,20,0x3f,0xc0,0x00,0x0c,0x30,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x30,0x00,0x0f,0xc0,0x00,0x0c,0xe0,0x00,0x0c,0x30,0x00,0x0c,0x30,0x00,0x0c,0x34,0x00,0x0c,0x34,0x00,0x3f,0x18,0x00,0x00,0x00,0x00,
+12,2,12,8,12,0,
+0x01,0x01,0xff,0xff,0x21,0x21,0x61,0x61,0xd2,0x9e,0x0c,0x00,0x08,0x08,0x0f,0x0f,0x08,0x08,0x00,0x00,0x07,0x0f,0x08,0x06,
+0x02,0x02,0xfe,0xfe,0x42,0x42,0xc2,0xc2,0xa4,0x3c,0x18,0x00,0x10,0x10,0x1f,0x1f,0x10,0x10,0x00,0x00,0x0f,0x1f,0x10,0x0c,
+0x04,0x04,0xfc,0xfc,0x84,0x84,0x84,0x84,0x48,0x78,0x30,0x00,0x20,0x20,0x3f,0x3f,0x20,0x20,0x01,0x01,0x1f,0x3e,0x20,0x18,
+0x08,0x08,0xf8,0xf8,0x08,0x08,0x08,0x08,0x90,0xf0,0x60,0x00,0x40,0x40,0x7f,0x7f,0x41,0x41,0x03,0x03,0x3e,0x7c,0x40,0x30,
+0x10,0x10,0xf0,0xf0,0x10,0x10,0x10,0x10,0x20,0xe0,0xc0,0x00,0x80,0x80,0xff,0xff,0x82,0x82,0x06,0x06,0x7d,0xf9,0x80,0x60,
+0x20,0x20,0xe0,0xe0,0x20,0x20,0x20,0x20,0x40,0xc0,0x80,0x00,0x00,0x00,0xff,0xff,0x04,0x04,0x0c,0x0c,0xfa,0xf3,0x01,0xc0,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x01,0x01,0x00,
+0x40,0x40,0xc0,0xc0,0x40,0x40,0x40,0x40,0x80,0x80,0x00,0x00,0x00,0x00,0xff,0xff,0x08,0x08,0x18,0x18,0xf4,0xe7,0x03,0x80,0x02,0x02,0x03,0x03,0x02,0x02,0x00,0x00,0x01,0x03,0x02,0x01,
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x10,0x10,0x30,0x30,0xe9,0xcf,0x06,0x00,0x04,0x04,0x07,0x07,0x04,0x04,0x00,0x00,0x03,0x07,0x04,0x03,
 // 'S'
- 83,13,8,12,1,0,39,8,20,0x07,0xa0,0x00,0x0c,0x60,0x00,0x18,0x20,0x00,0x18,0x20,0x00,0x1c,0x00,0x00,0x0f,0x80,0x00,0x07,0xc0,0x00,0x10,0xe0,0x00,0x10,0x60,0x00,0x10,0x60,0x00,0x18,0xc0,0x00,0x17,0x80,0x00,0x00,0x00,0x00,
+10,3,8,8,12,0,
+0x9c,0x3e,0x73,0x61,0x61,0xe1,0xc2,0x8f,0x0f,0x04,0x08,0x08,0x08,0x0c,0x07,0x03,
+0x38,0x7c,0xe6,0xc2,0xc2,0xc2,0x84,0x1e,0x1f,0x08,0x10,0x10,0x10,0x19,0x0f,0x07,
+0x70,0xf8,0xcc,0x84,0x84,0x84,0x08,0x3c,0x3e,0x10,0x21,0x21,0x21,0x33,0x1f,0x0e,
+0xe0,0xf0,0x98,0x08,0x08,0x08,0x10,0x78,0x7c,0x21,0x43,0x43,0x43,0x67,0x3e,0x1c,
+0xc0,0xe0,0x30,0x10,0x10,0x10,0x20,0xf0,0xf9,0x43,0x87,0x86,0x86,0xce,0x7c,0x38,
+0x80,0xc0,0x60,0x20,0x20,0x20,0x40,0xe0,0xf3,0x87,0x0e,0x0c,0x0c,0x9c,0xf8,0x71,0x01,0x00,0x01,0x01,0x01,0x01,0x00,0x00,
+0x00,0x80,0xc0,0x40,0x40,0x40,0x80,0xc0,0xe7,0x0f,0x1c,0x18,0x18,0x38,0xf0,0xe3,0x03,0x01,0x02,0x02,0x02,0x03,0x01,0x00,
+0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x80,0xce,0x1f,0x39,0x30,0x30,0x70,0xe1,0xc7,0x07,0x02,0x04,0x04,0x04,0x06,0x03,0x01,
 // 'T'
- 84,13,10,12,0,0,39,8,20,0x3f,0xf0,0x00,0x33,0x30,0x00,0x23,0x10,0x00,0x23,0x10,0x00,0x23,0x10,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,
+11,2,10,8,12,2,
+0x49,0x1f,0x03,0x01,0x01,0xff,0xff,0x01,0x01,0x03,0x1f,0xc0,0x01,0x45,0x08,0x08,0x0f,0x0f,0x08,0x08,0xc0,
+0x49,0x3e,0x06,0x02,0x02,0xfe,0xfe,0x02,0x02,0x06,0x3e,0xc0,0x01,0x45,0x10,0x10,0x1f,0x1f,0x10,0x10,0xc0,
+0x49,0x7c,0x0c,0x04,0x04,0xfc,0xfc,0x04,0x04,0x0c,0x7c,0xc0,0x01,0x45,0x20,0x20,0x3f,0x3f,0x20,0x20,0xc0,
+0x49,0xf8,0x18,0x08,0x08,0xf8,0xf8,0x08,0x08,0x18,0xf8,0xc0,0x01,0x45,0x40,0x40,0x7f,0x7f,0x40,0x40,0xc0,
+0x49,0xf0,0x30,0x10,0x10,0xf0,0xf0,0x10,0x10,0x30,0xf0,0xc0,0x49,0x01,0x00,0x80,0x80,0xff,0xff,0x80,0x80,0x00,0x01,0xc0,
+0x49,0xe0,0x60,0x20,0x20,0xe0,0xe0,0x20,0x20,0x60,0xe0,0xc0,0x40,0x03,0x02,0x41,0xff,0xff,0x02,0x40,0x03,0xc0,0x01,0x85,0x01,0xc0,
+0x49,0xc0,0xc0,0x40,0x40,0xc0,0xc0,0x40,0x40,0xc0,0xc0,0xc0,0x40,0x07,0x02,0x41,0xff,0xff,0x02,0x40,0x07,0xc0,0x01,0x45,0x02,0x02,0x03,0x03,0x02,0x02,0xc0,
+0x89,0x80,0xc0,0x41,0x0f,0x01,0x01,0x41,0xff,0xff,0x01,0x41,0x01,0x0f,0xc0,0x01,0x45,0x04,0x04,0x07,0x07,0x04,0x04,0xc0,
 // 'U'
- 85,15,13,12,0,0,39,8,20,0x3f,0x3e,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x06,0x10,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,
+13,2,13,8,12,2,
+0x45,0x01,0x01,0xff,0xff,0x01,0x01,0x01,0x44,0x01,0x01,0xff,0x01,0x01,0xc0,0x01,0x42,0x03,0x07,0x0c,0x83,0x08,0x41,0x04,0x03,0xc0,
+0x45,0x02,0x02,0xfe,0xfe,0x02,0x02,0x01,0x44,0x02,0x02,0xfe,0x02,0x02,0xc0,0x01,0x42,0x07,0x0f,0x18,0x83,0x10,0x41,0x08,0x07,0xc0,
+0x45,0x04,0x04,0xfc,0xfc,0x04,0x04,0x01,0x44,0x04,0x04,0xfc,0x04,0x04,0xc0,0x01,0x42,0x0f,0x1f,0x30,0x83,0x20,0x41,0x10,0x0f,0xc0,
+0x45,0x08,0x08,0xf8,0xf8,0x08,0x08,0x01,0x44,0x08,0x08,0xf8,0x08,0x08,0xc0,0x01,0x42,0x1f,0x3f,0x60,0x83,0x40,0x41,0x20,0x1f,0xc0,
+0x45,0x10,0x10,0xf0,0xf0,0x10,0x10,0x01,0x44,0x10,0x10,0xf0,0x10,0x10,0xc0,0x01,0x42,0x3f,0x7f,0xc0,0x83,0x80,0x41,0x40,0x3f,0xc0,
+0x45,0x20,0x20,0xe0,0xe0,0x20,0x20,0x01,0x44,0x20,0x20,0xe0,0x20,0x20,0xc0,0x01,0x42,0x7f,0xff,0x80,0x03,0x41,0x80,0x7f,0xc0,0x03,0x84,0x01,0xc0,
+0x45,0x40,0x40,0xc0,0xc0,0x40,0x40,0x01,0x44,0x40,0x40,0xc0,0x40,0x40,0xc0,0x01,0x41,0xff,0xff,0x05,0x40,0xff,0xc0,0x02,0x41,0x01,0x03,0x83,0x02,0x40,0x01,0xc0,
+0x85,0x80,0x01,0x84,0x80,0xc0,0x01,0x41,0xff,0xff,0x05,0x40,0xff,0xc0,0x01,0x42,0x01,0x03,0x06,0x83,0x04,0x41,0x02,0x01,0xc0,
 // 'V'
- 86,14,11,12,0,0,39,8,20,0x3e,0x38,0x00,0x1c,0x10,0x00,0x0c,0x10,0x00,0x0c,0x20,0x00,0x06,0x20,0x00,0x06,0x40,0x00,0x06,0x40,0x00,0x03,0x40,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+12,2,11,8,12,2,
+0x4a,0x01,0x03,0x0f,0x7f,0xf1,0x80,0x00,0xe0,0x19,0x07,0x01,0xc0,0x03,0x42,0x03,0x0f,0x03,0xc0,
+0x44,0x02,0x06,0x1e,0xfe,0xe2,0x01,0x43,0xc0,0x32,0x0e,0x02,0xc0,0x03,0x43,0x07,0x1f,0x06,0x01,0xc0,
+0x44,0x04,0x0c,0x3c,0xfc,0xc4,0x01,0x43,0x80,0x64,0x1c,0x04,0xc0,0x02,0x44,0x01,0x0f,0x3e,0x0c,0x03,0xc0,
+0x44,0x08,0x18,0x78,0xf8,0x88,0x02,0x42,0xc8,0x38,0x08,0xc0,0x02,0x44,0x03,0x1f,0x7c,0x18,0x07,0xc0,
+0x44,0x10,0x30,0xf0,0xf0,0x10,0x02,0x42,0x90,0x70,0x10,0xc0,0x02,0x45,0x07,0x3f,0xf8,0x30,0x0e,0x01,0xc0,
+0x44,0x20,0x60,0xe0,0xe0,0x20,0x02,0x42,0x20,0xe0,0x20,0xc0,0x01,0x46,0x01,0x0f,0x7e,0xf0,0x60,0x1c,0x03,0xc0,0x04,0x40,0x01,0xc0,
+0x40,0x40,0x82,0xc0,0x40,0x40,0x02,0x42,0x40,0xc0,0x40,0xc0,0x01,0x47,0x03,0x1f,0xfc,0xe0,0xc0,0x38,0x06,0x01,0xc0,0x04,0x40,0x03,0xc0,
+0x84,0x80,0x02,0x82,0x80,0xc0,0x00,0x48,0x01,0x07,0x3f,0xf8,0xc0,0x80,0x70,0x0c,0x03,0xc0,0x03,0x42,0x01,0x07,0x01,0xc0,
 // 'W'
- 87,18,15,12,0,0,39,8,20,0x3d,0xf3,0x80,0x18,0xc1,0x00,0x18,0xc1,0x00,0x0c,0x62,0x00,0x0c,0x62,0x00,0x0e,0x72,0x00,0x06,0xb4,0x00,0x06,0xb4,0x00,0x02,0x94,0x00,0x03,0x18,0x00,0x01,0x08,0x00,0x01,0x08,0x00,0x00,0x00,0x00,
+16,2,15,8,12,2,
+0x4e,0x01,0x07,0x3f,0xf9,0xe0,0x01,0xc7,0x3f,0xf9,0xe1,0x00,0xc0,0x39,0x07,0x01,0xc0,0x03,0x42,0x03,0x0e,0x01,0x01,0x42,0x03,0x0e,0x01,0xc0,
+0x4e,0x02,0x0e,0x7e,0xf2,0xc0,0x02,0x8e,0x7e,0xf2,0xc2,0x00,0x80,0x72,0x0e,0x02,0xc0,0x02,0x48,0x01,0x07,0x1c,0x03,0x00,0x01,0x07,0x1c,0x03,0xc0,
+0x49,0x04,0x1c,0xfc,0xe4,0x80,0x04,0x1c,0xfc,0xe4,0x84,0x01,0x42,0xe4,0x1c,0x04,0xc0,0x02,0x48,0x03,0x0f,0x38,0x07,0x00,0x03,0x0f,0x38,0x07,0xc0,
+0x49,0x08,0x38,0xf8,0xc8,0x00,0x08,0x38,0xf8,0xc8,0x08,0x01,0x42,0xc8,0x38,0x08,0xc0,0x01,0x4a,0x01,0x07,0x1f,0x70,0x0e,0x01,0x07,0x1f,0x70,0x0e,0x01,0xc0,
+0x49,0x10,0x70,0xf0,0x90,0x00,0x10,0x70,0xf0,0x90,0x10,0x01,0x42,0x90,0x70,0x10,0xc0,0x01,0x4a,0x03,0x0f,0x3e,0xe0,0x1c,0x03,0x0f,0x3e,0xe0,0x1c,0x03,0xc0,
+0x49,0x20,0xe0,0xe0,0x20,0x00,0x20,0xe0,0xe0,0x20,0x20,0x01,0x42,0x20,0xe0,0x20,0xc0,0x01,0x4a,0x07,0x1f,0x7c,0xc0,0x38,0x07,0x1f,0x7c,0xc0,0x38,0x07,0xc0,0x04,0x40,0x01,0x03,0x40,0x01,0xc0,
+0x49,0x40,0xc0,0xc0,0x40,0x00,0x40,0xc0,0xc0,0x40,0x40,0x01,0x42,0x40,0xc0,0x40,0xc0,0x00,0x4c,0x01,0x0f,0x3e,0xf8,0x80,0x71,0x0f,0x3e,0xf8,0x80,0x70,0x0e,0x01,0xc0,0x04,0x40,0x03,0x03,0x40,0x03,0xc0,
+0x83,0x80,0x00,0x84,0x80,0x01,0x82,0x80,0xc0,0x00,0x4c,0x03,0x1f,0x7c,0xf0,0x00,0xe3,0x1f,0x7c,0xf0,0x00,0xe0,0x1c,0x03,0xc0,0x03,0x41,0x01,0x07,0x02,0x41,0x01,0x07,0xc0,
 // 'X'
- 88,13,11,12,0,0,39,8,20,0x3c,0x78,0x00,0x18,0x30,0x00,0x0c,0x20,0x00,0x06,0x40,0x00,0x07,0x80,0x00,0x03,0x00,0x00,0x01,0x80,0x00,0x03,0xc0,0x00,0x04,0xc0,0x00,0x08,0x60,0x00,0x18,0x30,0x00,0x3c,0x78,0x00,0x00,0x00,0x00,
+11,2,11,8,12,0,
+0x01,0x03,0x07,0x1d,0xb8,0xf0,0xd0,0x89,0x07,0x03,0x01,0x08,0x0c,0x0e,0x09,0x00,0x00,0x01,0x0b,0x0e,0x0c,0x08,
+0x02,0x06,0x0e,0x3a,0x70,0xe0,0xa0,0x12,0x0e,0x06,0x02,0x10,0x18,0x1c,0x12,0x01,0x01,0x03,0x17,0x1c,0x18,0x10,
+0x04,0x0c,0x1c,0x74,0xe0,0xc0,0x40,0x24,0x1c,0x0c,0x04,0x20,0x30,0x38,0x24,0x02,0x03,0x07,0x2e,0x38,0x30,0x20,
+0x08,0x18,0x38,0xe8,0xc0,0x80,0x80,0x48,0x38,0x18,0x08,0x40,0x60,0x70,0x48,0x05,0x07,0x0e,0x5c,0x70,0x60,0x40,
+0x10,0x30,0x70,0xd0,0x80,0x00,0x00,0x90,0x70,0x30,0x10,0x80,0xc0,0xe0,0x91,0x0b,0x0f,0x1d,0xb8,0xe0,0xc0,0x80,
+0x20,0x60,0xe0,0xa0,0x00,0x00,0x00,0x20,0xe0,0x60,0x20,0x00,0x80,0xc0,0x23,0x17,0x1e,0x3a,0x71,0xc0,0x80,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x01,
+0x40,0xc0,0xc0,0x40,0x00,0x00,0x00,0x40,0xc0,0xc0,0x40,0x00,0x00,0x81,0x47,0x2e,0x3c,0x74,0xe2,0x81,0x00,0x00,0x02,0x03,0x03,0x02,0x00,0x00,0x00,0x02,0x03,0x03,0x02,
+0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x01,0x03,0x8e,0x5c,0x78,0xe8,0xc4,0x03,0x01,0x00,0x04,0x06,0x07,0x04,0x00,0x00,0x00,0x05,0x07,0x06,0x04,
 // 'Y'
- 89,14,12,12,0,0,39,8,20,0x3f,0x3c,0x00,0x0c,0x10,0x00,0x06,0x20,0x00,0x06,0x20,0x00,0x03,0x40,0x00,0x03,0x40,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,
+12,2,12,8,12,2,
+0x4b,0x01,0x01,0x03,0x0f,0x3d,0xf1,0xc0,0x30,0x0d,0x03,0x01,0x01,0xc0,0x02,0x45,0x08,0x08,0x0f,0x0f,0x08,0x08,0xc0,
+0x4b,0x02,0x02,0x06,0x1e,0x7a,0xe2,0x80,0x60,0x1a,0x06,0x02,0x02,0xc0,0x02,0x45,0x10,0x10,0x1f,0x1f,0x10,0x10,0xc0,
+0x4b,0x04,0x04,0x0c,0x3c,0xf4,0xc4,0x00,0xc0,0x34,0x0c,0x04,0x04,0xc0,0x02,0x45,0x20,0x20,0x3f,0x3f,0x20,0x20,0xc0,
+0x4b,0x08,0x08,0x18,0x78,0xe8,0x88,0x00,0x80,0x68,0x18,0x08,0x08,0xc0,0x02,0x45,0x40,0x41,0x7f,0x7e,0x41,0x40,0xc0,
+0x45,0x10,0x10,0x30,0xf0,0xd0,0x10,0x01,0x43,0xd0,0x30,0x10,0x10,0xc0,0x02,0x45,0x80,0x83,0xff,0xfc,0x83,0x80,0xc0,
+0x45,0x20,0x20,0x60,0xe0,0xa0,0x20,0x01,0x43,0xa0,0x60,0x20,0x20,0xc0,0x02,0x45,0x01,0x07,0xfe,0xf8,0x06,0x01,0xc0,0x02,0x85,0x01,0xc0,
+0x45,0x40,0x40,0xc0,0xc0,0x40,0x40,0x01,0x43,0x40,0xc0,0x40,0x40,0xc0,0x02,0x45,0x03,0x0f,0xfc,0xf0,0x0c,0x03,0xc0,0x02,0x45,0x02,0x02,0x03,0x03,0x02,0x02,0xc0,
+0x85,0x80,0x01,0x83,0x80,0xc0,0x01,0x47,0x01,0x07,0x1e,0xf8,0xe0,0x18,0x06,0x01,0xc0,0x02,0x45,0x04,0x04,0x07,0x07,0x04,0x04,0xc0,
 // 'Z'
- 90,12,9,12,0,0,39,8,20,0x1f,0xe0,0x00,0x18,0x60,0x00,0x10,0xc0,0x00,0x10,0xc0,0x00,0x01,0x80,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x06,0x20,0x00,0x0c,0x20,0x00,0x0c,0x20,0x00,0x18,0x60,0x00,0x3f,0xe0,0x00,0x00,0x00,0x00,
+10,2,9,8,12,0,
+0x00,0x0f,0x03,0x81,0xe1,0x71,0x1d,0x0f,0x83,0x08,0x0c,0x0f,0x0b,0x08,0x08,0x08,0x0c,0x0f,
+0x00,0x1e,0x06,0x02,0xc2,0xe2,0x3a,0x1e,0x06,0x10,0x18,0x1e,0x17,0x11,0x10,0x10,0x18,0x1f,
+0x00,0x3c,0x0c,0x04,0x84,0xc4,0x74,0x3c,0x0c,0x20,0x30,0x3c,0x2e,0x23,0x21,0x20,0x30,0x3e,
+0x00,0x78,0x18,0x08,0x08,0x88,0xe8,0x78,0x18,0x40,0x60,0x78,0x5c,0x47,0x43,0x40,0x60,0x7c,
+0x00,0xf0,0x30,0x10,0x10,0x10,0xd0,0xf0,0x30,0x80,0xc0,0xf0,0xb8,0x8e,0x87,0x81,0xc0,0xf8,
+0x00,0xe0,0x60,0x20,0x20,0x20,0xa0,0xe0,0x60,0x00,0x81,0xe0,0x70,0x1c,0x0e,0x03,0x81,0xf0,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+0x00,0xc0,0xc0,0x40,0x40,0x40,0x40,0xc0,0xc0,0x00,0x03,0xc0,0xe0,0x38,0x1c,0x07,0x03,0xe0,0x02,0x03,0x03,0x02,0x02,0x02,0x02,0x03,0x03,
+0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x07,0x81,0xc0,0x70,0x38,0x0e,0x07,0xc1,0x04,0x06,0x07,0x05,0x04,0x04,0x04,0x06,0x07,
 // 'bracketleft'
- 91,9,3,14,1,-2,45,8,22,0x1c,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,
+6,3,3,8,14,0,
+0xff,0x01,0x01,0x3f,0x20,0x20,
+0xfe,0x02,0x02,0x7f,0x40,0x40,
+0xfc,0x04,0x04,0xff,0x80,0x80,
+0xf8,0x08,0x08,0xff,0x00,0x00,0x01,0x01,0x01,
+0xf0,0x10,0x10,0xff,0x00,0x00,0x03,0x02,0x02,
+0xe0,0x20,0x20,0xff,0x00,0x00,0x07,0x04,0x04,
+0xc0,0x40,0x40,0xff,0x00,0x00,0x0f,0x08,0x08,
+0x80,0x80,0x80,0xff,0x00,0x00,0x1f,0x10,0x10,
 // 'backslash'
- 92,14,6,12,2,0,39,8,20,0x08,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x00,0x00,
+10,4,6,8,12,2,
+0x43,0x03,0x0c,0x30,0xc0,0xc0,0x03,0x41,0x03,0x0c,0xc0,
+0x43,0x06,0x18,0x60,0x80,0xc0,0x02,0x42,0x01,0x06,0x18,0xc0,
+0x42,0x0c,0x30,0xc0,0xc0,0x02,0x42,0x03,0x0c,0x30,0xc0,
+0x42,0x18,0x60,0x80,0xc0,0x01,0x43,0x01,0x06,0x18,0x60,0xc0,
+0x41,0x30,0xc0,0xc0,0x01,0x43,0x03,0x0c,0x30,0xc0,0xc0,
+0x41,0x60,0x80,0xc0,0x00,0x44,0x01,0x06,0x18,0x60,0x80,0xc0,0x04,0x40,0x01,0xc0,
+0x40,0xc0,0xc0,0x00,0x43,0x03,0x0c,0x30,0xc0,0xc0,0x04,0x40,0x03,0xc0,
+0x40,0x80,0xc0,0x44,0x01,0x06,0x18,0x60,0x80,0xc0,0x03,0x41,0x01,0x06,0xc0,
 // 'bracketright'
- 93,9,3,14,1,-2,45,8,22,0x1c,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,
+6,3,3,8,14,0,
+0x01,0x01,0xff,0x20,0x20,0x3f,
+0x02,0x02,0xfe,0x40,0x40,0x7f,
+0x04,0x04,0xfc,0x80,0x80,0xff,
+0x08,0x08,0xf8,0x00,0x00,0xff,0x01,0x01,0x01,
+0x10,0x10,0xf0,0x00,0x00,0xff,0x02,0x02,0x03,
+0x20,0x20,0xe0,0x00,0x00,0xff,0x04,0x04,0x07,
+0x40,0x40,0xc0,0x00,0x00,0xff,0x08,0x08,0x0f,
+0x80,0x80,0x80,0x00,0x00,0xff,0x10,0x10,0x1f,
 // 'asciicircum'
- 94,13,8,7,1,5,24,8,15,0x03,0x00,0x00,0x03,0x00,0x00,0x07,0x80,0x00,0x04,0x80,0x00,0x0c,0xc0,0x00,0x08,0x40,0x00,0x18,0x60,0x00,0x00,0x00,0x00,
+10,3,8,8,7,0,
+0x40,0x70,0x1c,0x07,0x07,0x1c,0x70,0x40,
+0x80,0xe0,0x38,0x0e,0x0e,0x38,0xe0,0x80,
+0x00,0xc0,0x70,0x1c,0x1c,0x70,0xc0,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x01,0x01,
+0x00,0x80,0xe0,0x38,0x38,0xe0,0x80,0x00,0x02,0x03,0x00,0x00,0x00,0x00,0x03,0x02,
+0x00,0x00,0xc0,0x70,0x70,0xc0,0x00,0x00,0x04,0x07,0x01,0x00,0x00,0x01,0x07,0x04,
+0x00,0x00,0x80,0xe0,0xe0,0x80,0x00,0x00,0x08,0x0e,0x03,0x00,0x00,0x03,0x0e,0x08,
+0x00,0x00,0x00,0xc0,0xc0,0x00,0x00,0x00,0x10,0x1c,0x07,0x01,0x01,0x07,0x1c,0x10,
+0x00,0x00,0x00,0x80,0x80,0x00,0x00,0x00,0x20,0x38,0x0e,0x03,0x03,0x0e,0x38,0x20,
 // 'underscore'
- 95,10,8,1,0,-2,6,21,22,0x3f,0xc0,0x00,0x00,0x00,0x00,
+8,2,8,21,1,2,
+0x87,0x20,0xc0,
+0x87,0x40,0xc0,
+0x87,0x80,0xc0,
+0x87,0x01,0xc0,
+0x87,0x02,0xc0,
+0x87,0x04,0xc0,
+0x87,0x08,0xc0,
+0x87,0x10,0xc0,
 // 'grave'
- 96,7,3,3,0,9,12,8,11,0x20,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,
+5,2,3,8,3,0,
+0x01,0x02,0x04,
+0x02,0x04,0x08,
+0x04,0x08,0x10,
+0x08,0x10,0x20,
+0x10,0x20,0x40,
+0x20,0x40,0x80,
+0x40,0x80,0x00,0x00,0x00,0x01,
+0x80,0x00,0x00,0x00,0x01,0x02,
 // 'a'
- 97,12,7,8,1,0,27,12,20,0x0f,0x00,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x03,0x80,0x00,0x0d,0x80,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,
+9,3,7,12,8,0,
+0x60,0x70,0x10,0x90,0xf0,0xe0,0x00,0x06,0x0f,0x09,0x08,0x07,0x0f,0x08,
+0xc0,0xe0,0x20,0x20,0xe0,0xc0,0x00,0x0c,0x1e,0x12,0x11,0x0f,0x1f,0x10,
+0x80,0xc0,0x40,0x40,0xc0,0x80,0x00,0x19,0x3d,0x24,0x22,0x1f,0x3f,0x20,
+0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x33,0x7b,0x48,0x44,0x3f,0x7f,0x40,
+0x66,0xf7,0x91,0x89,0x7f,0xfe,0x80,
+0xcc,0xee,0x22,0x12,0xfe,0xfc,0x00,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+0x98,0xdc,0x44,0x24,0xfc,0xf8,0x00,0x01,0x03,0x02,0x02,0x01,0x03,0x02,
+0x30,0xb8,0x88,0x48,0xf8,0xf0,0x00,0x03,0x07,0x04,0x04,0x03,0x07,0x04,
 // 'b'
- 98,11,8,12,0,0,39,8,20,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1f,0x00,0x00,0x19,0x80,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x19,0x80,0x00,0x17,0x00,0x00,0x00,0x00,0x00,
+9,2,8,8,12,0,
+0x01,0xff,0xff,0x10,0x10,0x30,0xe0,0xc0,0x00,0x0f,0x07,0x08,0x08,0x0c,0x07,0x03,
+0x02,0xfe,0xfe,0x20,0x20,0x60,0xc0,0x80,0x00,0x1f,0x0f,0x10,0x10,0x18,0x0f,0x07,
+0x04,0xfc,0xfc,0x40,0x40,0xc0,0x80,0x00,0x00,0x3f,0x1f,0x20,0x20,0x30,0x1f,0x0f,
+0x08,0xf8,0xf8,0x80,0x80,0x80,0x00,0x00,0x00,0x7f,0x3f,0x40,0x40,0x61,0x3f,0x1e,
+0x10,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x7f,0x81,0x81,0xc3,0x7e,0x3c,
+0x20,0xe0,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x02,0x02,0x86,0xfc,0x78,0x00,0x01,0x00,0x01,0x01,0x01,0x00,0x00,
+0x40,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x04,0x04,0x0c,0xf8,0xf0,0x00,0x03,0x01,0x02,0x02,0x03,0x01,0x00,
+0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x08,0x08,0x18,0xf0,0xe0,0x00,0x07,0x03,0x04,0x04,0x06,0x03,0x01,
 // 'c'
- 99,9,6,8,0,0,27,12,20,0x0e,0x00,0x00,0x1b,0x00,0x00,0x33,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x1b,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+7,2,6,12,8,0,
+0xc0,0xe0,0x30,0x10,0x70,0x60,0x03,0x07,0x0c,0x08,0x0c,0x04,
+0x80,0xc0,0x60,0x20,0xe0,0xc0,0x07,0x0f,0x18,0x10,0x18,0x08,
+0x00,0x80,0xc0,0x40,0xc0,0x80,0x0f,0x1f,0x30,0x20,0x31,0x11,
+0x00,0x00,0x80,0x80,0x80,0x00,0x1e,0x3f,0x61,0x40,0x63,0x23,
+0x3c,0x7e,0xc3,0x81,0xc7,0x46,
+0x78,0xfc,0x86,0x02,0x8e,0x8c,0x00,0x00,0x01,0x01,0x01,0x00,
+0xf0,0xf8,0x0c,0x04,0x1c,0x18,0x00,0x01,0x03,0x02,0x03,0x01,
+0xe0,0xf0,0x18,0x08,0x38,0x30,0x01,0x03,0x06,0x04,0x06,0x02,
 // 'd'
-100,13,8,12,1,0,39,8,20,0x01,0xc0,0x00,0x00,0xc0,0x00,0x00,0xc0,0x00,0x00,0xc0,0x00,0x07,0xc0,0x00,0x0c,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x0c,0xc0,0x00,0x07,0x60,0x00,0x00,0x00,0x00,
+10,3,8,8,12,0,
+0xc0,0xe0,0x30,0x10,0x11,0xff,0xff,0x00,0x03,0x07,0x0c,0x08,0x08,0x07,0x0f,0x08,
+0x80,0xc0,0x60,0x20,0x22,0xfe,0xfe,0x00,0x07,0x0f,0x18,0x10,0x10,0x0f,0x1f,0x10,
+0x00,0x80,0xc0,0x40,0x44,0xfc,0xfc,0x00,0x0f,0x1f,0x30,0x20,0x20,0x1f,0x3f,0x20,
+0x00,0x00,0x80,0x80,0x88,0xf8,0xf8,0x00,0x1e,0x3f,0x61,0x40,0x40,0x3f,0x7f,0x40,
+0x00,0x00,0x00,0x00,0x10,0xf0,0xf0,0x00,0x3c,0x7e,0xc3,0x81,0x81,0x7f,0xff,0x80,
+0x00,0x00,0x00,0x00,0x20,0xe0,0xe0,0x00,0x78,0xfc,0x86,0x02,0x02,0xff,0xff,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0x00,0x00,0x00,0x40,0xc0,0xc0,0x00,0xf0,0xf8,0x0c,0x04,0x04,0xff,0xff,0x00,0x00,0x01,0x03,0x02,0x02,0x01,0x03,0x02,
+0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x00,0xe0,0xf0,0x18,0x08,0x08,0xff,0xff,0x00,0x01,0x03,0x06,0x04,0x04,0x03,0x07,0x04,
 // 'e'
-101,10,7,8,0,0,27,12,20,0x0e,0x00,0x00,0x11,0x00,0x00,0x31,0x80,0x00,0x3f,0x80,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x19,0x80,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,
+8,2,7,12,8,0,
+0xc0,0xe0,0x90,0x90,0x90,0xe0,0xc0,0x03,0x07,0x0c,0x08,0x08,0x0c,0x04,
+0x80,0xc0,0x20,0x20,0x20,0xc0,0x80,0x07,0x0f,0x19,0x11,0x11,0x19,0x09,
+0x00,0x80,0x40,0x40,0x40,0x80,0x00,0x0f,0x1f,0x32,0x22,0x22,0x33,0x13,
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x1e,0x3f,0x64,0x44,0x44,0x67,0x26,
+0x3c,0x7e,0xc9,0x89,0x89,0xce,0x4c,
+0x78,0xfc,0x92,0x12,0x12,0x9c,0x98,0x00,0x00,0x01,0x01,0x01,0x01,0x00,
+0xf0,0xf8,0x24,0x24,0x24,0x38,0x30,0x00,0x01,0x03,0x02,0x02,0x03,0x01,
+0xe0,0xf0,0x48,0x48,0x48,0x70,0x60,0x01,0x03,0x06,0x04,0x04,0x06,0x02,
 // 'f'
-102,8,6,12,0,0,39,8,20,0x0e,0x00,0x00,0x1b,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x3e,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,
+6,2,6,8,12,0,
+0x10,0xfe,0xff,0x11,0x13,0x02,0x08,0x0f,0x0f,0x08,0x08,0x00,
+0x20,0xfc,0xfe,0x22,0x26,0x04,0x10,0x1f,0x1f,0x10,0x10,0x00,
+0x40,0xf8,0xfc,0x44,0x4c,0x08,0x20,0x3f,0x3f,0x20,0x20,0x00,
+0x80,0xf0,0xf8,0x88,0x98,0x10,0x40,0x7f,0x7f,0x40,0x40,0x00,
+0x00,0xe0,0xf0,0x10,0x30,0x20,0x81,0xff,0xff,0x81,0x81,0x00,
+0x00,0xc0,0xe0,0x20,0x60,0x40,0x02,0xff,0xff,0x02,0x02,0x00,0x01,0x01,0x01,0x01,0x01,0x00,
+0x00,0x80,0xc0,0x40,0xc0,0x80,0x04,0xff,0xff,0x04,0x04,0x00,0x02,0x03,0x03,0x02,0x02,0x00,
+0x00,0x00,0x80,0x80,0x80,0x00,0x08,0xff,0xff,0x08,0x09,0x01,0x04,0x07,0x07,0x04,0x04,0x00,
 // 'g'
-103,11,9,11,0,-3,36,12,23,0x0f,0x60,0x00,0x19,0xa0,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x0f,0x00,0x00,0x10,0x00,0x00,0x1f,0x80,0x00,0x30,0xc0,0x00,0x30,0xc0,0x00,0x1f,0x80,0x00,0x00,0x00,0x00,
+9,2,9,12,11,0,
+0x00,0xe0,0xf0,0x10,0x10,0xf0,0xe0,0x10,0x30,0x30,0x7d,0x4b,0x4a,0x4a,0x4b,0x79,0x30,0x00,
+0x00,0xc0,0xe0,0x20,0x20,0xe0,0xc0,0x20,0x60,0x60,0xfb,0x97,0x94,0x94,0x97,0xf3,0x60,0x00,
+0x00,0x80,0xc0,0x40,0x40,0xc0,0x80,0x40,0xc0,0xc0,0xf7,0x2f,0x28,0x28,0x2f,0xe7,0xc0,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,
+0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x80,0x80,0x80,0xef,0x5f,0x50,0x50,0x5f,0xcf,0x80,0x01,0x01,0x03,0x02,0x02,0x02,0x02,0x03,0x01,0x00,
+0x00,0xde,0xbf,0xa1,0xa1,0xbf,0x9e,0x01,0x03,0x03,0x07,0x04,0x04,0x04,0x04,0x07,0x03,0x00,
+0x00,0xbc,0x7e,0x42,0x42,0x7e,0x3c,0x02,0x06,0x06,0x0f,0x09,0x09,0x09,0x09,0x0f,0x06,0x00,
+0x00,0x78,0xfc,0x84,0x84,0xfc,0x78,0x04,0x0c,0x0c,0x1f,0x12,0x12,0x12,0x12,0x1e,0x0c,0x00,
+0x00,0xf0,0xf8,0x08,0x08,0xf8,0xf0,0x08,0x18,0x18,0x3e,0x25,0x25,0x25,0x25,0x3c,0x18,0x00,
 // 'h'
-104,12,9,12,0,0,39,8,20,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1b,0x80,0x00,0x1d,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x3d,0xe0,0x00,0x00,0x00,0x00,
+10,2,9,8,12,2,
+0x47,0x01,0xff,0xff,0x20,0x10,0x30,0xf0,0xe0,0xc0,0x48,0x08,0x0f,0x0f,0x08,0x00,0x08,0x0f,0x0f,0x08,0xc0,
+0x47,0x02,0xfe,0xfe,0x40,0x20,0x60,0xe0,0xc0,0xc0,0x48,0x10,0x1f,0x1f,0x10,0x00,0x10,0x1f,0x1f,0x10,0xc0,
+0x47,0x04,0xfc,0xfc,0x80,0x40,0xc0,0xc0,0x80,0xc0,0x48,0x20,0x3f,0x3f,0x20,0x00,0x20,0x3f,0x3f,0x20,0xc0,
+0x43,0x08,0xf8,0xf8,0x00,0x82,0x80,0xc0,0x48,0x40,0x7f,0x7f,0x41,0x00,0x41,0x7f,0x7f,0x40,0xc0,
+0x42,0x10,0xf0,0xf0,0xc0,0x48,0x80,0xff,0xff,0x82,0x01,0x83,0xff,0xfe,0x80,0xc0,
+0x42,0x20,0xe0,0xe0,0xc0,0x00,0x46,0xff,0xff,0x04,0x02,0x06,0xfe,0xfc,0xc0,0x83,0x01,0x00,0x83,0x01,0xc0,
+0x42,0x40,0xc0,0xc0,0xc0,0x00,0x46,0xff,0xff,0x08,0x04,0x0c,0xfc,0xf8,0xc0,0x48,0x02,0x03,0x03,0x02,0x00,0x02,0x03,0x03,0x02,0xc0,
+0x82,0x80,0xc0,0x00,0x46,0xff,0xff,0x10,0x08,0x18,0xf8,0xf0,0xc0,0x48,0x04,0x07,0x07,0x04,0x00,0x04,0x07,0x07,0x04,0xc0,
 // 'i'
-105,7,4,12,0,0,39,8,20,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,
+5,2,4,8,12,0,
+0x10,0xf3,0xf3,0x00,0x08,0x0f,0x0f,0x08,
+0x20,0xe6,0xe6,0x00,0x10,0x1f,0x1f,0x10,
+0x40,0xcc,0xcc,0x00,0x20,0x3f,0x3f,0x20,
+0x80,0x98,0x98,0x00,0x40,0x7f,0x7f,0x40,
+0x00,0x30,0x30,0x00,0x81,0xff,0xff,0x80,
+0x00,0x60,0x60,0x00,0x02,0xfe,0xfe,0x00,0x01,0x01,0x01,0x01,
+0x00,0xc0,0xc0,0x00,0x04,0xfc,0xfc,0x00,0x02,0x03,0x03,0x02,
+0x00,0x80,0x80,0x00,0x08,0xf9,0xf9,0x00,0x04,0x07,0x07,0x04,
 // 'j'
-106,6,4,15,-1,-3,48,8,23,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x58,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,
+5,1,4,8,15,0,
+0x00,0x10,0xf3,0xf3,0x60,0x40,0x7f,0x3f,
+0x00,0x20,0xe6,0xe6,0xc0,0x80,0xff,0x7f,
+0x00,0x40,0xcc,0xcc,0x80,0x00,0xff,0xff,0x01,0x01,0x01,0x00,
+0x00,0x80,0x98,0x98,0x00,0x00,0xff,0xff,0x03,0x02,0x03,0x01,
+0x00,0x00,0x30,0x30,0x00,0x01,0xff,0xff,0x06,0x04,0x07,0x03,
+0x00,0x00,0x60,0x60,0x00,0x02,0xfe,0xfe,0x0c,0x08,0x0f,0x07,
+0x00,0x00,0xc0,0xc0,0x00,0x04,0xfc,0xfc,0x18,0x10,0x1f,0x0f,
+0x00,0x00,0x80,0x80,0x00,0x08,0xf9,0xf9,0x30,0x20,0x3f,0x1f,
 // 'k'
-107,12,9,12,0,0,39,8,20,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1b,0xe0,0x00,0x19,0x80,0x00,0x1b,0x00,0x00,0x1e,0x00,0x00,0x1f,0x00,0x00,0x19,0x80,0x00,0x18,0xc0,0x00,0x3d,0xe0,0x00,0x00,0x00,0x00,
+10,2,9,8,12,0,
+0x01,0xff,0xff,0x80,0xd0,0x70,0x30,0x10,0x10,0x08,0x0f,0x0f,0x09,0x01,0x0b,0x0e,0x0c,0x08,
+0x02,0xfe,0xfe,0x00,0xa0,0xe0,0x60,0x20,0x20,0x10,0x1f,0x1f,0x13,0x03,0x16,0x1c,0x18,0x10,
+0x04,0xfc,0xfc,0x00,0x40,0xc0,0xc0,0x40,0x40,0x20,0x3f,0x3f,0x26,0x07,0x2d,0x38,0x30,0x20,
+0x08,0xf8,0xf8,0x00,0x80,0x80,0x80,0x80,0x80,0x40,0x7f,0x7f,0x4c,0x0e,0x5b,0x71,0x60,0x40,
+0x10,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0x98,0x1d,0xb7,0xe3,0xc1,0x81,
+0x20,0xe0,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x30,0x3a,0x6e,0xc6,0x82,0x02,0x01,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x01,
+0x40,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x60,0x74,0xdc,0x8c,0x04,0x04,0x02,0x03,0x03,0x02,0x00,0x02,0x03,0x03,0x02,
+0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xc0,0xe8,0xb8,0x18,0x08,0x08,0x04,0x07,0x07,0x04,0x00,0x05,0x07,0x06,0x04,
 // 'l'
-108,7,4,12,0,0,39,8,20,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,
+5,2,4,8,12,0,
+0x01,0xff,0xff,0x00,0x08,0x0f,0x0f,0x08,
+0x02,0xfe,0xfe,0x00,0x10,0x1f,0x1f,0x10,
+0x04,0xfc,0xfc,0x00,0x20,0x3f,0x3f,0x20,
+0x08,0xf8,0xf8,0x00,0x40,0x7f,0x7f,0x40,
+0x10,0xf0,0xf0,0x00,0x80,0xff,0xff,0x80,
+0x20,0xe0,0xe0,0x00,0x00,0xff,0xff,0x00,0x01,0x01,0x01,0x01,
+0x40,0xc0,0xc0,0x00,0x00,0xff,0xff,0x00,0x02,0x03,0x03,0x02,
+0x80,0x80,0x80,0x00,0x00,0xff,0xff,0x00,0x04,0x07,0x07,0x04,
 // 'm'
-109,17,14,8,0,0,27,12,20,0x3b,0x9c,0x00,0x1c,0xe6,0x00,0x18,0xc6,0x00,0x18,0xc6,0x00,0x18,0xc6,0x00,0x18,0xc6,0x00,0x18,0xc6,0x00,0x3d,0xef,0x00,0x00,0x00,0x00,
+15,2,14,12,8,0,
+0x10,0xf0,0xf0,0x20,0x10,0x10,0xf0,0xe0,0x20,0x10,0x10,0xf0,0xe0,0x00,0x08,0x0f,0x0f,0x08,0x00,0x08,0x0f,0x0f,0x08,0x00,0x08,0x0f,0x0f,0x08,
+0x20,0xe0,0xe0,0x40,0x20,0x20,0xe0,0xc0,0x40,0x20,0x20,0xe0,0xc0,0x00,0x10,0x1f,0x1f,0x10,0x00,0x10,0x1f,0x1f,0x10,0x00,0x10,0x1f,0x1f,0x10,
+0x40,0xc0,0xc0,0x80,0x40,0x40,0xc0,0x80,0x80,0x40,0x40,0xc0,0x80,0x00,0x20,0x3f,0x3f,0x20,0x00,0x20,0x3f,0x3f,0x20,0x00,0x20,0x3f,0x3f,0x20,
+0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x40,0x7f,0x7f,0x41,0x00,0x40,0x7f,0x7f,0x41,0x00,0x40,0x7f,0x7f,0x40,
+0x81,0xff,0xff,0x82,0x01,0x81,0xff,0xfe,0x82,0x01,0x81,0xff,0xfe,0x80,
+0x02,0xfe,0xfe,0x04,0x02,0x02,0xfe,0xfc,0x04,0x02,0x02,0xfe,0xfc,0x00,0x01,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x01,
+0x04,0xfc,0xfc,0x08,0x04,0x04,0xfc,0xf8,0x08,0x04,0x04,0xfc,0xf8,0x00,0x02,0x03,0x03,0x02,0x00,0x02,0x03,0x03,0x02,0x00,0x02,0x03,0x03,0x02,
+0x08,0xf8,0xf8,0x10,0x08,0x08,0xf8,0xf0,0x10,0x08,0x08,0xf8,0xf0,0x00,0x04,0x07,0x07,0x04,0x00,0x04,0x07,0x07,0x04,0x00,0x04,0x07,0x07,0x04,
 // 'n'
-110,12,9,8,0,0,27,12,20,0x3b,0x80,0x00,0x1c,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x3d,0xe0,0x00,0x00,0x00,0x00,
+10,2,9,12,8,0,
+0x10,0xf0,0xf0,0x20,0x10,0x10,0xf0,0xe0,0x00,0x08,0x0f,0x0f,0x08,0x00,0x08,0x0f,0x0f,0x08,
+0x20,0xe0,0xe0,0x40,0x20,0x20,0xe0,0xc0,0x00,0x10,0x1f,0x1f,0x10,0x00,0x10,0x1f,0x1f,0x10,
+0x40,0xc0,0xc0,0x80,0x40,0x40,0xc0,0x80,0x00,0x20,0x3f,0x3f,0x20,0x00,0x20,0x3f,0x3f,0x20,
+0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x00,0x40,0x7f,0x7f,0x41,0x00,0x40,0x7f,0x7f,0x40,
+0x81,0xff,0xff,0x82,0x01,0x81,0xff,0xfe,0x80,
+0x02,0xfe,0xfe,0x04,0x02,0x02,0xfe,0xfc,0x00,0x01,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x01,
+0x04,0xfc,0xfc,0x08,0x04,0x04,0xfc,0xf8,0x00,0x02,0x03,0x03,0x02,0x00,0x02,0x03,0x03,0x02,
+0x08,0xf8,0xf8,0x10,0x08,0x08,0xf8,0xf0,0x00,0x04,0x07,0x07,0x04,0x00,0x04,0x07,0x07,0x04,
 // 'o'
-111,10,7,8,0,0,27,12,20,0x0e,0x00,0x00,0x1b,0x00,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x1b,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,12,8,0,
+0xc0,0xe0,0x30,0x10,0x30,0xe0,0xc0,0x03,0x07,0x0c,0x08,0x0c,0x07,0x03,
+0x80,0xc0,0x60,0x20,0x60,0xc0,0x80,0x07,0x0f,0x18,0x10,0x18,0x0f,0x07,
+0x00,0x80,0xc0,0x40,0xc0,0x80,0x00,0x0f,0x1f,0x30,0x20,0x30,0x1f,0x0f,
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x1e,0x3f,0x61,0x40,0x61,0x3f,0x1e,
+0x3c,0x7e,0xc3,0x81,0xc3,0x7e,0x3c,
+0x78,0xfc,0x86,0x02,0x86,0xfc,0x78,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0xf0,0xf8,0x0c,0x04,0x0c,0xf8,0xf0,0x00,0x01,0x03,0x02,0x03,0x01,0x00,
+0xe0,0xf0,0x18,0x08,0x18,0xf0,0xe0,0x01,0x03,0x06,0x04,0x06,0x03,0x01,
 // 'p'
-112,11,8,11,0,-3,36,12,23,0x37,0x00,0x00,0x19,0x80,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x19,0x80,0x00,0x1f,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,
+9,2,8,12,11,0,
+0x10,0xf0,0xe0,0x10,0x10,0x30,0xe0,0xc0,0x40,0x7f,0x7f,0x48,0x08,0x0c,0x07,0x03,
+0x20,0xe0,0xc0,0x20,0x20,0x60,0xc0,0x80,0x80,0xff,0xff,0x90,0x10,0x18,0x0f,0x07,
+0x40,0xc0,0x80,0x40,0x40,0xc0,0x80,0x00,0x00,0xff,0xff,0x20,0x20,0x30,0x1f,0x0f,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,
+0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0xff,0xff,0x40,0x40,0x61,0x3f,0x1e,0x02,0x03,0x03,0x02,0x00,0x00,0x00,0x00,
+0x01,0xff,0xfe,0x81,0x81,0xc3,0x7e,0x3c,0x04,0x07,0x07,0x04,0x00,0x00,0x00,0x00,
+0x02,0xfe,0xfc,0x02,0x02,0x86,0xfc,0x78,0x08,0x0f,0x0f,0x09,0x01,0x01,0x00,0x00,
+0x04,0xfc,0xf8,0x04,0x04,0x0c,0xf8,0xf0,0x10,0x1f,0x1f,0x12,0x02,0x03,0x01,0x00,
+0x08,0xf8,0xf0,0x08,0x08,0x18,0xf0,0xe0,0x20,0x3f,0x3f,0x24,0x04,0x06,0x03,0x01,
 // 'q'
-113,11,8,11,0,-3,36,12,23,0x0e,0x40,0x00,0x19,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x19,0x80,0x00,0x0f,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,
+9,2,8,12,11,0,
+0xc0,0xe0,0x30,0x10,0x10,0xe0,0xe0,0x10,0x03,0x07,0x0c,0x08,0x48,0x7f,0x7f,0x40,
+0x80,0xc0,0x60,0x20,0x20,0xc0,0xc0,0x20,0x07,0x0f,0x18,0x10,0x90,0xff,0xff,0x80,
+0x00,0x80,0xc0,0x40,0x40,0x80,0x80,0x40,0x0f,0x1f,0x30,0x20,0x20,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x80,0x1e,0x3f,0x61,0x40,0x40,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x03,0x02,
+0x3c,0x7e,0xc3,0x81,0x81,0xfe,0xfe,0x01,0x00,0x00,0x00,0x00,0x04,0x07,0x07,0x04,
+0x78,0xfc,0x86,0x02,0x02,0xfc,0xfc,0x02,0x00,0x00,0x01,0x01,0x09,0x0f,0x0f,0x08,
+0xf0,0xf8,0x0c,0x04,0x04,0xf8,0xf8,0x04,0x00,0x01,0x03,0x02,0x12,0x1f,0x1f,0x10,
+0xe0,0xf0,0x18,0x08,0x08,0xf0,0xf0,0x08,0x01,0x03,0x06,0x04,0x24,0x3f,0x3f,0x20,
 // 'r'
-114,9,7,8,0,0,27,12,20,0x3b,0x00,0x00,0x1d,0x80,0x00,0x19,0x80,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,
+7,2,7,12,8,0,
+0x10,0xf0,0xf0,0x20,0x10,0x70,0x60,0x08,0x0f,0x0f,0x08,0x00,0x00,0x00,
+0x20,0xe0,0xe0,0x40,0x20,0xe0,0xc0,0x10,0x1f,0x1f,0x10,0x00,0x00,0x00,
+0x40,0xc0,0xc0,0x80,0x40,0xc0,0x80,0x20,0x3f,0x3f,0x20,0x00,0x01,0x01,
+0x80,0x80,0x80,0x00,0x80,0x80,0x00,0x40,0x7f,0x7f,0x41,0x00,0x03,0x03,
+0x81,0xff,0xff,0x82,0x01,0x07,0x06,
+0x02,0xfe,0xfe,0x04,0x02,0x0e,0x0c,0x01,0x01,0x01,0x01,0x00,0x00,0x00,
+0x04,0xfc,0xfc,0x08,0x04,0x1c,0x18,0x02,0x03,0x03,0x02,0x00,0x00,0x00,
+0x08,0xf8,0xf8,0x10,0x08,0x38,0x30,0x04,0x07,0x07,0x04,0x00,0x00,0x00,
 // 's'
-115,10,6,8,0,0,27,12,20,0x1d,0x00,0x00,0x33,0x00,0x00,0x31,0x00,0x00,0x1c,0x00,0x00,0x0e,0x00,0x00,0x23,0x00,0x00,0x33,0x00,0x00,0x2e,0x00,0x00,0x00,0x00,0x00,
+8,2,6,12,8,0,
+0x60,0xf0,0x90,0x90,0x20,0x70,0x0e,0x04,0x09,0x09,0x0f,0x06,
+0xc0,0xe0,0x20,0x20,0x40,0xe0,0x1c,0x09,0x13,0x13,0x1e,0x0c,
+0x80,0xc0,0x40,0x40,0x80,0xc0,0x39,0x13,0x26,0x26,0x3c,0x19,
+0x00,0x80,0x80,0x80,0x00,0x80,0x73,0x27,0x4c,0x4c,0x79,0x33,
+0xe6,0x4f,0x99,0x99,0xf2,0x67,
+0xcc,0x9e,0x32,0x32,0xe4,0xce,0x01,0x00,0x01,0x01,0x01,0x00,
+0x98,0x3c,0x64,0x64,0xc8,0x9c,0x03,0x01,0x02,0x02,0x03,0x01,
+0x30,0x78,0xc8,0xc8,0x90,0x38,0x07,0x02,0x04,0x04,0x07,0x03,
 // 't'
-116,9,6,11,0,0,36,9,20,0x08,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x3e,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x19,0x00,0x00,0x19,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+7,2,6,9,11,0,
+0x10,0xf8,0xfe,0x10,0x10,0x00,0x00,0x07,0x0f,0x08,0x08,0x06,
+0x20,0xf0,0xfc,0x20,0x20,0x00,0x00,0x0f,0x1f,0x10,0x10,0x0c,
+0x40,0xe0,0xf8,0x40,0x40,0x00,0x00,0x1f,0x3f,0x20,0x20,0x18,
+0x80,0xc0,0xf0,0x80,0x80,0x00,0x00,0x3f,0x7f,0x40,0x40,0x30,
+0x00,0x80,0xe0,0x00,0x00,0x00,0x01,0x7f,0xff,0x81,0x81,0x60,
+0x00,0x00,0xc0,0x00,0x00,0x00,0x02,0xff,0xff,0x02,0x02,0xc0,0x00,0x00,0x01,0x01,0x01,0x00,
+0x00,0x00,0x80,0x00,0x00,0x00,0x04,0xfe,0xff,0x04,0x04,0x80,0x00,0x01,0x03,0x02,0x02,0x01,
+0x08,0xfc,0xff,0x08,0x08,0x00,0x00,0x03,0x07,0x04,0x04,0x03,
 // 'u'
-117,12,9,8,0,0,27,12,20,0x39,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x0f,0x60,0x00,0x00,0x00,0x00,
+10,2,9,12,8,0,
+0x10,0xf0,0xf0,0x00,0x00,0x10,0xf0,0xf0,0x00,0x00,0x07,0x0f,0x08,0x08,0x08,0x07,0x0f,0x08,
+0x20,0xe0,0xe0,0x00,0x00,0x20,0xe0,0xe0,0x00,0x00,0x0f,0x1f,0x10,0x10,0x10,0x0f,0x1f,0x10,
+0x40,0xc0,0xc0,0x00,0x00,0x40,0xc0,0xc0,0x00,0x00,0x1f,0x3f,0x20,0x20,0x20,0x1f,0x3f,0x20,
+0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x3f,0x7f,0x40,0x40,0x40,0x3f,0x7f,0x40,
+0x01,0x7f,0xff,0x80,0x80,0x81,0x7f,0xff,0x80,
+0x02,0xfe,0xfe,0x00,0x00,0x02,0xfe,0xfe,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x01,0x01,
+0x04,0xfc,0xfc,0x00,0x00,0x04,0xfc,0xfc,0x00,0x00,0x01,0x03,0x02,0x02,0x02,0x01,0x03,0x02,
+0x08,0xf8,0xf8,0x00,0x00,0x08,0xf8,0xf8,0x00,0x00,0x03,0x07,0x04,0x04,0x04,0x03,0x07,0x04,
 // 'v'
-118,11,9,8,0,0,27,12,20,0x3d,0xe0,0x00,0x18,0xc0,0x00,0x0c,0x80,0x00,0x0d,0x80,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+9,2,9,12,8,2,
+0x48,0x10,0x30,0xf0,0xd0,0x00,0x90,0xf0,0x30,0x10,0xc0,0x02,0x42,0x03,0x0f,0x03,0xc0,
+0x48,0x20,0x60,0xe0,0xa0,0x00,0x20,0xe0,0x60,0x20,0xc0,0x01,0x44,0x01,0x07,0x1e,0x07,0x01,0xc0,
+0x48,0x40,0xc0,0xc0,0x40,0x00,0x40,0xc0,0xc0,0x40,0xc0,0x01,0x44,0x03,0x0f,0x3c,0x0e,0x03,0xc0,
+0x83,0x80,0x00,0x83,0x80,0xc0,0x00,0x46,0x01,0x07,0x1e,0x78,0x1c,0x07,0x01,0xc0,
+0x48,0x01,0x03,0x0f,0x3d,0xf0,0x39,0x0f,0x03,0x01,0xc0,
+0x48,0x02,0x06,0x1e,0x7a,0xe0,0x72,0x1e,0x06,0x02,0xc0,0x03,0x40,0x01,0xc0,
+0x48,0x04,0x0c,0x3c,0xf4,0xc0,0xe4,0x3c,0x0c,0x04,0xc0,0x03,0x40,0x03,0xc0,
+0x48,0x08,0x18,0x78,0xe8,0x80,0xc8,0x78,0x18,0x08,0xc0,0x02,0x42,0x01,0x07,0x01,0xc0,
 // 'w'
-119,15,13,8,0,0,27,12,20,0x3b,0xde,0x00,0x19,0x8c,0x00,0x0c,0xc8,0x00,0x0c,0xd8,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x00,0x00,0x00,
+13,2,13,12,8,2,
+0x4c,0x10,0x30,0xf0,0xc0,0x10,0x30,0xf0,0xd0,0x00,0x90,0xf0,0x30,0x10,0xc0,0x02,0x46,0x03,0x0f,0x03,0x00,0x03,0x0f,0x03,0xc0,
+0x4c,0x20,0x60,0xe0,0x80,0x20,0x60,0xe0,0xa0,0x00,0x20,0xe0,0x60,0x20,0xc0,0x01,0x48,0x01,0x07,0x1e,0x06,0x01,0x07,0x1e,0x07,0x01,0xc0,
+0x4c,0x40,0xc0,0xc0,0x00,0x40,0xc0,0xc0,0x40,0x00,0x40,0xc0,0xc0,0x40,0xc0,0x01,0x48,0x03,0x0f,0x3c,0x0c,0x03,0x0f,0x3c,0x0e,0x03,0xc0,
+0x82,0x80,0x00,0x83,0x80,0x00,0x83,0x80,0xc0,0x00,0x4a,0x01,0x07,0x1e,0x78,0x19,0x07,0x1e,0x78,0x1c,0x07,0x01,0xc0,
+0x4c,0x01,0x03,0x0f,0x3c,0xf1,0x33,0x0f,0x3d,0xf0,0x39,0x0f,0x03,0x01,0xc0,
+0x4c,0x02,0x06,0x1e,0x78,0xe2,0x66,0x1e,0x7a,0xe0,0x72,0x1e,0x06,0x02,0xc0,0x03,0x40,0x01,0x02,0x40,0x01,0xc0,
+0x4c,0x04,0x0c,0x3c,0xf0,0xc4,0xcc,0x3c,0xf4,0xc0,0xe4,0x3c,0x0c,0x04,0xc0,0x03,0x40,0x03,0x02,0x40,0x03,0xc0,
+0x4c,0x08,0x18,0x78,0xe0,0x88,0x98,0x78,0xe8,0x80,0xc8,0x78,0x18,0x08,0xc0,0x02,0x46,0x01,0x07,0x01,0x00,0x01,0x07,0x01,0xc0,
 // 'x'
-120,11,8,8,0,0,27,12,20,0x3d,0xc0,0x00,0x18,0x80,0x00,0x0d,0x00,0x00,0x0e,0x00,0x00,0x07,0x00,0x00,0x0b,0x00,0x00,0x11,0x80,0x00,0x3b,0xc0,0x00,0x00,0x00,0x00,
+9,2,8,12,8,0,
+0x10,0x30,0xf0,0xd0,0x80,0x50,0x30,0x10,0x08,0x0c,0x0a,0x01,0x0b,0x0f,0x0c,0x08,
+0x20,0x60,0xe0,0xa0,0x00,0xa0,0x60,0x20,0x10,0x18,0x15,0x03,0x17,0x1e,0x18,0x10,
+0x40,0xc0,0xc0,0x40,0x00,0x40,0xc0,0x40,0x20,0x30,0x2b,0x07,0x2e,0x3d,0x30,0x20,
+0x80,0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x40,0x61,0x57,0x0e,0x5c,0x7a,0x61,0x40,
+0x81,0xc3,0xaf,0x1d,0xb8,0xf5,0xc3,0x81,
+0x02,0x86,0x5e,0x3a,0x70,0xea,0x86,0x02,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x01,
+0x04,0x0c,0xbc,0x74,0xe0,0xd4,0x0c,0x04,0x02,0x03,0x02,0x00,0x02,0x03,0x03,0x02,
+0x08,0x18,0x78,0xe8,0xc0,0xa8,0x18,0x08,0x04,0x06,0x05,0x00,0x05,0x07,0x06,0x04,
 // 'y'
-121,11,8,11,0,-3,36,12,23,0x3d,0xc0,0x00,0x18,0x80,0x00,0x0d,0x80,0x00,0x0d,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x06,0x00,0x00,0x34,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+9,2,8,12,11,0,
+0x10,0x30,0xf0,0xd0,0x00,0xd0,0x70,0x10,0x60,0x60,0x40,0x33,0x1f,0x03,0x00,0x00,
+0x20,0x60,0xe0,0xa0,0x00,0xa0,0xe0,0x20,0xc0,0xc0,0x81,0x67,0x3e,0x07,0x00,0x00,
+0x40,0xc0,0xc0,0x40,0x00,0x40,0xc0,0x40,0x80,0x80,0x03,0xcf,0x7c,0x0f,0x01,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,
+0x80,0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x01,0x07,0x9e,0xf8,0x1e,0x03,0x00,0x03,0x03,0x02,0x01,0x00,0x00,0x00,0x00,
+0x01,0x03,0x0f,0x3d,0xf0,0x3d,0x07,0x01,0x06,0x06,0x04,0x03,0x01,0x00,0x00,0x00,
+0x02,0x06,0x1e,0x7a,0xe0,0x7a,0x0e,0x02,0x0c,0x0c,0x08,0x06,0x03,0x00,0x00,0x00,
+0x04,0x0c,0x3c,0xf4,0xc0,0xf4,0x1c,0x04,0x18,0x18,0x10,0x0c,0x07,0x00,0x00,0x00,
+0x08,0x18,0x78,0xe8,0x80,0xe8,0x38,0x08,0x30,0x30,0x20,0x19,0x0f,0x01,0x00,0x00,
 // 'z'
-122,11,6,8,1,0,27,12,20,0x1f,0x80,0x00,0x11,0x80,0x00,0x13,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x0c,0x80,0x00,0x18,0x80,0x00,0x1f,0x80,0x00,0x00,0x00,0x00,
+8,3,6,12,8,0,
+0x70,0x10,0x90,0xd0,0x70,0x30,0x0c,0x0e,0x0b,0x09,0x08,0x0e,
+0xe0,0x20,0x20,0xa0,0xe0,0x60,0x18,0x1c,0x17,0x13,0x10,0x1c,
+0xc0,0x40,0x40,0x40,0xc0,0xc0,0x31,0x38,0x2e,0x27,0x21,0x38,
+0x80,0x80,0x80,0x80,0x80,0x80,0x63,0x70,0x5c,0x4e,0x43,0x71,
+0xc7,0xe1,0xb9,0x9d,0x87,0xe3,
+0x8e,0xc2,0x72,0x3a,0x0e,0xc6,0x01,0x01,0x01,0x01,0x01,0x01,
+0x1c,0x84,0xe4,0x74,0x1c,0x8c,0x03,0x03,0x02,0x02,0x02,0x03,
+0x38,0x08,0xc8,0xe8,0x38,0x18,0x06,0x07,0x05,0x04,0x04,0x07,
 // 'braceleft'
-123,9,3,14,1,-2,45,8,22,0x04,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+6,3,3,8,14,0,
+0x40,0xbe,0x01,0x00,0x1f,0x20,
+0x80,0x7c,0x02,0x00,0x3f,0x40,
+0x00,0xf8,0x04,0x01,0x7e,0x80,
+0x00,0xf0,0x08,0x02,0xfd,0x00,0x00,0x00,0x01,
+0x00,0xe0,0x10,0x04,0xfb,0x00,0x00,0x01,0x02,
+0x00,0xc0,0x20,0x08,0xf7,0x00,0x00,0x03,0x04,
+0x00,0x80,0x40,0x10,0xef,0x00,0x00,0x07,0x08,
+0x00,0x00,0x80,0x20,0xdf,0x00,0x00,0x0f,0x10,
 // 'bar'
-124,16,1,12,4,0,39,8,20,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+10,6,1,8,12,0,
+0xff,0x0f,
+0xfe,0x1f,
+0xfc,0x3f,
+0xf8,0x7f,
+0xf0,0xff,
+0xe0,0xff,0x01,
+0xc0,0xff,0x03,
+0x80,0xff,0x07,
 // 'braceright'
-125,9,3,14,1,-2,45,8,22,0x10,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+6,3,3,8,14,0,
+0x01,0xbe,0x40,0x20,0x1f,0x00,
+0x02,0x7c,0x80,0x40,0x3f,0x00,
+0x04,0xf8,0x00,0x80,0x7e,0x01,
+0x08,0xf0,0x00,0x00,0xfd,0x02,0x01,0x00,0x00,
+0x10,0xe0,0x00,0x00,0xfb,0x04,0x02,0x01,0x00,
+0x20,0xc0,0x00,0x00,0xf7,0x08,0x04,0x03,0x00,
+0x40,0x80,0x00,0x00,0xef,0x10,0x08,0x07,0x00,
+0x80,0x00,0x00,0x00,0xdf,0x20,0x10,0x0f,0x00,
 // 'asciitilde'
-126,13,8,2,1,3,9,15,17,0x0e,0x60,0x00,0x19,0xc0,0x00,0x00,0x00,0x00,
-// 'space'
-160,7,1,1,1,0,6,19,20,0x00,0x00,0x00,0x00,0x00,0x00,
+10,3,8,15,2,0,
+0x00,0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x01,0x01,0x00,0x00,0x01,0x01,0x01,0x00,
+0x02,0x03,0x01,0x01,0x02,0x02,0x03,0x01,
+0x04,0x06,0x02,0x02,0x04,0x04,0x06,0x02,
+0x08,0x0c,0x04,0x04,0x08,0x08,0x0c,0x04,
+0x10,0x18,0x08,0x08,0x10,0x10,0x18,0x08,
+0x20,0x30,0x10,0x10,0x20,0x20,0x30,0x10,
+0x40,0x60,0x20,0x20,0x40,0x40,0x60,0x20,
+0x80,0xc0,0x40,0x40,0x80,0x80,0xc0,0x40,
+// 'space' same as 242
 // 'exclamdown'
-161,8,2,12,1,-3,39,11,23,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
+5,3,2,11,12,0,
+0x18,0xd8,0x7c,0x7f,
+0x30,0xb0,0xf8,0xff,
+0x60,0x60,0xf0,0xff,0x01,0x01,
+0xc0,0xc0,0xe0,0xfe,0x03,0x03,
+0x80,0x80,0xc1,0xfd,0x07,0x07,
+0x83,0xfb,0x0f,0x0f,
+0x06,0xf6,0x1f,0x1f,
+0x0c,0xec,0x3e,0x3f,
 // 'cent'
-162,12,6,12,1,-2,39,10,22,0x00,0x80,0x00,0x00,0x80,0x00,0x07,0x00,0x00,0x09,0x80,0x00,0x19,0x80,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x1c,0x80,0x00,0x0c,0x80,0x00,0x07,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,
+9,3,6,10,12,0,
+0xc0,0x60,0x10,0x90,0x70,0x6c,0x03,0x36,0x0e,0x09,0x08,0x06,
+0x80,0xc0,0x20,0x20,0xe0,0xd8,0x07,0x6c,0x1c,0x13,0x10,0x0c,
+0x00,0x80,0x40,0x40,0xc0,0xb0,0x0f,0xd9,0x38,0x26,0x21,0x19,
+0x00,0x00,0x80,0x80,0x80,0x60,0x1e,0xb3,0x70,0x4c,0x43,0x33,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0xc0,0x3c,0x66,0xe1,0x99,0x87,0x66,0x00,0x03,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x80,0x78,0xcc,0xc2,0x32,0x0e,0xcd,0x00,0x06,0x01,0x01,0x01,0x00,
+0xf0,0x98,0x84,0x64,0x1c,0x9b,0x00,0x0d,0x03,0x02,0x02,0x01,
+0xe0,0x30,0x08,0xc8,0x38,0x36,0x01,0x1b,0x07,0x04,0x04,0x03,
 // 'sterling'
-163,11,9,12,0,0,39,8,20,0x07,0x80,0x00,0x0c,0x40,0x00,0x08,0xc0,0x00,0x08,0xc0,0x00,0x0c,0x00,0x00,0x04,0x00,0x00,0x3f,0x80,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x1c,0x20,0x00,0x2f,0xc0,0x00,0x13,0x80,0x00,0x00,0x00,0x00,
+9,2,9,8,12,0,
+0x40,0x40,0x5e,0xf3,0x41,0x41,0x4d,0x0e,0x00,0x04,0x0a,0x06,0x07,0x0c,0x0c,0x0c,0x04,0x02,
+0x80,0x80,0xbc,0xe6,0x82,0x82,0x9a,0x1c,0x00,0x08,0x14,0x0c,0x0f,0x18,0x18,0x18,0x08,0x04,
+0x00,0x00,0x78,0xcc,0x04,0x04,0x34,0x38,0x00,0x11,0x29,0x19,0x1f,0x31,0x31,0x31,0x10,0x08,
+0x00,0x00,0xf0,0x98,0x08,0x08,0x68,0x70,0x00,0x22,0x52,0x32,0x3f,0x62,0x62,0x62,0x20,0x10,
+0x00,0x00,0xe0,0x30,0x10,0x10,0xd0,0xe0,0x00,0x44,0xa4,0x65,0x7f,0xc4,0xc4,0xc4,0x40,0x20,
+0x00,0x00,0xc0,0x60,0x20,0x20,0xa0,0xc0,0x00,0x88,0x48,0xcb,0xfe,0x88,0x88,0x89,0x81,0x40,0x00,0x01,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x00,0x80,0xc0,0x40,0x40,0x40,0x80,0x00,0x10,0x90,0x97,0xfc,0x10,0x10,0x13,0x03,0x80,0x01,0x02,0x01,0x01,0x03,0x03,0x03,0x01,0x00,
+0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x20,0x20,0x2f,0xf9,0x20,0x20,0x26,0x07,0x00,0x02,0x05,0x03,0x03,0x06,0x06,0x06,0x02,0x01,
 // 'currency'
-164,12,7,8,1,2,27,10,18,0x17,0x40,0x00,0x0d,0x80,0x00,0x18,0xc0,0x00,0x10,0x40,0x00,0x10,0x40,0x00,0x18,0xc0,0x00,0x0d,0x80,0x00,0x17,0x40,0x00,0x00,0x00,0x00,
+9,3,7,10,8,0,
+0xf4,0x98,0x0c,0x04,0x0c,0x98,0xf4,0x02,0x01,0x03,0x02,0x03,0x01,0x02,
+0xe8,0x30,0x18,0x08,0x18,0x30,0xe8,0x05,0x03,0x06,0x04,0x06,0x03,0x05,
+0xd0,0x60,0x30,0x10,0x30,0x60,0xd0,0x0b,0x06,0x0c,0x08,0x0c,0x06,0x0b,
+0xa0,0xc0,0x60,0x20,0x60,0xc0,0xa0,0x17,0x0c,0x18,0x10,0x18,0x0c,0x17,
+0x40,0x80,0xc0,0x40,0xc0,0x80,0x40,0x2f,0x19,0x30,0x20,0x30,0x19,0x2f,
+0x80,0x00,0x80,0x80,0x80,0x00,0x80,0x5e,0x33,0x61,0x40,0x61,0x33,0x5e,
+0xbd,0x66,0xc3,0x81,0xc3,0x66,0xbd,
+0x7a,0xcc,0x86,0x02,0x86,0xcc,0x7a,0x01,0x00,0x01,0x01,0x01,0x00,0x01,
 // 'yen'
-165,11,9,12,0,0,39,8,20,0x3c,0xe0,0x00,0x18,0x40,0x00,0x08,0x80,0x00,0x0c,0x80,0x00,0x05,0x00,0x00,0x05,0x00,0x00,0x0f,0x80,0x00,0x02,0x00,0x00,0x0f,0x80,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,
+9,2,9,8,12,2,
+0x48,0x01,0x03,0x4f,0x79,0xc0,0x70,0x4d,0x03,0x01,0xc0,0x01,0x44,0x09,0x09,0x0f,0x09,0x09,0xc0,
+0x48,0x02,0x06,0x9e,0xf2,0x80,0xe0,0x9a,0x06,0x02,0xc0,0x01,0x44,0x12,0x12,0x1f,0x12,0x12,0xc0,
+0x48,0x04,0x0c,0x3c,0xe4,0x00,0xc0,0x34,0x0c,0x04,0xc0,0x01,0x44,0x25,0x25,0x3f,0x25,0x25,0xc0,
+0x48,0x08,0x18,0x78,0xc8,0x00,0x80,0x68,0x18,0x08,0xc0,0x01,0x44,0x4a,0x4b,0x7e,0x4b,0x4a,0xc0,
+0x43,0x10,0x30,0xf0,0x90,0x01,0x42,0xd0,0x30,0x10,0xc0,0x01,0x44,0x94,0x97,0xfc,0x97,0x94,0xc0,
+0x43,0x20,0x60,0xe0,0x20,0x01,0x42,0xa0,0x60,0x20,0xc0,0x01,0x44,0x29,0x2f,0xf8,0x2e,0x29,0xc0,0x01,0x84,0x01,0xc0,
+0x43,0x40,0xc0,0xc0,0x40,0x01,0x42,0x40,0xc0,0x40,0xc0,0x01,0x44,0x53,0x5e,0xf0,0x5c,0x53,0xc0,0x01,0x44,0x02,0x02,0x03,0x02,0x02,0xc0,
+0x83,0x80,0x01,0x82,0x80,0xc0,0x00,0x46,0x01,0xa7,0xbc,0xe0,0xb8,0xa6,0x01,0xc0,0x01,0x44,0x04,0x04,0x07,0x04,0x04,0xc0,
 // 'brokenbar'
-166,16,1,12,4,0,39,8,20,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+10,6,1,8,12,0,
+0x9f,0x0f,
+0x3e,0x1f,
+0x7c,0x3e,
+0xf8,0x7c,
+0xf0,0xf9,
+0xe0,0xf3,0x01,
+0xc0,0xe7,0x03,
+0x80,0xcf,0x07,
 // 'section'
-167,11,6,15,1,-3,48,8,23,0x07,0x00,0x00,0x09,0x00,0x00,0x08,0x00,0x00,0x0c,0x00,0x00,0x06,0x00,0x00,0x0b,0x00,0x00,0x11,0x80,0x00,0x10,0x80,0x00,0x18,0x80,0x00,0x0d,0x00,0x00,0x06,0x00,0x00,0x03,0x00,0x00,0x01,0x00,0x00,0x09,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,3,6,8,15,0,
+0xc0,0x2e,0x19,0x31,0x63,0xc0,0x01,0x63,0x46,0x4c,0x3a,0x01,
+0x80,0x5c,0x32,0x62,0xc6,0x80,0x03,0xc6,0x8c,0x98,0x74,0x03,
+0x00,0xb8,0x64,0xc4,0x8c,0x00,0x07,0x8c,0x18,0x30,0xe9,0x07,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x70,0xc8,0x88,0x18,0x00,0x0e,0x19,0x30,0x61,0xd3,0x0e,0x00,0x03,0x02,0x02,0x01,0x00,
+0x00,0xe0,0x90,0x10,0x30,0x00,0x1c,0x32,0x61,0xc3,0xa6,0x1c,0x00,0x06,0x04,0x04,0x03,0x00,
+0x00,0xc0,0x20,0x20,0x60,0x00,0x38,0x65,0xc3,0x86,0x4c,0x38,0x00,0x0c,0x08,0x09,0x07,0x00,
+0x00,0x80,0x40,0x40,0xc0,0x00,0x70,0xcb,0x86,0x0c,0x98,0x70,0x00,0x18,0x11,0x13,0x0e,0x00,
+0x00,0x00,0x80,0x80,0x80,0x00,0xe0,0x97,0x0c,0x18,0x31,0xe0,0x00,0x31,0x23,0x26,0x1d,0x00,
 // 'dieresis'
-168,7,5,2,0,9,9,9,11,0x36,0x00,0x00,0x36,0x00,0x00,0x00,0x00,0x00,
+5,2,5,9,2,0,
+0x06,0x06,0x00,0x06,0x06,
+0x0c,0x0c,0x00,0x0c,0x0c,
+0x18,0x18,0x00,0x18,0x18,
+0x30,0x30,0x00,0x30,0x30,
+0x60,0x60,0x00,0x60,0x60,
+0xc0,0xc0,0x00,0xc0,0xc0,
+0x80,0x80,0x00,0x80,0x80,0x01,0x01,0x00,0x01,0x01,
+0x03,0x03,0x00,0x03,0x03,
 // 'copyright'
-169,14,12,12,0,0,39,8,20,0x07,0xe0,0x00,0x0c,0x30,0x00,0x11,0xc8,0x00,0x33,0x6c,0x00,0x26,0x24,0x00,0x24,0x04,0x00,0x24,0x04,0x00,0x26,0x24,0x00,0x33,0x6c,0x00,0x11,0xc8,0x00,0x0c,0x30,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,
+12,2,12,8,12,0,
+0xf8,0x0c,0x02,0xf3,0x99,0x0d,0x05,0x0d,0x9b,0x02,0x0c,0xf8,0x01,0x03,0x04,0x0c,0x09,0x0b,0x0a,0x0b,0x0d,0x04,0x03,0x01,
+0xf0,0x18,0x04,0xe6,0x32,0x1a,0x0a,0x1a,0x36,0x04,0x18,0xf0,0x03,0x06,0x08,0x19,0x13,0x16,0x14,0x16,0x1b,0x08,0x06,0x03,
+0xe0,0x30,0x08,0xcc,0x64,0x34,0x14,0x34,0x6c,0x08,0x30,0xe0,0x07,0x0c,0x10,0x33,0x26,0x2c,0x28,0x2c,0x36,0x10,0x0c,0x07,
+0xc0,0x60,0x10,0x98,0xc8,0x68,0x28,0x68,0xd8,0x10,0x60,0xc0,0x0f,0x18,0x20,0x67,0x4c,0x58,0x50,0x58,0x6c,0x20,0x18,0x0f,
+0x80,0xc0,0x20,0x30,0x90,0xd0,0x50,0xd0,0xb0,0x20,0xc0,0x80,0x1f,0x30,0x40,0xcf,0x99,0xb0,0xa0,0xb0,0xd9,0x40,0x30,0x1f,
+0x00,0x80,0x40,0x60,0x20,0xa0,0xa0,0xa0,0x60,0x40,0x80,0x00,0x3f,0x61,0x80,0x9e,0x33,0x61,0x40,0x61,0xb3,0x80,0x61,0x3f,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,
+0x00,0x00,0x80,0xc0,0x40,0x40,0x40,0x40,0xc0,0x80,0x00,0x00,0x7e,0xc3,0x00,0x3c,0x66,0xc3,0x81,0xc3,0x66,0x00,0xc3,0x7e,0x00,0x00,0x01,0x03,0x02,0x02,0x02,0x02,0x03,0x01,0x00,0x00,
+0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0xfc,0x86,0x01,0x79,0xcc,0x86,0x02,0x86,0xcd,0x01,0x86,0xfc,0x00,0x01,0x02,0x06,0x04,0x05,0x05,0x05,0x06,0x02,0x01,0x00,
 // 'ordfeminine'
-170,8,5,7,0,5,24,8,15,0x38,0x00,0x00,0x24,0x00,0x00,0x1c,0x00,0x00,0x24,0x00,0x00,0x3a,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,
+6,2,5,8,7,0,
+0x5b,0x55,0x55,0x4e,0x10,
+0xb6,0xaa,0xaa,0x9c,0x20,
+0x6c,0x54,0x54,0x38,0x40,0x01,0x01,0x01,0x01,0x00,
+0xd8,0xa8,0xa8,0x70,0x80,0x02,0x02,0x02,0x02,0x00,
+0xb0,0x50,0x50,0xe0,0x00,0x05,0x05,0x05,0x04,0x01,
+0x60,0xa0,0xa0,0xc0,0x00,0x0b,0x0a,0x0a,0x09,0x02,
+0xc0,0x40,0x40,0x80,0x00,0x16,0x15,0x15,0x13,0x04,
+0x80,0x80,0x80,0x00,0x00,0x2d,0x2a,0x2a,0x27,0x08,
 // 'guillemotleft'
-171,9,6,5,0,1,18,14,19,0x09,0x00,0x00,0x12,0x00,0x00,0x36,0x00,0x00,0x12,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,
+7,2,6,14,5,0,
+0x00,0x80,0x40,0x00,0x80,0x40,0x01,0x03,0x04,0x01,0x03,0x04,
+0x00,0x00,0x80,0x00,0x00,0x80,0x02,0x07,0x08,0x02,0x07,0x08,
+0x04,0x0e,0x11,0x04,0x0e,0x11,
+0x08,0x1c,0x22,0x08,0x1c,0x22,
+0x10,0x38,0x44,0x10,0x38,0x44,
+0x20,0x70,0x88,0x20,0x70,0x88,
+0x40,0xe0,0x10,0x40,0xe0,0x10,0x00,0x00,0x01,0x00,0x00,0x01,
+0x80,0xc0,0x20,0x80,0xc0,0x20,0x00,0x01,0x02,0x00,0x01,0x02,
 // 'logicalnot'
-172,13,8,5,1,1,18,14,19,0x1f,0xe0,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x00,0x00,
-// 'hyphen'
-173,7,4,1,0,3,6,16,17,0x3c,0x00,0x00,0x00,0x00,0x00,
+10,3,8,14,5,2,
+0x86,0x40,0x40,0xc0,0xc0,0x06,0x40,0x07,0xc0,
+0x87,0x80,0xc0,0x06,0x40,0x0f,0xc0,
+0x86,0x01,0x40,0x1f,0xc0,
+0x86,0x02,0x40,0x3e,0xc0,
+0x86,0x04,0x40,0x7c,0xc0,
+0x86,0x08,0x40,0xf8,0xc0,
+0x86,0x10,0x40,0xf0,0xc0,0x06,0x40,0x01,0xc0,
+0x86,0x20,0x40,0xe0,0xc0,0x06,0x40,0x03,0xc0,
+// 'hyphen' same as 1558
 // 'registered'
-174,14,12,12,0,0,39,8,20,0x07,0xe0,0x00,0x0c,0x30,0x00,0x17,0xc8,0x00,0x32,0x6c,0x00,0x22,0x64,0x00,0x23,0xc4,0x00,0x22,0x44,0x00,0x22,0x64,0x00,0x32,0x2c,0x00,0x17,0x38,0x00,0x0c,0x30,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,
+12,2,12,8,12,0,
+0xf8,0x0c,0x02,0x07,0xfd,0x25,0x25,0xfd,0x9b,0x02,0x0c,0xf8,0x01,0x03,0x04,0x0e,0x0b,0x0a,0x08,0x08,0x0f,0x06,0x03,0x01,
+0xf0,0x18,0x04,0x0e,0xfa,0x4a,0x4a,0xfa,0x36,0x04,0x18,0xf0,0x03,0x06,0x08,0x1c,0x17,0x14,0x10,0x11,0x1f,0x0c,0x06,0x03,
+0xe0,0x30,0x08,0x1c,0xf4,0x94,0x94,0xf4,0x6c,0x08,0x30,0xe0,0x07,0x0c,0x10,0x38,0x2f,0x28,0x20,0x23,0x3e,0x18,0x0c,0x07,
+0xc0,0x60,0x10,0x38,0xe8,0x28,0x28,0xe8,0xd8,0x10,0x60,0xc0,0x0f,0x18,0x20,0x70,0x5f,0x51,0x41,0x47,0x7c,0x30,0x18,0x0f,
+0x80,0xc0,0x20,0x70,0xd0,0x50,0x50,0xd0,0xb0,0x20,0xc0,0x80,0x1f,0x30,0x40,0xe0,0xbf,0xa2,0x82,0x8f,0xf9,0x60,0x30,0x1f,
+0x00,0x80,0x40,0xe0,0xa0,0xa0,0xa0,0xa0,0x60,0x40,0x80,0x00,0x3f,0x61,0x80,0xc0,0x7f,0x44,0x04,0x1f,0xf3,0xc0,0x61,0x3f,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,
+0x00,0x00,0x80,0xc0,0x40,0x40,0x40,0x40,0xc0,0x80,0x00,0x00,0x7e,0xc3,0x00,0x81,0xff,0x89,0x09,0x3f,0xe6,0x80,0xc3,0x7e,0x00,0x00,0x01,0x03,0x02,0x02,0x02,0x02,0x03,0x01,0x00,0x00,
+0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0xfc,0x86,0x01,0x03,0xfe,0x12,0x12,0x7e,0xcd,0x01,0x86,0xfc,0x00,0x01,0x02,0x07,0x05,0x05,0x04,0x04,0x07,0x03,0x01,0x00,
 // 'macron'
-175,7,5,1,0,9,6,10,11,0x3e,0x00,0x00,0x00,0x00,0x00,
+5,2,5,10,1,2,
+0x84,0x04,0xc0,
+0x84,0x08,0xc0,
+0x84,0x10,0xc0,
+0x84,0x20,0xc0,
+0x84,0x40,0xc0,
+0x84,0x80,0xc0,
+0x84,0x01,0xc0,
+0x84,0x02,0xc0,
 // 'degree'
-176,10,5,5,1,7,18,8,13,0x0e,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+7,3,5,8,5,0,
+0x0e,0x11,0x11,0x11,0x0e,
+0x1c,0x22,0x22,0x22,0x1c,
+0x38,0x44,0x44,0x44,0x38,
+0x70,0x88,0x88,0x88,0x70,
+0xe0,0x10,0x10,0x10,0xe0,0x00,0x01,0x01,0x01,0x00,
+0xc0,0x20,0x20,0x20,0xc0,0x01,0x02,0x02,0x02,0x01,
+0x80,0x40,0x40,0x40,0x80,0x03,0x04,0x04,0x04,0x03,
+0x00,0x80,0x80,0x80,0x00,0x07,0x08,0x08,0x08,0x07,
 // 'plusminus'
-177,13,7,9,1,0,30,11,20,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x1f,0xc0,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,
+10,3,7,11,9,2,
+0x82,0x40,0x40,0xf8,0x82,0x40,0xc0,0x82,0x08,0x40,0x0b,0x82,0x08,0xc0,
+0x82,0x80,0x40,0xf0,0x82,0x80,0xc0,0x82,0x10,0x40,0x17,0x82,0x10,0xc0,
+0x02,0x40,0xe0,0xc0,0x82,0x21,0x40,0x2f,0x82,0x21,0xc0,
+0x02,0x40,0xc0,0xc0,0x82,0x42,0x40,0x5f,0x82,0x42,0xc0,
+0x02,0x40,0x80,0xc0,0x82,0x84,0x40,0xbf,0x82,0x84,0xc0,
+0x82,0x08,0x40,0x7f,0x82,0x08,0xc0,0x86,0x01,0xc0,
+0x82,0x10,0x40,0xfe,0x82,0x10,0xc0,0x86,0x02,0xc0,
+0x82,0x20,0x40,0xfc,0x82,0x20,0xc0,0x82,0x04,0x40,0x05,0x82,0x04,0xc0,
 // 'twosuperior'
-178,8,5,7,0,5,24,8,15,0x1c,0x00,0x00,0x36,0x00,0x00,0x22,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x12,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,
+6,2,5,8,7,0,
+0x46,0x63,0x51,0x4b,0x66,
+0x8c,0xc6,0xa2,0x96,0xcc,
+0x18,0x8c,0x44,0x2c,0x98,0x01,0x01,0x01,0x01,0x01,
+0x30,0x18,0x88,0x58,0x30,0x02,0x03,0x02,0x02,0x03,
+0x60,0x30,0x10,0xb0,0x60,0x04,0x06,0x05,0x04,0x06,
+0xc0,0x60,0x20,0x60,0xc0,0x08,0x0c,0x0a,0x09,0x0c,
+0x80,0xc0,0x40,0xc0,0x80,0x11,0x18,0x14,0x12,0x19,
+0x00,0x80,0x80,0x80,0x00,0x23,0x31,0x28,0x25,0x33,
 // 'threesuperior'
-179,8,5,7,0,5,24,8,15,0x1c,0x00,0x00,0x36,0x00,0x00,0x22,0x00,0x00,0x0c,0x00,0x00,0x22,0x00,0x00,0x36,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,
+6,2,5,8,7,0,
+0x36,0x63,0x49,0x6b,0x36,
+0x6c,0xc6,0x92,0xd6,0x6c,
+0xd8,0x8c,0x24,0xac,0xd8,0x00,0x01,0x01,0x01,0x00,
+0xb0,0x18,0x48,0x58,0xb0,0x01,0x03,0x02,0x03,0x01,
+0x60,0x30,0x90,0xb0,0x60,0x03,0x06,0x04,0x06,0x03,
+0xc0,0x60,0x20,0x60,0xc0,0x06,0x0c,0x09,0x0d,0x06,
+0x80,0xc0,0x40,0xc0,0x80,0x0d,0x18,0x12,0x1a,0x0d,
+0x00,0x80,0x80,0x80,0x00,0x1b,0x31,0x24,0x35,0x1b,
 // 'acute'
-180,7,3,3,0,9,12,8,11,0x08,0x00,0x00,0x18,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
+5,2,3,8,3,0,
+0x04,0x02,0x03,
+0x08,0x04,0x06,
+0x10,0x08,0x0c,
+0x20,0x10,0x18,
+0x40,0x20,0x30,
+0x80,0x40,0x60,
+0x00,0x80,0xc0,0x01,0x00,0x00,
+0x00,0x00,0x80,0x02,0x01,0x01,
 // 'mu'
-181,12,10,11,0,-3,36,12,23,0x39,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x1f,0x70,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
+10,2,10,12,11,2,
+0x42,0x10,0xf0,0xf0,0x01,0x42,0x10,0xf0,0xf0,0xc0,0x00,0x41,0x7f,0x7f,0x82,0x08,0x43,0x07,0x0f,0x08,0x08,0xc0,
+0x42,0x20,0xe0,0xe0,0x01,0x42,0x20,0xe0,0xe0,0xc0,0x00,0x41,0xff,0xff,0x82,0x10,0x43,0x0f,0x1f,0x10,0x10,0xc0,
+0x42,0x40,0xc0,0xc0,0x01,0x42,0x40,0xc0,0xc0,0xc0,0x00,0x41,0xff,0xff,0x82,0x20,0x43,0x1f,0x3f,0x20,0x20,0xc0,0x00,0x41,0x01,0x01,0xc0,
+0x82,0x80,0x01,0x82,0x80,0xc0,0x00,0x41,0xff,0xff,0x82,0x40,0x43,0x3f,0x7f,0x40,0x40,0xc0,0x00,0x41,0x03,0x03,0xc0,
+0x49,0x01,0xff,0xff,0x80,0x80,0x81,0x7f,0xff,0x80,0x80,0xc0,0x00,0x41,0x07,0x07,0xc0,
+0x42,0x02,0xfe,0xfe,0x01,0x42,0x02,0xfe,0xfe,0xc0,0x00,0x41,0x0f,0x0f,0x82,0x01,0x00,0x82,0x01,0xc0,
+0x42,0x04,0xfc,0xfc,0x01,0x42,0x04,0xfc,0xfc,0xc0,0x00,0x41,0x1f,0x1f,0x82,0x02,0x43,0x01,0x03,0x02,0x02,0xc0,
+0x42,0x08,0xf8,0xf8,0x01,0x42,0x08,0xf8,0xf8,0xc0,0x00,0x41,0x3f,0x3f,0x82,0x04,0x43,0x03,0x07,0x04,0x04,0xc0,
 // 'paragraph'
-182,12,8,15,0,-3,48,8,23,0x1f,0xc0,0x00,0x3a,0x80,0x00,0x32,0x80,0x00,0x32,0x80,0x00,0x32,0x80,0x00,0x3a,0x80,0x00,0x1e,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,
+10,2,8,8,15,0,
+0x3e,0x7f,0x63,0x41,0xff,0x01,0xff,0x01,0x00,0x00,0x00,0x40,0x7f,0x40,0x7f,0x40,
+0x7c,0xfe,0xc6,0x82,0xfe,0x02,0xfe,0x02,0x00,0x00,0x00,0x80,0xff,0x80,0xff,0x80,
+0xf8,0xfc,0x8c,0x04,0xfc,0x04,0xfc,0x04,0x00,0x01,0x01,0x01,0xff,0x00,0xff,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,
+0xf0,0xf8,0x18,0x08,0xf8,0x08,0xf8,0x08,0x01,0x03,0x03,0x02,0xff,0x00,0xff,0x00,0x00,0x00,0x00,0x02,0x03,0x02,0x03,0x02,
+0xe0,0xf0,0x30,0x10,0xf0,0x10,0xf0,0x10,0x03,0x07,0x06,0x04,0xff,0x00,0xff,0x00,0x00,0x00,0x00,0x04,0x07,0x04,0x07,0x04,
+0xc0,0xe0,0x60,0x20,0xe0,0x20,0xe0,0x20,0x07,0x0f,0x0c,0x08,0xff,0x00,0xff,0x00,0x00,0x00,0x00,0x08,0x0f,0x08,0x0f,0x08,
+0x80,0xc0,0xc0,0x40,0xc0,0x40,0xc0,0x40,0x0f,0x1f,0x18,0x10,0xff,0x00,0xff,0x00,0x00,0x00,0x00,0x10,0x1f,0x10,0x1f,0x10,
+0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x1f,0x3f,0x31,0x20,0xff,0x00,0xff,0x00,0x00,0x00,0x00,0x20,0x3f,0x20,0x3f,0x20,
 // 'periodcentered'
-183,8,2,2,1,3,9,15,17,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
+5,3,2,15,2,0,
+0x80,0x80,0x01,0x01,
+0x03,0x03,
+0x06,0x06,
+0x0c,0x0c,
+0x18,0x18,
+0x30,0x30,
+0x60,0x60,
+0xc0,0xc0,
 // 'cedilla'
-184,8,3,4,1,-3,15,19,23,0x08,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
+5,3,3,19,4,0,
+0x40,0x58,0x20,
+0x80,0xb0,0x40,
+0x00,0x60,0x80,0x01,0x01,0x00,
+0x00,0xc0,0x00,0x02,0x02,0x01,
+0x00,0x80,0x00,0x04,0x05,0x02,
+0x08,0x0b,0x04,
+0x10,0x16,0x08,
+0x20,0x2c,0x10,
 // 'onesuperior'
-185,9,3,7,1,5,24,8,15,0x08,0x00,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,
+6,3,3,8,7,0,
+0x42,0x7f,0x40,
+0x84,0xfe,0x80,
+0x08,0xfc,0x00,0x01,0x01,0x01,
+0x10,0xf8,0x00,0x02,0x03,0x02,
+0x20,0xf0,0x00,0x04,0x07,0x04,
+0x40,0xe0,0x00,0x08,0x0f,0x08,
+0x80,0xc0,0x00,0x10,0x1f,0x10,
+0x00,0x80,0x00,0x21,0x3f,0x20,
 // 'ordmasculine'
-186,7,4,7,0,5,24,8,15,0x18,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,
+5,2,4,8,7,0,
+0x4e,0x51,0x51,0x4e,
+0x9c,0xa2,0xa2,0x9c,
+0x38,0x44,0x44,0x38,0x01,0x01,0x01,0x01,
+0x70,0x88,0x88,0x70,0x02,0x02,0x02,0x02,
+0xe0,0x10,0x10,0xe0,0x04,0x05,0x05,0x04,
+0xc0,0x20,0x20,0xc0,0x09,0x0a,0x0a,0x09,
+0x80,0x40,0x40,0x80,0x13,0x14,0x14,0x13,
+0x00,0x80,0x80,0x00,0x27,0x28,0x28,0x27,
 // 'guillemotright'
-187,9,6,5,0,1,18,14,19,0x24,0x00,0x00,0x12,0x00,0x00,0x1b,0x00,0x00,0x12,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00,
+7,2,6,14,5,0,
+0x40,0x80,0x00,0x40,0x80,0x00,0x04,0x03,0x01,0x04,0x03,0x01,
+0x80,0x00,0x00,0x80,0x00,0x00,0x08,0x07,0x02,0x08,0x07,0x02,
+0x11,0x0e,0x04,0x11,0x0e,0x04,
+0x22,0x1c,0x08,0x22,0x1c,0x08,
+0x44,0x38,0x10,0x44,0x38,0x10,
+0x88,0x70,0x20,0x88,0x70,0x20,
+0x10,0xe0,0x40,0x10,0xe0,0x40,0x01,0x00,0x00,0x01,0x00,0x00,
+0x20,0xc0,0x80,0x20,0xc0,0x80,0x02,0x01,0x00,0x02,0x01,0x00,
 // 'onequarter'
-188,17,11,12,1,0,39,8,20,0x08,0x08,0x00,0x18,0x18,0x00,0x08,0x30,0x00,0x08,0x20,0x00,0x08,0x40,0x00,0x08,0xc8,0x00,0x1d,0x98,0x00,0x01,0x28,0x00,0x02,0x48,0x00,0x06,0x7c,0x00,0x0c,0x08,0x00,0x08,0x1c,0x00,0x00,0x00,0x00,
+14,3,11,8,12,0,
+0x42,0x7f,0x40,0x00,0xc0,0x60,0x30,0x8c,0x46,0xe3,0x00,0x00,0x0c,0x06,0x03,0x00,0x00,0x03,0x02,0x0a,0x0f,0x0a,
+0x84,0xfe,0x80,0x00,0x80,0xc0,0x60,0x18,0x8c,0xc6,0x00,0x00,0x18,0x0c,0x06,0x01,0x00,0x06,0x05,0x14,0x1f,0x14,
+0x08,0xfc,0x00,0x00,0x00,0x80,0xc0,0x30,0x18,0x8c,0x00,0x01,0x31,0x19,0x0c,0x03,0x01,0x0c,0x0a,0x29,0x3f,0x28,
+0x10,0xf8,0x00,0x00,0x00,0x00,0x80,0x60,0x30,0x18,0x00,0x02,0x63,0x32,0x18,0x06,0x03,0x19,0x14,0x52,0x7f,0x50,
+0x20,0xf0,0x00,0x00,0x00,0x00,0x00,0xc0,0x60,0x30,0x00,0x04,0xc7,0x64,0x30,0x0c,0x06,0x33,0x28,0xa4,0xfe,0xa0,
+0x40,0xe0,0x00,0x00,0x00,0x00,0x00,0x80,0xc0,0x60,0x00,0x08,0x8f,0xc8,0x60,0x18,0x0c,0x66,0x51,0x48,0xfc,0x40,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,
+0x80,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xc0,0x00,0x10,0x1f,0x90,0xc0,0x30,0x18,0xcc,0xa3,0x91,0xf8,0x80,0x00,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x02,
+0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x21,0x3f,0x20,0x80,0x60,0x30,0x98,0x46,0x23,0xf1,0x00,0x00,0x06,0x03,0x01,0x00,0x00,0x01,0x01,0x05,0x07,0x05,
 // 'onehalf'
-189,16,11,12,1,0,39,8,20,0x08,0x10,0x00,0x18,0x30,0x00,0x08,0x60,0x00,0x08,0x40,0x00,0x08,0x80,0x00,0x09,0xb8,0x00,0x1f,0x6c,0x00,0x02,0x44,0x00,0x04,0x18,0x00,0x0c,0x20,0x00,0x18,0x64,0x00,0x10,0x7c,0x00,0x00,0x00,0x00,
+13,3,11,8,12,0,
+0x42,0x7f,0x40,0xc0,0x60,0x30,0xcc,0x66,0x23,0x60,0xc0,0x0c,0x06,0x03,0x00,0x00,0x00,0x0c,0x0e,0x09,0x09,0x0c,
+0x84,0xfe,0x80,0x80,0xc0,0x60,0x98,0xcc,0x46,0xc0,0x80,0x18,0x0c,0x06,0x01,0x00,0x00,0x19,0x1c,0x12,0x12,0x19,
+0x08,0xfc,0x00,0x00,0x80,0xc0,0x30,0x98,0x8c,0x80,0x00,0x31,0x19,0x0d,0x03,0x01,0x00,0x33,0x39,0x24,0x25,0x33,
+0x10,0xf8,0x00,0x00,0x00,0x80,0x60,0x30,0x18,0x00,0x00,0x62,0x33,0x1a,0x06,0x03,0x01,0x66,0x73,0x49,0x4b,0x66,
+0x20,0xf0,0x00,0x00,0x00,0x00,0xc0,0x60,0x30,0x00,0x00,0xc4,0x67,0x34,0x0c,0x06,0x03,0xcc,0xe6,0x92,0x96,0xcc,
+0x40,0xe0,0x00,0x00,0x00,0x00,0x80,0xc0,0x60,0x00,0x00,0x88,0xcf,0x68,0x18,0x0c,0x06,0x99,0xcc,0x24,0x2c,0x98,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,
+0x80,0xc0,0x00,0x00,0x00,0x00,0x00,0x80,0xc0,0x00,0x00,0x10,0x9f,0xd0,0x30,0x18,0x0c,0x33,0x99,0x48,0x58,0x30,0x03,0x01,0x00,0x00,0x00,0x00,0x03,0x03,0x02,0x02,0x03,
+0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x21,0x3f,0xa0,0x60,0x30,0x18,0x66,0x33,0x91,0xb0,0x60,0x06,0x03,0x01,0x00,0x00,0x00,0x06,0x07,0x04,0x04,0x06,
 // 'threequarters'
-190,16,13,12,0,0,39,8,20,0x1c,0x06,0x00,0x36,0x0c,0x00,0x22,0x18,0x00,0x0c,0x30,0x00,0x22,0x20,0x00,0x36,0x64,0x00,0x1c,0xcc,0x00,0x01,0x94,0x00,0x01,0x24,0x00,0x03,0x3e,0x00,0x06,0x04,0x00,0x0c,0x0e,0x00,0x00,0x00,0x00,
+14,2,13,8,12,0,
+0x36,0x63,0x49,0x6b,0x36,0x80,0xc0,0x60,0x38,0x8c,0x46,0xe3,0x01,0x00,0x00,0x08,0x0c,0x06,0x03,0x00,0x00,0x03,0x02,0x0a,0x0f,0x0a,
+0x6c,0xc6,0x92,0xd6,0x6c,0x00,0x80,0xc0,0x70,0x18,0x8c,0xc6,0x02,0x00,0x00,0x10,0x18,0x0c,0x07,0x01,0x00,0x06,0x05,0x14,0x1f,0x14,
+0xd8,0x8c,0x24,0xac,0xd8,0x00,0x00,0x80,0xe0,0x30,0x18,0x8c,0x04,0x00,0x01,0x21,0x31,0x18,0x0e,0x03,0x01,0x0c,0x0a,0x29,0x3f,0x28,
+0xb0,0x18,0x48,0x58,0xb0,0x00,0x00,0x00,0xc0,0x60,0x30,0x18,0x08,0x01,0x03,0x42,0x63,0x31,0x1c,0x06,0x03,0x19,0x14,0x52,0x7f,0x50,
+0x60,0x30,0x90,0xb0,0x60,0x00,0x00,0x00,0x80,0xc0,0x60,0x30,0x10,0x03,0x06,0x84,0xc6,0x63,0x38,0x0c,0x06,0x33,0x28,0xa4,0xfe,0xa0,
+0xc0,0x60,0x20,0x60,0xc0,0x00,0x00,0x00,0x00,0x80,0xc0,0x60,0x20,0x06,0x0c,0x09,0x8d,0xc6,0x70,0x18,0x0c,0x67,0x51,0x48,0xfc,0x40,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,
+0x80,0xc0,0x40,0xc0,0x80,0x00,0x00,0x00,0x00,0x00,0x80,0xc0,0x40,0x0d,0x18,0x12,0x1a,0x8d,0xe0,0x30,0x18,0xce,0xa3,0x91,0xf8,0x80,0x00,0x00,0x02,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x02,
+0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x1b,0x31,0x24,0x35,0x1b,0xc0,0x60,0x30,0x9c,0x46,0x23,0xf1,0x00,0x00,0x00,0x04,0x06,0x03,0x01,0x00,0x00,0x01,0x01,0x05,0x07,0x05,
 // 'questiondown'
-191,9,7,12,0,-3,39,11,23,0x06,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x0c,0x00,0x00,0x18,0x00,0x00,0x30,0x00,0x00,0x31,0x00,0x00,0x33,0x80,0x00,0x19,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+7,2,7,11,12,0,
+0x00,0x00,0x00,0xd8,0x18,0x00,0x00,0x1c,0x3e,0x63,0x41,0x50,0x38,0x10,
+0x00,0x00,0x00,0xb0,0x30,0x00,0x00,0x38,0x7c,0xc6,0x83,0xa0,0x70,0x20,
+0x00,0x00,0x00,0x60,0x60,0x00,0x00,0x70,0xf8,0x8c,0x07,0x40,0xe0,0x40,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x00,0x00,0xc0,0xc0,0x00,0x00,0xe0,0xf0,0x18,0x0e,0x80,0xc0,0x80,0x00,0x01,0x03,0x02,0x02,0x01,0x00,
+0x00,0x00,0x00,0x80,0x80,0x00,0x00,0xc0,0xe0,0x30,0x1d,0x01,0x80,0x00,0x01,0x03,0x06,0x04,0x05,0x03,0x01,
+0x80,0xc0,0x60,0x3b,0x03,0x00,0x00,0x03,0x07,0x0c,0x08,0x0a,0x07,0x02,
+0x00,0x80,0xc0,0x76,0x06,0x00,0x00,0x07,0x0f,0x18,0x10,0x14,0x0e,0x04,
+0x00,0x00,0x80,0xec,0x0c,0x00,0x00,0x0e,0x1f,0x31,0x20,0x28,0x1c,0x08,
 // 'Agrave'
-192,14,11,16,0,0,51,4,20,0x06,0x00,0x00,0x03,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x05,0x80,0x00,0x04,0xc0,0x00,0x04,0xc0,0x00,0x0f,0xe0,0x00,0x08,0x60,0x00,0x10,0x60,0x00,0x10,0x30,0x00,0x3c,0xf8,0x00,0x00,0x00,0x00,
+12,2,11,4,16,2,
+0x02,0x43,0x10,0x30,0x20,0x40,0xc0,0x01,0x46,0x80,0xf0,0x8c,0x9f,0xfc,0xe0,0x80,0xc0,0x43,0x08,0x0e,0x09,0x08,0x01,0x44,0x08,0x0b,0x0f,0x0c,0x08,0xc0,
+0x02,0x43,0x20,0x60,0x40,0x80,0xc0,0x02,0x44,0xe0,0x18,0x3e,0xf8,0xc0,0xc0,0x4a,0x10,0x1c,0x13,0x11,0x01,0x01,0x11,0x17,0x1f,0x18,0x10,0xc0,
+0x02,0x42,0x40,0xc0,0x80,0xc0,0x02,0x44,0xc0,0x30,0x7c,0xf1,0x80,0xc0,0x4a,0x20,0x38,0x26,0x23,0x02,0x02,0x23,0x2f,0x3e,0x30,0x20,0xc0,
+0x02,0x41,0x80,0x80,0xc0,0x02,0x43,0x80,0x61,0xf9,0xe2,0xc0,0x4a,0x40,0x70,0x4c,0x47,0x04,0x04,0x47,0x5f,0x7c,0x60,0x40,0xc0,
+0x02,0x43,0x01,0xc3,0xf2,0xc4,0xc0,0x4a,0x80,0xe0,0x98,0x8f,0x08,0x09,0x8f,0xbe,0xf8,0xc0,0x80,0xc0,
+0x02,0x43,0x02,0x86,0xe4,0x88,0xc0,0x00,0x48,0xc0,0x30,0x1e,0x11,0x13,0x1f,0x7c,0xf0,0x80,0xc0,0x83,0x01,0x01,0x84,0x01,0xc0,
+0x02,0x43,0x04,0x0c,0xc8,0x10,0xc0,0x00,0x47,0x80,0x60,0x3c,0x23,0x27,0x3f,0xf8,0xe0,0xc0,0x43,0x02,0x03,0x02,0x02,0x01,0x44,0x02,0x02,0x03,0x03,0x02,0xc0,
+0x02,0x43,0x08,0x18,0x90,0x20,0xc0,0x01,0x46,0xc0,0x78,0x46,0x4f,0x7e,0xf0,0xc0,0xc0,0x43,0x04,0x07,0x04,0x04,0x01,0x44,0x04,0x05,0x07,0x06,0x04,0xc0,
 // 'Aacute'
-193,14,11,16,0,0,51,4,20,0x00,0xc0,0x00,0x01,0x80,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x05,0x80,0x00,0x04,0xc0,0x00,0x04,0xc0,0x00,0x0f,0xe0,0x00,0x08,0x60,0x00,0x10,0x60,0x00,0x10,0x30,0x00,0x3c,0xf8,0x00,0x00,0x00,0x00,
+12,2,11,4,16,2,
+0x03,0x43,0x40,0x20,0x30,0x10,0xc0,0x01,0x46,0x80,0xf0,0x8c,0x9f,0xfc,0xe0,0x80,0xc0,0x43,0x08,0x0e,0x09,0x08,0x01,0x44,0x08,0x0b,0x0f,0x0c,0x08,0xc0,
+0x03,0x43,0x80,0x40,0x60,0x20,0xc0,0x02,0x44,0xe0,0x18,0x3e,0xf8,0xc0,0xc0,0x4a,0x10,0x1c,0x13,0x11,0x01,0x01,0x11,0x17,0x1f,0x18,0x10,0xc0,
+0x04,0x42,0x80,0xc0,0x40,0xc0,0x02,0x44,0xc0,0x31,0x7c,0xf0,0x80,0xc0,0x4a,0x20,0x38,0x26,0x23,0x02,0x02,0x23,0x2f,0x3e,0x30,0x20,0xc0,
+0x05,0x41,0x80,0x80,0xc0,0x02,0x43,0x80,0x62,0xf9,0xe1,0xc0,0x4a,0x40,0x70,0x4c,0x47,0x04,0x04,0x47,0x5f,0x7c,0x60,0x40,0xc0,
+0x03,0x43,0xc4,0xf2,0xc3,0x01,0xc0,0x4a,0x80,0xe0,0x98,0x8f,0x08,0x09,0x8f,0xbe,0xf8,0xc0,0x80,0xc0,
+0x03,0x43,0x88,0xe4,0x86,0x02,0xc0,0x00,0x48,0xc0,0x30,0x1e,0x11,0x13,0x1f,0x7c,0xf0,0x80,0xc0,0x83,0x01,0x01,0x84,0x01,0xc0,
+0x03,0x43,0x10,0xc8,0x0c,0x04,0xc0,0x00,0x47,0x80,0x60,0x3c,0x23,0x27,0x3f,0xf8,0xe0,0xc0,0x43,0x02,0x03,0x02,0x02,0x01,0x44,0x02,0x02,0x03,0x03,0x02,0xc0,
+0x03,0x43,0x20,0x90,0x18,0x08,0xc0,0x01,0x46,0xc0,0x78,0x46,0x4f,0x7e,0xf0,0xc0,0xc0,0x43,0x04,0x07,0x04,0x04,0x01,0x44,0x04,0x05,0x07,0x06,0x04,0xc0,
 // 'Acircumflex'
-194,14,11,16,0,0,51,4,20,0x01,0x00,0x00,0x03,0x80,0x00,0x04,0x40,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x05,0x80,0x00,0x04,0xc0,0x00,0x04,0xc0,0x00,0x0f,0xe0,0x00,0x08,0x60,0x00,0x10,0x60,0x00,0x10,0x30,0x00,0x3c,0xf8,0x00,0x00,0x00,0x00,
+12,2,11,4,16,2,
+0x02,0x44,0x40,0x20,0x30,0x20,0x40,0xc0,0x01,0x46,0x80,0xf0,0x8c,0x9f,0xfc,0xe0,0x80,0xc0,0x43,0x08,0x0e,0x09,0x08,0x01,0x44,0x08,0x0b,0x0f,0x0c,0x08,0xc0,
+0x02,0x44,0x80,0x40,0x60,0x40,0x80,0xc0,0x02,0x44,0xe0,0x18,0x3e,0xf8,0xc0,0xc0,0x4a,0x10,0x1c,0x13,0x11,0x01,0x01,0x11,0x17,0x1f,0x18,0x10,0xc0,
+0x03,0x42,0x80,0xc0,0x80,0xc0,0x02,0x44,0xc1,0x30,0x7c,0xf0,0x81,0xc0,0x4a,0x20,0x38,0x26,0x23,0x02,0x02,0x23,0x2f,0x3e,0x30,0x20,0xc0,
+0x04,0x40,0x80,0xc0,0x02,0x44,0x82,0x61,0xf9,0xe1,0x02,0xc0,0x4a,0x40,0x70,0x4c,0x47,0x04,0x04,0x47,0x5f,0x7c,0x60,0x40,0xc0,
+0x02,0x44,0x04,0xc2,0xf3,0xc2,0x04,0xc0,0x4a,0x80,0xe0,0x98,0x8f,0x08,0x09,0x8f,0xbe,0xf8,0xc0,0x80,0xc0,
+0x02,0x44,0x08,0x84,0xe6,0x84,0x08,0xc0,0x00,0x48,0xc0,0x30,0x1e,0x11,0x13,0x1f,0x7c,0xf0,0x80,0xc0,0x83,0x01,0x01,0x84,0x01,0xc0,
+0x02,0x44,0x10,0x08,0xcc,0x08,0x10,0xc0,0x00,0x47,0x80,0x60,0x3c,0x23,0x27,0x3f,0xf8,0xe0,0xc0,0x43,0x02,0x03,0x02,0x02,0x01,0x44,0x02,0x02,0x03,0x03,0x02,0xc0,
+0x02,0x44,0x20,0x10,0x98,0x10,0x20,0xc0,0x01,0x46,0xc0,0x78,0x46,0x4f,0x7e,0xf0,0xc0,0xc0,0x43,0x04,0x07,0x04,0x04,0x01,0x44,0x04,0x05,0x07,0x06,0x04,0xc0,
 // 'Atilde'
-195,14,11,15,0,0,48,5,20,0x07,0x40,0x00,0x0b,0x80,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x05,0x80,0x00,0x04,0xc0,0x00,0x04,0xc0,0x00,0x0f,0xe0,0x00,0x08,0x60,0x00,0x10,0x60,0x00,0x10,0x30,0x00,0x3c,0xf8,0x00,0x00,0x00,0x00,
+12,2,11,5,15,2,
+0x01,0x45,0x40,0x20,0x60,0x60,0x40,0x20,0xc0,0x01,0x46,0x80,0xf0,0x8c,0x9f,0xfc,0xe0,0x80,0xc0,0x43,0x08,0x0e,0x09,0x08,0x01,0x44,0x08,0x0b,0x0f,0x0c,0x08,0xc0,
+0x01,0x45,0x80,0x40,0xc0,0xc0,0x80,0x40,0xc0,0x02,0x44,0xe0,0x18,0x3e,0xf8,0xc0,0xc0,0x4a,0x10,0x1c,0x13,0x11,0x01,0x01,0x11,0x17,0x1f,0x18,0x10,0xc0,
+0x02,0x82,0x80,0x00,0x40,0x80,0xc0,0x01,0x45,0x01,0xc0,0x31,0x7d,0xf1,0x80,0xc0,0x4a,0x20,0x38,0x26,0x23,0x02,0x02,0x23,0x2f,0x3e,0x30,0x20,0xc0,
+0x01,0x45,0x02,0x81,0x63,0xfb,0xe2,0x01,0xc0,0x4a,0x40,0x70,0x4c,0x47,0x04,0x04,0x47,0x5f,0x7c,0x60,0x40,0xc0,
+0x01,0x45,0x04,0x02,0xc6,0xf6,0xc4,0x02,0xc0,0x4a,0x80,0xe0,0x98,0x8f,0x08,0x09,0x8f,0xbe,0xf8,0xc0,0x80,0xc0,
+0x01,0x45,0x08,0x04,0x8c,0xec,0x88,0x04,0xc0,0x00,0x48,0xc0,0x30,0x1e,0x11,0x13,0x1f,0x7c,0xf0,0x80,0xc0,0x83,0x01,0x01,0x84,0x01,0xc0,
+0x01,0x45,0x10,0x08,0x18,0xd8,0x10,0x08,0xc0,0x00,0x47,0x80,0x60,0x3c,0x23,0x27,0x3f,0xf8,0xe0,0xc0,0x43,0x02,0x03,0x02,0x02,0x01,0x44,0x02,0x02,0x03,0x03,0x02,0xc0,
+0x01,0x45,0x20,0x10,0x30,0xb0,0x20,0x10,0xc0,0x01,0x46,0xc0,0x78,0x46,0x4f,0x7e,0xf0,0xc0,0xc0,0x43,0x04,0x07,0x04,0x04,0x01,0x44,0x04,0x05,0x07,0x06,0x04,0xc0,
 // 'Adieresis'
-196,14,11,15,0,0,48,5,20,0x04,0x80,0x00,0x04,0x80,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x05,0x80,0x00,0x04,0xc0,0x00,0x04,0xc0,0x00,0x0f,0xe0,0x00,0x08,0x60,0x00,0x10,0x60,0x00,0x10,0x30,0x00,0x3c,0xf8,0x00,0x00,0x00,0x00,
+12,2,11,5,15,2,
+0x02,0x40,0x60,0x01,0x40,0x60,0xc0,0x01,0x46,0x80,0xf0,0x8c,0x9f,0xfc,0xe0,0x80,0xc0,0x43,0x08,0x0e,0x09,0x08,0x01,0x44,0x08,0x0b,0x0f,0x0c,0x08,0xc0,
+0x02,0x40,0xc0,0x01,0x40,0xc0,0xc0,0x02,0x44,0xe0,0x18,0x3e,0xf8,0xc0,0xc0,0x4a,0x10,0x1c,0x13,0x11,0x01,0x01,0x11,0x17,0x1f,0x18,0x10,0xc0,
+0x02,0x40,0x80,0x01,0x40,0x80,0xc0,0x02,0x44,0xc1,0x30,0x7c,0xf1,0x80,0xc0,0x4a,0x20,0x38,0x26,0x23,0x02,0x02,0x23,0x2f,0x3e,0x30,0x20,0xc0,
+0x02,0x43,0x83,0x60,0xf8,0xe3,0xc0,0x4a,0x40,0x70,0x4c,0x47,0x04,0x04,0x47,0x5f,0x7c,0x60,0x40,0xc0,
+0x02,0x43,0x06,0xc0,0xf0,0xc6,0xc0,0x4a,0x80,0xe0,0x98,0x8f,0x08,0x09,0x8f,0xbe,0xf8,0xc0,0x80,0xc0,
+0x02,0x43,0x0c,0x80,0xe0,0x8c,0xc0,0x00,0x48,0xc0,0x30,0x1e,0x11,0x13,0x1f,0x7c,0xf0,0x80,0xc0,0x83,0x01,0x01,0x84,0x01,0xc0,
+0x02,0x43,0x18,0x00,0xc0,0x18,0xc0,0x00,0x47,0x80,0x60,0x3c,0x23,0x27,0x3f,0xf8,0xe0,0xc0,0x43,0x02,0x03,0x02,0x02,0x01,0x44,0x02,0x02,0x03,0x03,0x02,0xc0,
+0x02,0x43,0x30,0x00,0x80,0x30,0xc0,0x01,0x46,0xc0,0x78,0x46,0x4f,0x7e,0xf0,0xc0,0xc0,0x43,0x04,0x07,0x04,0x04,0x01,0x44,0x04,0x05,0x07,0x06,0x04,0xc0,
 // 'Aring'
-197,14,11,16,0,0,51,4,20,0x03,0x00,0x00,0x04,0x80,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x05,0x80,0x00,0x04,0xc0,0x00,0x04,0xc0,0x00,0x0f,0xe0,0x00,0x08,0x60,0x00,0x10,0x60,0x00,0x10,0x30,0x00,0x3c,0xf8,0x00,0x00,0x00,0x00,
+12,2,11,4,16,2,
+0x02,0x43,0x20,0x50,0x50,0x20,0xc0,0x01,0x46,0x80,0xf0,0x8c,0x9f,0xfc,0xe0,0x80,0xc0,0x43,0x08,0x0e,0x09,0x08,0x01,0x44,0x08,0x0b,0x0f,0x0c,0x08,0xc0,
+0x02,0x43,0x40,0xa0,0xa0,0x40,0xc0,0x02,0x44,0xe0,0x18,0x3e,0xf8,0xc0,0xc0,0x4a,0x10,0x1c,0x13,0x11,0x01,0x01,0x11,0x17,0x1f,0x18,0x10,0xc0,
+0x02,0x43,0x80,0x40,0x40,0x80,0xc0,0x02,0x44,0xc0,0x31,0x7d,0xf0,0x80,0xc0,0x4a,0x20,0x38,0x26,0x23,0x02,0x02,0x23,0x2f,0x3e,0x30,0x20,0xc0,
+0x03,0x41,0x80,0x80,0xc0,0x02,0x43,0x81,0x62,0xfa,0xe1,0xc0,0x4a,0x40,0x70,0x4c,0x47,0x04,0x04,0x47,0x5f,0x7c,0x60,0x40,0xc0,
+0x02,0x43,0x02,0xc5,0xf5,0xc2,0xc0,0x4a,0x80,0xe0,0x98,0x8f,0x08,0x09,0x8f,0xbe,0xf8,0xc0,0x80,0xc0,
+0x02,0x43,0x04,0x8a,0xea,0x84,0xc0,0x00,0x48,0xc0,0x30,0x1e,0x11,0x13,0x1f,0x7c,0xf0,0x80,0xc0,0x83,0x01,0x01,0x84,0x01,0xc0,
+0x02,0x43,0x08,0x14,0xd4,0x08,0xc0,0x00,0x47,0x80,0x60,0x3c,0x23,0x27,0x3f,0xf8,0xe0,0xc0,0x43,0x02,0x03,0x02,0x02,0x01,0x44,0x02,0x02,0x03,0x03,0x02,0xc0,
+0x02,0x43,0x10,0x28,0xa8,0x10,0xc0,0x01,0x46,0xc0,0x78,0x46,0x4f,0x7e,0xf0,0xc0,0xc0,0x43,0x04,0x07,0x04,0x04,0x01,0x44,0x04,0x05,0x07,0x06,0x04,0xc0,
 // 'AE'
-198,19,16,12,0,0,39,8,20,0x03,0xff,0xc0,0x00,0xb0,0xc0,0x00,0xb0,0x40,0x01,0x30,0x40,0x01,0x32,0x00,0x02,0x3e,0x00,0x02,0x36,0x00,0x07,0xf2,0x40,0x04,0x30,0x40,0x08,0x30,0x40,0x08,0x30,0xc0,0x3e,0xff,0xc0,0x00,0x00,0x00,
+17,2,16,8,12,2,
+0x02,0x4c,0x80,0xe1,0x99,0x87,0x81,0xff,0xff,0x21,0x61,0xf1,0x01,0x03,0x8f,0xc0,0x49,0x08,0x08,0x0e,0x09,0x08,0x00,0x08,0x08,0x0f,0x0f,0x83,0x08,0x41,0x0c,0x0f,0xc0,
+0x03,0x4b,0xc2,0x32,0x0e,0x02,0xfe,0xfe,0x42,0xc2,0xe2,0x02,0x06,0x1e,0xc0,0x4f,0x10,0x10,0x1c,0x13,0x11,0x01,0x11,0x11,0x1f,0x1f,0x10,0x10,0x11,0x10,0x18,0x1f,0xc0,
+0x03,0x4b,0x84,0x64,0x1c,0x04,0xfc,0xfc,0x84,0x84,0xc4,0x04,0x0c,0x3c,0xc0,0x4f,0x20,0x20,0x38,0x26,0x23,0x02,0x22,0x22,0x3f,0x3f,0x20,0x21,0x23,0x20,0x30,0x3e,0xc0,
+0x03,0x4b,0x08,0xc8,0x38,0x08,0xf8,0xf8,0x08,0x08,0x88,0x08,0x18,0x78,0xc0,0x4f,0x40,0x40,0x70,0x4c,0x47,0x04,0x44,0x44,0x7f,0x7f,0x41,0x43,0x47,0x40,0x60,0x7c,0xc0,
+0x03,0x45,0x10,0x90,0x70,0x10,0xf0,0xf0,0x83,0x10,0x41,0x30,0xf0,0xc0,0x4f,0x80,0x80,0xe0,0x98,0x8e,0x09,0x88,0x88,0xff,0xff,0x82,0x86,0x8f,0x80,0xc0,0xf8,0xc0,
+0x03,0x45,0x20,0x20,0xe0,0x20,0xe0,0xe0,0x83,0x20,0x41,0x60,0xe0,0xc0,0x01,0x4d,0xc0,0x30,0x1c,0x13,0x10,0x10,0xff,0xff,0x04,0x0c,0x1e,0x00,0x80,0xf1,0xc0,0x84,0x01,0x00,0x89,0x01,0xc0,
+0x03,0x45,0x40,0x40,0xc0,0x40,0xc0,0xc0,0x83,0x40,0x41,0xc0,0xc0,0xc0,0x01,0x4a,0x80,0x60,0x38,0x26,0x21,0x20,0xff,0xff,0x08,0x18,0x3c,0x01,0x40,0xe3,0xc0,0x49,0x02,0x02,0x03,0x02,0x02,0x00,0x02,0x02,0x03,0x03,0x83,0x02,0x41,0x03,0x03,0xc0,
+0x03,0x8b,0x80,0xc0,0x02,0x4c,0xc0,0x70,0x4c,0x43,0x40,0xff,0xff,0x10,0x30,0x78,0x00,0x01,0xc7,0xc0,0x49,0x04,0x04,0x07,0x04,0x04,0x00,0x04,0x04,0x07,0x07,0x83,0x04,0x41,0x06,0x07,0xc0,
 // 'Ccedilla'
-199,15,10,15,1,-3,48,8,23,0x03,0xe8,0x00,0x0e,0x18,0x00,0x0c,0x08,0x00,0x1c,0x08,0x00,0x18,0x08,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1c,0x08,0x00,0x0c,0x08,0x00,0x0e,0x10,0x00,0x03,0xe0,0x00,0x01,0x00,0x00,0x00,0x80,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+12,3,10,8,15,2,
+0x43,0xf8,0xfe,0x0e,0x03,0x83,0x01,0x41,0x02,0x1f,0xc0,0x49,0x01,0x07,0x07,0x4c,0x58,0x28,0x08,0x08,0x04,0x03,0xc0,
+0x43,0xf0,0xfc,0x1c,0x06,0x83,0x02,0x41,0x04,0x3e,0xc0,0x49,0x03,0x0f,0x0e,0x98,0xb0,0x50,0x10,0x10,0x08,0x06,0xc0,
+0x43,0xe0,0xf8,0x38,0x0c,0x83,0x04,0x41,0x08,0x7c,0xc0,0x49,0x07,0x1f,0x1c,0x30,0x60,0xa0,0x20,0x20,0x10,0x0c,0xc0,0x02,0x41,0x01,0x01,0xc0,
+0x43,0xc0,0xf0,0x70,0x18,0x83,0x08,0x41,0x10,0xf8,0xc0,0x44,0x0f,0x3f,0x38,0x60,0xc0,0x82,0x40,0x41,0x20,0x18,0xc0,0x02,0x42,0x02,0x02,0x01,0xc0,
+0x43,0x80,0xe0,0xe0,0x30,0x83,0x10,0x41,0x20,0xf0,0xc0,0x43,0x1f,0x7f,0x70,0xc0,0x83,0x80,0x41,0x40,0x31,0xc0,0x02,0x42,0x04,0x05,0x02,0xc0,
+0x00,0x42,0xc0,0xc0,0x60,0x83,0x20,0x41,0x40,0xe0,0xc0,0x43,0x3f,0xff,0xe1,0x80,0x03,0x41,0x80,0x63,0xc0,0x02,0x44,0x09,0x0b,0x05,0x01,0x01,0xc0,
+0x00,0x42,0x80,0x80,0xc0,0x83,0x40,0x41,0x80,0xc0,0xc0,0x42,0x7e,0xff,0xc3,0x05,0x40,0xc7,0xc0,0x00,0x47,0x01,0x01,0x13,0x16,0x0a,0x02,0x02,0x01,0xc0,
+0x02,0x84,0x80,0x00,0x40,0x80,0xc0,0x43,0xfc,0xff,0x87,0x01,0x03,0x41,0x01,0x8f,0xc0,0x00,0x48,0x03,0x03,0x26,0x2c,0x14,0x04,0x04,0x02,0x01,0xc0,
 // 'Egrave'
-200,14,10,16,0,0,51,4,20,0x06,0x00,0x00,0x03,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x3f,0xf0,0x00,0x0c,0x30,0x00,0x0c,0x10,0x00,0x0c,0x10,0x00,0x0c,0x80,0x00,0x0f,0x80,0x00,0x0d,0x80,0x00,0x0c,0x80,0x00,0x0c,0x10,0x00,0x0c,0x10,0x00,0x0c,0x30,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,
+12,2,10,4,16,0,
+0x00,0x00,0x00,0x10,0x30,0x20,0x40,0x00,0x00,0x00,0x01,0x01,0xff,0xff,0x21,0x61,0xf1,0x01,0x03,0x0f,0x08,0x08,0x0f,0x0f,0x08,0x08,0x08,0x08,0x0c,0x0f,
+0x00,0x00,0x00,0x20,0x60,0x40,0x80,0x00,0x00,0x00,0x02,0x02,0xfe,0xfe,0x42,0xc2,0xe2,0x02,0x06,0x1e,0x10,0x10,0x1f,0x1f,0x10,0x10,0x11,0x10,0x18,0x1e,
+0x00,0x00,0x00,0x40,0xc0,0x80,0x00,0x00,0x00,0x00,0x04,0x04,0xfc,0xfc,0x84,0x84,0xc5,0x04,0x0c,0x3c,0x20,0x20,0x3f,0x3f,0x20,0x21,0x23,0x20,0x30,0x3c,
+0x00,0x00,0x00,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x08,0x08,0xf8,0xf8,0x09,0x09,0x8a,0x08,0x18,0x78,0x40,0x40,0x7f,0x7f,0x41,0x43,0x47,0x40,0x60,0x78,
+0x10,0x10,0xf0,0xf1,0x13,0x12,0x14,0x10,0x30,0xf0,0x80,0x80,0xff,0xff,0x82,0x86,0x8f,0x80,0xc0,0xf0,
+0x20,0x20,0xe0,0xe2,0x26,0x24,0x28,0x20,0x60,0xe0,0x00,0x00,0xff,0xff,0x04,0x0c,0x1e,0x00,0x80,0xe1,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+0x40,0x40,0xc0,0xc4,0x4c,0x48,0x50,0x40,0xc0,0xc0,0x00,0x00,0xff,0xff,0x08,0x18,0x3c,0x00,0x00,0xc3,0x02,0x02,0x03,0x03,0x02,0x02,0x02,0x02,0x03,0x03,
+0x80,0x80,0x80,0x88,0x98,0x90,0xa0,0x80,0x80,0x80,0x00,0x00,0xff,0xff,0x10,0x30,0x78,0x00,0x01,0x87,0x04,0x04,0x07,0x07,0x04,0x04,0x04,0x04,0x06,0x07,
 // 'Eacute'
-201,14,10,16,0,0,51,4,20,0x00,0xc0,0x00,0x01,0x80,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x3f,0xf0,0x00,0x0c,0x30,0x00,0x0c,0x10,0x00,0x0c,0x10,0x00,0x0c,0x80,0x00,0x0f,0x80,0x00,0x0d,0x80,0x00,0x0c,0x80,0x00,0x0c,0x10,0x00,0x0c,0x10,0x00,0x0c,0x30,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,
+12,2,10,4,16,0,
+0x00,0x00,0x00,0x00,0x40,0x20,0x30,0x10,0x00,0x00,0x01,0x01,0xff,0xff,0x21,0x61,0xf1,0x01,0x03,0x0f,0x08,0x08,0x0f,0x0f,0x08,0x08,0x08,0x08,0x0c,0x0f,
+0x00,0x00,0x00,0x00,0x80,0x40,0x60,0x20,0x00,0x00,0x02,0x02,0xfe,0xfe,0x42,0xc2,0xe2,0x02,0x06,0x1e,0x10,0x10,0x1f,0x1f,0x10,0x10,0x11,0x10,0x18,0x1e,
+0x00,0x00,0x00,0x00,0x00,0x80,0xc0,0x40,0x00,0x00,0x04,0x04,0xfc,0xfc,0x85,0x84,0xc4,0x04,0x0c,0x3c,0x20,0x20,0x3f,0x3f,0x20,0x21,0x23,0x20,0x30,0x3c,
+0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x00,0x00,0x08,0x08,0xf8,0xf8,0x0a,0x09,0x89,0x08,0x18,0x78,0x40,0x40,0x7f,0x7f,0x41,0x43,0x47,0x40,0x60,0x78,
+0x10,0x10,0xf0,0xf0,0x14,0x12,0x13,0x11,0x30,0xf0,0x80,0x80,0xff,0xff,0x82,0x86,0x8f,0x80,0xc0,0xf0,
+0x20,0x20,0xe0,0xe0,0x28,0x24,0x26,0x22,0x60,0xe0,0x00,0x00,0xff,0xff,0x04,0x0c,0x1e,0x00,0x80,0xe1,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+0x40,0x40,0xc0,0xc0,0x50,0x48,0x4c,0x44,0xc0,0xc0,0x00,0x00,0xff,0xff,0x08,0x18,0x3c,0x00,0x00,0xc3,0x02,0x02,0x03,0x03,0x02,0x02,0x02,0x02,0x03,0x03,
+0x80,0x80,0x80,0x80,0xa0,0x90,0x98,0x88,0x80,0x80,0x00,0x00,0xff,0xff,0x10,0x30,0x78,0x00,0x01,0x87,0x04,0x04,0x07,0x07,0x04,0x04,0x04,0x04,0x06,0x07,
 // 'Ecircumflex'
-202,14,10,16,0,0,51,4,20,0x01,0x00,0x00,0x03,0x80,0x00,0x04,0x40,0x00,0x00,0x00,0x00,0x3f,0xf0,0x00,0x0c,0x30,0x00,0x0c,0x10,0x00,0x0c,0x10,0x00,0x0c,0x80,0x00,0x0f,0x80,0x00,0x0d,0x80,0x00,0x0c,0x80,0x00,0x0c,0x10,0x00,0x0c,0x10,0x00,0x0c,0x30,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,
+12,2,10,4,16,0,
+0x00,0x00,0x00,0x40,0x20,0x30,0x20,0x40,0x00,0x00,0x01,0x01,0xff,0xff,0x21,0x61,0xf1,0x01,0x03,0x0f,0x08,0x08,0x0f,0x0f,0x08,0x08,0x08,0x08,0x0c,0x0f,
+0x00,0x00,0x00,0x80,0x40,0x60,0x40,0x80,0x00,0x00,0x02,0x02,0xfe,0xfe,0x42,0xc2,0xe2,0x02,0x06,0x1e,0x10,0x10,0x1f,0x1f,0x10,0x10,0x11,0x10,0x18,0x1e,
+0x00,0x00,0x00,0x00,0x80,0xc0,0x80,0x00,0x00,0x00,0x04,0x04,0xfc,0xfd,0x84,0x84,0xc4,0x05,0x0c,0x3c,0x20,0x20,0x3f,0x3f,0x20,0x21,0x23,0x20,0x30,0x3c,
+0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x08,0x08,0xf8,0xfa,0x09,0x09,0x89,0x0a,0x18,0x78,0x40,0x40,0x7f,0x7f,0x41,0x43,0x47,0x40,0x60,0x78,
+0x10,0x10,0xf0,0xf4,0x12,0x13,0x12,0x14,0x30,0xf0,0x80,0x80,0xff,0xff,0x82,0x86,0x8f,0x80,0xc0,0xf0,
+0x20,0x20,0xe0,0xe8,0x24,0x26,0x24,0x28,0x60,0xe0,0x00,0x00,0xff,0xff,0x04,0x0c,0x1e,0x00,0x80,0xe1,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+0x40,0x40,0xc0,0xd0,0x48,0x4c,0x48,0x50,0xc0,0xc0,0x00,0x00,0xff,0xff,0x08,0x18,0x3c,0x00,0x00,0xc3,0x02,0x02,0x03,0x03,0x02,0x02,0x02,0x02,0x03,0x03,
+0x80,0x80,0x80,0xa0,0x90,0x98,0x90,0xa0,0x80,0x80,0x00,0x00,0xff,0xff,0x10,0x30,0x78,0x00,0x01,0x87,0x04,0x04,0x07,0x07,0x04,0x04,0x04,0x04,0x06,0x07,
 // 'Edieresis'
-203,14,10,15,0,0,48,5,20,0x04,0x40,0x00,0x04,0x40,0x00,0x00,0x00,0x00,0x3f,0xf0,0x00,0x0c,0x30,0x00,0x0c,0x10,0x00,0x0c,0x10,0x00,0x0c,0x80,0x00,0x0f,0x80,0x00,0x0d,0x80,0x00,0x0c,0x80,0x00,0x0c,0x10,0x00,0x0c,0x10,0x00,0x0c,0x30,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,
+12,2,10,5,15,0,
+0x00,0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0x01,0x01,0xff,0xff,0x21,0x61,0xf1,0x01,0x03,0x0f,0x08,0x08,0x0f,0x0f,0x08,0x08,0x08,0x08,0x0c,0x0f,
+0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0xc0,0x00,0x00,0x02,0x02,0xfe,0xfe,0x42,0xc2,0xe2,0x02,0x06,0x1e,0x10,0x10,0x1f,0x1f,0x10,0x10,0x11,0x10,0x18,0x1e,
+0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x80,0x00,0x00,0x04,0x04,0xfc,0xfd,0x84,0x84,0xc4,0x05,0x0c,0x3c,0x20,0x20,0x3f,0x3f,0x20,0x21,0x23,0x20,0x30,0x3c,
+0x08,0x08,0xf8,0xfb,0x08,0x08,0x88,0x0b,0x18,0x78,0x40,0x40,0x7f,0x7f,0x41,0x43,0x47,0x40,0x60,0x78,
+0x10,0x10,0xf0,0xf6,0x10,0x10,0x10,0x16,0x30,0xf0,0x80,0x80,0xff,0xff,0x82,0x86,0x8f,0x80,0xc0,0xf0,
+0x20,0x20,0xe0,0xec,0x20,0x20,0x20,0x2c,0x60,0xe0,0x00,0x00,0xff,0xff,0x04,0x0c,0x1e,0x00,0x80,0xe1,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,
+0x40,0x40,0xc0,0xd8,0x40,0x40,0x40,0x58,0xc0,0xc0,0x00,0x00,0xff,0xff,0x08,0x18,0x3c,0x00,0x00,0xc3,0x02,0x02,0x03,0x03,0x02,0x02,0x02,0x02,0x03,0x03,
+0x80,0x80,0x80,0xb0,0x80,0x80,0x80,0xb0,0x80,0x80,0x00,0x00,0xff,0xff,0x10,0x30,0x78,0x00,0x01,0x87,0x04,0x04,0x07,0x07,0x04,0x04,0x04,0x04,0x06,0x07,
 // 'Igrave'
-204,9,6,16,0,0,51,4,20,0x30,0x00,0x00,0x18,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,
+7,2,6,4,16,0,
+0x10,0x30,0x20,0x40,0x00,0x00,0x01,0x01,0xff,0xff,0x01,0x01,0x08,0x08,0x0f,0x0f,0x08,0x08,
+0x20,0x60,0x40,0x80,0x00,0x00,0x02,0x02,0xfe,0xfe,0x02,0x02,0x10,0x10,0x1f,0x1f,0x10,0x10,
+0x40,0xc0,0x80,0x00,0x00,0x00,0x04,0x04,0xfc,0xfd,0x04,0x04,0x20,0x20,0x3f,0x3f,0x20,0x20,
+0x80,0x80,0x00,0x00,0x00,0x00,0x08,0x09,0xf9,0xfa,0x08,0x08,0x40,0x40,0x7f,0x7f,0x40,0x40,
+0x11,0x13,0xf2,0xf4,0x10,0x10,0x80,0x80,0xff,0xff,0x80,0x80,
+0x22,0x26,0xe4,0xe8,0x20,0x20,0x00,0x00,0xff,0xff,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,
+0x44,0x4c,0xc8,0xd0,0x40,0x40,0x00,0x00,0xff,0xff,0x00,0x00,0x02,0x02,0x03,0x03,0x02,0x02,
+0x88,0x98,0x90,0xa0,0x80,0x80,0x00,0x00,0xff,0xff,0x00,0x00,0x04,0x04,0x07,0x07,0x04,0x04,
 // 'Iacute'
-205,9,6,16,0,0,51,4,20,0x03,0x00,0x00,0x06,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,
+7,2,6,4,16,0,
+0x00,0x00,0x40,0x20,0x30,0x10,0x01,0x01,0xff,0xff,0x01,0x01,0x08,0x08,0x0f,0x0f,0x08,0x08,
+0x00,0x00,0x80,0x40,0x60,0x20,0x02,0x02,0xfe,0xfe,0x02,0x02,0x10,0x10,0x1f,0x1f,0x10,0x10,
+0x00,0x00,0x00,0x80,0xc0,0x40,0x04,0x04,0xfd,0xfc,0x04,0x04,0x20,0x20,0x3f,0x3f,0x20,0x20,
+0x00,0x00,0x00,0x00,0x80,0x80,0x08,0x08,0xfa,0xf9,0x09,0x08,0x40,0x40,0x7f,0x7f,0x40,0x40,
+0x10,0x10,0xf4,0xf2,0x13,0x11,0x80,0x80,0xff,0xff,0x80,0x80,
+0x20,0x20,0xe8,0xe4,0x26,0x22,0x00,0x00,0xff,0xff,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,
+0x40,0x40,0xd0,0xc8,0x4c,0x44,0x00,0x00,0xff,0xff,0x00,0x00,0x02,0x02,0x03,0x03,0x02,0x02,
+0x80,0x80,0xa0,0x90,0x98,0x88,0x00,0x00,0xff,0xff,0x00,0x00,0x04,0x04,0x07,0x07,0x04,0x04,
 // 'Icircumflex'
-206,9,6,16,0,0,51,4,20,0x08,0x00,0x00,0x1c,0x00,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,
+7,2,6,4,16,0,
+0x40,0x20,0x30,0x20,0x40,0x00,0x01,0x01,0xff,0xff,0x01,0x01,0x08,0x08,0x0f,0x0f,0x08,0x08,
+0x80,0x40,0x60,0x40,0x80,0x00,0x02,0x02,0xfe,0xfe,0x02,0x02,0x10,0x10,0x1f,0x1f,0x10,0x10,
+0x00,0x80,0xc0,0x80,0x00,0x00,0x05,0x04,0xfc,0xfc,0x05,0x04,0x20,0x20,0x3f,0x3f,0x20,0x20,
+0x00,0x00,0x80,0x00,0x00,0x00,0x0a,0x09,0xf9,0xf9,0x0a,0x08,0x40,0x40,0x7f,0x7f,0x40,0x40,
+0x14,0x12,0xf3,0xf2,0x14,0x10,0x80,0x80,0xff,0xff,0x80,0x80,
+0x28,0x24,0xe6,0xe4,0x28,0x20,0x00,0x00,0xff,0xff,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,
+0x50,0x48,0xcc,0xc8,0x50,0x40,0x00,0x00,0xff,0xff,0x00,0x00,0x02,0x02,0x03,0x03,0x02,0x02,
+0xa0,0x90,0x98,0x90,0xa0,0x80,0x00,0x00,0xff,0xff,0x00,0x00,0x04,0x04,0x07,0x07,0x04,0x04,
 // 'Idieresis'
-207,9,6,15,0,0,48,5,20,0x12,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,
+7,2,6,5,15,0,
+0x00,0x60,0x00,0x00,0x60,0x00,0x01,0x01,0xff,0xff,0x01,0x01,0x08,0x08,0x0f,0x0f,0x08,0x08,
+0x00,0xc0,0x00,0x00,0xc0,0x00,0x02,0x02,0xfe,0xfe,0x02,0x02,0x10,0x10,0x1f,0x1f,0x10,0x10,
+0x00,0x80,0x00,0x00,0x80,0x00,0x04,0x05,0xfc,0xfc,0x05,0x04,0x20,0x20,0x3f,0x3f,0x20,0x20,
+0x08,0x0b,0xf8,0xf8,0x0b,0x08,0x40,0x40,0x7f,0x7f,0x40,0x40,
+0x10,0x16,0xf0,0xf0,0x16,0x10,0x80,0x80,0xff,0xff,0x80,0x80,
+0x20,0x2c,0xe0,0xe0,0x2c,0x20,0x00,0x00,0xff,0xff,0x00,0x00,0x01,0x01,0x01,0x01,0x01,0x01,
+0x40,0x58,0xc0,0xc0,0x58,0x40,0x00,0x00,0xff,0xff,0x00,0x00,0x02,0x02,0x03,0x03,0x02,0x02,
+0x80,0xb0,0x80,0x80,0xb0,0x80,0x00,0x00,0xff,0xff,0x00,0x00,0x04,0x04,0x07,0x07,0x04,0x04,
 // 'Eth'
-208,15,12,12,0,0,39,8,20,0x3f,0xc0,0x00,0x0c,0x70,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x0c,0x00,0x1f,0x0c,0x00,0x0c,0x0c,0x00,0x0c,0x0c,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x70,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,
+13,2,12,8,12,0,
+0x01,0x21,0xff,0xff,0x21,0x21,0x01,0x03,0x02,0x0e,0xfc,0xf0,0x08,0x08,0x0f,0x0f,0x08,0x08,0x08,0x0c,0x04,0x07,0x03,0x00,
+0x02,0x42,0xfe,0xfe,0x42,0x42,0x02,0x06,0x04,0x1c,0xf8,0xe0,0x10,0x10,0x1f,0x1f,0x10,0x10,0x10,0x18,0x08,0x0e,0x07,0x01,
+0x04,0x84,0xfc,0xfc,0x84,0x84,0x04,0x0c,0x08,0x38,0xf0,0xc0,0x20,0x20,0x3f,0x3f,0x20,0x20,0x20,0x30,0x10,0x1c,0x0f,0x03,
+0x08,0x08,0xf8,0xf8,0x08,0x08,0x08,0x18,0x10,0x70,0xe0,0x80,0x40,0x41,0x7f,0x7f,0x41,0x41,0x40,0x60,0x20,0x38,0x1f,0x07,
+0x10,0x10,0xf0,0xf0,0x10,0x10,0x10,0x30,0x20,0xe0,0xc0,0x00,0x80,0x82,0xff,0xff,0x82,0x82,0x80,0xc0,0x40,0x70,0x3f,0x0f,
+0x20,0x20,0xe0,0xe0,0x20,0x20,0x20,0x60,0x40,0xc0,0x80,0x00,0x00,0x04,0xff,0xff,0x04,0x04,0x00,0x80,0x80,0xe1,0x7f,0x1e,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,
+0x40,0x40,0xc0,0xc0,0x40,0x40,0x40,0xc0,0x80,0x80,0x00,0x00,0x00,0x08,0xff,0xff,0x08,0x08,0x00,0x00,0x00,0xc3,0xff,0x3c,0x02,0x02,0x03,0x03,0x02,0x02,0x02,0x03,0x01,0x01,0x00,0x00,
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x10,0xff,0xff,0x10,0x10,0x00,0x01,0x01,0x87,0xfe,0x78,0x04,0x04,0x07,0x07,0x04,0x04,0x04,0x06,0x02,0x03,0x01,0x00,
 // 'Ntilde'
-209,15,13,15,0,0,48,5,20,0x03,0x90,0x00,0x04,0xe0,0x00,0x00,0x00,0x00,0x3c,0x3e,0x00,0x0e,0x08,0x00,0x0f,0x08,0x00,0x0b,0x08,0x00,0x0b,0x88,0x00,0x09,0xc8,0x00,0x08,0xe8,0x00,0x08,0x68,0x00,0x08,0x38,0x00,0x08,0x38,0x00,0x08,0x18,0x00,0x3e,0x08,0x00,0x00,0x00,0x00,
+13,2,13,5,15,2,
+0x02,0x46,0x40,0x20,0x20,0x60,0x40,0x40,0x20,0xc0,0x4c,0x01,0x01,0xff,0x07,0x1e,0x3c,0x70,0xe0,0xc1,0x01,0xff,0x01,0x01,0xc0,0x44,0x08,0x08,0x0f,0x08,0x08,0x02,0x42,0x03,0x07,0x0f,0xc0,
+0x02,0x46,0x80,0x40,0x40,0xc0,0x80,0x80,0x40,0xc0,0x4c,0x02,0x02,0xfe,0x0e,0x3c,0x78,0xe0,0xc0,0x82,0x02,0xfe,0x02,0x02,0xc0,0x44,0x10,0x10,0x1f,0x10,0x10,0x01,0x43,0x01,0x07,0x0e,0x1f,0xc0,
+0x03,0x82,0x80,0x01,0x40,0x80,0xc0,0x4c,0x04,0x04,0xfc,0x1d,0x78,0xf0,0xc1,0x81,0x05,0x04,0xfc,0x04,0x04,0xc0,0x4a,0x20,0x20,0x3f,0x20,0x20,0x00,0x01,0x03,0x0f,0x1c,0x3f,0xc0,
+0x4c,0x08,0x08,0xf8,0x3a,0xf1,0xe1,0x83,0x02,0x0a,0x09,0xf8,0x08,0x08,0xc0,0x4a,0x40,0x40,0x7f,0x40,0x40,0x01,0x03,0x07,0x1e,0x38,0x7f,0xc0,
+0x4c,0x10,0x10,0xf0,0x74,0xe2,0xc2,0x06,0x04,0x14,0x12,0xf0,0x10,0x10,0xc0,0x4a,0x80,0x80,0xff,0x80,0x81,0x03,0x07,0x0e,0x3c,0x70,0xff,0xc0,
+0x4c,0x20,0x20,0xe0,0xe8,0xc4,0x84,0x0c,0x08,0x28,0x24,0xe0,0x20,0x20,0xc0,0x01,0x48,0xff,0x00,0x03,0x07,0x0e,0x1c,0x78,0xe0,0xff,0xc0,0x84,0x01,0x04,0x40,0x01,0xc0,
+0x4c,0x40,0x40,0xc0,0xd0,0x88,0x08,0x18,0x10,0x50,0x48,0xc0,0x40,0x40,0xc0,0x01,0x48,0xff,0x01,0x07,0x0f,0x1c,0x38,0xf0,0xc0,0xff,0xc0,0x44,0x02,0x02,0x03,0x02,0x02,0x03,0x41,0x01,0x03,0xc0,
+0x82,0x80,0x46,0xa0,0x10,0x10,0x30,0x20,0xa0,0x90,0x82,0x80,0xc0,0x01,0x48,0xff,0x03,0x0f,0x1e,0x38,0x70,0xe0,0x80,0xff,0xc0,0x44,0x04,0x04,0x07,0x04,0x04,0x02,0x42,0x01,0x03,0x07,0xc0,
 // 'Ograve'
-210,16,11,16,1,0,51,4,20,0x03,0x00,0x00,0x01,0x80,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x06,0x30,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x06,0x30,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,
+13,3,11,4,16,2,
+0x02,0x43,0x10,0x30,0x20,0x40,0xc0,0x43,0xf0,0xfc,0x0e,0x02,0x82,0x01,0x43,0x02,0x0e,0xfc,0xf0,0xc0,0x00,0x42,0x03,0x07,0x04,0x82,0x08,0x42,0x04,0x07,0x03,0xc0,
+0x02,0x43,0x20,0x60,0x40,0x80,0xc0,0x43,0xe0,0xf8,0x1c,0x04,0x82,0x02,0x43,0x04,0x1c,0xf8,0xe0,0xc0,0x43,0x01,0x07,0x0e,0x08,0x82,0x10,0x43,0x08,0x0e,0x07,0x01,0xc0,
+0x02,0x42,0x40,0xc0,0x80,0xc0,0x4a,0xc0,0xf0,0x38,0x08,0x04,0x04,0x05,0x08,0x38,0xf0,0xc0,0xc0,0x43,0x03,0x0f,0x1c,0x10,0x82,0x20,0x43,0x10,0x1c,0x0f,0x03,0xc0,
+0x02,0x41,0x80,0x80,0xc0,0x4a,0x80,0xe0,0x70,0x10,0x09,0x09,0x0a,0x10,0x70,0xe0,0x80,0xc0,0x43,0x07,0x1f,0x38,0x20,0x82,0x40,0x43,0x20,0x38,0x1f,0x07,0xc0,
+0x00,0x48,0xc0,0xe0,0x21,0x13,0x12,0x14,0x20,0xe0,0xc0,0xc0,0x43,0x0f,0x3f,0x70,0x40,0x82,0x80,0x43,0x40,0x70,0x3f,0x0f,0xc0,
+0x00,0x48,0x80,0xc0,0x42,0x26,0x24,0x28,0x40,0xc0,0x80,0xc0,0x43,0x1e,0x7f,0xe1,0x80,0x02,0x43,0x80,0xe1,0x7f,0x1e,0xc0,0x03,0x82,0x01,0xc0,
+0x01,0x46,0x80,0x84,0x4c,0x48,0x50,0x80,0x80,0xc0,0x42,0x3c,0xff,0xc3,0x04,0x42,0xc3,0xff,0x3c,0xc0,0x01,0x41,0x01,0x01,0x82,0x02,0x41,0x01,0x01,0xc0,
+0x02,0x43,0x08,0x98,0x90,0xa0,0xc0,0x43,0x78,0xfe,0x87,0x01,0x02,0x43,0x01,0x87,0xfe,0x78,0xc0,0x00,0x42,0x01,0x03,0x02,0x82,0x04,0x42,0x02,0x03,0x01,0xc0,
 // 'Oacute'
-211,16,11,16,1,0,51,4,20,0x00,0x30,0x00,0x00,0x60,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x06,0x30,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x06,0x30,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,
+13,3,11,4,16,2,
+0x04,0x43,0x40,0x20,0x30,0x10,0xc0,0x43,0xf0,0xfc,0x0e,0x02,0x82,0x01,0x43,0x02,0x0e,0xfc,0xf0,0xc0,0x00,0x42,0x03,0x07,0x04,0x82,0x08,0x42,0x04,0x07,0x03,0xc0,
+0x04,0x43,0x80,0x40,0x60,0x20,0xc0,0x43,0xe0,0xf8,0x1c,0x04,0x82,0x02,0x43,0x04,0x1c,0xf8,0xe0,0xc0,0x43,0x01,0x07,0x0e,0x08,0x82,0x10,0x43,0x08,0x0e,0x07,0x01,0xc0,
+0x05,0x42,0x80,0xc0,0x40,0xc0,0x4a,0xc0,0xf0,0x38,0x08,0x04,0x05,0x04,0x08,0x38,0xf0,0xc0,0xc0,0x43,0x03,0x0f,0x1c,0x10,0x82,0x20,0x43,0x10,0x1c,0x0f,0x03,0xc0,
+0x06,0x41,0x80,0x80,0xc0,0x4a,0x80,0xe0,0x70,0x10,0x08,0x0a,0x09,0x11,0x70,0xe0,0x80,0xc0,0x43,0x07,0x1f,0x38,0x20,0x82,0x40,0x43,0x20,0x38,0x1f,0x07,0xc0,
+0x00,0x48,0xc0,0xe0,0x20,0x10,0x14,0x12,0x23,0xe1,0xc0,0xc0,0x43,0x0f,0x3f,0x70,0x40,0x82,0x80,0x43,0x40,0x70,0x3f,0x0f,0xc0,
+0x00,0x48,0x80,0xc0,0x40,0x20,0x28,0x24,0x46,0xc2,0x80,0xc0,0x43,0x1e,0x7f,0xe1,0x80,0x02,0x43,0x80,0xe1,0x7f,0x1e,0xc0,0x03,0x82,0x01,0xc0,
+0x01,0x46,0x80,0x80,0x40,0x50,0x48,0x8c,0x84,0xc0,0x42,0x3c,0xff,0xc3,0x04,0x42,0xc3,0xff,0x3c,0xc0,0x01,0x41,0x01,0x01,0x82,0x02,0x41,0x01,0x01,0xc0,
+0x03,0x44,0x80,0xa0,0x90,0x18,0x08,0xc0,0x43,0x78,0xfe,0x87,0x01,0x02,0x43,0x01,0x87,0xfe,0x78,0xc0,0x00,0x42,0x01,0x03,0x02,0x82,0x04,0x42,0x02,0x03,0x01,0xc0,
 // 'Ocircumflex'
-212,16,11,16,1,0,51,4,20,0x00,0x80,0x00,0x01,0xc0,0x00,0x02,0x20,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x06,0x30,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x06,0x30,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,
+13,3,11,4,16,2,
+0x02,0x44,0x40,0x20,0x30,0x20,0x40,0xc0,0x43,0xf0,0xfc,0x0e,0x02,0x82,0x01,0x43,0x02,0x0e,0xfc,0xf0,0xc0,0x00,0x42,0x03,0x07,0x04,0x82,0x08,0x42,0x04,0x07,0x03,0xc0,
+0x02,0x44,0x80,0x40,0x60,0x40,0x80,0xc0,0x43,0xe0,0xf8,0x1c,0x04,0x82,0x02,0x43,0x04,0x1c,0xf8,0xe0,0xc0,0x43,0x01,0x07,0x0e,0x08,0x82,0x10,0x43,0x08,0x0e,0x07,0x01,0xc0,
+0x03,0x42,0x80,0xc0,0x80,0xc0,0x43,0xc0,0xf0,0x38,0x09,0x82,0x04,0x43,0x09,0x38,0xf0,0xc0,0xc0,0x43,0x03,0x0f,0x1c,0x10,0x82,0x20,0x43,0x10,0x1c,0x0f,0x03,0xc0,
+0x04,0x40,0x80,0xc0,0x43,0x80,0xe0,0x70,0x12,0x82,0x09,0x43,0x12,0x70,0xe0,0x80,0xc0,0x43,0x07,0x1f,0x38,0x20,0x82,0x40,0x43,0x20,0x38,0x1f,0x07,0xc0,
+0x00,0x48,0xc0,0xe0,0x24,0x12,0x13,0x12,0x24,0xe0,0xc0,0xc0,0x43,0x0f,0x3f,0x70,0x40,0x82,0x80,0x43,0x40,0x70,0x3f,0x0f,0xc0,
+0x00,0x48,0x80,0xc0,0x48,0x24,0x26,0x24,0x48,0xc0,0x80,0xc0,0x43,0x1e,0x7f,0xe1,0x80,0x02,0x43,0x80,0xe1,0x7f,0x1e,0xc0,0x03,0x82,0x01,0xc0,
+0x01,0x46,0x80,0x90,0x48,0x4c,0x48,0x90,0x80,0xc0,0x42,0x3c,0xff,0xc3,0x04,0x42,0xc3,0xff,0x3c,0xc0,0x01,0x41,0x01,0x01,0x82,0x02,0x41,0x01,0x01,0xc0,
+0x02,0x44,0x20,0x90,0x98,0x90,0x20,0xc0,0x43,0x78,0xfe,0x87,0x01,0x02,0x43,0x01,0x87,0xfe,0x78,0xc0,0x00,0x42,0x01,0x03,0x02,0x82,0x04,0x42,0x02,0x03,0x01,0xc0,
 // 'Otilde'
-213,16,11,15,1,0,48,5,20,0x01,0xd0,0x00,0x02,0xe0,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x06,0x30,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x06,0x30,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,
+13,3,11,5,15,0,
+0x00,0x00,0x00,0x40,0x20,0x60,0x60,0x40,0x20,0x00,0x00,0xf0,0xfc,0x0e,0x02,0x01,0x01,0x01,0x02,0x0e,0xfc,0xf0,0x00,0x03,0x07,0x04,0x08,0x08,0x08,0x04,0x07,0x03,0x00,
+0x00,0x00,0x00,0x80,0x40,0xc0,0xc0,0x80,0x40,0x00,0x00,0xe0,0xf8,0x1c,0x04,0x02,0x02,0x02,0x04,0x1c,0xf8,0xe0,0x01,0x07,0x0e,0x08,0x10,0x10,0x10,0x08,0x0e,0x07,0x01,
+0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x00,0x80,0x00,0x00,0xc0,0xf0,0x38,0x09,0x04,0x05,0x05,0x09,0x38,0xf0,0xc0,0x03,0x0f,0x1c,0x10,0x20,0x20,0x20,0x10,0x1c,0x0f,0x03,
+0x80,0xe0,0x70,0x12,0x09,0x0b,0x0b,0x12,0x71,0xe0,0x80,0x07,0x1f,0x38,0x20,0x40,0x40,0x40,0x20,0x38,0x1f,0x07,
+0x00,0xc0,0xe0,0x24,0x12,0x16,0x16,0x24,0xe2,0xc0,0x00,0x0f,0x3f,0x70,0x40,0x80,0x80,0x80,0x40,0x70,0x3f,0x0f,
+0x00,0x80,0xc0,0x48,0x24,0x2c,0x2c,0x48,0xc4,0x80,0x00,0x1e,0x7f,0xe1,0x80,0x00,0x00,0x00,0x80,0xe1,0x7f,0x1e,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x80,0x90,0x48,0x58,0x58,0x90,0x88,0x00,0x00,0x3c,0xff,0xc3,0x00,0x00,0x00,0x00,0x00,0xc3,0xff,0x3c,0x00,0x00,0x01,0x01,0x02,0x02,0x02,0x01,0x01,0x00,0x00,
+0x00,0x00,0x00,0x20,0x90,0xb0,0xb0,0x20,0x10,0x00,0x00,0x78,0xfe,0x87,0x01,0x00,0x00,0x00,0x01,0x87,0xfe,0x78,0x00,0x01,0x03,0x02,0x04,0x04,0x04,0x02,0x03,0x01,0x00,
 // 'Odieresis'
-214,16,11,15,1,0,48,5,20,0x02,0x20,0x00,0x02,0x20,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x06,0x30,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x18,0x0c,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x06,0x30,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,
+13,3,11,5,15,2,
+0x02,0x40,0x60,0x02,0x40,0x60,0xc0,0x43,0xf0,0xfc,0x0e,0x02,0x82,0x01,0x43,0x02,0x0e,0xfc,0xf0,0xc0,0x00,0x42,0x03,0x07,0x04,0x82,0x08,0x42,0x04,0x07,0x03,0xc0,
+0x02,0x40,0xc0,0x02,0x40,0xc0,0xc0,0x43,0xe0,0xf8,0x1c,0x04,0x82,0x02,0x43,0x04,0x1c,0xf8,0xe0,0xc0,0x43,0x01,0x07,0x0e,0x08,0x82,0x10,0x43,0x08,0x0e,0x07,0x01,0xc0,
+0x02,0x40,0x80,0x02,0x40,0x80,0xc0,0x43,0xc0,0xf0,0x38,0x09,0x82,0x04,0x43,0x09,0x38,0xf0,0xc0,0xc0,0x43,0x03,0x0f,0x1c,0x10,0x82,0x20,0x43,0x10,0x1c,0x0f,0x03,0xc0,
+0x43,0x80,0xe0,0x70,0x13,0x82,0x08,0x43,0x13,0x70,0xe0,0x80,0xc0,0x43,0x07,0x1f,0x38,0x20,0x82,0x40,0x43,0x20,0x38,0x1f,0x07,0xc0,
+0x00,0x42,0xc0,0xe0,0x26,0x82,0x10,0x42,0x26,0xe0,0xc0,0xc0,0x43,0x0f,0x3f,0x70,0x40,0x82,0x80,0x43,0x40,0x70,0x3f,0x0f,0xc0,
+0x00,0x42,0x80,0xc0,0x4c,0x82,0x20,0x42,0x4c,0xc0,0x80,0xc0,0x43,0x1e,0x7f,0xe1,0x80,0x02,0x43,0x80,0xe1,0x7f,0x1e,0xc0,0x03,0x82,0x01,0xc0,
+0x01,0x41,0x80,0x98,0x82,0x40,0x41,0x98,0x80,0xc0,0x42,0x3c,0xff,0xc3,0x04,0x42,0xc3,0xff,0x3c,0xc0,0x01,0x41,0x01,0x01,0x82,0x02,0x41,0x01,0x01,0xc0,
+0x02,0x40,0x30,0x82,0x80,0x40,0x30,0xc0,0x43,0x78,0xfe,0x87,0x01,0x02,0x43,0x01,0x87,0xfe,0x78,0xc0,0x00,0x42,0x01,0x03,0x02,0x82,0x04,0x42,0x02,0x03,0x01,0xc0,
 // 'multiply'
-215,13,8,8,1,0,27,12,20,0x10,0x20,0x00,0x08,0x40,0x00,0x04,0x80,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x04,0x80,0x00,0x08,0x40,0x00,0x10,0x20,0x00,0x00,0x00,0x00,
+10,3,8,12,8,0,
+0x10,0x20,0x40,0x80,0x80,0x40,0x20,0x10,0x08,0x04,0x02,0x01,0x01,0x02,0x04,0x08,
+0x20,0x40,0x80,0x00,0x00,0x80,0x40,0x20,0x10,0x08,0x04,0x03,0x03,0x04,0x08,0x10,
+0x40,0x80,0x00,0x00,0x00,0x00,0x80,0x40,0x20,0x10,0x09,0x06,0x06,0x09,0x10,0x20,
+0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x40,0x21,0x12,0x0c,0x0c,0x12,0x21,0x40,
+0x81,0x42,0x24,0x18,0x18,0x24,0x42,0x81,
+0x02,0x84,0x48,0x30,0x30,0x48,0x84,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+0x04,0x08,0x90,0x60,0x60,0x90,0x08,0x04,0x02,0x01,0x00,0x00,0x00,0x00,0x01,0x02,
+0x08,0x10,0x20,0xc0,0xc0,0x20,0x10,0x08,0x04,0x02,0x01,0x00,0x00,0x01,0x02,0x04,
 // 'Oslash'
-216,16,11,14,1,-1,45,7,21,0x00,0x04,0x00,0x01,0xc8,0x00,0x06,0x30,0x00,0x0c,0x38,0x00,0x0c,0x28,0x00,0x18,0x4c,0x00,0x18,0x8c,0x00,0x18,0x8c,0x00,0x19,0x0c,0x00,0x0a,0x18,0x00,0x0e,0x18,0x00,0x06,0x30,0x00,0x09,0xc0,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+13,3,11,7,14,0,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xf0,0xfc,0x0e,0x02,0x81,0x61,0x11,0x0e,0x06,0xfd,0xf0,0x10,0x0b,0x06,0x07,0x08,0x08,0x08,0x04,0x07,0x03,0x00,
+0xe0,0xf8,0x1c,0x04,0x02,0xc2,0x22,0x1c,0x0c,0xfa,0xe1,0x21,0x17,0x0c,0x0e,0x11,0x10,0x10,0x08,0x0e,0x07,0x01,
+0xc0,0xf0,0x38,0x08,0x04,0x84,0x44,0x38,0x18,0xf4,0xc2,0x43,0x2f,0x18,0x1c,0x22,0x21,0x20,0x10,0x1c,0x0f,0x03,
+0x80,0xe0,0x70,0x10,0x08,0x08,0x88,0x70,0x30,0xe8,0x84,0x87,0x5f,0x30,0x38,0x44,0x43,0x40,0x20,0x38,0x1f,0x07,
+0x00,0xc0,0xe0,0x20,0x10,0x10,0x10,0xe0,0x60,0xd0,0x08,0x0f,0xbf,0x60,0x70,0x88,0x86,0x81,0x40,0x70,0x3f,0x0f,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x80,0xc0,0x40,0x20,0x20,0x20,0xc0,0xc0,0xa0,0x10,0x1e,0x7f,0xc1,0xe0,0x10,0x0c,0x02,0x81,0xe0,0x7f,0x1e,0x02,0x01,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x80,0x80,0x40,0x40,0x40,0x80,0x80,0x40,0x20,0x3c,0xff,0x83,0xc0,0x20,0x18,0x04,0x03,0xc1,0xff,0x3c,0x04,0x02,0x01,0x01,0x02,0x02,0x02,0x01,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x80,0x40,0x78,0xfe,0x07,0x81,0x40,0x30,0x08,0x07,0x83,0xfe,0x78,0x08,0x05,0x03,0x03,0x04,0x04,0x04,0x02,0x03,0x01,0x00,
 // 'Ugrave'
-217,15,13,16,0,0,51,4,20,0x03,0x00,0x00,0x01,0x80,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x3f,0x3e,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x06,0x10,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,
+13,2,13,4,16,2,
+0x03,0x43,0x10,0x30,0x20,0x40,0xc0,0x45,0x01,0x01,0xff,0xff,0x01,0x01,0x01,0x44,0x01,0x01,0xff,0x01,0x01,0xc0,0x01,0x42,0x03,0x07,0x0c,0x83,0x08,0x41,0x04,0x03,0xc0,
+0x03,0x43,0x20,0x60,0x40,0x80,0xc0,0x45,0x02,0x02,0xfe,0xfe,0x02,0x02,0x01,0x44,0x02,0x02,0xfe,0x02,0x02,0xc0,0x01,0x42,0x07,0x0f,0x18,0x83,0x10,0x41,0x08,0x07,0xc0,
+0x03,0x42,0x40,0xc0,0x80,0xc0,0x4c,0x04,0x04,0xfc,0xfc,0x04,0x04,0x00,0x01,0x04,0x04,0xfc,0x04,0x04,0xc0,0x01,0x42,0x0f,0x1f,0x30,0x83,0x20,0x41,0x10,0x0f,0xc0,
+0x03,0x41,0x80,0x80,0xc0,0x4c,0x08,0x08,0xf8,0xf8,0x08,0x09,0x01,0x02,0x08,0x08,0xf8,0x08,0x08,0xc0,0x01,0x42,0x1f,0x3f,0x60,0x83,0x40,0x41,0x20,0x1f,0xc0,
+0x4c,0x10,0x10,0xf0,0xf0,0x11,0x13,0x02,0x04,0x10,0x10,0xf0,0x10,0x10,0xc0,0x01,0x42,0x3f,0x7f,0xc0,0x83,0x80,0x41,0x40,0x3f,0xc0,
+0x4c,0x20,0x20,0xe0,0xe0,0x22,0x26,0x04,0x08,0x20,0x20,0xe0,0x20,0x20,0xc0,0x01,0x42,0x7f,0xff,0x80,0x03,0x41,0x80,0x7f,0xc0,0x03,0x84,0x01,0xc0,
+0x4c,0x40,0x40,0xc0,0xc0,0x44,0x4c,0x08,0x10,0x40,0x40,0xc0,0x40,0x40,0xc0,0x01,0x41,0xff,0xff,0x05,0x40,0xff,0xc0,0x02,0x41,0x01,0x03,0x83,0x02,0x40,0x01,0xc0,
+0x83,0x80,0x43,0x88,0x98,0x10,0x20,0x84,0x80,0xc0,0x01,0x41,0xff,0xff,0x05,0x40,0xff,0xc0,0x01,0x42,0x01,0x03,0x06,0x83,0x04,0x41,0x02,0x01,0xc0,
 // 'Uacute'
-218,15,13,16,0,0,51,4,20,0x00,0x30,0x00,0x00,0x60,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x3f,0x3e,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x06,0x10,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,
+13,2,13,4,16,2,
+0x05,0x43,0x40,0x20,0x30,0x10,0xc0,0x45,0x01,0x01,0xff,0xff,0x01,0x01,0x01,0x44,0x01,0x01,0xff,0x01,0x01,0xc0,0x01,0x42,0x03,0x07,0x0c,0x83,0x08,0x41,0x04,0x03,0xc0,
+0x05,0x43,0x80,0x40,0x60,0x20,0xc0,0x45,0x02,0x02,0xfe,0xfe,0x02,0x02,0x01,0x44,0x02,0x02,0xfe,0x02,0x02,0xc0,0x01,0x42,0x07,0x0f,0x18,0x83,0x10,0x41,0x08,0x07,0xc0,
+0x06,0x42,0x80,0xc0,0x40,0xc0,0x4c,0x04,0x04,0xfc,0xfc,0x04,0x04,0x01,0x00,0x04,0x04,0xfc,0x04,0x04,0xc0,0x01,0x42,0x0f,0x1f,0x30,0x83,0x20,0x41,0x10,0x0f,0xc0,
+0x07,0x41,0x80,0x80,0xc0,0x4c,0x08,0x08,0xf8,0xf8,0x08,0x08,0x02,0x01,0x09,0x08,0xf8,0x08,0x08,0xc0,0x01,0x42,0x1f,0x3f,0x60,0x83,0x40,0x41,0x20,0x1f,0xc0,
+0x4c,0x10,0x10,0xf0,0xf0,0x10,0x10,0x04,0x02,0x13,0x11,0xf0,0x10,0x10,0xc0,0x01,0x42,0x3f,0x7f,0xc0,0x83,0x80,0x41,0x40,0x3f,0xc0,
+0x4c,0x20,0x20,0xe0,0xe0,0x20,0x20,0x08,0x04,0x26,0x22,0xe0,0x20,0x20,0xc0,0x01,0x42,0x7f,0xff,0x80,0x03,0x41,0x80,0x7f,0xc0,0x03,0x84,0x01,0xc0,
+0x4c,0x40,0x40,0xc0,0xc0,0x40,0x40,0x10,0x08,0x4c,0x44,0xc0,0x40,0x40,0xc0,0x01,0x41,0xff,0xff,0x05,0x40,0xff,0xc0,0x02,0x41,0x01,0x03,0x83,0x02,0x40,0x01,0xc0,
+0x85,0x80,0x43,0x20,0x10,0x98,0x88,0x82,0x80,0xc0,0x01,0x41,0xff,0xff,0x05,0x40,0xff,0xc0,0x01,0x42,0x01,0x03,0x06,0x83,0x04,0x41,0x02,0x01,0xc0,
 // 'Ucircumflex'
-219,15,13,16,0,0,51,4,20,0x00,0x80,0x00,0x01,0xc0,0x00,0x02,0x20,0x00,0x00,0x00,0x00,0x3f,0x3e,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x06,0x10,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,
+13,2,13,4,16,2,
+0x03,0x44,0x40,0x20,0x30,0x20,0x40,0xc0,0x45,0x01,0x01,0xff,0xff,0x01,0x01,0x01,0x44,0x01,0x01,0xff,0x01,0x01,0xc0,0x01,0x42,0x03,0x07,0x0c,0x83,0x08,0x41,0x04,0x03,0xc0,
+0x03,0x44,0x80,0x40,0x60,0x40,0x80,0xc0,0x45,0x02,0x02,0xfe,0xfe,0x02,0x02,0x01,0x44,0x02,0x02,0xfe,0x02,0x02,0xc0,0x01,0x42,0x07,0x0f,0x18,0x83,0x10,0x41,0x08,0x07,0xc0,
+0x04,0x42,0x80,0xc0,0x80,0xc0,0x45,0x04,0x04,0xfc,0xfc,0x05,0x04,0x01,0x44,0x05,0x04,0xfc,0x04,0x04,0xc0,0x01,0x42,0x0f,0x1f,0x30,0x83,0x20,0x41,0x10,0x0f,0xc0,
+0x05,0x40,0x80,0xc0,0x4c,0x08,0x08,0xf8,0xf8,0x0a,0x09,0x01,0x01,0x0a,0x08,0xf8,0x08,0x08,0xc0,0x01,0x42,0x1f,0x3f,0x60,0x83,0x40,0x41,0x20,0x1f,0xc0,
+0x4c,0x10,0x10,0xf0,0xf0,0x14,0x12,0x03,0x02,0x14,0x10,0xf0,0x10,0x10,0xc0,0x01,0x42,0x3f,0x7f,0xc0,0x83,0x80,0x41,0x40,0x3f,0xc0,
+0x4c,0x20,0x20,0xe0,0xe0,0x28,0x24,0x06,0x04,0x28,0x20,0xe0,0x20,0x20,0xc0,0x01,0x42,0x7f,0xff,0x80,0x03,0x41,0x80,0x7f,0xc0,0x03,0x84,0x01,0xc0,
+0x4c,0x40,0x40,0xc0,0xc0,0x50,0x48,0x0c,0x08,0x50,0x40,0xc0,0x40,0x40,0xc0,0x01,0x41,0xff,0xff,0x05,0x40,0xff,0xc0,0x02,0x41,0x01,0x03,0x83,0x02,0x40,0x01,0xc0,
+0x83,0x80,0x44,0xa0,0x90,0x18,0x10,0xa0,0x83,0x80,0xc0,0x01,0x41,0xff,0xff,0x05,0x40,0xff,0xc0,0x01,0x42,0x01,0x03,0x06,0x83,0x04,0x41,0x02,0x01,0xc0,
 // 'Udieresis'
-220,15,13,15,0,0,48,5,20,0x02,0x20,0x00,0x02,0x20,0x00,0x00,0x00,0x00,0x3f,0x3e,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x0c,0x08,0x00,0x06,0x10,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,
+13,2,13,5,15,2,
+0x03,0x40,0x60,0x02,0x40,0x60,0xc0,0x45,0x01,0x01,0xff,0xff,0x01,0x01,0x01,0x44,0x01,0x01,0xff,0x01,0x01,0xc0,0x01,0x42,0x03,0x07,0x0c,0x83,0x08,0x41,0x04,0x03,0xc0,
+0x03,0x40,0xc0,0x02,0x40,0xc0,0xc0,0x45,0x02,0x02,0xfe,0xfe,0x02,0x02,0x01,0x44,0x02,0x02,0xfe,0x02,0x02,0xc0,0x01,0x42,0x07,0x0f,0x18,0x83,0x10,0x41,0x08,0x07,0xc0,
+0x03,0x40,0x80,0x02,0x40,0x80,0xc0,0x45,0x04,0x04,0xfc,0xfc,0x05,0x04,0x01,0x44,0x05,0x04,0xfc,0x04,0x04,0xc0,0x01,0x42,0x0f,0x1f,0x30,0x83,0x20,0x41,0x10,0x0f,0xc0,
+0x45,0x08,0x08,0xf8,0xf8,0x0b,0x08,0x01,0x44,0x0b,0x08,0xf8,0x08,0x08,0xc0,0x01,0x42,0x1f,0x3f,0x60,0x83,0x40,0x41,0x20,0x1f,0xc0,
+0x45,0x10,0x10,0xf0,0xf0,0x16,0x10,0x01,0x44,0x16,0x10,0xf0,0x10,0x10,0xc0,0x01,0x42,0x3f,0x7f,0xc0,0x83,0x80,0x41,0x40,0x3f,0xc0,
+0x45,0x20,0x20,0xe0,0xe0,0x2c,0x20,0x01,0x44,0x2c,0x20,0xe0,0x20,0x20,0xc0,0x01,0x42,0x7f,0xff,0x80,0x03,0x41,0x80,0x7f,0xc0,0x03,0x84,0x01,0xc0,
+0x45,0x40,0x40,0xc0,0xc0,0x58,0x40,0x01,0x44,0x58,0x40,0xc0,0x40,0x40,0xc0,0x01,0x41,0xff,0xff,0x05,0x40,0xff,0xc0,0x02,0x41,0x01,0x03,0x83,0x02,0x40,0x01,0xc0,
+0x83,0x80,0x41,0xb0,0x80,0x01,0x40,0xb0,0x83,0x80,0xc0,0x01,0x41,0xff,0xff,0x05,0x40,0xff,0xc0,0x01,0x42,0x01,0x03,0x06,0x83,0x04,0x41,0x02,0x01,0xc0,
 // 'Yacute'
-221,14,12,16,0,0,51,4,20,0x00,0x60,0x00,0x00,0xc0,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x3f,0x3c,0x00,0x0c,0x10,0x00,0x06,0x20,0x00,0x06,0x20,0x00,0x03,0x40,0x00,0x03,0x40,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,
+12,2,12,4,16,2,
+0x04,0x43,0x40,0x20,0x30,0x10,0xc0,0x4b,0x01,0x01,0x03,0x0f,0x3d,0xf1,0xc0,0x30,0x0d,0x03,0x01,0x01,0xc0,0x02,0x45,0x08,0x08,0x0f,0x0f,0x08,0x08,0xc0,
+0x04,0x43,0x80,0x40,0x60,0x20,0xc0,0x4b,0x02,0x02,0x06,0x1e,0x7a,0xe2,0x80,0x60,0x1a,0x06,0x02,0x02,0xc0,0x02,0x45,0x10,0x10,0x1f,0x1f,0x10,0x10,0xc0,
+0x05,0x42,0x80,0xc0,0x40,0xc0,0x4b,0x04,0x04,0x0c,0x3c,0xf4,0xc5,0x00,0xc0,0x34,0x0c,0x04,0x04,0xc0,0x02,0x45,0x20,0x20,0x3f,0x3f,0x20,0x20,0xc0,
+0x06,0x41,0x80,0x80,0xc0,0x4b,0x08,0x08,0x18,0x78,0xe8,0x8a,0x01,0x81,0x68,0x18,0x08,0x08,0xc0,0x02,0x45,0x40,0x41,0x7f,0x7e,0x41,0x40,0xc0,
+0x4b,0x10,0x10,0x30,0xf0,0xd0,0x14,0x02,0x03,0xd1,0x30,0x10,0x10,0xc0,0x02,0x45,0x80,0x83,0xff,0xfc,0x83,0x80,0xc0,
+0x4b,0x20,0x20,0x60,0xe0,0xa0,0x28,0x04,0x06,0xa2,0x60,0x20,0x20,0xc0,0x02,0x45,0x01,0x07,0xfe,0xf8,0x06,0x01,0xc0,0x02,0x85,0x01,0xc0,
+0x4b,0x40,0x40,0xc0,0xc0,0x40,0x50,0x08,0x0c,0x44,0xc0,0x40,0x40,0xc0,0x02,0x45,0x03,0x0f,0xfc,0xf0,0x0c,0x03,0xc0,0x02,0x45,0x02,0x02,0x03,0x03,0x02,0x02,0xc0,
+0x84,0x80,0x43,0xa0,0x10,0x18,0x88,0x82,0x80,0xc0,0x01,0x47,0x01,0x07,0x1e,0xf8,0xe0,0x18,0x06,0x01,0xc0,0x02,0x45,0x04,0x04,0x07,0x07,0x04,0x04,0xc0,
 // 'Thorn'
-222,13,11,12,0,0,39,8,20,0x3f,0x00,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x0f,0xe0,0x00,0x0c,0x30,0x00,0x0c,0x18,0x00,0x0c,0x18,0x00,0x0c,0x30,0x00,0x0f,0xe0,0x00,0x0c,0x00,0x00,0x0c,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,
+11,2,11,8,12,2,
+0x4a,0x01,0x01,0xff,0xff,0x09,0x09,0x08,0x08,0x98,0xf0,0x60,0xc0,0x45,0x08,0x08,0x0f,0x0f,0x09,0x09,0x82,0x01,0xc0,
+0x4a,0x02,0x02,0xfe,0xfe,0x12,0x12,0x10,0x10,0x30,0xe0,0xc0,0xc0,0x49,0x10,0x10,0x1f,0x1f,0x12,0x12,0x02,0x02,0x03,0x01,0xc0,
+0x4a,0x04,0x04,0xfc,0xfc,0x24,0x24,0x20,0x20,0x60,0xc0,0x80,0xc0,0x4a,0x20,0x20,0x3f,0x3f,0x24,0x24,0x04,0x04,0x06,0x03,0x01,0xc0,
+0x49,0x08,0x08,0xf8,0xf8,0x48,0x48,0x40,0x40,0xc0,0x80,0xc0,0x4a,0x40,0x40,0x7f,0x7f,0x48,0x48,0x08,0x08,0x0c,0x07,0x03,0xc0,
+0x45,0x10,0x10,0xf0,0xf0,0x90,0x90,0x82,0x80,0xc0,0x4a,0x80,0x80,0xff,0xff,0x90,0x90,0x10,0x10,0x19,0x0f,0x06,0xc0,
+0x45,0x20,0x20,0xe0,0xe0,0x20,0x20,0xc0,0x01,0x41,0xff,0xff,0x83,0x21,0x42,0x33,0x1e,0x0c,0xc0,0x85,0x01,0xc0,
+0x45,0x40,0x40,0xc0,0xc0,0x40,0x40,0xc0,0x01,0x41,0xff,0xff,0x83,0x42,0x42,0x66,0x3c,0x18,0xc0,0x45,0x02,0x02,0x03,0x03,0x02,0x02,0xc0,
+0x85,0x80,0xc0,0x01,0x41,0xff,0xff,0x83,0x84,0x42,0xcc,0x78,0x30,0xc0,0x45,0x04,0x04,0x07,0x07,0x04,0x04,0xc0,
 // 'germandbls'
-223,13,8,12,1,0,39,8,20,0x07,0x80,0x00,0x0c,0xc0,0x00,0x0c,0x60,0x00,0x0c,0x60,0x00,0x0c,0xc0,0x00,0x0f,0x80,0x00,0x0c,0xc0,0x00,0x0c,0x60,0x00,0x0c,0x60,0x00,0x0c,0x60,0x00,0x0e,0xc0,0x00,0x1d,0x80,0x00,0x00,0x00,0x00,
+10,3,8,8,12,0,
+0x00,0xfe,0xff,0x21,0x21,0x73,0xde,0x8c,0x08,0x0f,0x0f,0x04,0x08,0x0c,0x07,0x03,
+0x00,0xfc,0xfe,0x42,0x42,0xe6,0xbc,0x18,0x10,0x1f,0x1f,0x08,0x10,0x18,0x0f,0x07,
+0x00,0xf8,0xfc,0x84,0x84,0xcc,0x78,0x30,0x20,0x3f,0x3f,0x10,0x20,0x31,0x1f,0x0e,
+0x00,0xf0,0xf8,0x08,0x08,0x98,0xf0,0x60,0x40,0x7f,0x7f,0x21,0x41,0x63,0x3e,0x1c,
+0x00,0xe0,0xf0,0x10,0x10,0x30,0xe0,0xc0,0x80,0xff,0xff,0x42,0x82,0xc7,0x7d,0x38,
+0x00,0xc0,0xe0,0x20,0x20,0x60,0xc0,0x80,0x00,0xff,0xff,0x84,0x04,0x8e,0xfb,0x71,0x01,0x01,0x01,0x00,0x01,0x01,0x00,0x00,
+0x00,0x80,0xc0,0x40,0x40,0xc0,0x80,0x00,0x00,0xff,0xff,0x08,0x08,0x1c,0xf7,0xe3,0x02,0x03,0x03,0x01,0x02,0x03,0x01,0x00,
+0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0xff,0xff,0x10,0x10,0x39,0xef,0xc6,0x04,0x07,0x07,0x02,0x04,0x06,0x03,0x01,
 // 'agrave'
-224,12,7,12,1,0,39,8,20,0x08,0x00,0x00,0x0c,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x03,0x80,0x00,0x0d,0x80,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,
+9,3,7,8,12,0,
+0x60,0x73,0x12,0x94,0xf0,0xe0,0x00,0x06,0x0f,0x09,0x08,0x07,0x0f,0x08,
+0xc0,0xe6,0x24,0x28,0xe0,0xc0,0x00,0x0c,0x1e,0x12,0x11,0x0f,0x1f,0x10,
+0x80,0xcc,0x48,0x50,0xc0,0x80,0x00,0x19,0x3d,0x24,0x22,0x1f,0x3f,0x20,
+0x00,0x98,0x90,0xa0,0x80,0x00,0x00,0x33,0x7b,0x48,0x44,0x3f,0x7f,0x40,
+0x00,0x30,0x20,0x40,0x00,0x00,0x00,0x66,0xf7,0x91,0x89,0x7f,0xfe,0x80,
+0x00,0x60,0x40,0x80,0x00,0x00,0x00,0xcc,0xee,0x22,0x12,0xfe,0xfc,0x00,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0xc0,0x80,0x00,0x00,0x00,0x00,0x98,0xdc,0x44,0x25,0xfc,0xf8,0x00,0x01,0x03,0x02,0x02,0x01,0x03,0x02,
+0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x30,0xb9,0x89,0x4a,0xf8,0xf0,0x00,0x03,0x07,0x04,0x04,0x03,0x07,0x04,
 // 'aacute'
-225,12,7,12,1,0,39,8,20,0x00,0x80,0x00,0x01,0x80,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x03,0x80,0x00,0x0d,0x80,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,
+9,3,7,8,12,0,
+0x60,0x70,0x10,0x94,0xf2,0xe3,0x00,0x06,0x0f,0x09,0x08,0x07,0x0f,0x08,
+0xc0,0xe0,0x20,0x28,0xe4,0xc6,0x00,0x0c,0x1e,0x12,0x11,0x0f,0x1f,0x10,
+0x80,0xc0,0x40,0x50,0xc8,0x8c,0x00,0x19,0x3d,0x24,0x22,0x1f,0x3f,0x20,
+0x00,0x80,0x80,0xa0,0x90,0x18,0x00,0x33,0x7b,0x48,0x44,0x3f,0x7f,0x40,
+0x00,0x00,0x00,0x40,0x20,0x30,0x00,0x66,0xf7,0x91,0x89,0x7f,0xfe,0x80,
+0x00,0x00,0x00,0x80,0x40,0x60,0x00,0xcc,0xee,0x22,0x12,0xfe,0xfc,0x00,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0x00,0x00,0x00,0x80,0xc0,0x00,0x98,0xdc,0x44,0x25,0xfc,0xf8,0x00,0x01,0x03,0x02,0x02,0x01,0x03,0x02,
+0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x30,0xb8,0x88,0x4a,0xf9,0xf1,0x00,0x03,0x07,0x04,0x04,0x03,0x07,0x04,
 // 'acircumflex'
-226,12,7,12,1,0,39,8,20,0x02,0x00,0x00,0x07,0x00,0x00,0x08,0x80,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x03,0x80,0x00,0x0d,0x80,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,
+9,3,7,8,12,0,
+0x60,0x74,0x12,0x93,0xf2,0xe4,0x00,0x06,0x0f,0x09,0x08,0x07,0x0f,0x08,
+0xc0,0xe8,0x24,0x26,0xe4,0xc8,0x00,0x0c,0x1e,0x12,0x11,0x0f,0x1f,0x10,
+0x80,0xd0,0x48,0x4c,0xc8,0x90,0x00,0x19,0x3d,0x24,0x22,0x1f,0x3f,0x20,
+0x00,0xa0,0x90,0x98,0x90,0x20,0x00,0x33,0x7b,0x48,0x44,0x3f,0x7f,0x40,
+0x00,0x40,0x20,0x30,0x20,0x40,0x00,0x66,0xf7,0x91,0x89,0x7f,0xfe,0x80,
+0x00,0x80,0x40,0x60,0x40,0x80,0x00,0xcc,0xee,0x22,0x12,0xfe,0xfc,0x00,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0x00,0x80,0xc0,0x80,0x00,0x00,0x98,0xdd,0x44,0x24,0xfc,0xf9,0x00,0x01,0x03,0x02,0x02,0x01,0x03,0x02,
+0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x30,0xba,0x89,0x49,0xf9,0xf2,0x00,0x03,0x07,0x04,0x04,0x03,0x07,0x04,
 // 'atilde'
-227,12,7,11,1,0,36,9,20,0x06,0x80,0x00,0x0b,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x03,0x80,0x00,0x0d,0x80,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,
+9,3,7,9,11,0,
+0x60,0x74,0x12,0x96,0xf4,0xe2,0x00,0x06,0x0f,0x09,0x08,0x07,0x0f,0x08,
+0xc0,0xe8,0x24,0x2c,0xe8,0xc4,0x00,0x0c,0x1e,0x12,0x11,0x0f,0x1f,0x10,
+0x80,0xd0,0x48,0x58,0xd0,0x88,0x00,0x19,0x3d,0x24,0x22,0x1f,0x3f,0x20,
+0x00,0xa0,0x90,0xb0,0xa0,0x10,0x00,0x33,0x7b,0x48,0x44,0x3f,0x7f,0x40,
+0x00,0x40,0x20,0x60,0x40,0x20,0x00,0x66,0xf7,0x91,0x89,0x7f,0xfe,0x80,
+0x00,0x80,0x40,0xc0,0x80,0x40,0x00,0xcc,0xee,0x22,0x12,0xfe,0xfc,0x00,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0x00,0x80,0x80,0x00,0x80,0x00,0x98,0xdd,0x44,0x25,0xfd,0xf8,0x00,0x01,0x03,0x02,0x02,0x01,0x03,0x02,
+0x30,0xba,0x89,0x4b,0xfa,0xf1,0x00,0x03,0x07,0x04,0x04,0x03,0x07,0x04,
 // 'adieresis'
-228,12,7,11,1,0,36,9,20,0x09,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x03,0x80,0x00,0x0d,0x80,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,
+9,3,7,9,11,0,
+0x60,0x76,0x10,0x90,0xf6,0xe0,0x00,0x06,0x0f,0x09,0x08,0x07,0x0f,0x08,
+0xc0,0xec,0x20,0x20,0xec,0xc0,0x00,0x0c,0x1e,0x12,0x11,0x0f,0x1f,0x10,
+0x80,0xd8,0x40,0x40,0xd8,0x80,0x00,0x19,0x3d,0x24,0x22,0x1f,0x3f,0x20,
+0x00,0xb0,0x80,0x80,0xb0,0x00,0x00,0x33,0x7b,0x48,0x44,0x3f,0x7f,0x40,
+0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x66,0xf7,0x91,0x89,0x7f,0xfe,0x80,
+0x00,0xc0,0x00,0x00,0xc0,0x00,0x00,0xcc,0xee,0x22,0x12,0xfe,0xfc,0x00,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x98,0xdd,0x44,0x24,0xfd,0xf8,0x00,0x01,0x03,0x02,0x02,0x01,0x03,0x02,
+0x30,0xbb,0x88,0x48,0xfb,0xf0,0x00,0x03,0x07,0x04,0x04,0x03,0x07,0x04,
 // 'aring'
-229,12,7,13,1,0,42,7,20,0x06,0x00,0x00,0x09,0x00,0x00,0x09,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x03,0x80,0x00,0x0d,0x80,0x00,0x19,0x80,0x00,0x19,0x80,0x00,0x0e,0xc0,0x00,0x00,0x00,0x00,
+9,3,7,7,13,0,
+0x00,0x00,0x80,0x80,0x00,0x00,0x00,0x60,0x73,0x14,0x94,0xf3,0xe0,0x00,0x06,0x0f,0x09,0x08,0x07,0x0f,0x08,
+0xc0,0xe6,0x29,0x29,0xe6,0xc0,0x00,0x0c,0x1e,0x12,0x11,0x0f,0x1f,0x10,
+0x80,0xcc,0x52,0x52,0xcc,0x80,0x00,0x19,0x3d,0x24,0x22,0x1f,0x3f,0x20,
+0x00,0x98,0xa4,0xa4,0x98,0x00,0x00,0x33,0x7b,0x48,0x44,0x3f,0x7f,0x40,
+0x00,0x30,0x48,0x48,0x30,0x00,0x00,0x66,0xf7,0x91,0x89,0x7f,0xfe,0x80,
+0x00,0x60,0x90,0x90,0x60,0x00,0x00,0xcc,0xee,0x22,0x12,0xfe,0xfc,0x00,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0xc0,0x20,0x20,0xc0,0x00,0x00,0x98,0xdc,0x45,0x25,0xfc,0xf8,0x00,0x01,0x03,0x02,0x02,0x01,0x03,0x02,
+0x00,0x80,0x40,0x40,0x80,0x00,0x00,0x30,0xb9,0x8a,0x4a,0xf9,0xf0,0x00,0x03,0x07,0x04,0x04,0x03,0x07,0x04,
 // 'ae'
-230,15,12,8,0,0,27,12,20,0x1e,0x70,0x00,0x33,0x88,0x00,0x31,0x8c,0x00,0x07,0xfc,0x00,0x19,0x80,0x00,0x31,0x84,0x00,0x33,0xc8,0x00,0x1e,0x70,0x00,0x00,0x00,0x00,
+13,2,12,12,8,0,
+0x60,0x70,0x10,0x90,0xb0,0xe0,0xe0,0x90,0x90,0x90,0xe0,0xc0,0x06,0x0f,0x09,0x08,0x0c,0x07,0x07,0x0c,0x08,0x08,0x04,0x02,
+0xc0,0xe0,0x20,0x20,0x60,0xc0,0xc0,0x20,0x20,0x20,0xc0,0x80,0x0c,0x1e,0x12,0x11,0x19,0x0f,0x0f,0x19,0x11,0x11,0x09,0x05,
+0x80,0xc0,0x40,0x40,0xc0,0x80,0x80,0x40,0x40,0x40,0x80,0x00,0x19,0x3d,0x24,0x22,0x32,0x1f,0x1f,0x32,0x22,0x22,0x13,0x0b,
+0x00,0x80,0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x33,0x7b,0x48,0x44,0x65,0x3f,0x3f,0x64,0x44,0x44,0x27,0x16,
+0x66,0xf7,0x91,0x89,0xcb,0x7e,0x7e,0xc9,0x89,0x89,0x4e,0x2c,
+0xcc,0xee,0x22,0x12,0x96,0xfc,0xfc,0x92,0x12,0x12,0x9c,0x58,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x98,0xdc,0x44,0x24,0x2c,0xf8,0xf8,0x24,0x24,0x24,0x38,0xb0,0x01,0x03,0x02,0x02,0x03,0x01,0x01,0x03,0x02,0x02,0x01,0x00,
+0x30,0xb8,0x88,0x48,0x58,0xf0,0xf0,0x48,0x48,0x48,0x70,0x60,0x03,0x07,0x04,0x04,0x06,0x03,0x03,0x06,0x04,0x04,0x02,0x01,
 // 'ccedilla'
-231,9,6,11,0,-3,36,12,23,0x0e,0x00,0x00,0x1b,0x00,0x00,0x33,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x31,0x00,0x00,0x1b,0x00,0x00,0x0e,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
+7,2,6,12,11,0,
+0xc0,0xe0,0x30,0x10,0x70,0x60,0x03,0x47,0x5c,0x28,0x0c,0x06,
+0x80,0xc0,0x60,0x20,0xe0,0xc0,0x07,0x8f,0xb8,0x50,0x18,0x0c,
+0x00,0x80,0xc0,0x40,0xc0,0x80,0x0f,0x1f,0x70,0xa0,0x31,0x19,0x00,0x01,0x01,0x00,0x00,0x00,
+0x00,0x00,0x80,0x80,0x80,0x00,0x1e,0x3f,0xe1,0x40,0x63,0x33,0x00,0x02,0x02,0x01,0x00,0x00,
+0x3c,0x7e,0xc3,0x81,0xc7,0x66,0x00,0x04,0x05,0x02,0x00,0x00,
+0x78,0xfc,0x86,0x02,0x8e,0xcc,0x00,0x08,0x0b,0x05,0x01,0x00,
+0xf0,0xf8,0x0c,0x04,0x1c,0x98,0x00,0x11,0x17,0x0a,0x03,0x01,
+0xe0,0xf0,0x18,0x08,0x38,0x30,0x01,0x23,0x2e,0x14,0x06,0x03,
 // 'egrave'
-232,10,7,12,0,0,39,8,20,0x08,0x00,0x00,0x0c,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x31,0x80,0x00,0x3f,0x80,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x19,0x80,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,12,0,
+0xc0,0xe0,0x93,0x92,0x94,0xe0,0xc0,0x03,0x07,0x0c,0x08,0x08,0x0c,0x04,
+0x80,0xc0,0x26,0x24,0x28,0xc0,0x80,0x07,0x0f,0x19,0x11,0x11,0x19,0x09,
+0x00,0x80,0x4c,0x48,0x50,0x80,0x00,0x0f,0x1f,0x32,0x22,0x22,0x33,0x13,
+0x00,0x00,0x98,0x90,0xa0,0x00,0x00,0x1e,0x3f,0x64,0x44,0x44,0x67,0x26,
+0x00,0x00,0x30,0x20,0x40,0x00,0x00,0x3c,0x7e,0xc9,0x89,0x89,0xce,0x4c,
+0x00,0x00,0x60,0x40,0x80,0x00,0x00,0x78,0xfc,0x92,0x12,0x12,0x9c,0x98,0x00,0x00,0x01,0x01,0x01,0x01,0x00,
+0x00,0x00,0xc0,0x80,0x00,0x00,0x00,0xf0,0xf8,0x24,0x24,0x25,0x38,0x30,0x00,0x01,0x03,0x02,0x02,0x03,0x01,
+0x00,0x00,0x80,0x00,0x00,0x00,0x00,0xe0,0xf0,0x49,0x49,0x4a,0x70,0x60,0x01,0x03,0x06,0x04,0x04,0x06,0x02,
 // 'eacute'
-233,10,7,12,0,0,39,8,20,0x01,0x00,0x00,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x31,0x80,0x00,0x3f,0x80,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x19,0x80,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,12,0,
+0xc0,0xe0,0x90,0x94,0x92,0xe3,0xc0,0x03,0x07,0x0c,0x08,0x08,0x0c,0x04,
+0x80,0xc0,0x20,0x28,0x24,0xc6,0x80,0x07,0x0f,0x19,0x11,0x11,0x19,0x09,
+0x00,0x80,0x40,0x50,0x48,0x8c,0x00,0x0f,0x1f,0x32,0x22,0x22,0x33,0x13,
+0x00,0x00,0x80,0xa0,0x90,0x18,0x00,0x1e,0x3f,0x64,0x44,0x44,0x67,0x26,
+0x00,0x00,0x00,0x40,0x20,0x30,0x00,0x3c,0x7e,0xc9,0x89,0x89,0xce,0x4c,
+0x00,0x00,0x00,0x80,0x40,0x60,0x00,0x78,0xfc,0x92,0x12,0x12,0x9c,0x98,0x00,0x00,0x01,0x01,0x01,0x01,0x00,
+0x00,0x00,0x00,0x00,0x80,0xc0,0x00,0xf0,0xf8,0x24,0x25,0x24,0x38,0x30,0x00,0x01,0x03,0x02,0x02,0x03,0x01,
+0x00,0x00,0x00,0x00,0x00,0x80,0x00,0xe0,0xf0,0x48,0x4a,0x49,0x71,0x60,0x01,0x03,0x06,0x04,0x04,0x06,0x02,
 // 'ecircumflex'
-234,10,7,12,0,0,39,8,20,0x04,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x31,0x80,0x00,0x3f,0x80,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x19,0x80,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,12,0,
+0xc0,0xe4,0x92,0x93,0x92,0xe4,0xc0,0x03,0x07,0x0c,0x08,0x08,0x0c,0x04,
+0x80,0xc8,0x24,0x26,0x24,0xc8,0x80,0x07,0x0f,0x19,0x11,0x11,0x19,0x09,
+0x00,0x90,0x48,0x4c,0x48,0x90,0x00,0x0f,0x1f,0x32,0x22,0x22,0x33,0x13,
+0x00,0x20,0x90,0x98,0x90,0x20,0x00,0x1e,0x3f,0x64,0x44,0x44,0x67,0x26,
+0x00,0x40,0x20,0x30,0x20,0x40,0x00,0x3c,0x7e,0xc9,0x89,0x89,0xce,0x4c,
+0x00,0x80,0x40,0x60,0x40,0x80,0x00,0x78,0xfc,0x92,0x12,0x12,0x9c,0x98,0x00,0x00,0x01,0x01,0x01,0x01,0x00,
+0x00,0x00,0x80,0xc0,0x80,0x00,0x00,0xf0,0xf9,0x24,0x24,0x24,0x39,0x30,0x00,0x01,0x03,0x02,0x02,0x03,0x01,
+0x00,0x00,0x00,0x80,0x00,0x00,0x00,0xe0,0xf2,0x49,0x49,0x49,0x72,0x60,0x01,0x03,0x06,0x04,0x04,0x06,0x02,
 // 'edieresis'
-235,10,7,11,0,0,36,9,20,0x09,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x31,0x80,0x00,0x3f,0x80,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x19,0x80,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,
+8,2,7,9,11,0,
+0xc0,0xe0,0x96,0x90,0x90,0xe6,0xc0,0x03,0x07,0x0c,0x08,0x08,0x0c,0x04,
+0x80,0xc0,0x2c,0x20,0x20,0xcc,0x80,0x07,0x0f,0x19,0x11,0x11,0x19,0x09,
+0x00,0x80,0x58,0x40,0x40,0x98,0x00,0x0f,0x1f,0x32,0x22,0x22,0x33,0x13,
+0x00,0x00,0xb0,0x80,0x80,0x30,0x00,0x1e,0x3f,0x64,0x44,0x44,0x67,0x26,
+0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x3c,0x7e,0xc9,0x89,0x89,0xce,0x4c,
+0x00,0x00,0xc0,0x00,0x00,0xc0,0x00,0x78,0xfc,0x92,0x12,0x12,0x9c,0x98,0x00,0x00,0x01,0x01,0x01,0x01,0x00,
+0x00,0x00,0x80,0x00,0x00,0x80,0x00,0xf0,0xf8,0x25,0x24,0x24,0x39,0x30,0x00,0x01,0x03,0x02,0x02,0x03,0x01,
+0xe0,0xf0,0x4b,0x48,0x48,0x73,0x60,0x01,0x03,0x06,0x04,0x04,0x06,0x02,
 // 'igrave'
-236,7,4,12,0,0,39,8,20,0x20,0x00,0x00,0x30,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,
+5,2,4,8,12,0,
+0x13,0xf2,0xf4,0x00,0x08,0x0f,0x0f,0x08,
+0x26,0xe4,0xe8,0x00,0x10,0x1f,0x1f,0x10,
+0x4c,0xc8,0xd0,0x00,0x20,0x3f,0x3f,0x20,
+0x98,0x90,0xa0,0x00,0x40,0x7f,0x7f,0x40,
+0x30,0x20,0x40,0x00,0x81,0xff,0xff,0x80,
+0x60,0x40,0x80,0x00,0x02,0xfe,0xfe,0x00,0x01,0x01,0x01,0x01,
+0xc0,0x80,0x00,0x00,0x04,0xfc,0xfd,0x00,0x02,0x03,0x03,0x02,
+0x80,0x00,0x00,0x00,0x09,0xf9,0xfa,0x00,0x04,0x07,0x07,0x04,
 // 'iacute'
-237,7,4,12,0,0,39,8,20,0x04,0x00,0x00,0x0c,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,
+5,2,4,8,12,0,
+0x10,0xf4,0xf2,0x03,0x08,0x0f,0x0f,0x08,
+0x20,0xe8,0xe4,0x06,0x10,0x1f,0x1f,0x10,
+0x40,0xd0,0xc8,0x0c,0x20,0x3f,0x3f,0x20,
+0x80,0xa0,0x90,0x18,0x40,0x7f,0x7f,0x40,
+0x00,0x40,0x20,0x30,0x81,0xff,0xff,0x80,
+0x00,0x80,0x40,0x60,0x02,0xfe,0xfe,0x00,0x01,0x01,0x01,0x01,
+0x00,0x00,0x80,0xc0,0x04,0xfd,0xfc,0x00,0x02,0x03,0x03,0x02,
+0x00,0x00,0x00,0x80,0x08,0xfa,0xf9,0x01,0x04,0x07,0x07,0x04,
 // 'icircumflex'
-238,6,5,12,-1,0,39,8,20,0x10,0x00,0x00,0x38,0x00,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,
+5,1,5,8,12,0,
+0x04,0x12,0xf3,0xf2,0x04,0x00,0x08,0x0f,0x0f,0x08,
+0x08,0x24,0xe6,0xe4,0x08,0x00,0x10,0x1f,0x1f,0x10,
+0x10,0x48,0xcc,0xc8,0x10,0x00,0x20,0x3f,0x3f,0x20,
+0x20,0x90,0x98,0x90,0x20,0x00,0x40,0x7f,0x7f,0x40,
+0x40,0x20,0x30,0x20,0x40,0x00,0x81,0xff,0xff,0x80,
+0x80,0x40,0x60,0x40,0x80,0x00,0x02,0xfe,0xfe,0x00,0x00,0x01,0x01,0x01,0x01,
+0x00,0x80,0xc0,0x80,0x00,0x01,0x04,0xfc,0xfc,0x01,0x00,0x02,0x03,0x03,0x02,
+0x00,0x00,0x80,0x00,0x00,0x02,0x09,0xf9,0xf9,0x02,0x00,0x04,0x07,0x07,0x04,
 // 'idieresis'
-239,7,4,11,0,0,36,9,20,0x24,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,
+5,2,4,9,11,0,
+0x16,0xf0,0xf0,0x06,0x08,0x0f,0x0f,0x08,
+0x2c,0xe0,0xe0,0x0c,0x10,0x1f,0x1f,0x10,
+0x58,0xc0,0xc0,0x18,0x20,0x3f,0x3f,0x20,
+0xb0,0x80,0x80,0x30,0x40,0x7f,0x7f,0x40,
+0x60,0x00,0x00,0x60,0x81,0xff,0xff,0x80,
+0xc0,0x00,0x00,0xc0,0x02,0xfe,0xfe,0x00,0x01,0x01,0x01,0x01,
+0x80,0x00,0x00,0x80,0x05,0xfc,0xfc,0x01,0x02,0x03,0x03,0x02,
+0x0b,0xf8,0xf8,0x03,0x04,0x07,0x07,0x04,
 // 'eth'
-240,10,7,13,0,0,42,7,20,0x10,0x00,0x00,0x09,0x80,0x00,0x06,0x00,0x00,0x1a,0x00,0x00,0x03,0x00,0x00,0x0f,0x00,0x00,0x1b,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x1b,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,7,13,0,
+0x00,0x80,0x00,0x00,0x00,0x00,0x00,0xc0,0xe4,0x35,0x12,0x3e,0xf9,0xe1,0x03,0x07,0x0c,0x08,0x0c,0x07,0x03,
+0x80,0xc9,0x6a,0x24,0x7c,0xf2,0xc2,0x07,0x0f,0x18,0x10,0x18,0x0f,0x07,
+0x00,0x92,0xd4,0x48,0xf8,0xe4,0x84,0x0f,0x1f,0x30,0x20,0x30,0x1f,0x0f,
+0x00,0x24,0xa8,0x90,0xf0,0xc8,0x08,0x1e,0x3f,0x61,0x40,0x61,0x3f,0x1f,
+0x00,0x48,0x50,0x20,0xe0,0x90,0x10,0x3c,0x7e,0xc3,0x81,0xc3,0x7f,0x3e,
+0x00,0x90,0xa0,0x40,0xc0,0x20,0x20,0x78,0xfc,0x86,0x02,0x87,0xff,0x7c,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x20,0x40,0x80,0x80,0x40,0x40,0xf0,0xf9,0x0d,0x04,0x0f,0xfe,0xf8,0x00,0x01,0x03,0x02,0x03,0x01,0x00,
+0x00,0x40,0x80,0x00,0x00,0x80,0x80,0xe0,0xf2,0x1a,0x09,0x1f,0xfc,0xf0,0x01,0x03,0x06,0x04,0x06,0x03,0x01,
 // 'ntilde'
-241,12,9,11,0,0,36,9,20,0x06,0x80,0x00,0x0b,0x00,0x00,0x00,0x00,0x00,0x3b,0x80,0x00,0x1c,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x3d,0xe0,0x00,0x00,0x00,0x00,
+10,2,9,9,11,0,
+0x10,0xf0,0xf4,0x22,0x16,0x14,0xf2,0xe0,0x00,0x08,0x0f,0x0f,0x08,0x00,0x08,0x0f,0x0f,0x08,
+0x20,0xe0,0xe8,0x44,0x2c,0x28,0xe4,0xc0,0x00,0x10,0x1f,0x1f,0x10,0x00,0x10,0x1f,0x1f,0x10,
+0x40,0xc0,0xd0,0x88,0x58,0x50,0xc8,0x80,0x00,0x20,0x3f,0x3f,0x20,0x00,0x20,0x3f,0x3f,0x20,
+0x80,0x80,0xa0,0x10,0xb0,0xa0,0x90,0x00,0x00,0x40,0x7f,0x7f,0x41,0x00,0x40,0x7f,0x7f,0x40,
+0x00,0x00,0x40,0x20,0x60,0x40,0x20,0x00,0x00,0x81,0xff,0xff,0x82,0x01,0x81,0xff,0xfe,0x80,
+0x00,0x00,0x80,0x40,0xc0,0x80,0x40,0x00,0x00,0x02,0xfe,0xfe,0x04,0x02,0x02,0xfe,0xfc,0x00,0x01,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x01,
+0x00,0x00,0x00,0x80,0x80,0x00,0x80,0x00,0x00,0x04,0xfc,0xfd,0x08,0x05,0x05,0xfc,0xf8,0x00,0x02,0x03,0x03,0x02,0x00,0x02,0x03,0x03,0x02,
+0x08,0xf8,0xfa,0x11,0x0b,0x0a,0xf9,0xf0,0x00,0x04,0x07,0x07,0x04,0x00,0x04,0x07,0x07,0x04,
 // 'ograve'
-242,10,7,12,0,0,39,8,20,0x10,0x00,0x00,0x18,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x1b,0x00,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x1b,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,12,0,
+0xc0,0xe3,0x32,0x14,0x30,0xe0,0xc0,0x03,0x07,0x0c,0x08,0x0c,0x07,0x03,
+0x80,0xc6,0x64,0x28,0x60,0xc0,0x80,0x07,0x0f,0x18,0x10,0x18,0x0f,0x07,
+0x00,0x8c,0xc8,0x50,0xc0,0x80,0x00,0x0f,0x1f,0x30,0x20,0x30,0x1f,0x0f,
+0x00,0x18,0x90,0xa0,0x80,0x00,0x00,0x1e,0x3f,0x61,0x40,0x61,0x3f,0x1e,
+0x00,0x30,0x20,0x40,0x00,0x00,0x00,0x3c,0x7e,0xc3,0x81,0xc3,0x7e,0x3c,
+0x00,0x60,0x40,0x80,0x00,0x00,0x00,0x78,0xfc,0x86,0x02,0x86,0xfc,0x78,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0xc0,0x80,0x00,0x00,0x00,0x00,0xf0,0xf8,0x0c,0x05,0x0c,0xf8,0xf0,0x00,0x01,0x03,0x02,0x03,0x01,0x00,
+0x00,0x80,0x00,0x00,0x00,0x00,0x00,0xe0,0xf1,0x19,0x0a,0x18,0xf0,0xe0,0x01,0x03,0x06,0x04,0x06,0x03,0x01,
 // 'oacute'
-243,10,7,12,0,0,39,8,20,0x01,0x00,0x00,0x03,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x1b,0x00,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x1b,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,12,0,
+0xc0,0xe0,0x30,0x14,0x32,0xe3,0xc0,0x03,0x07,0x0c,0x08,0x0c,0x07,0x03,
+0x80,0xc0,0x60,0x28,0x64,0xc6,0x80,0x07,0x0f,0x18,0x10,0x18,0x0f,0x07,
+0x00,0x80,0xc0,0x50,0xc8,0x8c,0x00,0x0f,0x1f,0x30,0x20,0x30,0x1f,0x0f,
+0x00,0x00,0x80,0xa0,0x90,0x18,0x00,0x1e,0x3f,0x61,0x40,0x61,0x3f,0x1e,
+0x00,0x00,0x00,0x40,0x20,0x30,0x00,0x3c,0x7e,0xc3,0x81,0xc3,0x7e,0x3c,
+0x00,0x00,0x00,0x80,0x40,0x60,0x00,0x78,0xfc,0x86,0x02,0x86,0xfc,0x78,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x80,0xc0,0x00,0xf0,0xf8,0x0c,0x05,0x0c,0xf8,0xf0,0x00,0x01,0x03,0x02,0x03,0x01,0x00,
+0x00,0x00,0x00,0x00,0x00,0x80,0x00,0xe0,0xf0,0x18,0x0a,0x19,0xf1,0xe0,0x01,0x03,0x06,0x04,0x06,0x03,0x01,
 // 'ocircumflex'
-244,10,7,12,0,0,39,8,20,0x04,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x1b,0x00,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x1b,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,12,0,
+0xc0,0xe4,0x32,0x13,0x32,0xe4,0xc0,0x03,0x07,0x0c,0x08,0x0c,0x07,0x03,
+0x80,0xc8,0x64,0x26,0x64,0xc8,0x80,0x07,0x0f,0x18,0x10,0x18,0x0f,0x07,
+0x00,0x90,0xc8,0x4c,0xc8,0x90,0x00,0x0f,0x1f,0x30,0x20,0x30,0x1f,0x0f,
+0x00,0x20,0x90,0x98,0x90,0x20,0x00,0x1e,0x3f,0x61,0x40,0x61,0x3f,0x1e,
+0x00,0x40,0x20,0x30,0x20,0x40,0x00,0x3c,0x7e,0xc3,0x81,0xc3,0x7e,0x3c,
+0x00,0x80,0x40,0x60,0x40,0x80,0x00,0x78,0xfc,0x86,0x02,0x86,0xfc,0x78,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x00,0x80,0xc0,0x80,0x00,0x00,0xf0,0xf9,0x0c,0x04,0x0c,0xf9,0xf0,0x00,0x01,0x03,0x02,0x03,0x01,0x00,
+0x00,0x00,0x00,0x80,0x00,0x00,0x00,0xe0,0xf2,0x19,0x09,0x19,0xf2,0xe0,0x01,0x03,0x06,0x04,0x06,0x03,0x01,
 // 'otilde'
-245,10,7,11,0,0,36,9,20,0x0d,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x1b,0x00,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x1b,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,9,11,0,
+0xc0,0xe4,0x32,0x16,0x34,0xe2,0xc0,0x03,0x07,0x0c,0x08,0x0c,0x07,0x03,
+0x80,0xc8,0x64,0x2c,0x68,0xc4,0x80,0x07,0x0f,0x18,0x10,0x18,0x0f,0x07,
+0x00,0x90,0xc8,0x58,0xd0,0x88,0x00,0x0f,0x1f,0x30,0x20,0x30,0x1f,0x0f,
+0x00,0x20,0x90,0xb0,0xa0,0x10,0x00,0x1e,0x3f,0x61,0x40,0x61,0x3f,0x1e,
+0x00,0x40,0x20,0x60,0x40,0x20,0x00,0x3c,0x7e,0xc3,0x81,0xc3,0x7e,0x3c,
+0x00,0x80,0x40,0xc0,0x80,0x40,0x00,0x78,0xfc,0x86,0x02,0x86,0xfc,0x78,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x00,0x80,0x80,0x00,0x80,0x00,0xf0,0xf9,0x0c,0x05,0x0d,0xf8,0xf0,0x00,0x01,0x03,0x02,0x03,0x01,0x00,
+0xe0,0xf2,0x19,0x0b,0x1a,0xf1,0xe0,0x01,0x03,0x06,0x04,0x06,0x03,0x01,
 // 'odieresis'
-246,10,7,11,0,0,36,9,20,0x12,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x1b,0x00,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x31,0x80,0x00,0x1b,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,9,11,0,
+0xc0,0xe6,0x30,0x10,0x36,0xe0,0xc0,0x03,0x07,0x0c,0x08,0x0c,0x07,0x03,
+0x80,0xcc,0x60,0x20,0x6c,0xc0,0x80,0x07,0x0f,0x18,0x10,0x18,0x0f,0x07,
+0x00,0x98,0xc0,0x40,0xd8,0x80,0x00,0x0f,0x1f,0x30,0x20,0x30,0x1f,0x0f,
+0x00,0x30,0x80,0x80,0xb0,0x00,0x00,0x1e,0x3f,0x61,0x40,0x61,0x3f,0x1e,
+0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x3c,0x7e,0xc3,0x81,0xc3,0x7e,0x3c,
+0x00,0xc0,0x00,0x00,0xc0,0x00,0x00,0x78,0xfc,0x86,0x02,0x86,0xfc,0x78,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x80,0x00,0x00,0x80,0x00,0x00,0xf0,0xf9,0x0c,0x04,0x0d,0xf8,0xf0,0x00,0x01,0x03,0x02,0x03,0x01,0x00,
+0xe0,0xf3,0x18,0x08,0x1b,0xf0,0xe0,0x01,0x03,0x06,0x04,0x06,0x03,0x01,
 // 'divide'
-247,13,8,7,1,1,24,12,19,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+10,3,8,12,7,2,
+0x82,0x80,0x41,0xb0,0xb0,0x82,0x80,0xc0,0x02,0x41,0x06,0x06,0xc0,
+0x02,0x41,0x60,0x60,0xc0,0x82,0x01,0x41,0x0d,0x0d,0x82,0x01,0xc0,
+0x02,0x41,0xc0,0xc0,0xc0,0x82,0x02,0x41,0x1a,0x1a,0x82,0x02,0xc0,
+0x02,0x41,0x80,0x80,0xc0,0x82,0x04,0x41,0x35,0x35,0x82,0x04,0xc0,
+0x82,0x08,0x41,0x6b,0x6b,0x82,0x08,0xc0,
+0x82,0x10,0x41,0xd6,0xd6,0x82,0x10,0xc0,
+0x82,0x20,0x41,0xac,0xac,0x82,0x20,0xc0,0x02,0x41,0x01,0x01,0xc0,
+0x82,0x40,0x41,0x58,0x58,0x82,0x40,0xc0,0x02,0x41,0x03,0x03,0xc0,
 // 'oslash'
-248,10,7,10,0,-1,33,11,21,0x00,0x80,0x00,0x0f,0x00,0x00,0x19,0x00,0x00,0x33,0x80,0x00,0x35,0x80,0x00,0x35,0x80,0x00,0x39,0x80,0x00,0x13,0x00,0x00,0x1e,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
+8,2,7,11,10,0,
+0xc0,0xe0,0x30,0x90,0x50,0xf0,0xc8,0x13,0x0f,0x0a,0x09,0x0c,0x07,0x03,
+0x80,0xc0,0x60,0x20,0xa0,0xe0,0x90,0x27,0x1f,0x14,0x13,0x18,0x0f,0x07,
+0x00,0x80,0xc0,0x40,0x40,0xc0,0x20,0x4f,0x3f,0x28,0x26,0x31,0x1f,0x0f,
+0x00,0x00,0x80,0x80,0x80,0x80,0x40,0x9e,0x7f,0x51,0x4c,0x62,0x3f,0x1e,
+0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x3c,0xfe,0xa3,0x99,0xc5,0x7f,0x3c,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x78,0xfc,0x46,0x32,0x8a,0xfe,0x79,0x02,0x01,0x01,0x01,0x01,0x00,0x00,
+0xf0,0xf8,0x8c,0x64,0x14,0xfc,0xf2,0x04,0x03,0x02,0x02,0x03,0x01,0x00,
+0xe0,0xf0,0x18,0xc8,0x28,0xf8,0xe4,0x09,0x07,0x05,0x04,0x06,0x03,0x01,
 // 'ugrave'
-249,12,9,12,0,0,39,8,20,0x08,0x00,0x00,0x0c,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x39,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x0f,0x60,0x00,0x00,0x00,0x00,
+10,2,9,8,12,0,
+0x10,0xf0,0xf3,0x02,0x04,0x10,0xf0,0xf0,0x00,0x00,0x07,0x0f,0x08,0x08,0x08,0x07,0x0f,0x08,
+0x20,0xe0,0xe6,0x04,0x08,0x20,0xe0,0xe0,0x00,0x00,0x0f,0x1f,0x10,0x10,0x10,0x0f,0x1f,0x10,
+0x40,0xc0,0xcc,0x08,0x10,0x40,0xc0,0xc0,0x00,0x00,0x1f,0x3f,0x20,0x20,0x20,0x1f,0x3f,0x20,
+0x80,0x80,0x98,0x10,0x20,0x80,0x80,0x80,0x00,0x00,0x3f,0x7f,0x40,0x40,0x40,0x3f,0x7f,0x40,
+0x00,0x00,0x30,0x20,0x40,0x00,0x00,0x00,0x00,0x01,0x7f,0xff,0x80,0x80,0x81,0x7f,0xff,0x80,
+0x00,0x00,0x60,0x40,0x80,0x00,0x00,0x00,0x00,0x02,0xfe,0xfe,0x00,0x00,0x02,0xfe,0xfe,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0x00,0xc0,0x80,0x00,0x00,0x00,0x00,0x00,0x04,0xfc,0xfc,0x00,0x01,0x04,0xfc,0xfc,0x00,0x00,0x01,0x03,0x02,0x02,0x02,0x01,0x03,0x02,
+0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0xf8,0xf9,0x01,0x02,0x08,0xf8,0xf8,0x00,0x00,0x03,0x07,0x04,0x04,0x04,0x03,0x07,0x04,
 // 'uacute'
-250,12,9,12,0,0,39,8,20,0x00,0x80,0x00,0x01,0x80,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x39,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x0f,0x60,0x00,0x00,0x00,0x00,
+10,2,9,8,12,0,
+0x10,0xf0,0xf0,0x00,0x04,0x12,0xf3,0xf0,0x00,0x00,0x07,0x0f,0x08,0x08,0x08,0x07,0x0f,0x08,
+0x20,0xe0,0xe0,0x00,0x08,0x24,0xe6,0xe0,0x00,0x00,0x0f,0x1f,0x10,0x10,0x10,0x0f,0x1f,0x10,
+0x40,0xc0,0xc0,0x00,0x10,0x48,0xcc,0xc0,0x00,0x00,0x1f,0x3f,0x20,0x20,0x20,0x1f,0x3f,0x20,
+0x80,0x80,0x80,0x00,0x20,0x90,0x98,0x80,0x00,0x00,0x3f,0x7f,0x40,0x40,0x40,0x3f,0x7f,0x40,
+0x00,0x00,0x00,0x00,0x40,0x20,0x30,0x00,0x00,0x01,0x7f,0xff,0x80,0x80,0x81,0x7f,0xff,0x80,
+0x00,0x00,0x00,0x00,0x80,0x40,0x60,0x00,0x00,0x02,0xfe,0xfe,0x00,0x00,0x02,0xfe,0xfe,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0x00,0x00,0x00,0x00,0x80,0xc0,0x00,0x00,0x04,0xfc,0xfc,0x00,0x01,0x04,0xfc,0xfc,0x00,0x00,0x01,0x03,0x02,0x02,0x02,0x01,0x03,0x02,
+0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x08,0xf8,0xf8,0x00,0x02,0x09,0xf9,0xf8,0x00,0x00,0x03,0x07,0x04,0x04,0x04,0x03,0x07,0x04,
 // 'ucircumflex'
-251,12,9,12,0,0,39,8,20,0x02,0x00,0x00,0x07,0x00,0x00,0x08,0x80,0x00,0x00,0x00,0x00,0x39,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x0f,0x60,0x00,0x00,0x00,0x00,
+10,2,9,8,12,0,
+0x10,0xf0,0xf4,0x02,0x03,0x12,0xf4,0xf0,0x00,0x00,0x07,0x0f,0x08,0x08,0x08,0x07,0x0f,0x08,
+0x20,0xe0,0xe8,0x04,0x06,0x24,0xe8,0xe0,0x00,0x00,0x0f,0x1f,0x10,0x10,0x10,0x0f,0x1f,0x10,
+0x40,0xc0,0xd0,0x08,0x0c,0x48,0xd0,0xc0,0x00,0x00,0x1f,0x3f,0x20,0x20,0x20,0x1f,0x3f,0x20,
+0x80,0x80,0xa0,0x10,0x18,0x90,0xa0,0x80,0x00,0x00,0x3f,0x7f,0x40,0x40,0x40,0x3f,0x7f,0x40,
+0x00,0x00,0x40,0x20,0x30,0x20,0x40,0x00,0x00,0x01,0x7f,0xff,0x80,0x80,0x81,0x7f,0xff,0x80,
+0x00,0x00,0x80,0x40,0x60,0x40,0x80,0x00,0x00,0x02,0xfe,0xfe,0x00,0x00,0x02,0xfe,0xfe,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0x00,0x00,0x80,0xc0,0x80,0x00,0x00,0x00,0x04,0xfc,0xfd,0x00,0x00,0x04,0xfd,0xfc,0x00,0x00,0x01,0x03,0x02,0x02,0x02,0x01,0x03,0x02,
+0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x08,0xf8,0xfa,0x01,0x01,0x09,0xfa,0xf8,0x00,0x00,0x03,0x07,0x04,0x04,0x04,0x03,0x07,0x04,
 // 'udieresis'
-252,12,9,11,0,0,36,9,20,0x09,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x39,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x0f,0x60,0x00,0x00,0x00,0x00,
+10,2,9,9,11,0,
+0x10,0xf0,0xf6,0x00,0x00,0x16,0xf0,0xf0,0x00,0x00,0x07,0x0f,0x08,0x08,0x08,0x07,0x0f,0x08,
+0x20,0xe0,0xec,0x00,0x00,0x2c,0xe0,0xe0,0x00,0x00,0x0f,0x1f,0x10,0x10,0x10,0x0f,0x1f,0x10,
+0x40,0xc0,0xd8,0x00,0x00,0x58,0xc0,0xc0,0x00,0x00,0x1f,0x3f,0x20,0x20,0x20,0x1f,0x3f,0x20,
+0x80,0x80,0xb0,0x00,0x00,0xb0,0x80,0x80,0x00,0x00,0x3f,0x7f,0x40,0x40,0x40,0x3f,0x7f,0x40,
+0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x00,0x01,0x7f,0xff,0x80,0x80,0x81,0x7f,0xff,0x80,
+0x00,0x00,0xc0,0x00,0x00,0xc0,0x00,0x00,0x00,0x02,0xfe,0xfe,0x00,0x00,0x02,0xfe,0xfe,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x00,0x04,0xfc,0xfd,0x00,0x00,0x05,0xfc,0xfc,0x00,0x00,0x01,0x03,0x02,0x02,0x02,0x01,0x03,0x02,
+0x08,0xf8,0xfb,0x00,0x00,0x0b,0xf8,0xf8,0x00,0x00,0x03,0x07,0x04,0x04,0x04,0x03,0x07,0x04,
 // 'yacute'
-253,11,8,15,0,-3,48,8,23,0x00,0x80,0x00,0x01,0x80,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x3d,0xc0,0x00,0x18,0x80,0x00,0x0d,0x80,0x00,0x0d,0x00,0x00,0x07,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,0x06,0x00,0x00,0x04,0x00,0x00,0x34,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+9,2,8,8,15,2,
+0x47,0x10,0x30,0xf0,0xd0,0x04,0xd2,0x73,0x10,0xc0,0x45,0x60,0x60,0x40,0x3b,0x0f,0x01,0xc0,
+0x47,0x20,0x60,0xe0,0xa0,0x08,0xa4,0xe6,0x20,0xc0,0x45,0xc0,0xc0,0x81,0x77,0x1e,0x03,0xc0,
+0x47,0x40,0xc0,0xc0,0x40,0x10,0x48,0xcc,0x40,0xc0,0x46,0x80,0x80,0x03,0xef,0x3c,0x07,0x01,0xc0,0x82,0x01,0xc0,
+0x83,0x80,0x43,0x20,0x90,0x98,0x80,0xc0,0x00,0x45,0x01,0x07,0xde,0x78,0x0e,0x03,0xc0,0x43,0x03,0x03,0x02,0x01,0xc0,
+0x03,0x42,0x40,0x20,0x30,0xc0,0x47,0x01,0x03,0x0f,0xbd,0xf0,0x1d,0x07,0x01,0xc0,0x43,0x06,0x06,0x04,0x03,0xc0,
+0x03,0x42,0x80,0x40,0x60,0xc0,0x47,0x02,0x06,0x1e,0x7a,0xe0,0x3a,0x0e,0x02,0xc0,0x44,0x0c,0x0c,0x08,0x07,0x01,0xc0,
+0x04,0x41,0x80,0xc0,0xc0,0x47,0x04,0x0c,0x3c,0xf4,0xc1,0x74,0x1c,0x04,0xc0,0x44,0x18,0x18,0x10,0x0e,0x03,0xc0,
+0x05,0x40,0x80,0xc0,0x47,0x08,0x18,0x78,0xe8,0x82,0xe9,0x39,0x08,0xc0,0x44,0x30,0x30,0x20,0x1d,0x07,0xc0,
 // 'thorn'
-254,11,8,14,0,-3,45,9,23,0x38,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1f,0x00,0x00,0x19,0x80,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x18,0xc0,0x00,0x19,0x80,0x00,0x1f,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,
+9,2,8,9,14,0,
+0x02,0xfe,0xfe,0x10,0x10,0x30,0xe0,0xc0,0x40,0x7f,0x7f,0x48,0x08,0x0c,0x07,0x03,
+0x04,0xfc,0xfc,0x20,0x20,0x60,0xc0,0x80,0x80,0xff,0xff,0x90,0x10,0x18,0x0f,0x07,
+0x08,0xf8,0xf8,0x40,0x40,0xc0,0x80,0x00,0x00,0xff,0xff,0x20,0x20,0x30,0x1f,0x0f,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,
+0x10,0xf0,0xf0,0x80,0x80,0x80,0x00,0x00,0x00,0xff,0xff,0x40,0x40,0x61,0x3f,0x1e,0x02,0x03,0x03,0x02,0x00,0x00,0x00,0x00,
+0x20,0xe0,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x81,0x81,0xc3,0x7e,0x3c,0x04,0x07,0x07,0x04,0x00,0x00,0x00,0x00,
+0x40,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x02,0x02,0x86,0xfc,0x78,0x08,0x0f,0x0f,0x09,0x01,0x01,0x00,0x00,
+0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x04,0x04,0x0c,0xf8,0xf0,0x10,0x1f,0x1f,0x12,0x02,0x03,0x01,0x00,
+0x01,0xff,0xff,0x08,0x08,0x18,0xf0,0xe0,0x20,0x3f,0x3f,0x24,0x04,0x06,0x03,0x01,
 // 'ydieresis'
-255,11,8,14,0,-3,45,9,23,0x09,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x3d,0xc0,0x00,0x18,0x80,0x00,0x0d,0x80,0x00,0x0d,0x00,0x00,0x07,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,0x06,0x00,0x00,0x04,0x00,0x00,0x34,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
-// EOF
-0,0,0,0,0,0,0,0,0
+9,2,8,9,14,0,
+0x10,0x30,0xf6,0xd0,0x00,0xd6,0x70,0x10,0x60,0x60,0x40,0x3b,0x0f,0x01,0x00,0x00,
+0x20,0x60,0xec,0xa0,0x00,0xac,0xe0,0x20,0xc0,0xc0,0x81,0x77,0x1e,0x03,0x00,0x00,
+0x40,0xc0,0xd8,0x40,0x00,0x58,0xc0,0x40,0x80,0x80,0x03,0xef,0x3c,0x07,0x01,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,
+0x80,0x80,0xb0,0x80,0x00,0xb0,0x80,0x80,0x00,0x01,0x07,0xde,0x78,0x0e,0x03,0x00,0x03,0x03,0x02,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x01,0x03,0x0f,0xbd,0xf0,0x1d,0x07,0x01,0x06,0x06,0x04,0x03,0x00,0x00,0x00,0x00,
+0x00,0x00,0xc0,0x00,0x00,0xc0,0x00,0x00,0x02,0x06,0x1e,0x7a,0xe0,0x3a,0x0e,0x02,0x0c,0x0c,0x08,0x07,0x01,0x00,0x00,0x00,
+0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x04,0x0c,0x3d,0xf4,0xc0,0x75,0x1c,0x04,0x18,0x18,0x10,0x0e,0x03,0x00,0x00,0x00,
+0x08,0x18,0x7b,0xe8,0x80,0xeb,0x38,0x08,0x30,0x30,0x20,0x1d,0x07,0x00,0x00,0x00,
+};
+
+// glyph index for each encoding
+const unsigned int __ncenR12_index__[] = {
+// direct, first encoding, number of encodings
+0,0,256,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+242,256,300,350,508,668,902,1133,1150,1240,1330,1434,1528,1558,1588,1612,
+1713,1871,1991,2130,2269,2427,2566,2724,2855,3013,3171,3207,3249,3375,3414,3540,
+3679,3941,4130,4345,4541,4775,4971,5159,5374,5627,5747,5914,6148,6321,6610,6855,
+7070,7265,7513,7747,7905,8100,8322,8506,8772,8987,9193,9370,9439,9547,9616,9734,
+9764,9800,9911,10069,10165,10323,10434,10554,10722,10897,10979,11073,11250,11332,11548,11689,
+11800,11950,12100,12211,12307,12421,12562,12697,12889,13015,13165,13261,13330,13355,13424,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+242,13502,13546,13666,13843,13954,14129,14154,14292,14343,14577,14653,14731,1558,14791,15025,
+15055,15121,15222,15298,15374,15410,15591,15773,15797,15836,15884,15946,16024,16239,16454,16707,
+16846,17068,17290,17518,17751,17969,18192,18484,18709,18945,19181,19417,19643,19787,19931,20075,
+20213,20447,20727,20975,21224,21474,21722,21967,22093,22330,22581,22832,23085,23333,23568,23767,
+23925,24064,24203,24342,24474,24606,24752,24938,25052,25191,25330,25469,25601,25683,25765,25866,
+25944,26090,26258,26397,26536,26675,26807,26939,27039,27164,27341,27518,27695,27863,28038,28212,
 };
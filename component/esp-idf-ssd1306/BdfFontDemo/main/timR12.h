@@ -1,395 +1,1933 @@
 // Created from bdf2c Version 4, (c) 2009, 2010 by Lutz Sammer
 //	License AGPLv3: GNU Affero General Public License version 3
-// character bitmap for each encoding
-unsigned char __timR12_bitmap__[] = {
+// page-major glyphs for each encoding
+const unsigned char __timR12_pages__[] = {
 // fontboundingbox_width
 19,
 // fontboundingbox_height
 26,
 // 'char0'
-  0,14,9,11,0,0,36,8,19,0x2a,0xa0,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x20,0x20,0x00,0x00,0x00,0x00,0x2a,0xa0,0x00,0x00,0x00,0x00,
+12,2,9,8,11,0,
+0x55,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x55,0x05,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x05,
+0xaa,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0xaa,0x0a,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0x0a,
+0x54,0x00,0x04,0x00,0x04,0x00,0x04,0x00,0x54,0x15,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x15,
+0xa8,0x00,0x08,0x00,0x08,0x00,0x08,0x00,0xa8,0x2a,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0x2a,
+0x50,0x00,0x10,0x00,0x10,0x00,0x10,0x00,0x50,0x55,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x55,
+0xa0,0x00,0x20,0x00,0x20,0x00,0x20,0x00,0xa0,0xaa,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0xaa,
+0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x00,0x40,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0x01,0x00,0x01,0x00,0x01,0x00,0x01,0x00,0x01,
+0x80,0x00,0x80,0x00,0x80,0x00,0x80,0x00,0x80,0xaa,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0x02,0x00,0x02,0x00,0x02,0x00,0x02,0x00,0x02,
 // 'space'
- 32,6,1,1,0,0,6,18,19,0x00,0x00,0x00,0x00,0x00,0x00,
+4,2,1,18,1,0,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
+0x00,
 // 'exclam'
- 33,9,1,11,2,0,36,8,19,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,
+5,4,1,8,11,0,
+0x7f,0x06,
+0xfe,0x0c,
+0xfc,0x19,
+0xf8,0x33,
+0xf0,0x67,
+0xe0,0xcf,
+0xc0,0x9f,0x01,
+0x80,0x3f,0x03,
 // 'quotedbl'
- 34,10,4,3,1,8,12,8,11,0x12,0x00,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,
+7,3,4,8,3,0,
+0x07,0x00,0x00,0x07,
+0x0e,0x00,0x00,0x0e,
+0x1c,0x00,0x00,0x1c,
+0x38,0x00,0x00,0x38,
+0x70,0x00,0x00,0x70,
+0xe0,0x00,0x00,0xe0,
+0xc0,0x00,0x00,0xc0,0x01,0x00,0x00,0x01,
+0x80,0x00,0x00,0x80,0x03,0x00,0x00,0x03,
 // 'numbersign'
- 35,10,8,11,0,0,36,8,19,0x04,0x80,0x00,0x04,0x80,0x00,0x04,0x80,0x00,0x1f,0xc0,0x00,0x09,0x00,0x00,0x09,0x00,0x00,0x3f,0x80,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,
+8,2,8,8,11,0,
+0x40,0xc8,0x78,0x4f,0xc8,0x78,0x4f,0x08,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x00,
+0x80,0x90,0xf0,0x9e,0x90,0xf0,0x9e,0x10,0x00,0x0f,0x00,0x00,0x0f,0x00,0x00,0x00,
+0x00,0x20,0xe0,0x3c,0x20,0xe0,0x3c,0x20,0x01,0x1f,0x01,0x01,0x1f,0x01,0x01,0x00,
+0x00,0x40,0xc0,0x78,0x40,0xc0,0x78,0x40,0x02,0x3e,0x03,0x02,0x3e,0x03,0x02,0x00,
+0x00,0x80,0x80,0xf0,0x80,0x80,0xf0,0x80,0x04,0x7c,0x07,0x04,0x7c,0x07,0x04,0x00,
+0x00,0x00,0x00,0xe0,0x00,0x00,0xe0,0x00,0x08,0xf9,0x0f,0x09,0xf9,0x0f,0x09,0x01,
+0x00,0x00,0x00,0xc0,0x00,0x00,0xc0,0x00,0x10,0xf2,0x1e,0x13,0xf2,0x1e,0x13,0x02,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x20,0xe4,0x3c,0x27,0xe4,0x3c,0x27,0x04,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x00,
 // 'dollar'
- 36,10,7,13,0,-1,42,7,20,0x04,0x00,0x00,0x1f,0x00,0x00,0x24,0x80,0x00,0x24,0x80,0x00,0x24,0x00,0x00,0x14,0x00,0x00,0x0e,0x00,0x00,0x05,0x00,0x00,0x04,0x80,0x00,0x24,0x80,0x00,0x24,0x80,0x00,0x1f,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+8,2,7,7,13,0,
+0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x0e,0x11,0x21,0xff,0x21,0x41,0x86,0x03,0x04,0x04,0x0f,0x04,0x04,0x03,
+0x1c,0x22,0x42,0xff,0x42,0x82,0x0c,0x06,0x08,0x08,0x1f,0x08,0x08,0x07,
+0x38,0x44,0x84,0xfe,0x84,0x04,0x18,0x0c,0x10,0x10,0x3f,0x10,0x11,0x0e,
+0x70,0x88,0x08,0xfc,0x08,0x08,0x30,0x18,0x20,0x21,0x7f,0x21,0x22,0x1c,
+0xe0,0x10,0x10,0xf8,0x10,0x10,0x60,0x30,0x41,0x42,0xff,0x42,0x44,0x38,
+0xc0,0x20,0x20,0xf0,0x20,0x20,0xc0,0x61,0x82,0x84,0xff,0x84,0x88,0x70,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+0x80,0x40,0x40,0xe0,0x40,0x40,0x80,0xc3,0x04,0x08,0xff,0x08,0x10,0xe1,0x00,0x01,0x01,0x03,0x01,0x01,0x00,
+0x00,0x80,0x80,0xc0,0x80,0x80,0x00,0x87,0x08,0x10,0xff,0x10,0x20,0xc3,0x01,0x02,0x02,0x07,0x02,0x02,0x01,
 // 'percent'
- 37,17,11,11,1,0,36,8,19,0x07,0x20,0x00,0x09,0xe0,0x00,0x11,0x60,0x00,0x11,0x40,0x00,0x12,0xc0,0x00,0x0c,0x9c,0x00,0x01,0xa4,0x00,0x01,0x44,0x00,0x03,0x44,0x00,0x02,0x48,0x00,0x02,0x30,0x00,0x00,0x00,0x00,
+14,3,11,8,11,0,
+0x1c,0x22,0x21,0x11,0xcf,0x72,0x9e,0x47,0x20,0x20,0xe0,0x00,0x00,0x00,0x07,0x01,0x00,0x03,0x04,0x04,0x02,0x01,
+0x38,0x44,0x42,0x22,0x9e,0xe4,0x3c,0x8e,0x40,0x40,0xc0,0x00,0x00,0x00,0x0e,0x03,0x00,0x07,0x08,0x08,0x04,0x03,
+0x70,0x88,0x84,0x44,0x3c,0xc8,0x78,0x1c,0x80,0x80,0x80,0x00,0x00,0x00,0x1c,0x07,0x01,0x0e,0x11,0x10,0x08,0x07,
+0xe0,0x10,0x08,0x88,0x78,0x90,0xf0,0x38,0x00,0x00,0x00,0x00,0x01,0x01,0x38,0x0e,0x03,0x1c,0x22,0x21,0x11,0x0f,
+0xc0,0x20,0x10,0x10,0xf0,0x20,0xe0,0x70,0x00,0x00,0x00,0x01,0x02,0x02,0x71,0x1c,0x07,0x39,0x44,0x42,0x22,0x1e,
+0x80,0x40,0x20,0x20,0xe0,0x40,0xc0,0xe0,0x00,0x00,0x00,0x03,0x04,0x04,0xe2,0x39,0x0e,0x73,0x88,0x84,0x44,0x3c,
+0x00,0x80,0x40,0x40,0xc0,0x80,0x80,0xc0,0x00,0x00,0x00,0x07,0x08,0x08,0xc4,0x73,0x1c,0xe7,0x11,0x08,0x88,0x78,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x00,0x00,
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x80,0x00,0x00,0x00,0x0e,0x11,0x10,0x88,0xe7,0x39,0xcf,0x23,0x10,0x10,0xf0,0x00,0x00,0x00,0x03,0x00,0x00,0x01,0x02,0x02,0x01,0x00,
 // 'ampersand'
- 38,15,12,11,0,0,36,8,19,0x03,0x00,0x00,0x04,0x80,0x00,0x04,0x80,0x00,0x04,0x80,0x00,0x03,0x38,0x00,0x0e,0x10,0x00,0x11,0x20,0x00,0x20,0xc0,0x00,0x20,0x84,0x00,0x11,0x48,0x00,0x0e,0x30,0x00,0x00,0x00,0x00,
+13,2,12,8,11,2,
+0x4a,0x80,0x40,0x20,0x2e,0x31,0x51,0x8e,0x80,0x50,0x30,0x10,0xc0,0x41,0x01,0x02,0x82,0x04,0x46,0x02,0x01,0x02,0x04,0x04,0x02,0x01,0xc0,
+0x00,0x49,0x80,0x40,0x5c,0x62,0xa2,0x1c,0x00,0xa0,0x60,0x20,0xc0,0x41,0x03,0x04,0x82,0x08,0x46,0x04,0x03,0x05,0x08,0x08,0x04,0x02,0xc0,
+0x01,0x48,0x80,0xb8,0xc4,0x44,0x38,0x00,0x40,0xc0,0x40,0xc0,0x41,0x06,0x09,0x82,0x10,0x46,0x09,0x06,0x0a,0x11,0x10,0x08,0x04,0xc0,
+0x02,0x44,0x70,0x88,0x88,0x70,0x00,0x82,0x80,0xc0,0x41,0x0c,0x12,0x82,0x21,0x46,0x12,0x0c,0x14,0x22,0x21,0x10,0x08,0xc0,
+0x02,0x43,0xe0,0x10,0x10,0xe0,0xc0,0x4b,0x18,0x24,0x42,0x42,0x43,0x25,0x18,0x28,0x45,0x43,0x21,0x10,0xc0,
+0x02,0x43,0xc0,0x20,0x20,0xc0,0xc0,0x4b,0x30,0x48,0x84,0x85,0x86,0x4a,0x31,0x50,0x8a,0x86,0x42,0x20,0xc0,
+0x02,0x43,0x80,0x40,0x40,0x80,0xc0,0x4b,0x60,0x90,0x08,0x0b,0x0c,0x94,0x63,0xa0,0x14,0x0c,0x84,0x40,0xc0,0x01,0x82,0x01,0x02,0x41,0x01,0x01,0xc0,
+0x03,0x41,0x80,0x80,0xc0,0x4b,0xc0,0x20,0x10,0x17,0x18,0x28,0xc7,0x40,0x28,0x18,0x08,0x80,0xc0,0x00,0x40,0x01,0x82,0x02,0x45,0x01,0x00,0x01,0x02,0x02,0x01,0xc0,
 // 'quotesingle'
- 39,6,1,3,1,8,12,8,11,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+3,3,1,8,3,0,
+0x07,
+0x0e,
+0x1c,
+0x38,
+0x70,
+0xe0,
+0xc0,0x01,
+0x80,0x03,
 // 'parenleft'
- 40,7,4,14,0,-3,45,8,22,0x04,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+5,2,4,8,14,0,
+0xf0,0x0c,0x02,0x01,0x03,0x0c,0x10,0x20,
+0xe0,0x18,0x04,0x02,0x07,0x18,0x20,0x40,
+0xc0,0x30,0x08,0x04,0x0f,0x30,0x40,0x80,
+0x80,0x60,0x10,0x08,0x1f,0x60,0x80,0x00,0x00,0x00,0x00,0x01,
+0x00,0xc0,0x20,0x10,0x3f,0xc0,0x00,0x00,0x00,0x00,0x01,0x02,
+0x00,0x80,0x40,0x20,0x7e,0x81,0x00,0x00,0x00,0x01,0x02,0x04,
+0x00,0x00,0x80,0x40,0xfc,0x03,0x00,0x00,0x00,0x03,0x04,0x08,
+0x00,0x00,0x00,0x80,0xf8,0x06,0x01,0x00,0x01,0x06,0x08,0x10,
 // 'parenright'
- 41,6,4,14,-1,-3,45,8,22,0x40,0x00,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,
+5,1,4,8,14,0,
+0x01,0x02,0x0c,0xf0,0x20,0x10,0x0c,0x03,
+0x02,0x04,0x18,0xe0,0x40,0x20,0x18,0x07,
+0x04,0x08,0x30,0xc0,0x80,0x40,0x30,0x0f,
+0x08,0x10,0x60,0x80,0x00,0x80,0x60,0x1f,0x01,0x00,0x00,0x00,
+0x10,0x20,0xc0,0x00,0x00,0x00,0xc0,0x3f,0x02,0x01,0x00,0x00,
+0x20,0x40,0x80,0x00,0x00,0x00,0x81,0x7e,0x04,0x02,0x01,0x00,
+0x40,0x80,0x00,0x00,0x00,0x00,0x03,0xfc,0x08,0x04,0x03,0x00,
+0x80,0x00,0x00,0x00,0x00,0x01,0x06,0xf8,0x10,0x08,0x06,0x01,
 // 'asterisk'
- 42,11,5,6,1,5,21,8,14,0x04,0x00,0x00,0x15,0x00,0x00,0x0e,0x00,0x00,0x0e,0x00,0x00,0x15,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+8,3,5,8,6,0,
+0x12,0x0c,0x3f,0x0c,0x12,
+0x24,0x18,0x7e,0x18,0x24,
+0x48,0x30,0xfc,0x30,0x48,
+0x90,0x60,0xf8,0x60,0x90,0x00,0x00,0x01,0x00,0x00,
+0x20,0xc0,0xf0,0xc0,0x20,0x01,0x00,0x03,0x00,0x01,
+0x40,0x80,0xe0,0x80,0x40,0x02,0x01,0x07,0x01,0x02,
+0x80,0x00,0xc0,0x00,0x80,0x04,0x03,0x0f,0x03,0x04,
+0x00,0x00,0x80,0x00,0x00,0x09,0x06,0x1f,0x06,0x09,
 // 'plus'
- 43,12,7,7,1,1,24,11,18,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x1f,0xc0,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+9,3,7,11,7,2,
+0x82,0x40,0x40,0xf8,0x82,0x40,0xc0,0x02,0x40,0x03,0xc0,
+0x82,0x80,0x40,0xf0,0x82,0x80,0xc0,0x02,0x40,0x07,0xc0,
+0x02,0x40,0xe0,0xc0,0x82,0x01,0x40,0x0f,0x82,0x01,0xc0,
+0x02,0x40,0xc0,0xc0,0x82,0x02,0x40,0x1f,0x82,0x02,0xc0,
+0x02,0x40,0x80,0xc0,0x82,0x04,0x40,0x3f,0x82,0x04,0xc0,
+0x82,0x08,0x40,0x7f,0x82,0x08,0xc0,
+0x82,0x10,0x40,0xfe,0x82,0x10,0xc0,
+0x82,0x20,0x40,0xfc,0x82,0x20,0xc0,0x02,0x40,0x01,0xc0,
 // 'comma'
- 44,7,2,3,1,-1,12,17,20,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+4,3,2,17,3,0,
+0x08,0x06,
+0x10,0x0c,
+0x20,0x18,
+0x40,0x30,
+0x80,0x60,
+0x00,0xc0,0x01,0x00,
+0x00,0x80,0x02,0x01,
+0x04,0x03,
 // 'hyphen'
- 45,7,4,1,0,4,6,14,15,0x3c,0x00,0x00,0x00,0x00,0x00,
+5,2,4,14,1,2,
+0x83,0x40,0xc0,
+0x83,0x80,0xc0,
+0x83,0x01,0xc0,
+0x83,0x02,0xc0,
+0x83,0x04,0xc0,
+0x83,0x08,0xc0,
+0x83,0x10,0xc0,
+0x83,0x20,0xc0,
 // 'period'
- 46,7,1,2,1,0,9,17,19,0x10,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+4,3,1,17,2,0,
+0x06,
+0x0c,
+0x18,
+0x30,
+0x60,
+0xc0,
+0x80,0x01,
+0x03,
 // 'slash'
- 47,7,5,13,0,-2,42,8,21,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
+5,2,5,8,13,2,
+0x01,0x42,0xe0,0x18,0x07,0xc0,0x41,0x18,0x07,0xc0,
+0x01,0x42,0xc0,0x30,0x0e,0xc0,0x42,0x30,0x0e,0x01,0xc0,
+0x01,0x42,0x80,0x60,0x1c,0xc0,0x42,0x60,0x1c,0x03,0xc0,
+0x02,0x41,0xc0,0x38,0xc0,0x42,0xc0,0x38,0x07,0xc0,
+0x02,0x41,0x80,0x70,0xc0,0x43,0x80,0x70,0x0e,0x01,0xc0,0x40,0x01,0xc0,
+0x03,0x40,0xe0,0xc0,0x00,0x42,0xe0,0x1c,0x03,0xc0,0x40,0x03,0xc0,
+0x03,0x40,0xc0,0xc0,0x00,0x43,0xc0,0x38,0x06,0x01,0xc0,0x41,0x06,0x01,0xc0,
+0x03,0x40,0x80,0xc0,0x00,0x43,0x80,0x70,0x0c,0x03,0xc0,0x41,0x0c,0x03,0xc0,
 // 'zero'
- 48,10,7,11,0,0,36,8,19,0x0e,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,11,0,
+0xf8,0x06,0x01,0x01,0x01,0x06,0xf8,0x00,0x03,0x04,0x04,0x04,0x03,0x00,
+0xf0,0x0c,0x02,0x02,0x02,0x0c,0xf0,0x01,0x06,0x08,0x08,0x08,0x06,0x01,
+0xe0,0x18,0x04,0x04,0x04,0x18,0xe0,0x03,0x0c,0x10,0x10,0x10,0x0c,0x03,
+0xc0,0x30,0x08,0x08,0x08,0x30,0xc0,0x07,0x18,0x20,0x20,0x20,0x18,0x07,
+0x80,0x60,0x10,0x10,0x10,0x60,0x80,0x0f,0x30,0x40,0x40,0x40,0x30,0x0f,
+0x00,0xc0,0x20,0x20,0x20,0xc0,0x00,0x1f,0x60,0x80,0x80,0x80,0x60,0x1f,
+0x00,0x80,0x40,0x40,0x40,0x80,0x00,0x3e,0xc1,0x00,0x00,0x00,0xc1,0x3e,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x7c,0x83,0x00,0x00,0x00,0x83,0x7c,0x00,0x01,0x02,0x02,0x02,0x01,0x00,
 // 'one'
- 49,11,4,11,1,0,36,8,19,0x04,0x00,0x00,0x0c,0x00,0x00,0x14,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,3,4,8,11,0,
+0x04,0x02,0xff,0x00,0x00,0x04,0x07,0x04,
+0x08,0x04,0xfe,0x00,0x00,0x08,0x0f,0x08,
+0x10,0x08,0xfc,0x00,0x00,0x10,0x1f,0x10,
+0x20,0x10,0xf8,0x00,0x00,0x20,0x3f,0x20,
+0x40,0x20,0xf0,0x00,0x00,0x40,0x7f,0x40,
+0x80,0x40,0xe0,0x00,0x00,0x80,0xff,0x80,
+0x00,0x80,0xc0,0x00,0x01,0x00,0xff,0x00,0x00,0x01,0x01,0x01,
+0x00,0x00,0x80,0x00,0x02,0x01,0xff,0x00,0x00,0x02,0x03,0x02,
 // 'two'
- 50,10,7,11,0,0,36,8,19,0x0e,0x00,0x00,0x11,0x00,0x00,0x20,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x10,0x80,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,11,0,
+0x04,0x02,0x01,0x81,0x41,0x22,0x1c,0x04,0x06,0x05,0x04,0x04,0x04,0x02,
+0x08,0x04,0x02,0x02,0x82,0x44,0x38,0x08,0x0c,0x0a,0x09,0x08,0x08,0x04,
+0x10,0x08,0x04,0x04,0x04,0x88,0x70,0x10,0x18,0x14,0x12,0x11,0x10,0x08,
+0x20,0x10,0x08,0x08,0x08,0x10,0xe0,0x20,0x30,0x28,0x24,0x22,0x21,0x10,
+0x40,0x20,0x10,0x10,0x10,0x20,0xc0,0x40,0x60,0x50,0x48,0x44,0x42,0x21,
+0x80,0x40,0x20,0x20,0x20,0x40,0x80,0x80,0xc0,0xa0,0x90,0x88,0x84,0x43,
+0x00,0x80,0x40,0x40,0x40,0x80,0x00,0x01,0x80,0x40,0x20,0x10,0x08,0x87,0x01,0x01,0x01,0x01,0x01,0x01,0x00,
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x02,0x01,0x80,0x40,0x20,0x11,0x0e,0x02,0x03,0x02,0x02,0x02,0x02,0x01,
 // 'three'
- 51,10,7,11,0,0,36,8,19,0x0e,0x00,0x00,0x11,0x00,0x00,0x21,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x0e,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x31,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,11,0,
+0x04,0x02,0x21,0x31,0x29,0x46,0x80,0x02,0x06,0x04,0x04,0x04,0x02,0x01,
+0x08,0x04,0x42,0x62,0x52,0x8c,0x00,0x04,0x0c,0x08,0x08,0x08,0x04,0x03,
+0x10,0x08,0x84,0xc4,0xa4,0x18,0x00,0x08,0x18,0x10,0x10,0x10,0x09,0x06,
+0x20,0x10,0x08,0x88,0x48,0x30,0x00,0x10,0x30,0x21,0x21,0x21,0x12,0x0c,
+0x40,0x20,0x10,0x10,0x90,0x60,0x00,0x20,0x60,0x42,0x43,0x42,0x24,0x18,
+0x80,0x40,0x20,0x20,0x20,0xc0,0x00,0x40,0xc0,0x84,0x86,0x85,0x48,0x30,
+0x00,0x80,0x40,0x40,0x40,0x80,0x00,0x81,0x80,0x08,0x0c,0x0a,0x91,0x60,0x00,0x01,0x01,0x01,0x01,0x00,0x00,
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x02,0x01,0x10,0x18,0x14,0x23,0xc0,0x01,0x03,0x02,0x02,0x02,0x01,0x00,
 // 'four'
- 52,9,8,11,-1,0,36,8,19,0x01,0x00,0x00,0x03,0x00,0x00,0x05,0x00,0x00,0x05,0x00,0x00,0x09,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x21,0x00,0x00,0x7f,0x80,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+8,1,8,8,11,2,
+0x00,0x45,0x80,0x60,0x10,0x0c,0x02,0xff,0xc0,0x85,0x01,0x41,0x07,0x01,0xc0,
+0x01,0x44,0xc0,0x20,0x18,0x04,0xfe,0xc0,0x41,0x02,0x03,0x83,0x02,0x41,0x0f,0x02,0xc0,
+0x01,0x44,0x80,0x40,0x30,0x08,0xfc,0xc0,0x42,0x04,0x06,0x05,0x82,0x04,0x41,0x1f,0x04,0xc0,
+0x02,0x43,0x80,0x60,0x10,0xf8,0xc0,0x42,0x08,0x0c,0x0b,0x82,0x08,0x41,0x3f,0x08,0xc0,
+0x03,0x42,0xc0,0x20,0xf0,0xc0,0x47,0x10,0x18,0x16,0x11,0x10,0x10,0x7f,0x10,0xc0,
+0x03,0x42,0x80,0x40,0xe0,0xc0,0x47,0x20,0x30,0x2c,0x22,0x21,0x20,0xff,0x20,0xc0,
+0x04,0x41,0x80,0xc0,0xc0,0x47,0x40,0x60,0x58,0x44,0x43,0x40,0xff,0x40,0xc0,0x05,0x40,0x01,0xc0,
+0x05,0x40,0x80,0xc0,0x47,0x80,0xc0,0xb0,0x88,0x86,0x81,0xff,0x80,0xc0,0x05,0x40,0x03,0xc0,
 // 'five'
- 53,10,7,11,0,0,36,8,19,0x0f,0x80,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x1e,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x23,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,11,0,
+0x00,0x18,0x17,0x11,0x11,0x21,0xc1,0x02,0x04,0x04,0x04,0x02,0x02,0x01,
+0x00,0x30,0x2e,0x22,0x22,0x42,0x82,0x04,0x08,0x08,0x08,0x04,0x04,0x03,
+0x00,0x60,0x5c,0x44,0x44,0x84,0x04,0x08,0x10,0x10,0x10,0x08,0x08,0x07,
+0x00,0xc0,0xb8,0x88,0x88,0x08,0x08,0x10,0x20,0x20,0x20,0x10,0x11,0x0e,
+0x00,0x80,0x70,0x10,0x10,0x10,0x10,0x20,0x41,0x41,0x41,0x21,0x22,0x1c,
+0x00,0x00,0xe0,0x20,0x20,0x20,0x20,0x40,0x83,0x82,0x82,0x42,0x44,0x38,
+0x00,0x00,0xc0,0x40,0x40,0x40,0x40,0x80,0x06,0x05,0x04,0x84,0x88,0x70,0x00,0x01,0x01,0x01,0x00,0x00,0x00,
+0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x00,0x0c,0x0b,0x08,0x08,0x10,0xe0,0x01,0x02,0x02,0x02,0x01,0x01,0x00,
 // 'six'
- 54,10,7,11,0,0,36,8,19,0x03,0x80,0x00,0x0c,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x26,0x00,0x00,0x39,0x00,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,11,0,
+0xf0,0x2c,0x22,0x12,0x11,0x21,0xc1,0x01,0x02,0x04,0x04,0x04,0x02,0x01,
+0xe0,0x58,0x44,0x24,0x22,0x42,0x82,0x03,0x04,0x08,0x08,0x08,0x04,0x03,
+0xc0,0xb0,0x88,0x48,0x44,0x84,0x04,0x07,0x08,0x10,0x10,0x10,0x08,0x07,
+0x80,0x60,0x10,0x90,0x88,0x08,0x08,0x0f,0x11,0x21,0x20,0x20,0x11,0x0e,
+0x00,0xc0,0x20,0x20,0x10,0x10,0x10,0x1f,0x22,0x42,0x41,0x41,0x22,0x1c,
+0x00,0x80,0x40,0x40,0x20,0x20,0x20,0x3e,0x45,0x84,0x82,0x82,0x44,0x38,
+0x00,0x00,0x80,0x80,0x40,0x40,0x40,0x7c,0x8b,0x08,0x04,0x04,0x88,0x70,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x80,0x80,0x80,0xf8,0x16,0x11,0x09,0x08,0x10,0xe0,0x00,0x01,0x02,0x02,0x02,0x01,0x00,
 // 'seven'
- 55,10,7,11,0,0,36,8,19,0x3f,0x80,0x00,0x20,0x80,0x00,0x21,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,11,2,
+0x46,0x07,0x01,0x01,0xc1,0x31,0x0d,0x03,0xc0,0x01,0x41,0x06,0x01,0xc0,
+0x46,0x0e,0x02,0x02,0x82,0x62,0x1a,0x06,0xc0,0x01,0x41,0x0c,0x03,0xc0,
+0x40,0x1c,0x82,0x04,0x42,0xc4,0x34,0x0c,0xc0,0x01,0x41,0x18,0x07,0xc0,
+0x40,0x38,0x82,0x08,0x42,0x88,0x68,0x18,0xc0,0x01,0x42,0x30,0x0e,0x01,0xc0,
+0x40,0x70,0x83,0x10,0x41,0xd0,0x30,0xc0,0x01,0x42,0x60,0x1c,0x03,0xc0,
+0x40,0xe0,0x83,0x20,0x41,0xa0,0x60,0xc0,0x01,0x43,0xc0,0x38,0x06,0x01,0xc0,
+0x40,0xc0,0x84,0x40,0x40,0xc0,0xc0,0x45,0x01,0x00,0x80,0x70,0x0c,0x03,0xc0,0x01,0x40,0x01,0xc0,
+0x86,0x80,0xc0,0x40,0x03,0x01,0x43,0xe0,0x18,0x06,0x01,0xc0,0x01,0x40,0x03,0xc0,
 // 'eight'
- 56,10,6,11,0,0,36,8,19,0x0c,0x00,0x00,0x12,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x12,0x00,0x00,0x0c,0x00,0x00,0x12,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x12,0x00,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,
+8,2,6,8,11,0,
+0x8c,0x52,0x21,0x21,0x52,0x8c,0x01,0x02,0x04,0x04,0x02,0x01,
+0x18,0xa4,0x42,0x42,0xa4,0x18,0x03,0x04,0x08,0x08,0x04,0x03,
+0x30,0x48,0x84,0x84,0x48,0x30,0x06,0x09,0x10,0x10,0x09,0x06,
+0x60,0x90,0x08,0x08,0x90,0x60,0x0c,0x12,0x21,0x21,0x12,0x0c,
+0xc0,0x20,0x10,0x10,0x20,0xc0,0x18,0x25,0x42,0x42,0x25,0x18,
+0x80,0x40,0x20,0x20,0x40,0x80,0x31,0x4a,0x84,0x84,0x4a,0x31,
+0x00,0x80,0x40,0x40,0x80,0x00,0x63,0x94,0x08,0x08,0x94,0x63,0x00,0x00,0x01,0x01,0x00,0x00,
+0x00,0x00,0x80,0x80,0x00,0x00,0xc6,0x29,0x10,0x10,0x29,0xc6,0x00,0x01,0x02,0x02,0x01,0x00,
 // 'nine'
- 57,10,7,11,0,0,36,8,19,0x0e,0x00,0x00,0x11,0x00,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x11,0x80,0x00,0x0e,0x80,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x06,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,11,0,
+0x1c,0x22,0x41,0x41,0x41,0xa2,0x7c,0x04,0x04,0x04,0x02,0x02,0x01,0x00,
+0x38,0x44,0x82,0x82,0x82,0x44,0xf8,0x08,0x08,0x08,0x04,0x04,0x03,0x00,
+0x70,0x88,0x04,0x04,0x04,0x88,0xf0,0x10,0x10,0x11,0x09,0x09,0x06,0x01,
+0xe0,0x10,0x08,0x08,0x08,0x10,0xe0,0x20,0x21,0x22,0x12,0x12,0x0d,0x03,
+0xc0,0x20,0x10,0x10,0x10,0x20,0xc0,0x41,0x42,0x44,0x24,0x24,0x1a,0x07,
+0x80,0x40,0x20,0x20,0x20,0x40,0x80,0x83,0x84,0x88,0x48,0x48,0x34,0x0f,
+0x00,0x80,0x40,0x40,0x40,0x80,0x00,0x07,0x08,0x10,0x90,0x90,0x68,0x1f,0x01,0x01,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x0e,0x11,0x20,0x20,0x20,0xd1,0x3e,0x02,0x02,0x02,0x01,0x01,0x00,0x00,
 // 'colon'
- 58,7,1,8,1,0,27,11,19,0x10,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+4,3,1,11,8,0,
+0x18,0x06,
+0x30,0x0c,
+0x60,0x18,
+0xc0,0x30,
+0x80,0x61,
+0xc3,
+0x86,0x01,
+0x0c,0x03,
 // 'semicolon'
- 59,6,2,9,0,-1,30,11,20,0x10,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
+4,2,2,11,9,0,
+0x00,0x18,0x08,0x06,
+0x00,0x30,0x10,0x0c,
+0x00,0x60,0x20,0x18,
+0x00,0xc0,0x40,0x30,
+0x00,0x80,0x80,0x61,
+0x00,0xc3,0x01,0x00,
+0x00,0x86,0x02,0x01,
+0x00,0x0c,0x04,0x03,
 // 'less'
- 60,11,8,9,0,0,30,10,19,0x00,0xc0,0x00,0x03,0x00,0x00,0x04,0x00,0x00,0x18,0x00,0x00,0x20,0x00,0x00,0x18,0x00,0x00,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,
+9,2,8,10,9,0,
+0x40,0xa0,0xa0,0x10,0x08,0x08,0x04,0x04,0x00,0x00,0x00,0x01,0x02,0x02,0x04,0x04,
+0x80,0x40,0x40,0x20,0x10,0x10,0x08,0x08,0x00,0x01,0x01,0x02,0x04,0x04,0x08,0x08,
+0x00,0x80,0x80,0x40,0x20,0x20,0x10,0x10,0x01,0x02,0x02,0x04,0x08,0x08,0x10,0x10,
+0x00,0x00,0x00,0x80,0x40,0x40,0x20,0x20,0x02,0x05,0x05,0x08,0x10,0x10,0x20,0x20,
+0x00,0x00,0x00,0x00,0x80,0x80,0x40,0x40,0x04,0x0a,0x0a,0x11,0x20,0x20,0x40,0x40,
+0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x08,0x14,0x14,0x22,0x41,0x41,0x80,0x80,
+0x10,0x28,0x28,0x44,0x82,0x82,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,
+0x20,0x50,0x50,0x88,0x04,0x04,0x02,0x02,0x00,0x00,0x00,0x00,0x01,0x01,0x02,0x02,
 // 'equal'
- 61,11,7,4,0,2,15,13,17,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,
+9,2,7,13,4,2,
+0x86,0x20,0xc0,0x86,0x01,0xc0,
+0x86,0x40,0xc0,0x86,0x02,0xc0,
+0x86,0x80,0xc0,0x86,0x04,0xc0,
+0x86,0x09,0xc0,
+0x86,0x12,0xc0,
+0x86,0x24,0xc0,
+0x86,0x48,0xc0,
+0x86,0x90,0xc0,
 // 'greater'
- 62,12,8,9,1,0,30,10,19,0x18,0x00,0x00,0x06,0x00,0x00,0x01,0x00,0x00,0x00,0xc0,0x00,0x00,0x20,0x00,0x00,0xc0,0x00,0x01,0x00,0x00,0x06,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
+9,3,8,10,9,0,
+0x04,0x04,0x08,0x08,0x10,0xa0,0xa0,0x40,0x04,0x04,0x02,0x02,0x01,0x00,0x00,0x00,
+0x08,0x08,0x10,0x10,0x20,0x40,0x40,0x80,0x08,0x08,0x04,0x04,0x02,0x01,0x01,0x00,
+0x10,0x10,0x20,0x20,0x40,0x80,0x80,0x00,0x10,0x10,0x08,0x08,0x04,0x02,0x02,0x01,
+0x20,0x20,0x40,0x40,0x80,0x00,0x00,0x00,0x20,0x20,0x10,0x10,0x08,0x05,0x05,0x02,
+0x40,0x40,0x80,0x80,0x00,0x00,0x00,0x00,0x40,0x40,0x20,0x20,0x11,0x0a,0x0a,0x04,
+0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x41,0x41,0x22,0x14,0x14,0x08,
+0x01,0x01,0x82,0x82,0x44,0x28,0x28,0x10,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0x02,0x04,0x04,0x88,0x50,0x50,0x20,0x02,0x02,0x01,0x01,0x00,0x00,0x00,0x00,
 // 'question'
- 63,10,5,11,1,0,36,8,19,0x0e,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+7,3,5,8,11,0,
+0x06,0x01,0x61,0x11,0x0e,0x00,0x00,0x06,0x00,0x00,
+0x0c,0x02,0xc2,0x22,0x1c,0x00,0x00,0x0c,0x00,0x00,
+0x18,0x04,0x84,0x44,0x38,0x00,0x00,0x19,0x00,0x00,
+0x30,0x08,0x08,0x88,0x70,0x00,0x00,0x33,0x00,0x00,
+0x60,0x10,0x10,0x10,0xe0,0x00,0x00,0x66,0x01,0x00,
+0xc0,0x20,0x20,0x20,0xc0,0x00,0x00,0xcc,0x02,0x01,
+0x80,0x40,0x40,0x40,0x80,0x01,0x00,0x98,0x04,0x03,0x00,0x00,0x01,0x00,0x00,
+0x00,0x80,0x80,0x80,0x00,0x03,0x00,0x30,0x08,0x07,0x00,0x00,0x03,0x00,0x00,
 // 'at'
- 64,17,14,14,0,-3,45,8,22,0x01,0xf0,0x00,0x06,0x0c,0x00,0x08,0x02,0x00,0x10,0x6a,0x00,0x11,0x99,0x00,0x21,0x11,0x00,0x22,0x11,0x00,0x22,0x11,0x00,0x22,0x32,0x00,0x22,0x52,0x00,0x11,0x8c,0x00,0x08,0x00,0x00,0x06,0x0c,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,
+15,2,14,8,14,2,
+0x4d,0xe0,0x18,0x04,0x02,0xc2,0x31,0x11,0x09,0x09,0xf1,0x1a,0x02,0x0c,0xf0,0xc0,0x4c,0x03,0x04,0x08,0x10,0x13,0x24,0x24,0x22,0x21,0x23,0x14,0x14,0x03,0xc0,
+0x4d,0xc0,0x30,0x08,0x04,0x84,0x62,0x22,0x12,0x12,0xe2,0x34,0x04,0x18,0xe0,0xc0,0x4d,0x07,0x08,0x10,0x20,0x27,0x48,0x48,0x44,0x42,0x47,0x28,0x28,0x06,0x01,0xc0,
+0x4d,0x80,0x60,0x10,0x08,0x08,0xc4,0x44,0x24,0x24,0xc4,0x68,0x08,0x30,0xc0,0xc0,0x4d,0x0f,0x10,0x20,0x40,0x4f,0x90,0x90,0x88,0x84,0x8f,0x50,0x50,0x0c,0x03,0xc0,
+0x00,0x4c,0xc0,0x20,0x10,0x10,0x88,0x88,0x48,0x48,0x88,0xd0,0x10,0x60,0x80,0xc0,0x4d,0x1f,0x20,0x40,0x80,0x9e,0x21,0x20,0x10,0x08,0x1f,0xa0,0xa0,0x18,0x07,0xc0,0x04,0x84,0x01,0xc0,
+0x00,0x4b,0x80,0x40,0x20,0x20,0x10,0x10,0x90,0x90,0x10,0xa0,0x20,0xc0,0xc0,0x4d,0x3e,0x41,0x80,0x00,0x3c,0x43,0x41,0x20,0x10,0x3f,0x41,0x40,0x30,0x0f,0xc0,0x02,0x41,0x01,0x01,0x84,0x02,0x41,0x01,0x01,0xc0,
+0x01,0x42,0x80,0x40,0x40,0x84,0x20,0x42,0x40,0x40,0x80,0xc0,0x41,0x7c,0x83,0x01,0x49,0x78,0x86,0x82,0x41,0x21,0x7e,0x83,0x80,0x61,0x1e,0xc0,0x01,0x42,0x01,0x02,0x02,0x84,0x04,0x41,0x02,0x02,0xc0,
+0x02,0x41,0x80,0x80,0x84,0x40,0x41,0x80,0x80,0xc0,0x4d,0xf8,0x06,0x01,0x00,0xf0,0x0c,0x04,0x82,0x42,0xfc,0x06,0x00,0xc3,0x3c,0xc0,0x00,0x45,0x01,0x02,0x04,0x04,0x09,0x09,0x82,0x08,0x41,0x05,0x05,0xc0,
+0x04,0x84,0x80,0xc0,0x4d,0xf0,0x0c,0x02,0x01,0xe1,0x18,0x08,0x04,0x84,0xf8,0x0d,0x01,0x86,0x78,0xc0,0x4c,0x01,0x02,0x04,0x08,0x09,0x12,0x12,0x11,0x10,0x11,0x0a,0x0a,0x01,0xc0,
 // 'A'
- 65,14,12,11,0,0,36,8,19,0x01,0x00,0x00,0x01,0x80,0x00,0x02,0x80,0x00,0x02,0xc0,0x00,0x04,0x40,0x00,0x04,0x60,0x00,0x08,0x20,0x00,0x0f,0xe0,0x00,0x10,0x30,0x00,0x10,0x10,0x00,0x38,0x3c,0x00,0x00,0x00,0x00,
+12,2,12,8,11,2,
+0x01,0x46,0xc0,0xb0,0x8c,0x83,0x8e,0xb8,0xe0,0xc0,0x42,0x04,0x07,0x04,0x04,0x43,0x05,0x07,0x04,0x04,0xc0,
+0x01,0x46,0x80,0x60,0x18,0x06,0x1c,0x70,0xc0,0xc0,0x42,0x08,0x0e,0x09,0x84,0x01,0x43,0x0b,0x0e,0x08,0x08,0xc0,
+0x02,0x45,0xc0,0x30,0x0c,0x38,0xe0,0x80,0xc0,0x42,0x10,0x1c,0x13,0x84,0x02,0x43,0x17,0x1c,0x10,0x10,0xc0,
+0x02,0x44,0x80,0x60,0x18,0x70,0xc0,0xc0,0x43,0x20,0x38,0x26,0x05,0x82,0x04,0x44,0x05,0x2f,0x38,0x20,0x20,0xc0,
+0x03,0x43,0xc0,0x30,0xe0,0x80,0xc0,0x43,0x40,0x70,0x4c,0x0b,0x82,0x08,0x44,0x0b,0x5e,0x70,0x40,0x40,0xc0,
+0x03,0x42,0x80,0x60,0xc0,0xc0,0x4b,0x80,0xe0,0x98,0x16,0x11,0x10,0x11,0x17,0xbc,0xe0,0x80,0x80,0xc0,
+0x04,0x41,0xc0,0x80,0xc0,0x00,0x48,0xc0,0x30,0x2c,0x23,0x20,0x23,0x2e,0x78,0xc0,0xc0,0x82,0x01,0x04,0x83,0x01,0xc0,
+0x04,0x40,0x80,0xc0,0x00,0x48,0x80,0x60,0x58,0x46,0x41,0x47,0x5c,0xf0,0x80,0xc0,0x42,0x02,0x03,0x02,0x04,0x43,0x02,0x03,0x02,0x02,0xc0,
 // 'B'
- 66,14,8,11,1,0,36,8,19,0x1f,0x80,0x00,0x08,0xc0,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x08,0x80,0x00,0x0f,0x80,0x00,0x08,0xc0,0x00,0x08,0x20,0x00,0x08,0x20,0x00,0x08,0x60,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,
+11,3,8,8,11,0,
+0x01,0xff,0x21,0x21,0x21,0x73,0x4e,0x80,0x04,0x07,0x04,0x04,0x04,0x04,0x06,0x03,
+0x02,0xfe,0x42,0x42,0x42,0xe6,0x9c,0x00,0x08,0x0f,0x08,0x08,0x08,0x08,0x0c,0x07,
+0x04,0xfc,0x84,0x84,0x84,0xcc,0x38,0x00,0x10,0x1f,0x10,0x10,0x10,0x11,0x19,0x0e,
+0x08,0xf8,0x08,0x08,0x08,0x98,0x70,0x00,0x20,0x3f,0x21,0x21,0x21,0x23,0x32,0x1c,
+0x10,0xf0,0x10,0x10,0x10,0x30,0xe0,0x00,0x40,0x7f,0x42,0x42,0x42,0x47,0x64,0x38,
+0x20,0xe0,0x20,0x20,0x20,0x60,0xc0,0x00,0x80,0xff,0x84,0x84,0x84,0x8e,0xc9,0x70,
+0x40,0xc0,0x40,0x40,0x40,0xc0,0x80,0x00,0x00,0xff,0x08,0x08,0x08,0x1c,0x93,0xe0,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,
+0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0xff,0x10,0x10,0x10,0x39,0x27,0xc0,0x02,0x03,0x02,0x02,0x02,0x02,0x03,0x01,
 // 'C'
- 67,13,10,11,0,0,36,8,19,0x07,0xd0,0x00,0x18,0x30,0x00,0x10,0x10,0x00,0x20,0x10,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x10,0x10,0x00,0x18,0x60,0x00,0x07,0x80,0x00,0x00,0x00,0x00,
+11,2,10,8,11,2,
+0x42,0xf8,0x06,0x02,0x84,0x01,0x41,0x02,0x0f,0xc0,0x00,0x41,0x03,0x02,0x83,0x04,0x42,0x02,0x02,0x01,0xc0,
+0x42,0xf0,0x0c,0x04,0x84,0x02,0x41,0x04,0x1e,0xc0,0x42,0x01,0x06,0x04,0x83,0x08,0x42,0x04,0x04,0x02,0xc0,
+0x42,0xe0,0x18,0x08,0x84,0x04,0x41,0x08,0x3c,0xc0,0x42,0x03,0x0c,0x08,0x83,0x10,0x42,0x08,0x08,0x04,0xc0,
+0x42,0xc0,0x30,0x10,0x84,0x08,0x41,0x10,0x78,0xc0,0x42,0x07,0x18,0x10,0x83,0x20,0x42,0x10,0x10,0x08,0xc0,
+0x42,0x80,0x60,0x20,0x84,0x10,0x41,0x20,0xf0,0xc0,0x42,0x0f,0x30,0x20,0x83,0x40,0x42,0x20,0x20,0x10,0xc0,
+0x00,0x41,0xc0,0x40,0x84,0x20,0x41,0x40,0xe0,0xc0,0x42,0x1f,0x60,0x40,0x83,0x80,0x42,0x40,0x40,0x21,0xc0,
+0x00,0x41,0x80,0x80,0x84,0x40,0x41,0x80,0xc0,0xc0,0x42,0x3e,0xc1,0x80,0x03,0x42,0x80,0x80,0x43,0xc0,0x02,0x83,0x01,0xc0,
+0x02,0x84,0x80,0x00,0x40,0x80,0xc0,0x42,0x7c,0x83,0x01,0x04,0x41,0x01,0x87,0xc0,0x00,0x41,0x01,0x01,0x83,0x02,0x41,0x01,0x01,0xc0,
 // 'D'
- 68,14,10,11,0,0,36,8,19,0x3f,0x00,0x00,0x10,0xc0,0x00,0x10,0x20,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x20,0x00,0x10,0xc0,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,
+12,2,10,8,11,2,
+0x41,0x01,0xff,0x83,0x01,0x43,0x02,0x02,0x04,0xf8,0xc0,0x41,0x04,0x07,0x83,0x04,0x42,0x02,0x02,0x01,0xc0,
+0x41,0x02,0xfe,0x83,0x02,0x43,0x04,0x04,0x08,0xf0,0xc0,0x41,0x08,0x0f,0x83,0x08,0x43,0x04,0x04,0x02,0x01,0xc0,
+0x41,0x04,0xfc,0x83,0x04,0x43,0x08,0x08,0x10,0xe0,0xc0,0x41,0x10,0x1f,0x83,0x10,0x43,0x08,0x08,0x04,0x03,0xc0,
+0x41,0x08,0xf8,0x83,0x08,0x43,0x10,0x10,0x20,0xc0,0xc0,0x41,0x20,0x3f,0x83,0x20,0x43,0x10,0x10,0x08,0x07,0xc0,
+0x41,0x10,0xf0,0x83,0x10,0x43,0x20,0x20,0x40,0x80,0xc0,0x41,0x40,0x7f,0x83,0x40,0x43,0x20,0x20,0x10,0x0f,0xc0,
+0x41,0x20,0xe0,0x83,0x20,0x42,0x40,0x40,0x80,0xc0,0x41,0x80,0xff,0x83,0x80,0x43,0x40,0x40,0x20,0x1f,0xc0,
+0x41,0x40,0xc0,0x83,0x40,0x41,0x80,0x80,0xc0,0x00,0x40,0xff,0x03,0x43,0x80,0x80,0x41,0x3e,0xc0,0x85,0x01,0xc0,
+0x85,0x80,0xc0,0x00,0x40,0xff,0x03,0x43,0x01,0x01,0x82,0x7c,0xc0,0x41,0x02,0x03,0x83,0x02,0x41,0x01,0x01,0xc0,
 // 'E'
- 69,12,9,11,0,0,36,8,19,0x3f,0xc0,0x00,0x10,0x40,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x80,0x00,0x1f,0x80,0x00,0x10,0x80,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x20,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,
+10,2,9,8,11,2,
+0x41,0x01,0xff,0x83,0x21,0x41,0x71,0x03,0xc0,0x41,0x04,0x07,0x85,0x04,0x40,0x02,0xc0,
+0x41,0x02,0xfe,0x83,0x42,0x41,0xe2,0x06,0xc0,0x41,0x08,0x0f,0x85,0x08,0x40,0x04,0xc0,
+0x41,0x04,0xfc,0x83,0x84,0x41,0xc4,0x0c,0xc0,0x41,0x10,0x1f,0x83,0x10,0x42,0x11,0x10,0x08,0xc0,
+0x41,0x08,0xf8,0x83,0x08,0x41,0x88,0x18,0xc0,0x41,0x20,0x3f,0x83,0x21,0x42,0x23,0x20,0x10,0xc0,
+0x41,0x10,0xf0,0x84,0x10,0x40,0x30,0xc0,0x41,0x40,0x7f,0x83,0x42,0x42,0x47,0x40,0x20,0xc0,
+0x41,0x20,0xe0,0x84,0x20,0x40,0x60,0xc0,0x41,0x80,0xff,0x83,0x84,0x42,0x8e,0x80,0x40,0xc0,
+0x41,0x40,0xc0,0x84,0x40,0x40,0xc0,0xc0,0x00,0x40,0xff,0x83,0x08,0x42,0x1c,0x00,0x80,0xc0,0x87,0x01,0xc0,
+0x87,0x80,0xc0,0x00,0x40,0xff,0x83,0x10,0x41,0x38,0x01,0xc0,0x41,0x02,0x03,0x85,0x02,0x40,0x01,0xc0,
 // 'F'
- 70,11,8,11,0,0,36,8,19,0x3f,0xc0,0x00,0x10,0x40,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x80,0x00,0x1f,0x80,0x00,0x10,0x80,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+9,2,8,8,11,2,
+0x41,0x01,0xff,0x83,0x21,0x41,0x71,0x03,0xc0,0x42,0x04,0x07,0x04,0xc0,
+0x41,0x02,0xfe,0x83,0x42,0x41,0xe2,0x06,0xc0,0x42,0x08,0x0f,0x08,0xc0,
+0x41,0x04,0xfc,0x83,0x84,0x41,0xc4,0x0c,0xc0,0x42,0x10,0x1f,0x10,0x02,0x40,0x01,0xc0,
+0x41,0x08,0xf8,0x83,0x08,0x41,0x88,0x18,0xc0,0x42,0x20,0x3f,0x21,0x82,0x01,0x40,0x03,0xc0,
+0x41,0x10,0xf0,0x84,0x10,0x40,0x30,0xc0,0x42,0x40,0x7f,0x42,0x82,0x02,0x40,0x07,0xc0,
+0x41,0x20,0xe0,0x84,0x20,0x40,0x60,0xc0,0x42,0x80,0xff,0x84,0x82,0x04,0x40,0x0e,0xc0,
+0x41,0x40,0xc0,0x84,0x40,0x40,0xc0,0xc0,0x00,0x40,0xff,0x83,0x08,0x40,0x1c,0xc0,0x82,0x01,0xc0,
+0x87,0x80,0xc0,0x00,0x40,0xff,0x83,0x10,0x41,0x38,0x01,0xc0,0x42,0x02,0x03,0x02,0xc0,
 // 'G'
- 71,14,11,11,0,0,36,8,19,0x03,0xd0,0x00,0x0c,0x30,0x00,0x10,0x10,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x78,0x00,0x20,0x10,0x00,0x20,0x10,0x00,0x10,0x10,0x00,0x0c,0x30,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,
+12,2,11,8,11,0,
+0xf8,0x04,0x02,0x02,0x01,0x01,0x01,0x21,0x22,0xe7,0x20,0x00,0x01,0x02,0x02,0x04,0x04,0x04,0x04,0x02,0x03,0x00,
+0xf0,0x08,0x04,0x04,0x02,0x02,0x02,0x42,0x44,0xce,0x40,0x01,0x02,0x04,0x04,0x08,0x08,0x08,0x08,0x04,0x07,0x00,
+0xe0,0x10,0x08,0x08,0x04,0x04,0x04,0x84,0x88,0x9c,0x80,0x03,0x04,0x08,0x08,0x10,0x10,0x10,0x10,0x08,0x0f,0x00,
+0xc0,0x20,0x10,0x10,0x08,0x08,0x08,0x08,0x10,0x38,0x00,0x07,0x08,0x10,0x10,0x20,0x20,0x20,0x21,0x11,0x1f,0x01,
+0x80,0x40,0x20,0x20,0x10,0x10,0x10,0x10,0x20,0x70,0x00,0x0f,0x10,0x20,0x20,0x40,0x40,0x40,0x42,0x22,0x3e,0x02,
+0x00,0x80,0x40,0x40,0x20,0x20,0x20,0x20,0x40,0xe0,0x00,0x1f,0x20,0x40,0x40,0x80,0x80,0x80,0x84,0x44,0x7c,0x04,
+0x00,0x00,0x80,0x80,0x40,0x40,0x40,0x40,0x80,0xc0,0x00,0x3e,0x41,0x80,0x80,0x00,0x00,0x00,0x08,0x88,0xf9,0x08,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x80,0x00,0x7c,0x82,0x01,0x01,0x00,0x00,0x00,0x10,0x11,0xf3,0x10,0x00,0x00,0x01,0x01,0x02,0x02,0x02,0x02,0x01,0x01,0x00,
 // 'H'
- 72,14,10,11,0,0,36,8,19,0x38,0x70,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x1f,0xe0,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x38,0x70,0x00,0x00,0x00,0x00,
+12,2,10,8,11,2,
+0x42,0x01,0xff,0x21,0x83,0x20,0x42,0x21,0xff,0x01,0xc0,0x42,0x04,0x07,0x04,0x03,0x42,0x04,0x07,0x04,0xc0,
+0x42,0x02,0xfe,0x42,0x83,0x40,0x42,0x42,0xfe,0x02,0xc0,0x42,0x08,0x0f,0x08,0x03,0x42,0x08,0x0f,0x08,0xc0,
+0x42,0x04,0xfc,0x84,0x83,0x80,0x42,0x84,0xfc,0x04,0xc0,0x42,0x10,0x1f,0x10,0x03,0x42,0x10,0x1f,0x10,0xc0,
+0x42,0x08,0xf8,0x08,0x03,0x42,0x08,0xf8,0x08,0xc0,0x42,0x20,0x3f,0x21,0x83,0x01,0x42,0x21,0x3f,0x20,0xc0,
+0x42,0x10,0xf0,0x10,0x03,0x42,0x10,0xf0,0x10,0xc0,0x42,0x40,0x7f,0x42,0x83,0x02,0x42,0x42,0x7f,0x40,0xc0,
+0x42,0x20,0xe0,0x20,0x03,0x42,0x20,0xe0,0x20,0xc0,0x42,0x80,0xff,0x84,0x83,0x04,0x42,0x84,0xff,0x80,0xc0,
+0x42,0x40,0xc0,0x40,0x03,0x42,0x40,0xc0,0x40,0xc0,0x00,0x40,0xff,0x85,0x08,0x40,0xff,0xc0,0x82,0x01,0x03,0x82,0x01,0xc0,
+0x82,0x80,0x03,0x82,0x80,0xc0,0x00,0x40,0xff,0x85,0x10,0x40,0xff,0xc0,0x42,0x02,0x03,0x02,0x03,0x42,0x02,0x03,0x02,0xc0,
 // 'I'
- 73,7,3,11,0,0,36,8,19,0x38,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+5,2,3,8,11,0,
+0x01,0xff,0x01,0x04,0x07,0x04,
+0x02,0xfe,0x02,0x08,0x0f,0x08,
+0x04,0xfc,0x04,0x10,0x1f,0x10,
+0x08,0xf8,0x08,0x20,0x3f,0x20,
+0x10,0xf0,0x10,0x40,0x7f,0x40,
+0x20,0xe0,0x20,0x80,0xff,0x80,
+0x40,0xc0,0x40,0x00,0xff,0x00,0x01,0x01,0x01,
+0x80,0x80,0x80,0x00,0xff,0x00,0x02,0x03,0x02,
 // 'J'
- 74,8,5,11,0,0,36,8,19,0x0e,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,
+6,2,5,8,11,0,
+0x00,0x00,0x01,0xff,0x01,0x03,0x04,0x04,0x03,0x00,
+0x00,0x00,0x02,0xfe,0x02,0x06,0x08,0x08,0x07,0x00,
+0x00,0x00,0x04,0xfc,0x04,0x0c,0x10,0x10,0x0f,0x00,
+0x00,0x00,0x08,0xf8,0x08,0x18,0x20,0x20,0x1f,0x00,
+0x00,0x00,0x10,0xf0,0x10,0x30,0x40,0x40,0x3f,0x00,
+0x00,0x00,0x20,0xe0,0x20,0x60,0x80,0x80,0x7f,0x00,
+0x00,0x00,0x40,0xc0,0x40,0xc0,0x00,0x00,0xff,0x00,0x00,0x01,0x01,0x00,0x00,
+0x00,0x00,0x80,0x80,0x80,0x80,0x00,0x00,0xff,0x00,0x01,0x02,0x02,0x01,0x00,
 // 'K'
- 75,15,10,11,1,0,36,8,19,0x1e,0x78,0x00,0x08,0x20,0x00,0x08,0x40,0x00,0x08,0x80,0x00,0x09,0x00,0x00,0x0e,0x00,0x00,0x09,0x00,0x00,0x08,0x80,0x00,0x08,0x40,0x00,0x08,0x20,0x00,0x1e,0x78,0x00,0x00,0x00,0x00,
+12,3,10,8,11,0,
+0x01,0xff,0x21,0x21,0x50,0x88,0x05,0x03,0x01,0x01,0x04,0x07,0x04,0x04,0x00,0x00,0x05,0x06,0x04,0x04,
+0x02,0xfe,0x42,0x42,0xa0,0x10,0x0a,0x06,0x02,0x02,0x08,0x0f,0x08,0x08,0x00,0x01,0x0a,0x0c,0x08,0x08,
+0x04,0xfc,0x84,0x84,0x40,0x20,0x14,0x0c,0x04,0x04,0x10,0x1f,0x10,0x10,0x01,0x02,0x14,0x18,0x10,0x10,
+0x08,0xf8,0x08,0x08,0x80,0x40,0x28,0x18,0x08,0x08,0x20,0x3f,0x21,0x21,0x02,0x04,0x28,0x30,0x20,0x20,
+0x10,0xf0,0x10,0x10,0x00,0x80,0x50,0x30,0x10,0x10,0x40,0x7f,0x42,0x42,0x05,0x08,0x50,0x60,0x40,0x40,
+0x20,0xe0,0x20,0x20,0x00,0x00,0xa0,0x60,0x20,0x20,0x80,0xff,0x84,0x84,0x0a,0x11,0xa0,0xc0,0x80,0x80,
+0x40,0xc0,0x40,0x40,0x00,0x00,0x40,0xc0,0x40,0x40,0x00,0xff,0x08,0x08,0x14,0x22,0x41,0x80,0x00,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x01,0x01,0x01,0x01,
+0x80,0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,0x80,0x00,0xff,0x10,0x10,0x28,0x44,0x82,0x01,0x00,0x00,0x02,0x03,0x02,0x02,0x00,0x00,0x02,0x03,0x02,0x02,
 // 'L'
- 76,12,8,11,0,0,36,8,19,0x38,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x40,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,
+10,2,8,8,11,2,
+0x42,0x01,0xff,0x01,0xc0,0x41,0x04,0x07,0x84,0x04,0x40,0x02,0xc0,
+0x42,0x02,0xfe,0x02,0xc0,0x41,0x08,0x0f,0x84,0x08,0x40,0x04,0xc0,
+0x42,0x04,0xfc,0x04,0xc0,0x41,0x10,0x1f,0x84,0x10,0x40,0x08,0xc0,
+0x42,0x08,0xf8,0x08,0xc0,0x41,0x20,0x3f,0x84,0x20,0x40,0x10,0xc0,
+0x42,0x10,0xf0,0x10,0xc0,0x41,0x40,0x7f,0x84,0x40,0x40,0x20,0xc0,
+0x42,0x20,0xe0,0x20,0xc0,0x41,0x80,0xff,0x84,0x80,0x40,0x40,0xc0,
+0x42,0x40,0xc0,0x40,0xc0,0x00,0x40,0xff,0x04,0x40,0x80,0xc0,0x86,0x01,0xc0,
+0x82,0x80,0xc0,0x00,0x40,0xff,0xc0,0x41,0x02,0x03,0x84,0x02,0x40,0x01,0xc0,
 // 'M'
- 77,17,13,11,0,0,36,8,19,0x38,0x0e,0x00,0x18,0x0c,0x00,0x14,0x14,0x00,0x14,0x14,0x00,0x12,0x24,0x00,0x12,0x24,0x00,0x12,0x24,0x00,0x11,0x44,0x00,0x11,0x44,0x00,0x10,0x84,0x00,0x38,0x8e,0x00,0x00,0x00,0x00,
+15,2,13,8,11,0,
+0x01,0xff,0x03,0x0c,0x70,0x80,0x00,0x80,0x70,0x0c,0x03,0xff,0x01,0x04,0x07,0x04,0x00,0x00,0x01,0x06,0x01,0x00,0x00,0x04,0x07,0x04,
+0x02,0xfe,0x06,0x18,0xe0,0x00,0x00,0x00,0xe0,0x18,0x06,0xfe,0x02,0x08,0x0f,0x08,0x00,0x00,0x03,0x0c,0x03,0x00,0x00,0x08,0x0f,0x08,
+0x04,0xfc,0x0c,0x30,0xc0,0x00,0x00,0x00,0xc0,0x30,0x0c,0xfc,0x04,0x10,0x1f,0x10,0x00,0x01,0x06,0x18,0x06,0x01,0x00,0x10,0x1f,0x10,
+0x08,0xf8,0x18,0x60,0x80,0x00,0x00,0x00,0x80,0x60,0x18,0xf8,0x08,0x20,0x3f,0x20,0x00,0x03,0x0c,0x30,0x0c,0x03,0x00,0x20,0x3f,0x20,
+0x10,0xf0,0x30,0xc0,0x00,0x00,0x00,0x00,0x00,0xc0,0x30,0xf0,0x10,0x40,0x7f,0x40,0x00,0x07,0x18,0x60,0x18,0x07,0x00,0x40,0x7f,0x40,
+0x20,0xe0,0x60,0x80,0x00,0x00,0x00,0x00,0x00,0x80,0x60,0xe0,0x20,0x80,0xff,0x80,0x01,0x0e,0x30,0xc0,0x30,0x0e,0x01,0x80,0xff,0x80,
+0x40,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0x40,0x00,0xff,0x00,0x03,0x1c,0x60,0x80,0x60,0x1c,0x03,0x00,0xff,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x01,0x01,0x01,
+0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x00,0xff,0x01,0x06,0x38,0xc0,0x00,0xc0,0x38,0x06,0x01,0xff,0x00,0x02,0x03,0x02,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x02,0x03,0x02,
 // 'N'
- 78,14,10,11,0,0,36,8,19,0x38,0x70,0x00,0x18,0x20,0x00,0x14,0x20,0x00,0x14,0x20,0x00,0x12,0x20,0x00,0x12,0x20,0x00,0x11,0x20,0x00,0x10,0xa0,0x00,0x10,0xa0,0x00,0x10,0x60,0x00,0x3c,0x20,0x00,0x00,0x00,0x00,
+12,2,10,8,11,0,
+0x01,0xff,0x03,0x0c,0x30,0x40,0x80,0x01,0xff,0x01,0x04,0x07,0x04,0x04,0x00,0x00,0x01,0x02,0x07,0x00,
+0x02,0xfe,0x06,0x18,0x60,0x80,0x00,0x02,0xfe,0x02,0x08,0x0f,0x08,0x08,0x00,0x00,0x03,0x04,0x0f,0x00,
+0x04,0xfc,0x0c,0x30,0xc0,0x00,0x00,0x04,0xfc,0x04,0x10,0x1f,0x10,0x10,0x00,0x01,0x06,0x08,0x1f,0x00,
+0x08,0xf8,0x18,0x60,0x80,0x00,0x00,0x08,0xf8,0x08,0x20,0x3f,0x20,0x20,0x01,0x02,0x0c,0x10,0x3f,0x00,
+0x10,0xf0,0x30,0xc0,0x00,0x00,0x00,0x10,0xf0,0x10,0x40,0x7f,0x40,0x40,0x03,0x04,0x18,0x20,0x7f,0x00,
+0x20,0xe0,0x60,0x80,0x00,0x00,0x00,0x20,0xe0,0x20,0x80,0xff,0x80,0x81,0x06,0x08,0x30,0x40,0xff,0x00,
+0x40,0xc0,0xc0,0x00,0x00,0x00,0x00,0x40,0xc0,0x40,0x00,0xff,0x00,0x03,0x0c,0x10,0x60,0x80,0xff,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x01,0x00,
+0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x00,0xff,0x01,0x06,0x18,0x20,0xc0,0x00,0xff,0x00,0x02,0x03,0x02,0x02,0x00,0x00,0x00,0x01,0x03,0x00,
 // 'O'
- 79,15,9,11,1,0,36,8,19,0x03,0x80,0x00,0x0c,0x60,0x00,0x08,0x20,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x08,0x20,0x00,0x0c,0x60,0x00,0x03,0x80,0x00,0x00,0x00,0x00,
+12,3,9,8,11,0,
+0xf8,0x06,0x02,0x01,0x01,0x01,0x02,0x06,0xf8,0x00,0x03,0x02,0x04,0x04,0x04,0x02,0x03,0x00,
+0xf0,0x0c,0x04,0x02,0x02,0x02,0x04,0x0c,0xf0,0x01,0x06,0x04,0x08,0x08,0x08,0x04,0x06,0x01,
+0xe0,0x18,0x08,0x04,0x04,0x04,0x08,0x18,0xe0,0x03,0x0c,0x08,0x10,0x10,0x10,0x08,0x0c,0x03,
+0xc0,0x30,0x10,0x08,0x08,0x08,0x10,0x30,0xc0,0x07,0x18,0x10,0x20,0x20,0x20,0x10,0x18,0x07,
+0x80,0x60,0x20,0x10,0x10,0x10,0x20,0x60,0x80,0x0f,0x30,0x20,0x40,0x40,0x40,0x20,0x30,0x0f,
+0x00,0xc0,0x40,0x20,0x20,0x20,0x40,0xc0,0x00,0x1f,0x60,0x40,0x80,0x80,0x80,0x40,0x60,0x1f,
+0x00,0x80,0x80,0x40,0x40,0x40,0x80,0x80,0x00,0x3e,0xc1,0x80,0x00,0x00,0x00,0x80,0xc1,0x3e,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x7c,0x83,0x01,0x00,0x00,0x00,0x01,0x83,0x7c,0x00,0x01,0x01,0x02,0x02,0x02,0x01,0x01,0x00,
 // 'P'
- 80,11,8,11,0,0,36,8,19,0x3f,0x00,0x00,0x10,0x80,0x00,0x10,0x40,0x00,0x10,0x40,0x00,0x10,0x80,0x00,0x1f,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+9,2,8,8,11,2,
+0x41,0x01,0xff,0x83,0x21,0x41,0x12,0x0c,0xc0,0x42,0x04,0x07,0x04,0xc0,
+0x41,0x02,0xfe,0x83,0x42,0x41,0x24,0x18,0xc0,0x42,0x08,0x0f,0x08,0xc0,
+0x41,0x04,0xfc,0x83,0x84,0x41,0x48,0x30,0xc0,0x42,0x10,0x1f,0x10,0xc0,
+0x41,0x08,0xf8,0x83,0x08,0x41,0x90,0x60,0xc0,0x42,0x20,0x3f,0x21,0x82,0x01,0xc0,
+0x41,0x10,0xf0,0x83,0x10,0x41,0x20,0xc0,0xc0,0x42,0x40,0x7f,0x42,0x82,0x02,0x40,0x01,0xc0,
+0x41,0x20,0xe0,0x83,0x20,0x41,0x40,0x80,0xc0,0x42,0x80,0xff,0x84,0x82,0x04,0x41,0x02,0x01,0xc0,
+0x41,0x40,0xc0,0x83,0x40,0x40,0x80,0xc0,0x00,0x40,0xff,0x83,0x08,0x41,0x04,0x03,0xc0,0x82,0x01,0xc0,
+0x85,0x80,0xc0,0x00,0x40,0xff,0x83,0x10,0x41,0x09,0x06,0xc0,0x42,0x02,0x03,0x02,0xc0,
 // 'Q'
- 81,15,10,14,1,-3,45,8,22,0x03,0x80,0x00,0x0c,0x60,0x00,0x08,0x20,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x08,0x20,0x00,0x0c,0x60,0x00,0x07,0x80,0x00,0x01,0x80,0x00,0x00,0xc0,0x00,0x00,0x38,0x00,0x00,0x00,0x00,
+12,3,10,8,14,2,
+0x42,0xf8,0x06,0x02,0x82,0x01,0x42,0x02,0x06,0xf8,0xc0,0x00,0x48,0x03,0x06,0x04,0x0c,0x1c,0x12,0x23,0x20,0x20,0xc0,
+0x42,0xf0,0x0c,0x04,0x82,0x02,0x42,0x04,0x0c,0xf0,0xc0,0x49,0x01,0x06,0x0c,0x08,0x18,0x38,0x24,0x46,0x41,0x40,0xc0,
+0x42,0xe0,0x18,0x08,0x82,0x04,0x42,0x08,0x18,0xe0,0xc0,0x49,0x03,0x0c,0x18,0x10,0x30,0x70,0x48,0x8c,0x83,0x80,0xc0,
+0x42,0xc0,0x30,0x10,0x82,0x08,0x42,0x10,0x30,0xc0,0xc0,0x48,0x07,0x18,0x30,0x20,0x60,0xe0,0x90,0x18,0x07,0xc0,0x06,0x82,0x01,0xc0,
+0x42,0x80,0x60,0x20,0x82,0x10,0x42,0x20,0x60,0x80,0xc0,0x48,0x0f,0x30,0x60,0x40,0xc0,0xc0,0x20,0x30,0x0f,0xc0,0x04,0x41,0x01,0x01,0x82,0x02,0xc0,
+0x00,0x41,0xc0,0x40,0x82,0x20,0x41,0x40,0xc0,0xc0,0x42,0x1f,0x60,0xc0,0x82,0x80,0x42,0x40,0x60,0x1f,0xc0,0x03,0x42,0x01,0x03,0x02,0x82,0x04,0xc0,
+0x00,0x41,0x80,0x80,0x82,0x40,0x41,0x80,0x80,0xc0,0x42,0x3e,0xc1,0x80,0x02,0x42,0x80,0xc1,0x3e,0xc0,0x01,0x44,0x01,0x01,0x03,0x07,0x04,0x82,0x08,0xc0,
+0x02,0x82,0x80,0xc0,0x42,0x7c,0x83,0x01,0x02,0x42,0x01,0x83,0x7c,0xc0,0x00,0x48,0x01,0x03,0x02,0x06,0x0e,0x09,0x11,0x10,0x10,0xc0,
 // 'R'
- 82,13,10,11,0,0,36,8,19,0x3f,0x00,0x00,0x10,0x80,0x00,0x10,0x40,0x00,0x10,0x40,0x00,0x10,0x80,0x00,0x1f,0x00,0x00,0x12,0x00,0x00,0x11,0x00,0x00,0x10,0x80,0x00,0x10,0x40,0x00,0x38,0x70,0x00,0x00,0x00,0x00,
+11,2,10,8,11,2,
+0x47,0x01,0xff,0x21,0x21,0x61,0xa1,0x12,0x0c,0xc0,0x42,0x04,0x07,0x04,0x02,0x43,0x01,0x06,0x04,0x04,0xc0,
+0x47,0x02,0xfe,0x42,0x42,0xc2,0x42,0x24,0x18,0xc0,0x42,0x08,0x0f,0x08,0x01,0x44,0x01,0x02,0x0c,0x08,0x08,0xc0,
+0x41,0x04,0xfc,0x83,0x84,0x41,0x48,0x30,0xc0,0x49,0x10,0x1f,0x10,0x00,0x01,0x02,0x04,0x18,0x10,0x10,0xc0,
+0x41,0x08,0xf8,0x83,0x08,0x41,0x90,0x60,0xc0,0x49,0x20,0x3f,0x21,0x01,0x03,0x05,0x08,0x30,0x20,0x20,0xc0,
+0x41,0x10,0xf0,0x83,0x10,0x41,0x20,0xc0,0xc0,0x49,0x40,0x7f,0x42,0x02,0x06,0x0a,0x11,0x60,0x40,0x40,0xc0,
+0x41,0x20,0xe0,0x83,0x20,0x41,0x40,0x80,0xc0,0x49,0x80,0xff,0x84,0x04,0x0c,0x14,0x22,0xc1,0x80,0x80,0xc0,
+0x41,0x40,0xc0,0x83,0x40,0x40,0x80,0xc0,0x00,0x46,0xff,0x08,0x08,0x18,0x28,0x44,0x83,0xc0,0x82,0x01,0x03,0x82,0x01,0xc0,
+0x85,0x80,0xc0,0x00,0x46,0xff,0x10,0x10,0x30,0x50,0x89,0x06,0xc0,0x42,0x02,0x03,0x02,0x03,0x42,0x03,0x02,0x02,0xc0,
 // 'S'
- 83,11,8,11,0,0,36,8,19,0x0e,0x80,0x00,0x11,0x80,0x00,0x20,0x80,0x00,0x20,0x00,0x00,0x18,0x00,0x00,0x07,0x00,0x00,0x00,0x80,0x00,0x00,0x40,0x00,0x20,0x40,0x00,0x30,0x80,0x00,0x2f,0x00,0x00,0x00,0x00,0x00,
+9,2,8,8,11,0,
+0x0c,0x12,0x11,0x21,0x21,0x22,0x47,0x80,0x07,0x02,0x04,0x04,0x04,0x04,0x02,0x01,
+0x18,0x24,0x22,0x42,0x42,0x44,0x8e,0x00,0x0e,0x04,0x08,0x08,0x08,0x08,0x04,0x03,
+0x30,0x48,0x44,0x84,0x84,0x88,0x1c,0x00,0x1c,0x08,0x10,0x10,0x10,0x10,0x09,0x06,
+0x60,0x90,0x88,0x08,0x08,0x10,0x38,0x00,0x38,0x10,0x20,0x21,0x21,0x21,0x12,0x0c,
+0xc0,0x20,0x10,0x10,0x10,0x20,0x70,0x00,0x70,0x21,0x41,0x42,0x42,0x42,0x24,0x18,
+0x80,0x40,0x20,0x20,0x20,0x40,0xe0,0x00,0xe1,0x42,0x82,0x84,0x84,0x84,0x48,0x30,
+0x00,0x80,0x40,0x40,0x40,0x80,0xc0,0x00,0xc3,0x84,0x04,0x08,0x08,0x08,0x91,0x60,0x01,0x00,0x01,0x01,0x01,0x01,0x00,0x00,
+0x00,0x00,0x80,0x80,0x80,0x00,0x80,0x00,0x86,0x09,0x08,0x10,0x10,0x11,0x23,0xc0,0x03,0x01,0x02,0x02,0x02,0x02,0x01,0x00,
 // 'T'
- 84,12,9,11,0,0,36,8,19,0x3f,0xe0,0x00,0x22,0x20,0x00,0x22,0x20,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
+10,2,9,8,11,2,
+0x40,0x07,0x82,0x01,0x40,0xff,0x82,0x01,0x40,0x07,0xc0,0x02,0x42,0x04,0x07,0x04,0xc0,
+0x40,0x0e,0x82,0x02,0x40,0xfe,0x82,0x02,0x40,0x0e,0xc0,0x02,0x42,0x08,0x0f,0x08,0xc0,
+0x40,0x1c,0x82,0x04,0x40,0xfc,0x82,0x04,0x40,0x1c,0xc0,0x02,0x42,0x10,0x1f,0x10,0xc0,
+0x40,0x38,0x82,0x08,0x40,0xf8,0x82,0x08,0x40,0x38,0xc0,0x02,0x42,0x20,0x3f,0x20,0xc0,
+0x40,0x70,0x82,0x10,0x40,0xf0,0x82,0x10,0x40,0x70,0xc0,0x02,0x42,0x40,0x7f,0x40,0xc0,
+0x40,0xe0,0x82,0x20,0x40,0xe0,0x82,0x20,0x40,0xe0,0xc0,0x02,0x42,0x80,0xff,0x80,0xc0,
+0x40,0xc0,0x82,0x40,0x40,0xc0,0x82,0x40,0x40,0xc0,0xc0,0x40,0x01,0x02,0x40,0xff,0x02,0x40,0x01,0xc0,0x02,0x82,0x01,0xc0,
+0x88,0x80,0xc0,0x40,0x03,0x02,0x40,0xff,0x02,0x40,0x03,0xc0,0x02,0x42,0x02,0x03,0x02,0xc0,
 // 'U'
- 85,14,10,11,0,0,36,8,19,0x38,0x70,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x08,0x40,0x00,0x07,0x80,0x00,0x00,0x00,0x00,
+12,2,10,8,11,2,
+0x42,0x01,0xff,0x01,0x03,0x42,0x01,0xff,0x01,0xc0,0x00,0x41,0x01,0x02,0x83,0x04,0x41,0x02,0x01,0xc0,
+0x42,0x02,0xfe,0x02,0x03,0x42,0x02,0xfe,0x02,0xc0,0x00,0x41,0x03,0x04,0x83,0x08,0x41,0x04,0x03,0xc0,
+0x42,0x04,0xfc,0x04,0x03,0x42,0x04,0xfc,0x04,0xc0,0x00,0x41,0x07,0x08,0x83,0x10,0x41,0x08,0x07,0xc0,
+0x42,0x08,0xf8,0x08,0x03,0x42,0x08,0xf8,0x08,0xc0,0x00,0x41,0x0f,0x10,0x83,0x20,0x41,0x10,0x0f,0xc0,
+0x42,0x10,0xf0,0x10,0x03,0x42,0x10,0xf0,0x10,0xc0,0x00,0x41,0x1f,0x20,0x83,0x40,0x41,0x20,0x1f,0xc0,
+0x42,0x20,0xe0,0x20,0x03,0x42,0x20,0xe0,0x20,0xc0,0x00,0x41,0x3f,0x40,0x83,0x80,0x41,0x40,0x3f,0xc0,
+0x42,0x40,0xc0,0x40,0x03,0x42,0x40,0xc0,0x40,0xc0,0x00,0x41,0x7f,0x80,0x03,0x41,0x80,0x7f,0xc0,0x02,0x83,0x01,0xc0,
+0x82,0x80,0x03,0x82,0x80,0xc0,0x00,0x40,0xff,0x05,0x40,0xff,0xc0,0x01,0x40,0x01,0x83,0x02,0x40,0x01,0xc0,
 // 'V'
- 86,14,11,11,0,0,36,8,19,0x38,0x38,0x00,0x10,0x10,0x00,0x08,0x20,0x00,0x08,0x20,0x00,0x04,0x40,0x00,0x04,0x40,0x00,0x04,0x40,0x00,0x02,0x80,0x00,0x02,0x80,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+12,2,11,8,11,2,
+0x4a,0x01,0x03,0x0d,0x70,0x80,0x00,0x80,0x70,0x0d,0x03,0x01,0xc0,0x03,0x42,0x01,0x06,0x01,0xc0,
+0x43,0x02,0x06,0x1a,0xe0,0x02,0x43,0xe0,0x1a,0x06,0x02,0xc0,0x03,0x42,0x03,0x0c,0x03,0xc0,
+0x43,0x04,0x0c,0x34,0xc0,0x02,0x43,0xc0,0x34,0x0c,0x04,0xc0,0x02,0x44,0x01,0x06,0x18,0x06,0x01,0xc0,
+0x43,0x08,0x18,0x68,0x80,0x02,0x43,0x80,0x68,0x18,0x08,0xc0,0x02,0x44,0x03,0x0c,0x30,0x0c,0x03,0xc0,
+0x42,0x10,0x30,0xd0,0x04,0x42,0xd0,0x30,0x10,0xc0,0x02,0x44,0x07,0x18,0x60,0x18,0x07,0xc0,
+0x42,0x20,0x60,0xa0,0x04,0x42,0xa0,0x60,0x20,0xc0,0x01,0x46,0x01,0x0e,0x30,0xc0,0x30,0x0e,0x01,0xc0,
+0x42,0x40,0xc0,0x40,0x04,0x42,0x40,0xc0,0x40,0xc0,0x01,0x46,0x03,0x1c,0x60,0x80,0x60,0x1c,0x03,0xc0,0x04,0x40,0x01,0xc0,
+0x82,0x80,0x04,0x82,0x80,0xc0,0x00,0x48,0x01,0x06,0x38,0xc0,0x00,0xc0,0x38,0x06,0x01,0xc0,0x04,0x40,0x03,0xc0,
 // 'W'
- 87,18,15,11,0,0,36,8,19,0x39,0xc3,0x80,0x10,0x81,0x00,0x08,0x42,0x00,0x08,0x42,0x00,0x04,0x62,0x00,0x04,0xa4,0x00,0x04,0xa4,0x00,0x02,0x94,0x00,0x02,0x94,0x00,0x01,0x08,0x00,0x01,0x08,0x00,0x00,0x00,0x00,
+16,2,15,8,11,2,
+0x4e,0x01,0x03,0x0d,0x70,0x80,0x01,0xe3,0x1d,0x70,0x80,0x00,0xe0,0x1d,0x03,0x01,0xc0,0x03,0x42,0x01,0x06,0x01,0x01,0x42,0x01,0x06,0x01,0xc0,
+0x48,0x02,0x06,0x1a,0xe0,0x00,0x02,0xc6,0x3a,0xe0,0x01,0x43,0xc0,0x3a,0x06,0x02,0xc0,0x03,0x42,0x03,0x0c,0x03,0x01,0x42,0x03,0x0c,0x03,0xc0,
+0x48,0x04,0x0c,0x34,0xc0,0x00,0x04,0x8c,0x74,0xc0,0x01,0x43,0x80,0x74,0x0c,0x04,0xc0,0x02,0x48,0x01,0x06,0x18,0x07,0x00,0x01,0x06,0x18,0x07,0xc0,
+0x48,0x08,0x18,0x68,0x80,0x00,0x08,0x18,0xe8,0x80,0x02,0x42,0xe8,0x18,0x08,0xc0,0x02,0x48,0x03,0x0c,0x30,0x0f,0x00,0x03,0x0c,0x30,0x0f,0xc0,
+0x42,0x10,0x30,0xd0,0x01,0x42,0x10,0x30,0xd0,0x03,0x42,0xd0,0x30,0x10,0xc0,0x02,0x49,0x07,0x18,0x60,0x1e,0x01,0x07,0x18,0x60,0x1e,0x01,0xc0,
+0x42,0x20,0x60,0xa0,0x01,0x42,0x20,0x60,0xa0,0x03,0x42,0xa0,0x60,0x20,0xc0,0x01,0x4a,0x01,0x0e,0x30,0xc0,0x3c,0x03,0x0e,0x30,0xc0,0x3c,0x03,0xc0,
+0x42,0x40,0xc0,0x40,0x01,0x42,0x40,0xc0,0x40,0x03,0x42,0x40,0xc0,0x40,0xc0,0x01,0x4a,0x03,0x1c,0x60,0x80,0x78,0x07,0x1c,0x60,0x80,0x78,0x07,0xc0,0x04,0x40,0x01,0x03,0x40,0x01,0xc0,
+0x82,0x80,0x01,0x82,0x80,0x03,0x82,0x80,0xc0,0x00,0x4c,0x01,0x06,0x38,0xc0,0x00,0xf1,0x0e,0x38,0xc0,0x00,0xf0,0x0e,0x01,0xc0,0x04,0x40,0x03,0x03,0x40,0x03,0xc0,
 // 'X'
- 88,14,11,11,0,0,36,8,19,0x38,0x38,0x00,0x10,0x10,0x00,0x08,0x20,0x00,0x04,0x40,0x00,0x02,0x80,0x00,0x01,0x00,0x00,0x02,0x80,0x00,0x04,0x40,0x00,0x08,0x20,0x00,0x10,0x10,0x00,0x38,0x38,0x00,0x00,0x00,0x00,
+12,2,11,8,11,0,
+0x01,0x03,0x05,0x88,0x50,0x20,0x50,0x88,0x05,0x03,0x01,0x04,0x06,0x05,0x00,0x00,0x00,0x00,0x00,0x05,0x06,0x04,
+0x02,0x06,0x0a,0x10,0xa0,0x40,0xa0,0x10,0x0a,0x06,0x02,0x08,0x0c,0x0a,0x01,0x00,0x00,0x00,0x01,0x0a,0x0c,0x08,
+0x04,0x0c,0x14,0x20,0x40,0x80,0x40,0x20,0x14,0x0c,0x04,0x10,0x18,0x14,0x02,0x01,0x00,0x01,0x02,0x14,0x18,0x10,
+0x08,0x18,0x28,0x40,0x80,0x00,0x80,0x40,0x28,0x18,0x08,0x20,0x30,0x28,0x04,0x02,0x01,0x02,0x04,0x28,0x30,0x20,
+0x10,0x30,0x50,0x80,0x00,0x00,0x00,0x80,0x50,0x30,0x10,0x40,0x60,0x50,0x08,0x05,0x02,0x05,0x08,0x50,0x60,0x40,
+0x20,0x60,0xa0,0x00,0x00,0x00,0x00,0x00,0xa0,0x60,0x20,0x80,0xc0,0xa0,0x11,0x0a,0x04,0x0a,0x11,0xa0,0xc0,0x80,
+0x40,0xc0,0x40,0x00,0x00,0x00,0x00,0x00,0x40,0xc0,0x40,0x00,0x80,0x41,0x22,0x14,0x08,0x14,0x22,0x41,0x80,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,
+0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x00,0x01,0x82,0x44,0x28,0x10,0x28,0x44,0x82,0x01,0x00,0x02,0x03,0x02,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x02,
 // 'Y'
- 89,14,11,11,0,0,36,8,19,0x38,0x38,0x00,0x10,0x10,0x00,0x08,0x20,0x00,0x04,0x40,0x00,0x04,0x40,0x00,0x02,0x80,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,
+12,2,11,8,11,2,
+0x4a,0x01,0x03,0x05,0x18,0x20,0xc0,0x20,0x18,0x05,0x03,0x01,0xc0,0x03,0x42,0x04,0x07,0x04,0xc0,
+0x4a,0x02,0x06,0x0a,0x30,0x40,0x80,0x40,0x30,0x0a,0x06,0x02,0xc0,0x03,0x42,0x08,0x0f,0x08,0xc0,
+0x4a,0x04,0x0c,0x14,0x60,0x80,0x00,0x80,0x60,0x14,0x0c,0x04,0xc0,0x03,0x42,0x10,0x1f,0x10,0xc0,
+0x43,0x08,0x18,0x28,0xc0,0x02,0x43,0xc0,0x28,0x18,0x08,0xc0,0x03,0x42,0x21,0x3e,0x21,0xc0,
+0x43,0x10,0x30,0x50,0x80,0x02,0x43,0x80,0x50,0x30,0x10,0xc0,0x02,0x44,0x01,0x42,0x7c,0x42,0x01,0xc0,
+0x42,0x20,0x60,0xa0,0x04,0x42,0xa0,0x60,0x20,0xc0,0x02,0x44,0x03,0x84,0xf8,0x84,0x03,0xc0,
+0x42,0x40,0xc0,0x40,0x04,0x42,0x40,0xc0,0x40,0xc0,0x01,0x46,0x01,0x06,0x08,0xf0,0x08,0x06,0x01,0xc0,0x03,0x82,0x01,0xc0,
+0x82,0x80,0x04,0x82,0x80,0xc0,0x00,0x48,0x01,0x02,0x0c,0x10,0xe0,0x10,0x0c,0x02,0x01,0xc0,0x03,0x42,0x02,0x03,0x02,0xc0,
 // 'Z'
- 90,12,9,11,0,0,36,8,19,0x3f,0xe0,0x00,0x20,0x40,0x00,0x20,0x80,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x10,0x20,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,
+10,2,9,8,11,0,
+0x07,0x01,0x81,0x41,0x21,0x19,0x05,0x03,0x01,0x04,0x06,0x05,0x04,0x04,0x04,0x04,0x04,0x02,
+0x0e,0x02,0x02,0x82,0x42,0x32,0x0a,0x06,0x02,0x08,0x0c,0x0b,0x08,0x08,0x08,0x08,0x08,0x04,
+0x1c,0x04,0x04,0x04,0x84,0x64,0x14,0x0c,0x04,0x10,0x18,0x16,0x11,0x10,0x10,0x10,0x10,0x08,
+0x38,0x08,0x08,0x08,0x08,0xc8,0x28,0x18,0x08,0x20,0x30,0x2c,0x22,0x21,0x20,0x20,0x20,0x10,
+0x70,0x10,0x10,0x10,0x10,0x90,0x50,0x30,0x10,0x40,0x60,0x58,0x44,0x42,0x41,0x40,0x40,0x20,
+0xe0,0x20,0x20,0x20,0x20,0x20,0xa0,0x60,0x20,0x80,0xc0,0xb0,0x88,0x84,0x83,0x80,0x80,0x40,
+0xc0,0x40,0x40,0x40,0x40,0x40,0x40,0xc0,0x40,0x01,0x80,0x60,0x10,0x08,0x06,0x01,0x00,0x80,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x01,0x00,
+0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x03,0x00,0xc0,0x20,0x10,0x0c,0x02,0x01,0x00,0x02,0x03,0x02,0x02,0x02,0x02,0x02,0x02,0x01,
 // 'bracketleft'
- 91,8,3,14,1,-3,45,8,22,0x1c,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,
+5,3,3,8,14,0,
+0xff,0x01,0x01,0x3f,0x20,0x20,
+0xfe,0x02,0x02,0x7f,0x40,0x40,
+0xfc,0x04,0x04,0xff,0x80,0x80,
+0xf8,0x08,0x08,0xff,0x00,0x00,0x01,0x01,0x01,
+0xf0,0x10,0x10,0xff,0x00,0x00,0x03,0x02,0x02,
+0xe0,0x20,0x20,0xff,0x00,0x00,0x07,0x04,0x04,
+0xc0,0x40,0x40,0xff,0x00,0x00,0x0f,0x08,0x08,
+0x80,0x80,0x80,0xff,0x00,0x00,0x1f,0x10,0x10,
 // 'backslash'
- 92,7,6,11,-1,0,36,8,19,0x40,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+6,1,6,8,11,2,
+0x44,0x01,0x06,0x18,0x60,0x80,0xc0,0x03,0x41,0x01,0x06,0xc0,
+0x43,0x02,0x0c,0x30,0xc0,0xc0,0x03,0x41,0x03,0x0c,0xc0,
+0x43,0x04,0x18,0x60,0x80,0xc0,0x02,0x42,0x01,0x06,0x18,0xc0,
+0x42,0x08,0x30,0xc0,0xc0,0x02,0x42,0x03,0x0c,0x30,0xc0,
+0x42,0x10,0x60,0x80,0xc0,0x01,0x43,0x01,0x06,0x18,0x60,0xc0,
+0x41,0x20,0xc0,0xc0,0x01,0x43,0x03,0x0c,0x30,0xc0,0xc0,
+0x41,0x40,0x80,0xc0,0x00,0x44,0x01,0x06,0x18,0x60,0x80,0xc0,0x04,0x40,0x01,0xc0,
+0x40,0x80,0xc0,0x00,0x43,0x03,0x0c,0x30,0xc0,0xc0,0x04,0x40,0x03,0xc0,
 // 'bracketright'
- 93,7,3,14,0,-3,45,8,22,0x38,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+5,2,3,8,14,0,
+0x01,0x01,0xff,0x20,0x20,0x3f,
+0x02,0x02,0xfe,0x40,0x40,0x7f,
+0x04,0x04,0xfc,0x80,0x80,0xff,
+0x08,0x08,0xf8,0x00,0x00,0xff,0x01,0x01,0x01,
+0x10,0x10,0xf0,0x00,0x00,0xff,0x02,0x02,0x03,
+0x20,0x20,0xe0,0x00,0x00,0xff,0x04,0x04,0x07,
+0x40,0x40,0xc0,0x00,0x00,0xff,0x08,0x08,0x0f,
+0x80,0x80,0x80,0x00,0x00,0xff,0x10,0x10,0x1f,
 // 'asciicircum'
- 94,10,7,7,0,4,24,8,15,0x04,0x00,0x00,0x0a,0x00,0x00,0x0a,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x00,0x00,0x00,
+8,2,7,8,7,0,
+0x60,0x18,0x06,0x01,0x06,0x18,0x60,
+0xc0,0x30,0x0c,0x02,0x0c,0x30,0xc0,
+0x80,0x60,0x18,0x04,0x18,0x60,0x80,0x01,0x00,0x00,0x00,0x00,0x00,0x01,
+0x00,0xc0,0x30,0x08,0x30,0xc0,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x03,
+0x00,0x80,0x60,0x10,0x60,0x80,0x00,0x06,0x01,0x00,0x00,0x00,0x01,0x06,
+0x00,0x00,0xc0,0x20,0xc0,0x00,0x00,0x0c,0x03,0x00,0x00,0x00,0x03,0x0c,
+0x00,0x00,0x80,0x40,0x80,0x00,0x00,0x18,0x06,0x01,0x00,0x01,0x06,0x18,
+0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x30,0x0c,0x03,0x00,0x03,0x0c,0x30,
 // 'underscore'
- 95,10,8,1,0,-2,6,20,21,0x3f,0xc0,0x00,0x00,0x00,0x00,
+8,2,8,20,1,2,
+0x87,0x10,0xc0,
+0x87,0x20,0xc0,
+0x87,0x40,0xc0,
+0x87,0x80,0xc0,
+0x87,0x01,0xc0,
+0x87,0x02,0xc0,
+0x87,0x04,0xc0,
+0x87,0x08,0xc0,
 // 'grave'
- 96,9,3,3,1,8,12,8,11,0x10,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+6,3,3,8,3,0,
+0x01,0x02,0x04,
+0x02,0x04,0x08,
+0x04,0x08,0x10,
+0x08,0x10,0x20,
+0x10,0x20,0x40,
+0x20,0x40,0x80,
+0x40,0x80,0x00,0x00,0x00,0x01,
+0x80,0x00,0x00,0x00,0x01,0x02,
 // 'a'
- 97,10,7,8,1,0,27,11,19,0x0e,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x07,0x00,0x00,0x19,0x00,0x00,0x11,0x00,0x00,0x13,0x40,0x00,0x0d,0x80,0x00,0x00,0x00,0x00,
+7,3,7,11,8,0,
+0xb0,0x88,0x48,0x48,0xf0,0x00,0x00,0x03,0x04,0x04,0x02,0x07,0x04,0x02,
+0x60,0x10,0x90,0x90,0xe0,0x00,0x00,0x07,0x09,0x08,0x04,0x0f,0x08,0x04,
+0xc0,0x20,0x20,0x20,0xc0,0x00,0x00,0x0e,0x12,0x11,0x09,0x1f,0x10,0x08,
+0x80,0x40,0x40,0x40,0x80,0x00,0x00,0x1d,0x24,0x22,0x12,0x3f,0x20,0x10,
+0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x3b,0x48,0x44,0x24,0x7f,0x40,0x20,
+0x76,0x91,0x89,0x49,0xfe,0x80,0x40,
+0xec,0x22,0x12,0x92,0xfc,0x00,0x80,0x00,0x01,0x01,0x00,0x01,0x01,0x00,
+0xd8,0x44,0x24,0x24,0xf8,0x00,0x00,0x01,0x02,0x02,0x01,0x03,0x02,0x01,
 // 'b'
- 98,10,7,11,0,0,36,8,19,0x10,0x00,0x00,0x30,0x00,0x00,0x10,0x00,0x00,0x17,0x00,0x00,0x19,0x00,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x19,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,11,0,
+0x02,0xff,0x10,0x08,0x08,0x18,0xe0,0x00,0x03,0x06,0x04,0x04,0x02,0x01,
+0x04,0xfe,0x20,0x10,0x10,0x30,0xc0,0x00,0x07,0x0c,0x08,0x08,0x04,0x03,
+0x08,0xfc,0x40,0x20,0x20,0x60,0x80,0x00,0x0f,0x18,0x10,0x10,0x08,0x07,
+0x10,0xf8,0x80,0x40,0x40,0xc0,0x00,0x00,0x1f,0x30,0x20,0x20,0x10,0x0f,
+0x20,0xf0,0x00,0x80,0x80,0x80,0x00,0x00,0x3f,0x61,0x40,0x40,0x21,0x1e,
+0x40,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xc2,0x81,0x81,0x43,0x3c,
+0x80,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x84,0x02,0x02,0x86,0x78,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x08,0x04,0x04,0x0c,0xf0,0x00,0x01,0x03,0x02,0x02,0x01,0x00,
 // 'c'
- 99,9,6,8,0,0,27,11,19,0x0e,0x00,0x00,0x11,0x00,0x00,0x21,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+7,2,6,11,8,0,
+0xe0,0x10,0x08,0x08,0x08,0x30,0x01,0x02,0x04,0x04,0x04,0x02,
+0xc0,0x20,0x10,0x10,0x10,0x60,0x03,0x04,0x08,0x08,0x08,0x04,
+0x80,0x40,0x20,0x20,0x20,0xc0,0x07,0x08,0x10,0x10,0x10,0x08,
+0x00,0x80,0x40,0x40,0x40,0x80,0x0f,0x10,0x20,0x20,0x20,0x11,
+0x00,0x00,0x80,0x80,0x80,0x00,0x1e,0x21,0x40,0x40,0x40,0x23,
+0x3c,0x42,0x81,0x81,0x81,0x46,
+0x78,0x84,0x02,0x02,0x02,0x8c,0x00,0x00,0x01,0x01,0x01,0x00,
+0xf0,0x08,0x04,0x04,0x04,0x18,0x00,0x01,0x02,0x02,0x02,0x01,
 // 'd'
-100,10,7,11,0,0,36,8,19,0x01,0x00,0x00,0x03,0x00,0x00,0x01,0x00,0x00,0x0d,0x00,0x00,0x13,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x13,0x80,0x00,0x0d,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,11,0,
+0xe0,0x10,0x08,0x08,0x12,0xff,0x00,0x01,0x02,0x04,0x04,0x02,0x07,0x02,
+0xc0,0x20,0x10,0x10,0x24,0xfe,0x00,0x03,0x04,0x08,0x08,0x04,0x0f,0x04,
+0x80,0x40,0x20,0x20,0x48,0xfc,0x00,0x07,0x08,0x10,0x10,0x08,0x1f,0x08,
+0x00,0x80,0x40,0x40,0x90,0xf8,0x00,0x0f,0x10,0x20,0x20,0x10,0x3f,0x10,
+0x00,0x00,0x80,0x80,0x20,0xf0,0x00,0x1e,0x21,0x40,0x40,0x21,0x7f,0x20,
+0x00,0x00,0x00,0x00,0x40,0xe0,0x00,0x3c,0x42,0x81,0x81,0x42,0xff,0x40,
+0x00,0x00,0x00,0x00,0x80,0xc0,0x00,0x78,0x84,0x02,0x02,0x84,0xff,0x80,0x00,0x00,0x01,0x01,0x00,0x01,0x00,
+0x00,0x00,0x00,0x00,0x00,0x80,0x00,0xf0,0x08,0x04,0x04,0x09,0xff,0x00,0x00,0x01,0x02,0x02,0x01,0x03,0x01,
 // 'e'
-101,9,6,8,0,0,27,11,19,0x0e,0x00,0x00,0x11,0x00,0x00,0x21,0x00,0x00,0x3f,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+7,2,6,11,8,0,
+0xe0,0x50,0x48,0x48,0x48,0x70,0x01,0x02,0x04,0x04,0x04,0x02,
+0xc0,0xa0,0x90,0x90,0x90,0xe0,0x03,0x04,0x08,0x08,0x08,0x04,
+0x80,0x40,0x20,0x20,0x20,0xc0,0x07,0x09,0x11,0x11,0x11,0x09,
+0x00,0x80,0x40,0x40,0x40,0x80,0x0f,0x12,0x22,0x22,0x22,0x13,
+0x00,0x00,0x80,0x80,0x80,0x00,0x1e,0x25,0x44,0x44,0x44,0x27,
+0x3c,0x4a,0x89,0x89,0x89,0x4e,
+0x78,0x94,0x12,0x12,0x12,0x9c,0x00,0x00,0x01,0x01,0x01,0x00,
+0xf0,0x28,0x24,0x24,0x24,0x38,0x00,0x01,0x02,0x02,0x02,0x01,
 // 'f'
-102,9,5,11,1,0,36,8,19,0x06,0x00,0x00,0x09,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x1e,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,
+6,3,5,8,11,0,
+0x10,0xfe,0x11,0x11,0x02,0x04,0x07,0x04,0x04,0x00,
+0x20,0xfc,0x22,0x22,0x04,0x08,0x0f,0x08,0x08,0x00,
+0x40,0xf8,0x44,0x44,0x08,0x10,0x1f,0x10,0x10,0x00,
+0x80,0xf0,0x88,0x88,0x10,0x20,0x3f,0x20,0x20,0x00,
+0x00,0xe0,0x10,0x10,0x20,0x41,0x7f,0x41,0x41,0x00,
+0x00,0xc0,0x20,0x20,0x40,0x82,0xff,0x82,0x82,0x00,
+0x00,0x80,0x40,0x40,0x80,0x04,0xff,0x04,0x04,0x00,0x01,0x01,0x01,0x01,0x00,
+0x00,0x00,0x80,0x80,0x00,0x08,0xff,0x08,0x08,0x01,0x02,0x03,0x02,0x02,0x00,
 // 'g'
-103,10,7,12,0,-4,39,11,23,0x0d,0x80,0x00,0x13,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x12,0x00,0x00,0x1c,0x00,0x00,0x20,0x00,0x00,0x1f,0x00,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x31,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,11,12,0,
+0x60,0x90,0x08,0x08,0x90,0x78,0x08,0x3a,0x65,0x45,0x45,0x44,0x24,0x18,
+0xc0,0x20,0x10,0x10,0x20,0xf0,0x10,0x74,0xcb,0x8a,0x8a,0x89,0x48,0x30,
+0x80,0x40,0x20,0x20,0x40,0xe0,0x20,0xe9,0x96,0x14,0x14,0x12,0x91,0x60,0x00,0x01,0x01,0x01,0x01,0x00,0x00,
+0x00,0x80,0x40,0x40,0x80,0xc0,0x40,0xd3,0x2c,0x28,0x28,0x24,0x23,0xc0,0x01,0x03,0x02,0x02,0x02,0x01,0x00,
+0x00,0x00,0x80,0x80,0x00,0x80,0x80,0xa6,0x59,0x50,0x50,0x49,0x47,0x80,0x03,0x06,0x04,0x04,0x04,0x02,0x01,
+0x4c,0xb2,0xa1,0xa1,0x92,0x8f,0x01,0x07,0x0c,0x08,0x08,0x08,0x04,0x03,
+0x98,0x64,0x42,0x42,0x24,0x1e,0x02,0x0e,0x19,0x11,0x11,0x11,0x09,0x06,
+0x30,0xc8,0x84,0x84,0x48,0x3c,0x04,0x1d,0x32,0x22,0x22,0x22,0x12,0x0c,
 // 'h'
-104,10,8,11,0,0,36,8,19,0x10,0x00,0x00,0x30,0x00,0x00,0x10,0x00,0x00,0x17,0x00,0x00,0x19,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x39,0xc0,0x00,0x00,0x00,0x00,
+8,2,8,8,11,0,
+0x02,0xff,0x10,0x08,0x08,0x18,0xf0,0x00,0x04,0x07,0x04,0x00,0x00,0x04,0x07,0x04,
+0x04,0xfe,0x20,0x10,0x10,0x30,0xe0,0x00,0x08,0x0f,0x08,0x00,0x00,0x08,0x0f,0x08,
+0x08,0xfc,0x40,0x20,0x20,0x60,0xc0,0x00,0x10,0x1f,0x10,0x00,0x00,0x10,0x1f,0x10,
+0x10,0xf8,0x80,0x40,0x40,0xc0,0x80,0x00,0x20,0x3f,0x20,0x00,0x00,0x20,0x3f,0x20,
+0x20,0xf0,0x00,0x80,0x80,0x80,0x00,0x00,0x40,0x7f,0x41,0x00,0x00,0x41,0x7f,0x40,
+0x40,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0x82,0x01,0x01,0x83,0xfe,0x80,
+0x80,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x04,0x02,0x02,0x06,0xfc,0x00,0x01,0x01,0x01,0x00,0x00,0x01,0x01,0x01,
+0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x08,0x04,0x04,0x0c,0xf8,0x00,0x02,0x03,0x02,0x00,0x00,0x02,0x03,0x02,
 // 'i'
-105,8,3,11,1,0,36,8,19,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,
+5,3,3,8,11,0,
+0x10,0xfb,0x00,0x04,0x07,0x04,
+0x20,0xf6,0x00,0x08,0x0f,0x08,
+0x40,0xec,0x00,0x10,0x1f,0x10,
+0x80,0xd8,0x00,0x20,0x3f,0x20,
+0x00,0xb0,0x00,0x41,0x7f,0x40,
+0x00,0x60,0x00,0x82,0xff,0x80,
+0x00,0xc0,0x00,0x04,0xfe,0x00,0x01,0x01,0x01,
+0x00,0x80,0x00,0x08,0xfd,0x00,0x02,0x03,0x02,
 // 'j'
-106,6,3,15,0,-4,48,8,23,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x28,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
+4,2,3,8,15,0,
+0x00,0x10,0xfb,0x60,0x40,0x3f,
+0x00,0x20,0xf6,0xc0,0x80,0x7f,
+0x00,0x40,0xec,0x80,0x00,0xff,0x01,0x01,0x00,
+0x00,0x80,0xd8,0x00,0x00,0xff,0x03,0x02,0x01,
+0x00,0x00,0xb0,0x00,0x01,0xff,0x06,0x04,0x03,
+0x00,0x00,0x60,0x00,0x02,0xff,0x0c,0x08,0x07,
+0x00,0x00,0xc0,0x00,0x04,0xfe,0x18,0x10,0x0f,
+0x00,0x00,0x80,0x00,0x08,0xfd,0x30,0x20,0x1f,
 // 'k'
-107,11,7,11,1,0,36,8,19,0x08,0x00,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x0b,0x80,0x00,0x09,0x00,0x00,0x0a,0x00,0x00,0x0c,0x00,0x00,0x0a,0x00,0x00,0x09,0x00,0x00,0x08,0x80,0x00,0x1d,0xc0,0x00,0x00,0x00,0x00,
+8,3,7,8,11,0,
+0x02,0xff,0x40,0xa8,0x18,0x08,0x00,0x04,0x07,0x04,0x00,0x05,0x06,0x04,
+0x04,0xfe,0x80,0x50,0x30,0x10,0x00,0x08,0x0f,0x08,0x01,0x0a,0x0c,0x08,
+0x08,0xfc,0x00,0xa0,0x60,0x20,0x00,0x10,0x1f,0x11,0x02,0x14,0x18,0x10,
+0x10,0xf8,0x00,0x40,0xc0,0x40,0x00,0x20,0x3f,0x22,0x05,0x28,0x30,0x20,
+0x20,0xf0,0x00,0x80,0x80,0x80,0x00,0x40,0x7f,0x44,0x0a,0x51,0x60,0x40,
+0x40,0xe0,0x00,0x00,0x00,0x00,0x00,0x80,0xff,0x88,0x15,0xa3,0xc1,0x80,
+0x80,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x10,0x2a,0x46,0x82,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x01,
+0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x20,0x54,0x8c,0x04,0x00,0x02,0x03,0x02,0x00,0x02,0x03,0x02,
 // 'l'
-108,8,3,11,1,0,36,8,19,0x08,0x00,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,
+5,3,3,8,11,0,
+0x02,0xff,0x00,0x04,0x07,0x04,
+0x04,0xfe,0x00,0x08,0x0f,0x08,
+0x08,0xfc,0x00,0x10,0x1f,0x10,
+0x10,0xf8,0x00,0x20,0x3f,0x20,
+0x20,0xf0,0x00,0x40,0x7f,0x40,
+0x40,0xe0,0x00,0x80,0xff,0x80,
+0x80,0xc0,0x00,0x00,0xff,0x00,0x01,0x01,0x01,
+0x00,0x80,0x00,0x01,0xff,0x00,0x02,0x03,0x02,
 // 'm'
-109,16,11,8,1,0,27,11,19,0x0b,0x30,0x00,0x1c,0xc8,0x00,0x08,0x88,0x00,0x08,0x88,0x00,0x08,0x88,0x00,0x08,0x88,0x00,0x08,0x88,0x00,0x1d,0xdc,0x00,0x00,0x00,0x00,
+13,3,11,11,8,0,
+0x10,0xf8,0x10,0x08,0x08,0xf0,0x10,0x08,0x08,0xf0,0x00,0x04,0x07,0x04,0x00,0x04,0x07,0x04,0x00,0x04,0x07,0x04,
+0x20,0xf0,0x20,0x10,0x10,0xe0,0x20,0x10,0x10,0xe0,0x00,0x08,0x0f,0x08,0x00,0x08,0x0f,0x08,0x00,0x08,0x0f,0x08,
+0x40,0xe0,0x40,0x20,0x20,0xc0,0x40,0x20,0x20,0xc0,0x00,0x10,0x1f,0x10,0x00,0x10,0x1f,0x10,0x00,0x10,0x1f,0x10,
+0x80,0xc0,0x80,0x40,0x40,0x80,0x80,0x40,0x40,0x80,0x00,0x20,0x3f,0x20,0x00,0x20,0x3f,0x20,0x00,0x20,0x3f,0x20,
+0x00,0x80,0x00,0x80,0x80,0x00,0x00,0x80,0x80,0x00,0x00,0x41,0x7f,0x41,0x00,0x40,0x7f,0x41,0x00,0x40,0x7f,0x40,
+0x82,0xff,0x82,0x01,0x81,0xfe,0x82,0x01,0x81,0xfe,0x80,
+0x04,0xfe,0x04,0x02,0x02,0xfc,0x04,0x02,0x02,0xfc,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x01,0x00,0x01,0x01,0x01,
+0x08,0xfc,0x08,0x04,0x04,0xf8,0x08,0x04,0x04,0xf8,0x00,0x02,0x03,0x02,0x00,0x02,0x03,0x02,0x00,0x02,0x03,0x02,
 // 'n'
-110,10,8,8,0,0,27,11,19,0x17,0x00,0x00,0x39,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x39,0xc0,0x00,0x00,0x00,0x00,
+8,2,8,11,8,0,
+0x10,0xf8,0x10,0x08,0x08,0x18,0xf0,0x00,0x04,0x07,0x04,0x00,0x00,0x04,0x07,0x04,
+0x20,0xf0,0x20,0x10,0x10,0x30,0xe0,0x00,0x08,0x0f,0x08,0x00,0x00,0x08,0x0f,0x08,
+0x40,0xe0,0x40,0x20,0x20,0x60,0xc0,0x00,0x10,0x1f,0x10,0x00,0x00,0x10,0x1f,0x10,
+0x80,0xc0,0x80,0x40,0x40,0xc0,0x80,0x00,0x20,0x3f,0x20,0x00,0x00,0x20,0x3f,0x20,
+0x00,0x80,0x00,0x80,0x80,0x80,0x00,0x00,0x41,0x7f,0x41,0x00,0x00,0x41,0x7f,0x40,
+0x82,0xff,0x82,0x01,0x01,0x83,0xfe,0x80,
+0x04,0xfe,0x04,0x02,0x02,0x06,0xfc,0x00,0x01,0x01,0x01,0x00,0x00,0x01,0x01,0x01,
+0x08,0xfc,0x08,0x04,0x04,0x0c,0xf8,0x00,0x02,0x03,0x02,0x00,0x00,0x02,0x03,0x02,
 // 'o'
-111,10,7,8,0,0,27,11,19,0x0e,0x00,0x00,0x11,0x00,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,11,8,0,
+0xe0,0x10,0x08,0x08,0x08,0x10,0xe0,0x01,0x02,0x04,0x04,0x04,0x02,0x01,
+0xc0,0x20,0x10,0x10,0x10,0x20,0xc0,0x03,0x04,0x08,0x08,0x08,0x04,0x03,
+0x80,0x40,0x20,0x20,0x20,0x40,0x80,0x07,0x08,0x10,0x10,0x10,0x08,0x07,
+0x00,0x80,0x40,0x40,0x40,0x80,0x00,0x0f,0x10,0x20,0x20,0x20,0x10,0x0f,
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x1e,0x21,0x40,0x40,0x40,0x21,0x1e,
+0x3c,0x42,0x81,0x81,0x81,0x42,0x3c,
+0x78,0x84,0x02,0x02,0x02,0x84,0x78,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0xf0,0x08,0x04,0x04,0x04,0x08,0xf0,0x00,0x01,0x02,0x02,0x02,0x01,0x00,
 // 'p'
-112,10,7,12,0,-4,39,11,23,0x17,0x00,0x00,0x39,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x18,0x80,0x00,0x17,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+8,2,7,11,12,0,
+0x10,0xf8,0x10,0x08,0x08,0x18,0xf0,0x40,0x7f,0x42,0x04,0x04,0x04,0x03,
+0x20,0xf0,0x20,0x10,0x10,0x30,0xe0,0x80,0xff,0x84,0x08,0x08,0x08,0x07,
+0x40,0xe0,0x40,0x20,0x20,0x60,0xc0,0x00,0xff,0x08,0x10,0x10,0x10,0x0f,0x01,0x01,0x01,0x00,0x00,0x00,0x00,
+0x80,0xc0,0x80,0x40,0x40,0xc0,0x80,0x00,0xff,0x10,0x20,0x20,0x20,0x1f,0x02,0x03,0x02,0x00,0x00,0x00,0x00,
+0x00,0x80,0x00,0x80,0x80,0x80,0x00,0x01,0xff,0x21,0x40,0x40,0x41,0x3f,0x04,0x07,0x04,0x00,0x00,0x00,0x00,
+0x02,0xff,0x42,0x81,0x81,0x83,0x7e,0x08,0x0f,0x08,0x00,0x00,0x00,0x00,
+0x04,0xfe,0x84,0x02,0x02,0x06,0xfc,0x10,0x1f,0x10,0x01,0x01,0x01,0x00,
+0x08,0xfc,0x08,0x04,0x04,0x0c,0xf8,0x20,0x3f,0x21,0x02,0x02,0x02,0x01,
 // 'q'
-113,11,7,12,1,-4,39,11,23,0x0e,0x80,0x00,0x19,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x19,0x80,0x00,0x0e,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,
+8,3,7,11,12,0,
+0xf0,0x18,0x08,0x08,0x10,0xf8,0x00,0x03,0x06,0x04,0x04,0x42,0x7f,0x40,
+0xe0,0x30,0x10,0x10,0x20,0xf0,0x00,0x07,0x0c,0x08,0x08,0x84,0xff,0x80,
+0xc0,0x60,0x20,0x20,0x40,0xe0,0x00,0x0f,0x18,0x10,0x10,0x08,0xff,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,
+0x80,0xc0,0x40,0x40,0x80,0xc0,0x00,0x1f,0x30,0x20,0x20,0x10,0xff,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x02,
+0x00,0x80,0x80,0x80,0x00,0x80,0x00,0x3f,0x61,0x40,0x40,0x21,0xff,0x00,0x00,0x00,0x00,0x00,0x04,0x07,0x04,
+0x7e,0xc3,0x81,0x81,0x42,0xff,0x00,0x00,0x00,0x00,0x00,0x08,0x0f,0x08,
+0xfc,0x86,0x02,0x02,0x84,0xfe,0x00,0x00,0x01,0x01,0x01,0x10,0x1f,0x10,
+0xf8,0x0c,0x04,0x04,0x08,0xfc,0x00,0x01,0x03,0x02,0x02,0x21,0x3f,0x20,
 // 'r'
-114,8,5,8,0,0,27,11,19,0x16,0x00,0x00,0x3a,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+6,2,5,11,8,0,
+0x10,0xf8,0x10,0x08,0x18,0x04,0x07,0x04,0x00,0x00,
+0x20,0xf0,0x20,0x10,0x30,0x08,0x0f,0x08,0x00,0x00,
+0x40,0xe0,0x40,0x20,0x60,0x10,0x1f,0x10,0x00,0x00,
+0x80,0xc0,0x80,0x40,0xc0,0x20,0x3f,0x20,0x00,0x00,
+0x00,0x80,0x00,0x80,0x80,0x41,0x7f,0x41,0x00,0x01,
+0x82,0xff,0x82,0x01,0x03,
+0x04,0xfe,0x04,0x02,0x06,0x01,0x01,0x01,0x00,0x00,
+0x08,0xfc,0x08,0x04,0x0c,0x02,0x03,0x02,0x00,0x00,
 // 's'
-115,8,5,8,0,0,27,11,19,0x1e,0x00,0x00,0x22,0x00,0x00,0x20,0x00,0x00,0x1c,0x00,0x00,0x02,0x00,0x00,0x22,0x00,0x00,0x32,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x00,
+6,2,5,11,8,0,
+0x30,0x48,0x48,0x48,0x98,0x07,0x02,0x04,0x04,0x03,
+0x60,0x90,0x90,0x90,0x30,0x0e,0x04,0x08,0x08,0x07,
+0xc0,0x20,0x20,0x20,0x60,0x1c,0x09,0x11,0x11,0x0e,
+0x80,0x40,0x40,0x40,0xc0,0x39,0x12,0x22,0x22,0x1c,
+0x00,0x80,0x80,0x80,0x80,0x73,0x24,0x44,0x44,0x39,
+0xe6,0x49,0x89,0x89,0x73,
+0xcc,0x92,0x12,0x12,0xe6,0x01,0x00,0x01,0x01,0x00,
+0x98,0x24,0x24,0x24,0xcc,0x03,0x01,0x02,0x02,0x01,
 // 't'
-116,7,4,10,0,0,33,9,19,0x10,0x00,0x00,0x10,0x00,0x00,0x3c,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x14,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,
+5,2,4,9,10,0,
+0x08,0xfe,0x08,0x08,0x00,0x03,0x04,0x02,
+0x10,0xfc,0x10,0x10,0x00,0x07,0x08,0x04,
+0x20,0xf8,0x20,0x20,0x00,0x0f,0x10,0x08,
+0x40,0xf0,0x40,0x40,0x00,0x1f,0x20,0x10,
+0x80,0xe0,0x80,0x80,0x00,0x3f,0x40,0x20,
+0x00,0xc0,0x00,0x00,0x01,0x7f,0x81,0x41,
+0x00,0x80,0x00,0x00,0x02,0xff,0x02,0x82,0x00,0x00,0x01,0x00,
+0x04,0xff,0x04,0x04,0x00,0x01,0x02,0x01,
 // 'u'
-117,10,8,8,0,0,27,11,19,0x31,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x11,0xc0,0x00,0x0e,0x80,0x00,0x00,0x00,0x00,
+8,2,8,11,8,0,
+0x08,0xf8,0x00,0x00,0x00,0x08,0xf8,0x00,0x00,0x03,0x04,0x04,0x04,0x02,0x07,0x02,
+0x10,0xf0,0x00,0x00,0x00,0x10,0xf0,0x00,0x00,0x07,0x08,0x08,0x08,0x04,0x0f,0x04,
+0x20,0xe0,0x00,0x00,0x00,0x20,0xe0,0x00,0x00,0x0f,0x10,0x10,0x10,0x08,0x1f,0x08,
+0x40,0xc0,0x00,0x00,0x00,0x40,0xc0,0x00,0x00,0x1f,0x20,0x20,0x20,0x10,0x3f,0x10,
+0x80,0x80,0x00,0x00,0x00,0x80,0x80,0x00,0x00,0x3f,0x40,0x40,0x40,0x20,0x7f,0x20,
+0x01,0x7f,0x80,0x80,0x80,0x41,0xff,0x40,
+0x02,0xfe,0x00,0x00,0x00,0x82,0xfe,0x80,0x00,0x00,0x01,0x01,0x01,0x00,0x01,0x00,
+0x04,0xfc,0x00,0x00,0x00,0x04,0xfc,0x00,0x00,0x01,0x02,0x02,0x02,0x01,0x03,0x01,
 // 'v'
-118,10,8,8,0,0,27,11,19,0x39,0xc0,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x09,0x00,0x00,0x09,0x00,0x00,0x05,0x00,0x00,0x06,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,
+8,2,8,11,8,0,
+0x08,0x38,0xc8,0x00,0x00,0xc8,0x38,0x08,0x00,0x00,0x00,0x03,0x06,0x01,0x00,0x00,
+0x10,0x70,0x90,0x00,0x00,0x90,0x70,0x10,0x00,0x00,0x01,0x06,0x0c,0x03,0x00,0x00,
+0x20,0xe0,0x20,0x00,0x00,0x20,0xe0,0x20,0x00,0x00,0x03,0x0c,0x18,0x07,0x00,0x00,
+0x40,0xc0,0x40,0x00,0x00,0x40,0xc0,0x40,0x00,0x01,0x06,0x18,0x30,0x0e,0x01,0x00,
+0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x80,0x00,0x03,0x0c,0x30,0x60,0x1c,0x03,0x00,
+0x01,0x07,0x19,0x60,0xc0,0x39,0x07,0x01,
+0x02,0x0e,0x32,0xc0,0x80,0x72,0x0e,0x02,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,
+0x04,0x1c,0x64,0x80,0x00,0xe4,0x1c,0x04,0x00,0x00,0x00,0x01,0x03,0x00,0x00,0x00,
 // 'w'
-119,14,12,8,0,0,27,11,19,0x3b,0x9c,0x00,0x11,0x08,0x00,0x11,0x08,0x00,0x08,0x90,0x00,0x08,0x90,0x00,0x05,0x50,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x00,0x00,0x00,
+12,2,12,11,8,2,
+0x46,0x08,0x38,0xc8,0x00,0x08,0x38,0xc8,0x01,0x42,0xc8,0x38,0x08,0xc0,0x02,0x46,0x01,0x06,0x01,0x00,0x01,0x06,0x01,0xc0,
+0x46,0x10,0x70,0x90,0x00,0x10,0x70,0x90,0x01,0x42,0x90,0x70,0x10,0xc0,0x01,0x47,0x01,0x02,0x0c,0x02,0x01,0x02,0x0c,0x03,0xc0,
+0x46,0x20,0xe0,0x20,0x00,0x20,0xe0,0x20,0x01,0x42,0x20,0xe0,0x20,0xc0,0x01,0x47,0x03,0x04,0x18,0x04,0x03,0x04,0x18,0x07,0xc0,
+0x46,0x40,0xc0,0x40,0x00,0x40,0xc0,0x40,0x01,0x42,0x40,0xc0,0x40,0xc0,0x00,0x49,0x01,0x06,0x08,0x30,0x09,0x06,0x08,0x30,0x0e,0x01,0xc0,
+0x82,0x80,0x00,0x82,0x80,0x01,0x82,0x80,0xc0,0x00,0x49,0x03,0x0c,0x10,0x60,0x13,0x0c,0x10,0x60,0x1c,0x03,0xc0,
+0x4b,0x01,0x07,0x19,0x20,0xc1,0x27,0x19,0x20,0xc0,0x39,0x07,0x01,0xc0,
+0x4b,0x02,0x0e,0x32,0x40,0x82,0x4e,0x32,0x40,0x80,0x72,0x0e,0x02,0xc0,0x03,0x40,0x01,0x02,0x40,0x01,0xc0,
+0x4b,0x04,0x1c,0x64,0x80,0x04,0x9c,0x64,0x80,0x00,0xe4,0x1c,0x04,0xc0,0x03,0x40,0x03,0x02,0x40,0x03,0xc0,
 // 'x'
-120,10,7,8,0,0,27,11,19,0x3b,0x80,0x00,0x11,0x00,0x00,0x0a,0x00,0x00,0x04,0x00,0x00,0x0a,0x00,0x00,0x0a,0x00,0x00,0x11,0x00,0x00,0x3b,0x80,0x00,0x00,0x00,0x00,
+8,2,7,11,8,0,
+0x08,0x18,0xa8,0x40,0xa8,0x18,0x08,0x04,0x06,0x05,0x00,0x05,0x06,0x04,
+0x10,0x30,0x50,0x80,0x50,0x30,0x10,0x08,0x0c,0x0b,0x00,0x0b,0x0c,0x08,
+0x20,0x60,0xa0,0x00,0xa0,0x60,0x20,0x10,0x18,0x16,0x01,0x16,0x18,0x10,
+0x40,0xc0,0x40,0x00,0x40,0xc0,0x40,0x20,0x30,0x2d,0x02,0x2d,0x30,0x20,
+0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x40,0x61,0x5a,0x04,0x5a,0x61,0x40,
+0x81,0xc3,0xb5,0x08,0xb5,0xc3,0x81,
+0x02,0x86,0x6a,0x10,0x6a,0x86,0x02,0x01,0x01,0x01,0x00,0x01,0x01,0x01,
+0x04,0x0c,0xd4,0x20,0xd4,0x0c,0x04,0x02,0x03,0x02,0x00,0x02,0x03,0x02,
 // 'y'
-121,10,8,12,0,-4,39,11,23,0x3d,0xc0,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x09,0x00,0x00,0x09,0x00,0x00,0x05,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x28,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
+8,2,8,11,12,0,
+0x08,0x38,0xc8,0x08,0x00,0xc8,0x38,0x08,0x60,0x40,0x20,0x19,0x06,0x01,0x00,0x00,
+0x10,0x70,0x90,0x10,0x00,0x90,0x70,0x10,0xc0,0x80,0x41,0x32,0x0c,0x03,0x00,0x00,
+0x20,0xe0,0x20,0x20,0x00,0x20,0xe0,0x20,0x80,0x00,0x83,0x64,0x18,0x07,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x40,0xc0,0x40,0x40,0x00,0x40,0xc0,0x40,0x00,0x01,0x06,0xc8,0x30,0x0e,0x01,0x00,0x03,0x02,0x01,0x00,0x00,0x00,0x00,0x00,
+0x80,0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x03,0x0c,0x90,0x60,0x1c,0x03,0x00,0x06,0x04,0x02,0x01,0x00,0x00,0x00,0x00,
+0x01,0x07,0x19,0x21,0xc0,0x39,0x07,0x01,0x0c,0x08,0x04,0x03,0x00,0x00,0x00,0x00,
+0x02,0x0e,0x32,0x42,0x80,0x72,0x0e,0x02,0x18,0x10,0x08,0x06,0x01,0x00,0x00,0x00,
+0x04,0x1c,0x64,0x84,0x00,0xe4,0x1c,0x04,0x30,0x20,0x10,0x0c,0x03,0x00,0x00,0x00,
 // 'z'
-122,9,6,8,0,0,27,11,19,0x3f,0x00,0x00,0x21,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x21,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,
+7,2,6,11,8,0,
+0x18,0x08,0x88,0x48,0x28,0x18,0x06,0x05,0x04,0x04,0x04,0x06,
+0x30,0x10,0x10,0x90,0x50,0x30,0x0c,0x0a,0x09,0x08,0x08,0x0c,
+0x60,0x20,0x20,0x20,0xa0,0x60,0x18,0x14,0x12,0x11,0x10,0x18,
+0xc0,0x40,0x40,0x40,0x40,0xc0,0x30,0x28,0x24,0x22,0x21,0x30,
+0x80,0x80,0x80,0x80,0x80,0x80,0x61,0x50,0x48,0x44,0x42,0x61,
+0xc3,0xa1,0x91,0x89,0x85,0xc3,
+0x86,0x42,0x22,0x12,0x0a,0x86,0x01,0x01,0x01,0x01,0x01,0x01,
+0x0c,0x84,0x44,0x24,0x14,0x0c,0x03,0x02,0x02,0x02,0x02,0x03,
 // 'braceleft'
-123,12,4,14,2,-3,45,8,22,0x03,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+8,4,4,8,14,0,
+0x40,0xbe,0x01,0x01,0x00,0x1f,0x20,0x20,
+0x80,0x7c,0x02,0x02,0x00,0x3f,0x40,0x40,
+0x00,0xf8,0x04,0x04,0x01,0x7e,0x80,0x80,
+0x00,0xf0,0x08,0x08,0x02,0xfd,0x00,0x00,0x00,0x00,0x01,0x01,
+0x00,0xe0,0x10,0x10,0x04,0xfb,0x00,0x00,0x00,0x01,0x02,0x02,
+0x00,0xc0,0x20,0x20,0x08,0xf7,0x00,0x00,0x00,0x03,0x04,0x04,
+0x00,0x80,0x40,0x40,0x10,0xef,0x00,0x00,0x00,0x07,0x08,0x08,
+0x00,0x00,0x80,0x80,0x20,0xdf,0x00,0x00,0x00,0x0f,0x10,0x10,
 // 'bar'
-124,5,1,11,0,0,36,8,19,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
+3,2,1,8,11,0,
+0xff,0x07,
+0xfe,0x0f,
+0xfc,0x1f,
+0xf8,0x3f,
+0xf0,0x7f,
+0xe0,0xff,
+0xc0,0xff,0x01,
+0x80,0xff,0x03,
 // 'braceright'
-125,10,4,14,0,-3,45,8,22,0x30,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,
+8,2,4,8,14,0,
+0x01,0x01,0xbe,0x40,0x20,0x20,0x1f,0x00,
+0x02,0x02,0x7c,0x80,0x40,0x40,0x3f,0x00,
+0x04,0x04,0xf8,0x00,0x80,0x80,0x7e,0x01,
+0x08,0x08,0xf0,0x00,0x00,0x00,0xfd,0x02,0x01,0x01,0x00,0x00,
+0x10,0x10,0xe0,0x00,0x00,0x00,0xfb,0x04,0x02,0x02,0x01,0x00,
+0x20,0x20,0xc0,0x00,0x00,0x00,0xf7,0x08,0x04,0x04,0x03,0x00,
+0x40,0x40,0x80,0x00,0x00,0x00,0xef,0x10,0x08,0x08,0x07,0x00,
+0x80,0x80,0x00,0x00,0x00,0x00,0xdf,0x20,0x10,0x10,0x0f,0x00,
 // 'asciitilde'
-126,11,8,3,0,3,12,13,16,0x1c,0x40,0x00,0x26,0x40,0x00,0x23,0x80,0x00,0x00,0x00,0x00,
-// 'space'
-160,6,1,1,0,0,6,18,19,0x00,0x00,0x00,0x00,0x00,0x00,
+9,2,8,13,3,0,
+0xc0,0x20,0x20,0x60,0xc0,0x80,0x80,0x60,
+0x80,0x40,0x40,0xc0,0x80,0x00,0x00,0xc0,0x01,0x00,0x00,0x00,0x01,0x01,0x01,0x00,
+0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x80,0x03,0x00,0x00,0x01,0x03,0x02,0x02,0x01,
+0x06,0x01,0x01,0x03,0x06,0x04,0x04,0x03,
+0x0c,0x02,0x02,0x06,0x0c,0x08,0x08,0x06,
+0x18,0x04,0x04,0x0c,0x18,0x10,0x10,0x0c,
+0x30,0x08,0x08,0x18,0x30,0x20,0x20,0x18,
+0x60,0x10,0x10,0x30,0x60,0x40,0x40,0x30,
+// 'space' same as 170
 // 'exclamdown'
-161,9,1,11,2,-3,36,11,22,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,
+5,4,1,11,11,0,
+0x98,0x3f,
+0x30,0x7f,
+0x60,0xfe,
+0xc0,0xfc,0x01,
+0x80,0xf9,0x03,
+0xf3,0x07,
+0xe6,0x0f,
+0xcc,0x1f,
 // 'cent'
-162,10,7,12,0,-2,39,9,21,0x01,0x00,0x00,0x01,0x00,0x00,0x0f,0x00,0x00,0x12,0x80,0x00,0x22,0x80,0x00,0x22,0x00,0x00,0x24,0x00,0x00,0x24,0x80,0x00,0x15,0x00,0x00,0x0e,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,
+8,2,7,9,12,0,
+0xe0,0x10,0x08,0x88,0x78,0x0e,0x30,0x01,0x02,0x1c,0x07,0x04,0x02,0x01,
+0xc0,0x20,0x10,0x10,0xf0,0x1c,0x60,0x03,0x04,0x38,0x0f,0x08,0x04,0x02,
+0x80,0x40,0x20,0x20,0xe0,0x38,0xc0,0x07,0x08,0x70,0x1e,0x11,0x08,0x04,
+0x00,0x80,0x40,0x40,0xc0,0x70,0x80,0x0f,0x10,0xe0,0x3c,0x23,0x10,0x09,
+0x00,0x00,0x80,0x80,0x80,0xe0,0x00,0x1e,0x21,0xc0,0x78,0x47,0x20,0x13,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0xc0,0x00,0x3c,0x42,0x81,0xf1,0x8f,0x41,0x26,0x00,0x00,0x03,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x78,0x84,0x02,0xe2,0x1e,0x83,0x4c,0x00,0x00,0x07,0x01,0x01,0x00,0x00,
+0xf0,0x08,0x04,0xc4,0x3c,0x07,0x98,0x00,0x01,0x0e,0x03,0x02,0x01,0x00,
 // 'sterling'
-163,10,8,11,0,0,36,8,19,0x03,0x00,0x00,0x04,0x80,0x00,0x08,0x80,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x3f,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x1c,0x40,0x00,0x24,0x40,0x00,0x1b,0x80,0x00,0x00,0x00,0x00,
+8,2,8,8,11,0,
+0x20,0x20,0x3c,0xe2,0x21,0x21,0x06,0x00,0x02,0x05,0x05,0x03,0x04,0x04,0x04,0x03,
+0x40,0x40,0x78,0xc4,0x42,0x42,0x0c,0x00,0x04,0x0a,0x0a,0x07,0x08,0x08,0x08,0x06,
+0x80,0x80,0xf0,0x88,0x84,0x84,0x18,0x00,0x08,0x14,0x14,0x0f,0x10,0x10,0x10,0x0c,
+0x00,0x00,0xe0,0x10,0x08,0x08,0x30,0x00,0x11,0x29,0x29,0x1f,0x21,0x21,0x20,0x18,
+0x00,0x00,0xc0,0x20,0x10,0x10,0x60,0x00,0x22,0x52,0x53,0x3e,0x42,0x42,0x40,0x30,
+0x00,0x00,0x80,0x40,0x20,0x20,0xc0,0x00,0x44,0xa4,0xa7,0x7c,0x84,0x84,0x80,0x60,
+0x00,0x00,0x00,0x80,0x40,0x40,0x80,0x00,0x88,0x48,0x4f,0xf8,0x08,0x08,0x01,0xc0,0x00,0x01,0x01,0x00,0x01,0x01,0x01,0x00,
+0x00,0x00,0x00,0x00,0x80,0x80,0x00,0x00,0x10,0x90,0x9e,0xf1,0x10,0x10,0x03,0x80,0x01,0x02,0x02,0x01,0x02,0x02,0x02,0x01,
 // 'currency'
-164,10,8,9,0,1,30,9,18,0x26,0x40,0x00,0x19,0x80,0x00,0x10,0x80,0x00,0x20,0x40,0x00,0x20,0x40,0x00,0x20,0x40,0x00,0x10,0x80,0x00,0x19,0x80,0x00,0x26,0x40,0x00,0x00,0x00,0x00,
+8,2,8,9,9,0,
+0x72,0x8c,0x04,0x02,0x02,0x04,0x8c,0x72,0x02,0x01,0x01,0x02,0x02,0x01,0x01,0x02,
+0xe4,0x18,0x08,0x04,0x04,0x08,0x18,0xe4,0x04,0x03,0x02,0x04,0x04,0x02,0x03,0x04,
+0xc8,0x30,0x10,0x08,0x08,0x10,0x30,0xc8,0x09,0x06,0x04,0x08,0x08,0x04,0x06,0x09,
+0x90,0x60,0x20,0x10,0x10,0x20,0x60,0x90,0x13,0x0c,0x08,0x10,0x10,0x08,0x0c,0x13,
+0x20,0xc0,0x40,0x20,0x20,0x40,0xc0,0x20,0x27,0x18,0x10,0x20,0x20,0x10,0x18,0x27,
+0x40,0x80,0x80,0x40,0x40,0x80,0x80,0x40,0x4e,0x31,0x20,0x40,0x40,0x20,0x31,0x4e,
+0x80,0x00,0x00,0x80,0x80,0x00,0x00,0x80,0x9c,0x63,0x41,0x80,0x80,0x41,0x63,0x9c,
+0x39,0xc6,0x82,0x01,0x01,0x82,0xc6,0x39,0x01,0x00,0x00,0x01,0x01,0x00,0x00,0x01,
 // 'yen'
-165,10,9,11,-1,0,36,8,19,0x71,0xc0,0x00,0x20,0x80,0x00,0x11,0x00,0x00,0x0a,0x00,0x00,0x04,0x00,0x00,0x1f,0x00,0x00,0x04,0x00,0x00,0x1f,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+9,1,9,8,11,2,
+0x48,0x01,0x03,0xa5,0xa8,0xf0,0xa8,0xa5,0x03,0x01,0xc0,0x02,0x42,0x04,0x07,0x04,0xc0,
+0x48,0x02,0x06,0x4a,0x50,0xe0,0x50,0x4a,0x06,0x02,0xc0,0x01,0x44,0x01,0x09,0x0f,0x09,0x01,0xc0,
+0x48,0x04,0x0c,0x94,0xa0,0xc0,0xa0,0x94,0x0c,0x04,0xc0,0x01,0x44,0x02,0x12,0x1f,0x12,0x02,0xc0,
+0x48,0x08,0x18,0x28,0x40,0x80,0x40,0x28,0x18,0x08,0xc0,0x01,0x44,0x05,0x25,0x3f,0x25,0x05,0xc0,
+0x48,0x10,0x30,0x50,0x80,0x00,0x80,0x50,0x30,0x10,0xc0,0x01,0x44,0x0a,0x4a,0x7f,0x4a,0x0a,0xc0,
+0x42,0x20,0x60,0xa0,0x02,0x42,0xa0,0x60,0x20,0xc0,0x01,0x44,0x14,0x95,0xfe,0x95,0x14,0xc0,
+0x42,0x40,0xc0,0x40,0x02,0x42,0x40,0xc0,0x40,0xc0,0x01,0x44,0x29,0x2a,0xfc,0x2a,0x29,0xc0,0x02,0x82,0x01,0xc0,
+0x82,0x80,0x02,0x82,0x80,0xc0,0x00,0x46,0x01,0x52,0x54,0xf8,0x54,0x52,0x01,0xc0,0x02,0x42,0x02,0x03,0x02,0xc0,
 // 'brokenbar'
-166,5,1,11,0,0,36,8,19,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,
+3,2,1,8,11,0,
+0xdf,0x07,
+0xbe,0x0f,
+0x7c,0x1f,
+0xf8,0x3e,
+0xf0,0x7d,
+0xe0,0xfb,
+0xc0,0xf7,0x01,
+0x80,0xef,0x03,
 // 'section'
-167,10,7,14,0,-3,45,8,22,0x0e,0x00,0x00,0x11,0x00,0x00,0x13,0x00,0x00,0x08,0x00,0x00,0x14,0x00,0x00,0x22,0x00,0x00,0x21,0x00,0x00,0x10,0x80,0x00,0x08,0x80,0x00,0x05,0x00,0x00,0x02,0x00,0x00,0x19,0x00,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,14,0,
+0x60,0x96,0x09,0x11,0x25,0x46,0x80,0x00,0x18,0x29,0x22,0x24,0x1a,0x01,
+0xc0,0x2c,0x12,0x22,0x4a,0x8c,0x00,0x00,0x31,0x52,0x44,0x48,0x34,0x03,
+0x80,0x58,0x24,0x44,0x94,0x18,0x00,0x01,0x62,0xa4,0x88,0x90,0x69,0x06,
+0x00,0xb0,0x48,0x88,0x28,0x30,0x00,0x03,0xc4,0x48,0x10,0x21,0xd2,0x0c,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x60,0x90,0x10,0x50,0x60,0x00,0x06,0x89,0x90,0x21,0x42,0xa4,0x18,0x00,0x01,0x02,0x02,0x02,0x01,0x00,
+0x00,0xc0,0x20,0x20,0xa0,0xc0,0x00,0x0c,0x12,0x21,0x42,0x84,0x48,0x30,0x00,0x03,0x05,0x04,0x04,0x03,0x00,
+0x00,0x80,0x40,0x40,0x40,0x80,0x00,0x18,0x25,0x42,0x84,0x09,0x91,0x60,0x00,0x06,0x0a,0x08,0x09,0x06,0x00,
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x30,0x4b,0x84,0x08,0x12,0x23,0xc0,0x00,0x0c,0x14,0x11,0x12,0x0d,0x00,
 // 'dieresis'
-168,9,4,2,1,9,9,8,10,0x12,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,
+6,3,4,8,2,0,
+0x03,0x00,0x00,0x03,
+0x06,0x00,0x00,0x06,
+0x0c,0x00,0x00,0x0c,
+0x18,0x00,0x00,0x18,
+0x30,0x00,0x00,0x30,
+0x60,0x00,0x00,0x60,
+0xc0,0x00,0x00,0xc0,
+0x80,0x00,0x00,0x80,0x01,0x00,0x00,0x01,
 // 'copyright'
-169,15,11,11,0,0,36,8,19,0x03,0x80,0x00,0x0c,0x60,0x00,0x10,0x10,0x00,0x13,0x90,0x00,0x24,0x48,0x00,0x24,0x08,0x00,0x24,0x08,0x00,0x14,0x50,0x00,0x13,0x90,0x00,0x0c,0x60,0x00,0x03,0x80,0x00,0x00,0x00,0x00,
+13,2,11,8,11,0,
+0x70,0x8c,0x02,0xf2,0x09,0x09,0x09,0x92,0x02,0x8c,0x70,0x00,0x01,0x02,0x02,0x05,0x05,0x05,0x02,0x02,0x01,0x00,
+0xe0,0x18,0x04,0xe4,0x12,0x12,0x12,0x24,0x04,0x18,0xe0,0x00,0x03,0x04,0x05,0x0a,0x0a,0x0a,0x05,0x04,0x03,0x00,
+0xc0,0x30,0x08,0xc8,0x24,0x24,0x24,0x48,0x08,0x30,0xc0,0x01,0x06,0x08,0x0b,0x14,0x14,0x14,0x0a,0x08,0x06,0x01,
+0x80,0x60,0x10,0x90,0x48,0x48,0x48,0x90,0x10,0x60,0x80,0x03,0x0c,0x10,0x17,0x28,0x28,0x28,0x14,0x10,0x0c,0x03,
+0x00,0xc0,0x20,0x20,0x90,0x90,0x90,0x20,0x20,0xc0,0x00,0x07,0x18,0x20,0x2f,0x50,0x50,0x50,0x29,0x20,0x18,0x07,
+0x00,0x80,0x40,0x40,0x20,0x20,0x20,0x40,0x40,0x80,0x00,0x0e,0x31,0x40,0x5e,0xa1,0xa1,0xa1,0x52,0x40,0x31,0x0e,
+0x00,0x00,0x80,0x80,0x40,0x40,0x40,0x80,0x80,0x00,0x00,0x1c,0x63,0x80,0xbc,0x42,0x42,0x42,0xa4,0x80,0x63,0x1c,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x38,0xc6,0x01,0x79,0x84,0x84,0x84,0x49,0x01,0xc6,0x38,0x00,0x00,0x01,0x01,0x02,0x02,0x02,0x01,0x01,0x00,0x00,
 // 'ordfeminine'
-170,7,4,6,0,5,21,8,14,0x18,0x00,0x00,0x04,0x00,0x00,0x1c,0x00,0x00,0x24,0x00,0x00,0x14,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,
+5,2,4,8,6,0,
+0x28,0x35,0x25,0x3e,
+0x50,0x6a,0x4a,0x7c,
+0xa0,0xd4,0x94,0xf8,
+0x40,0xa8,0x28,0xf0,0x01,0x01,0x01,0x01,
+0x80,0x50,0x50,0xe0,0x02,0x03,0x02,0x03,
+0x00,0xa0,0xa0,0xc0,0x05,0x06,0x04,0x07,
+0x00,0x40,0x40,0x80,0x0a,0x0d,0x09,0x0f,
+0x00,0x80,0x80,0x00,0x14,0x1a,0x12,0x1f,
 // 'guillemotleft'
-171,10,7,7,0,0,24,12,19,0x04,0x80,0x00,0x09,0x00,0x00,0x12,0x00,0x00,0x24,0x00,0x00,0x12,0x00,0x00,0x09,0x00,0x00,0x04,0x80,0x00,0x00,0x00,0x00,
+8,2,7,12,7,0,
+0x80,0x40,0x20,0x90,0x40,0x20,0x10,0x00,0x01,0x02,0x04,0x01,0x02,0x04,
+0x00,0x80,0x40,0x20,0x80,0x40,0x20,0x01,0x02,0x04,0x09,0x02,0x04,0x08,
+0x00,0x00,0x80,0x40,0x00,0x80,0x40,0x02,0x05,0x08,0x12,0x05,0x08,0x10,
+0x00,0x00,0x00,0x80,0x00,0x00,0x80,0x04,0x0a,0x11,0x24,0x0a,0x11,0x20,
+0x08,0x14,0x22,0x49,0x14,0x22,0x41,
+0x10,0x28,0x44,0x92,0x28,0x44,0x82,
+0x20,0x50,0x88,0x24,0x50,0x88,0x04,0x00,0x00,0x00,0x01,0x00,0x00,0x01,
+0x40,0xa0,0x10,0x48,0xa0,0x10,0x08,0x00,0x00,0x01,0x02,0x00,0x01,0x02,
 // 'logicalnot'
-172,11,8,5,0,0,18,14,19,0x3f,0xc0,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x40,0x00,0x00,0x00,0x00,
-// 'hyphen'
-173,7,4,1,0,4,6,14,15,0x3c,0x00,0x00,0x00,0x00,0x00,
+9,2,8,14,5,2,
+0x86,0x40,0x40,0xc0,0xc0,0x06,0x40,0x07,0xc0,
+0x87,0x80,0xc0,0x06,0x40,0x0f,0xc0,
+0x86,0x01,0x40,0x1f,0xc0,
+0x86,0x02,0x40,0x3e,0xc0,
+0x86,0x04,0x40,0x7c,0xc0,
+0x86,0x08,0x40,0xf8,0xc0,
+0x86,0x10,0x40,0xf0,0xc0,0x06,0x40,0x01,0xc0,
+0x86,0x20,0x40,0xe0,0xc0,0x06,0x40,0x03,0xc0,
+// 'hyphen' same as 1346
 // 'registered'
-174,15,11,11,0,0,36,8,19,0x03,0x80,0x00,0x0c,0x60,0x00,0x10,0x10,0x00,0x13,0x90,0x00,0x22,0x48,0x00,0x23,0x88,0x00,0x22,0x88,0x00,0x12,0x90,0x00,0x12,0x50,0x00,0x0c,0x60,0x00,0x03,0x80,0x00,0x00,0x00,0x00,
+13,2,11,8,11,0,
+0x70,0x8c,0x02,0x02,0xf9,0x29,0xe9,0x12,0x02,0x8c,0x70,0x00,0x01,0x02,0x02,0x05,0x04,0x04,0x03,0x02,0x01,0x00,
+0xe0,0x18,0x04,0x04,0xf2,0x52,0xd2,0x24,0x04,0x18,0xe0,0x00,0x03,0x04,0x04,0x0b,0x08,0x09,0x06,0x04,0x03,0x00,
+0xc0,0x30,0x08,0x08,0xe4,0xa4,0xa4,0x48,0x08,0x30,0xc0,0x01,0x06,0x08,0x08,0x17,0x10,0x13,0x0c,0x08,0x06,0x01,
+0x80,0x60,0x10,0x10,0xc8,0x48,0x48,0x90,0x10,0x60,0x80,0x03,0x0c,0x10,0x10,0x2f,0x21,0x27,0x18,0x10,0x0c,0x03,
+0x00,0xc0,0x20,0x20,0x90,0x90,0x90,0x20,0x20,0xc0,0x00,0x07,0x18,0x20,0x20,0x5f,0x42,0x4e,0x31,0x20,0x18,0x07,
+0x00,0x80,0x40,0x40,0x20,0x20,0x20,0x40,0x40,0x80,0x00,0x0e,0x31,0x40,0x40,0xbf,0x85,0x9d,0x62,0x40,0x31,0x0e,
+0x00,0x00,0x80,0x80,0x40,0x40,0x40,0x80,0x80,0x00,0x00,0x1c,0x63,0x80,0x80,0x7e,0x0a,0x3a,0xc4,0x80,0x63,0x1c,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x38,0xc6,0x01,0x01,0xfc,0x14,0x74,0x89,0x01,0xc6,0x38,0x00,0x00,0x01,0x01,0x02,0x02,0x02,0x01,0x01,0x00,0x00,
 // 'macron'
-175,8,5,1,0,9,6,9,10,0x3e,0x00,0x00,0x00,0x00,0x00,
+6,2,5,9,1,2,
+0x84,0x02,0xc0,
+0x84,0x04,0xc0,
+0x84,0x08,0xc0,
+0x84,0x10,0xc0,
+0x84,0x20,0xc0,
+0x84,0x40,0xc0,
+0x84,0x80,0xc0,
+0x84,0x01,0xc0,
 // 'degree'
-176,10,5,5,1,6,18,8,13,0x0e,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+7,3,5,8,5,0,
+0x0e,0x11,0x11,0x11,0x0e,
+0x1c,0x22,0x22,0x22,0x1c,
+0x38,0x44,0x44,0x44,0x38,
+0x70,0x88,0x88,0x88,0x70,
+0xe0,0x10,0x10,0x10,0xe0,0x00,0x01,0x01,0x01,0x00,
+0xc0,0x20,0x20,0x20,0xc0,0x01,0x02,0x02,0x02,0x01,
+0x80,0x40,0x40,0x40,0x80,0x03,0x04,0x04,0x04,0x03,
+0x00,0x80,0x80,0x80,0x00,0x07,0x08,0x08,0x08,0x07,
 // 'plusminus'
-177,12,7,9,1,0,30,10,19,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x1f,0xc0,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,
+9,3,7,10,9,2,
+0x82,0x20,0x40,0xfc,0x82,0x20,0xc0,0x82,0x04,0x40,0x05,0x82,0x04,0xc0,
+0x82,0x40,0x40,0xf8,0x82,0x40,0xc0,0x82,0x08,0x40,0x0b,0x82,0x08,0xc0,
+0x82,0x80,0x40,0xf0,0x82,0x80,0xc0,0x82,0x10,0x40,0x17,0x82,0x10,0xc0,
+0x02,0x40,0xe0,0xc0,0x82,0x21,0x40,0x2f,0x82,0x21,0xc0,
+0x02,0x40,0xc0,0xc0,0x82,0x42,0x40,0x5f,0x82,0x42,0xc0,
+0x02,0x40,0x80,0xc0,0x82,0x84,0x40,0xbf,0x82,0x84,0xc0,
+0x82,0x08,0x40,0x7f,0x82,0x08,0xc0,0x86,0x01,0xc0,
+0x82,0x10,0x40,0xfe,0x82,0x10,0xc0,0x86,0x02,0xc0,
 // 'twosuperior'
-178,7,5,7,0,4,24,8,15,0x1c,0x00,0x00,0x22,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x12,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,
+5,2,5,8,7,0,
+0x42,0x61,0x51,0x49,0x66,
+0x84,0xc2,0xa2,0x92,0xcc,
+0x08,0x84,0x44,0x24,0x98,0x01,0x01,0x01,0x01,0x01,
+0x10,0x08,0x88,0x48,0x30,0x02,0x03,0x02,0x02,0x03,
+0x20,0x10,0x10,0x90,0x60,0x04,0x06,0x05,0x04,0x06,
+0x40,0x20,0x20,0x20,0xc0,0x08,0x0c,0x0a,0x09,0x0c,
+0x80,0x40,0x40,0x40,0x80,0x10,0x18,0x14,0x12,0x19,
+0x00,0x80,0x80,0x80,0x00,0x21,0x30,0x28,0x24,0x33,
 // 'threesuperior'
-179,7,6,7,-1,4,24,8,15,0x1c,0x00,0x00,0x22,0x00,0x00,0x02,0x00,0x00,0x0c,0x00,0x00,0x02,0x00,0x00,0x42,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,
+6,1,6,8,7,0,
+0x20,0x42,0x41,0x49,0x49,0x36,
+0x40,0x84,0x82,0x92,0x92,0x6c,
+0x80,0x08,0x04,0x24,0x24,0xd8,0x00,0x01,0x01,0x01,0x01,0x00,
+0x00,0x10,0x08,0x48,0x48,0xb0,0x01,0x02,0x02,0x02,0x02,0x01,
+0x00,0x20,0x10,0x90,0x90,0x60,0x02,0x04,0x04,0x04,0x04,0x03,
+0x00,0x40,0x20,0x20,0x20,0xc0,0x04,0x08,0x08,0x09,0x09,0x06,
+0x00,0x80,0x40,0x40,0x40,0x80,0x08,0x10,0x10,0x12,0x12,0x0d,
+0x00,0x00,0x80,0x80,0x80,0x00,0x10,0x21,0x20,0x24,0x24,0x1b,
 // 'acute'
-180,10,3,3,2,8,12,8,11,0x02,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,
+6,4,3,8,3,0,
+0x04,0x02,0x01,
+0x08,0x04,0x02,
+0x10,0x08,0x04,
+0x20,0x10,0x08,
+0x40,0x20,0x10,
+0x80,0x40,0x20,
+0x00,0x80,0x40,0x01,0x00,0x00,
+0x00,0x00,0x80,0x02,0x01,0x00,
 // 'mu'
-181,10,8,11,0,-3,36,11,22,0x31,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x11,0xc0,0x00,0x1e,0x80,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+8,2,8,11,11,0,
+0x08,0xf8,0x00,0x00,0x00,0x08,0xf8,0x00,0x00,0x3f,0x04,0x04,0x04,0x02,0x07,0x02,
+0x10,0xf0,0x00,0x00,0x00,0x10,0xf0,0x00,0x00,0x7f,0x08,0x08,0x08,0x04,0x0f,0x04,
+0x20,0xe0,0x00,0x00,0x00,0x20,0xe0,0x00,0x00,0xff,0x10,0x10,0x10,0x08,0x1f,0x08,
+0x40,0xc0,0x00,0x00,0x00,0x40,0xc0,0x00,0x00,0xff,0x20,0x20,0x20,0x10,0x3f,0x10,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x80,0x80,0x00,0x00,0x00,0x80,0x80,0x00,0x00,0xff,0x40,0x40,0x40,0x20,0x7f,0x20,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+0x01,0xff,0x80,0x80,0x80,0x41,0xff,0x40,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,
+0x02,0xfe,0x00,0x00,0x00,0x82,0xfe,0x80,0x00,0x0f,0x01,0x01,0x01,0x00,0x01,0x00,
+0x04,0xfc,0x00,0x00,0x00,0x04,0xfc,0x00,0x00,0x1f,0x02,0x02,0x02,0x01,0x03,0x01,
 // 'paragraph'
-182,10,7,15,0,-4,48,8,23,0x0f,0x80,0x00,0x1d,0x00,0x00,0x3d,0x00,0x00,0x3d,0x00,0x00,0x3d,0x00,0x00,0x1d,0x00,0x00,0x0d,0x00,0x00,0x05,0x00,0x00,0x05,0x00,0x00,0x05,0x00,0x00,0x05,0x00,0x00,0x05,0x00,0x00,0x05,0x00,0x00,0x05,0x00,0x00,0x05,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,15,0,
+0x1c,0x3e,0x7f,0xff,0x01,0xff,0x01,0x00,0x00,0x00,0x7f,0x00,0x7f,0x00,
+0x38,0x7c,0xfe,0xfe,0x02,0xfe,0x02,0x00,0x00,0x00,0xff,0x00,0xff,0x00,
+0x70,0xf8,0xfc,0xfc,0x04,0xfc,0x04,0x00,0x00,0x01,0xff,0x00,0xff,0x00,0x00,0x00,0x00,0x01,0x00,0x01,0x00,
+0xe0,0xf0,0xf8,0xf8,0x08,0xf8,0x08,0x00,0x01,0x03,0xff,0x00,0xff,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x00,
+0xc0,0xe0,0xf0,0xf0,0x10,0xf0,0x10,0x01,0x03,0x07,0xff,0x00,0xff,0x00,0x00,0x00,0x00,0x07,0x00,0x07,0x00,
+0x80,0xc0,0xe0,0xe0,0x20,0xe0,0x20,0x03,0x07,0x0f,0xff,0x00,0xff,0x00,0x00,0x00,0x00,0x0f,0x00,0x0f,0x00,
+0x00,0x80,0xc0,0xc0,0x40,0xc0,0x40,0x07,0x0f,0x1f,0xff,0x00,0xff,0x00,0x00,0x00,0x00,0x1f,0x00,0x1f,0x00,
+0x00,0x00,0x80,0x80,0x80,0x80,0x80,0x0e,0x1f,0x3f,0xff,0x00,0xff,0x00,0x00,0x00,0x00,0x3f,0x00,0x3f,0x00,
 // 'periodcentered'
-183,7,1,2,1,4,9,13,15,0x10,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+4,3,1,13,2,0,
+0x60,
+0xc0,
+0x80,0x01,
+0x03,
+0x06,
+0x0c,
+0x18,
+0x30,
 // 'cedilla'
-184,8,4,4,0,-4,15,19,23,0x08,0x00,0x00,0x1c,0x00,0x00,0x04,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+6,2,4,19,4,0,
+0x40,0x50,0x58,0x30,
+0x80,0xa0,0xb0,0x60,
+0x00,0x40,0x60,0xc0,0x01,0x01,0x01,0x00,
+0x00,0x80,0xc0,0x80,0x02,0x02,0x02,0x01,
+0x00,0x00,0x80,0x00,0x04,0x05,0x05,0x03,
+0x08,0x0a,0x0b,0x06,
+0x10,0x14,0x16,0x0c,
+0x20,0x28,0x2c,0x18,
 // 'onesuperior'
-185,8,3,7,1,4,24,8,15,0x08,0x00,0x00,0x18,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,
+5,3,3,8,7,0,
+0x42,0x7f,0x40,
+0x84,0xfe,0x80,
+0x08,0xfc,0x00,0x01,0x01,0x01,
+0x10,0xf8,0x00,0x02,0x03,0x02,
+0x20,0xf0,0x00,0x04,0x07,0x04,
+0x40,0xe0,0x00,0x08,0x0f,0x08,
+0x80,0xc0,0x00,0x10,0x1f,0x10,
+0x00,0x80,0x00,0x21,0x3f,0x20,
 // 'ordmasculine'
-186,7,4,6,0,5,21,8,14,0x18,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x24,0x00,0x00,0x18,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,
+5,2,4,8,6,0,
+0x2e,0x31,0x31,0x2e,
+0x5c,0x62,0x62,0x5c,
+0xb8,0xc4,0xc4,0xb8,
+0x70,0x88,0x88,0x70,0x01,0x01,0x01,0x01,
+0xe0,0x10,0x10,0xe0,0x02,0x03,0x03,0x02,
+0xc0,0x20,0x20,0xc0,0x05,0x06,0x06,0x05,
+0x80,0x40,0x40,0x80,0x0b,0x0c,0x0c,0x0b,
+0x00,0x80,0x80,0x00,0x17,0x18,0x18,0x17,
 // 'guillemotright'
-187,10,7,7,0,0,24,12,19,0x24,0x00,0x00,0x12,0x00,0x00,0x09,0x00,0x00,0x04,0x80,0x00,0x09,0x00,0x00,0x12,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00,
+8,2,7,12,7,0,
+0x10,0x20,0x40,0x90,0x20,0x40,0x80,0x04,0x02,0x01,0x04,0x02,0x01,0x00,
+0x20,0x40,0x80,0x20,0x40,0x80,0x00,0x08,0x04,0x02,0x09,0x04,0x02,0x01,
+0x40,0x80,0x00,0x40,0x80,0x00,0x00,0x10,0x08,0x05,0x12,0x08,0x05,0x02,
+0x80,0x00,0x00,0x80,0x00,0x00,0x00,0x20,0x11,0x0a,0x24,0x11,0x0a,0x04,
+0x41,0x22,0x14,0x49,0x22,0x14,0x08,
+0x82,0x44,0x28,0x92,0x44,0x28,0x10,
+0x04,0x88,0x50,0x24,0x88,0x50,0x20,0x01,0x00,0x00,0x01,0x00,0x00,0x00,
+0x08,0x10,0xa0,0x48,0x10,0xa0,0x40,0x02,0x01,0x00,0x02,0x01,0x00,0x00,
 // 'onequarter'
-188,16,11,11,1,0,36,8,19,0x08,0x10,0x00,0x18,0x20,0x00,0x08,0x60,0x00,0x08,0x40,0x00,0x08,0x88,0x00,0x09,0x98,0x00,0x1d,0x28,0x00,0x03,0x28,0x00,0x02,0x48,0x00,0x04,0xfc,0x00,0x08,0x08,0x00,0x00,0x00,0x00,
+13,3,11,8,11,0,
+0x42,0x7f,0x40,0x80,0xe0,0x30,0x0c,0xc6,0x21,0xf0,0x00,0x00,0x04,0x02,0x01,0x00,0x02,0x03,0x02,0x02,0x07,0x02,
+0x84,0xfe,0x80,0x00,0xc0,0x60,0x18,0x8c,0x42,0xe0,0x00,0x00,0x08,0x04,0x03,0x01,0x04,0x06,0x05,0x04,0x0f,0x04,
+0x08,0xfc,0x00,0x00,0x80,0xc0,0x30,0x18,0x84,0xc0,0x00,0x01,0x11,0x09,0x06,0x03,0x08,0x0c,0x0b,0x08,0x1f,0x08,
+0x10,0xf8,0x00,0x00,0x00,0x80,0x60,0x30,0x08,0x80,0x00,0x02,0x23,0x12,0x0c,0x07,0x11,0x18,0x16,0x11,0x3f,0x10,
+0x20,0xf0,0x00,0x00,0x00,0x00,0xc0,0x60,0x10,0x00,0x00,0x04,0x47,0x24,0x18,0x0e,0x23,0x30,0x2c,0x22,0x7f,0x20,
+0x40,0xe0,0x00,0x00,0x00,0x00,0x80,0xc0,0x20,0x00,0x00,0x08,0x8f,0x48,0x30,0x1c,0x46,0x61,0x58,0x44,0xfe,0x40,
+0x80,0xc0,0x00,0x00,0x00,0x00,0x00,0x80,0x40,0x00,0x00,0x10,0x1f,0x90,0x60,0x38,0x8c,0xc3,0xb1,0x88,0xfc,0x80,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x00,
+0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x21,0x3f,0x20,0xc0,0x70,0x18,0x86,0x63,0x10,0xf8,0x00,0x00,0x02,0x01,0x00,0x00,0x01,0x01,0x01,0x01,0x03,0x01,
 // 'onehalf'
-189,15,12,11,0,0,36,8,19,0x10,0x20,0x00,0x30,0x40,0x00,0x10,0xc0,0x00,0x10,0x80,0x00,0x11,0x38,0x00,0x13,0x44,0x00,0x3a,0x04,0x00,0x06,0x08,0x00,0x04,0x10,0x00,0x08,0x24,0x00,0x10,0x7c,0x00,0x00,0x00,0x00,
+13,2,12,8,11,0,
+0x42,0x7f,0x40,0x80,0xe0,0x30,0x0c,0x26,0x11,0x10,0x90,0x60,0x00,0x04,0x02,0x01,0x00,0x00,0x00,0x04,0x06,0x05,0x04,0x06,
+0x84,0xfe,0x80,0x00,0xc0,0x60,0x18,0x4c,0x22,0x20,0x20,0xc0,0x00,0x08,0x04,0x03,0x01,0x00,0x00,0x08,0x0c,0x0a,0x09,0x0c,
+0x08,0xfc,0x00,0x00,0x80,0xc0,0x30,0x98,0x44,0x40,0x40,0x80,0x01,0x11,0x09,0x06,0x03,0x00,0x00,0x10,0x18,0x14,0x12,0x19,
+0x10,0xf8,0x00,0x00,0x00,0x80,0x60,0x30,0x88,0x80,0x80,0x00,0x02,0x23,0x12,0x0c,0x07,0x01,0x00,0x21,0x30,0x28,0x24,0x33,
+0x20,0xf0,0x00,0x00,0x00,0x00,0xc0,0x60,0x10,0x00,0x00,0x00,0x04,0x47,0x24,0x18,0x0e,0x03,0x00,0x42,0x61,0x51,0x49,0x66,
+0x40,0xe0,0x00,0x00,0x00,0x00,0x80,0xc0,0x20,0x00,0x00,0x00,0x08,0x8f,0x48,0x30,0x1c,0x06,0x01,0x84,0xc2,0xa2,0x92,0xcc,
+0x80,0xc0,0x00,0x00,0x00,0x00,0x00,0x80,0x40,0x00,0x00,0x00,0x10,0x1f,0x90,0x60,0x38,0x0c,0x03,0x09,0x84,0x44,0x24,0x98,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x01,0x01,
+0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x21,0x3f,0x20,0xc0,0x70,0x18,0x06,0x13,0x08,0x88,0x48,0x30,0x00,0x02,0x01,0x00,0x00,0x00,0x00,0x02,0x03,0x02,0x02,0x03,
 // 'threequarters'
-190,14,13,11,-1,0,36,8,19,0x1c,0x10,0x00,0x22,0x20,0x00,0x02,0x60,0x00,0x0c,0x40,0x00,0x02,0x88,0x00,0x43,0x98,0x00,0x3d,0x28,0x00,0x03,0x28,0x00,0x02,0x48,0x00,0x04,0xfc,0x00,0x04,0x08,0x00,0x00,0x00,0x00,
+13,1,13,8,11,2,
+0x4b,0x20,0x42,0x41,0x49,0x49,0xb6,0xe0,0x30,0x0c,0xc6,0x21,0xf0,0xc0,0x03,0x48,0x06,0x01,0x00,0x02,0x03,0x02,0x02,0x07,0x02,0xc0,
+0x4b,0x40,0x84,0x82,0x92,0x92,0x6c,0xc0,0x60,0x18,0x8c,0x42,0xe0,0xc0,0x03,0x48,0x0c,0x03,0x01,0x04,0x06,0x05,0x04,0x0f,0x04,0xc0,
+0x4b,0x80,0x08,0x04,0x24,0x24,0xd8,0x80,0xc0,0x30,0x18,0x84,0xc0,0xc0,0x00,0x82,0x01,0x48,0x19,0x06,0x03,0x08,0x0c,0x0b,0x08,0x1f,0x08,0xc0,
+0x00,0x4a,0x10,0x08,0x48,0x48,0xb0,0x00,0x80,0x60,0x30,0x08,0x80,0xc0,0x40,0x01,0x82,0x02,0x48,0x32,0x0d,0x07,0x11,0x18,0x16,0x11,0x3f,0x10,0xc0,
+0x00,0x44,0x20,0x10,0x90,0x90,0x60,0x01,0x42,0xc0,0x60,0x10,0xc0,0x40,0x02,0x82,0x04,0x48,0x64,0x1b,0x0e,0x23,0x30,0x2c,0x22,0x7f,0x20,0xc0,
+0x00,0x40,0x40,0x82,0x20,0x40,0xc0,0x01,0x42,0x80,0xc0,0x20,0xc0,0x4c,0x04,0x08,0x08,0x09,0xc9,0x36,0x1c,0x46,0x61,0x58,0x44,0xfe,0x40,0xc0,
+0x00,0x40,0x80,0x82,0x40,0x40,0x80,0x02,0x41,0x80,0x40,0xc0,0x4c,0x08,0x10,0x10,0x12,0x92,0x6d,0x38,0x8c,0xc3,0xb1,0x88,0xfc,0x80,0xc0,0x03,0x40,0x01,0x05,0x40,0x01,0xc0,
+0x01,0x82,0x80,0x04,0x40,0x80,0xc0,0x4b,0x10,0x21,0x20,0x24,0x24,0xdb,0x70,0x18,0x86,0x63,0x10,0xf8,0xc0,0x03,0x40,0x03,0x01,0x83,0x01,0x41,0x03,0x01,0xc0,
 // 'questiondown'
-191,10,5,11,1,-3,36,11,22,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x10,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+7,3,5,11,11,0,
+0x00,0x00,0x98,0x00,0x00,0x1c,0x22,0x21,0x20,0x18,
+0x00,0x00,0x30,0x00,0x00,0x38,0x44,0x43,0x40,0x30,
+0x00,0x00,0x60,0x00,0x00,0x70,0x88,0x86,0x80,0x60,
+0x00,0x00,0xc0,0x00,0x00,0xe0,0x10,0x0c,0x00,0xc0,0x00,0x01,0x01,0x01,0x00,
+0x00,0x00,0x80,0x00,0x00,0xc0,0x20,0x19,0x00,0x80,0x01,0x02,0x02,0x02,0x01,
+0x80,0x40,0x33,0x00,0x00,0x03,0x04,0x04,0x04,0x03,
+0x00,0x80,0x66,0x00,0x00,0x07,0x08,0x08,0x08,0x06,
+0x00,0x00,0xcc,0x00,0x00,0x0e,0x11,0x10,0x10,0x0c,
 // 'Agrave'
-192,14,12,15,0,0,48,4,19,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x80,0x00,0x02,0x80,0x00,0x02,0xc0,0x00,0x04,0x40,0x00,0x04,0x60,0x00,0x08,0x20,0x00,0x0f,0xe0,0x00,0x10,0x30,0x00,0x10,0x10,0x00,0x38,0x3c,0x00,0x00,0x00,0x00,
+12,2,12,4,15,2,
+0x03,0x42,0x10,0x20,0x40,0xc0,0x01,0x46,0xc0,0xb0,0x8c,0x83,0x8e,0xb8,0xe0,0xc0,0x42,0x04,0x07,0x04,0x04,0x43,0x05,0x07,0x04,0x04,0xc0,
+0x03,0x42,0x20,0x40,0x80,0xc0,0x01,0x46,0x80,0x60,0x18,0x06,0x1c,0x70,0xc0,0xc0,0x42,0x08,0x0e,0x09,0x84,0x01,0x43,0x0b,0x0e,0x08,0x08,0xc0,
+0x03,0x41,0x40,0x80,0xc0,0x02,0x45,0xc0,0x30,0x0c,0x39,0xe0,0x80,0xc0,0x42,0x10,0x1c,0x13,0x84,0x02,0x43,0x17,0x1c,0x10,0x10,0xc0,
+0x03,0x40,0x80,0xc0,0x02,0x44,0x80,0x60,0x19,0x72,0xc0,0xc0,0x43,0x20,0x38,0x26,0x05,0x82,0x04,0x44,0x05,0x2f,0x38,0x20,0x20,0xc0,
+0x03,0x43,0xc1,0x32,0xe4,0x80,0xc0,0x43,0x40,0x70,0x4c,0x0b,0x82,0x08,0x44,0x0b,0x5e,0x70,0x40,0x40,0xc0,
+0x03,0x42,0x82,0x64,0xc8,0xc0,0x4b,0x80,0xe0,0x98,0x16,0x11,0x10,0x11,0x17,0xbc,0xe0,0x80,0x80,0xc0,
+0x03,0x42,0x04,0xc8,0x90,0xc0,0x00,0x48,0xc0,0x30,0x2c,0x23,0x20,0x23,0x2e,0x78,0xc0,0xc0,0x82,0x01,0x04,0x83,0x01,0xc0,
+0x03,0x42,0x08,0x90,0x20,0xc0,0x00,0x48,0x80,0x60,0x58,0x46,0x41,0x47,0x5c,0xf0,0x80,0xc0,0x42,0x02,0x03,0x02,0x04,0x43,0x02,0x03,0x02,0x02,0xc0,
 // 'Aacute'
-193,14,12,15,0,0,48,4,19,0x00,0x40,0x00,0x00,0x80,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x80,0x00,0x02,0x80,0x00,0x02,0xc0,0x00,0x04,0x40,0x00,0x04,0x60,0x00,0x08,0x20,0x00,0x0f,0xe0,0x00,0x10,0x30,0x00,0x10,0x10,0x00,0x38,0x3c,0x00,0x00,0x00,0x00,
+12,2,12,4,15,2,
+0x04,0x42,0x40,0x20,0x10,0xc0,0x01,0x46,0xc0,0xb0,0x8c,0x83,0x8e,0xb8,0xe0,0xc0,0x42,0x04,0x07,0x04,0x04,0x43,0x05,0x07,0x04,0x04,0xc0,
+0x04,0x42,0x80,0x40,0x20,0xc0,0x01,0x46,0x80,0x60,0x18,0x06,0x1c,0x70,0xc0,0xc0,0x42,0x08,0x0e,0x09,0x84,0x01,0x43,0x0b,0x0e,0x08,0x08,0xc0,
+0x05,0x41,0x80,0x40,0xc0,0x02,0x45,0xc0,0x30,0x0d,0x38,0xe0,0x80,0xc0,0x42,0x10,0x1c,0x13,0x84,0x02,0x43,0x17,0x1c,0x10,0x10,0xc0,
+0x06,0x40,0x80,0xc0,0x02,0x44,0x80,0x60,0x1a,0x71,0xc0,0xc0,0x43,0x20,0x38,0x26,0x05,0x82,0x04,0x44,0x05,0x2f,0x38,0x20,0x20,0xc0,
+0x03,0x43,0xc0,0x34,0xe2,0x81,0xc0,0x43,0x40,0x70,0x4c,0x0b,0x82,0x08,0x44,0x0b,0x5e,0x70,0x40,0x40,0xc0,
+0x03,0x43,0x80,0x68,0xc4,0x02,0xc0,0x4b,0x80,0xe0,0x98,0x16,0x11,0x10,0x11,0x17,0xbc,0xe0,0x80,0x80,0xc0,
+0x04,0x42,0xd0,0x88,0x04,0xc0,0x00,0x48,0xc0,0x30,0x2c,0x23,0x20,0x23,0x2e,0x78,0xc0,0xc0,0x82,0x01,0x04,0x83,0x01,0xc0,
+0x04,0x42,0xa0,0x10,0x08,0xc0,0x00,0x48,0x80,0x60,0x58,0x46,0x41,0x47,0x5c,0xf0,0x80,0xc0,0x42,0x02,0x03,0x02,0x04,0x43,0x02,0x03,0x02,0x02,0xc0,
 // 'Acircumflex'
-194,14,12,15,0,0,48,4,19,0x01,0x00,0x00,0x02,0x80,0x00,0x04,0x40,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x80,0x00,0x02,0x80,0x00,0x02,0xc0,0x00,0x04,0x40,0x00,0x04,0x60,0x00,0x08,0x20,0x00,0x0f,0xe0,0x00,0x10,0x30,0x00,0x10,0x10,0x00,0x38,0x3c,0x00,0x00,0x00,0x00,
+12,2,12,4,15,2,
+0x02,0x44,0x40,0x20,0x10,0x20,0x40,0xc0,0x01,0x46,0xc0,0xb0,0x8c,0x83,0x8e,0xb8,0xe0,0xc0,0x42,0x04,0x07,0x04,0x04,0x43,0x05,0x07,0x04,0x04,0xc0,
+0x02,0x44,0x80,0x40,0x20,0x40,0x80,0xc0,0x01,0x46,0x80,0x60,0x18,0x06,0x1c,0x70,0xc0,0xc0,0x42,0x08,0x0e,0x09,0x84,0x01,0x43,0x0b,0x0e,0x08,0x08,0xc0,
+0x03,0x42,0x80,0x40,0x80,0xc0,0x02,0x45,0xc1,0x30,0x0c,0x38,0xe1,0x80,0xc0,0x42,0x10,0x1c,0x13,0x84,0x02,0x43,0x17,0x1c,0x10,0x10,0xc0,
+0x04,0x40,0x80,0xc0,0x02,0x44,0x82,0x61,0x18,0x71,0xc2,0xc0,0x43,0x20,0x38,0x26,0x05,0x82,0x04,0x44,0x05,0x2f,0x38,0x20,0x20,0xc0,
+0x02,0x44,0x04,0xc2,0x31,0xe2,0x84,0xc0,0x43,0x40,0x70,0x4c,0x0b,0x82,0x08,0x44,0x0b,0x5e,0x70,0x40,0x40,0xc0,
+0x02,0x44,0x08,0x84,0x62,0xc4,0x08,0xc0,0x4b,0x80,0xe0,0x98,0x16,0x11,0x10,0x11,0x17,0xbc,0xe0,0x80,0x80,0xc0,
+0x02,0x44,0x10,0x08,0xc4,0x88,0x10,0xc0,0x00,0x48,0xc0,0x30,0x2c,0x23,0x20,0x23,0x2e,0x78,0xc0,0xc0,0x82,0x01,0x04,0x83,0x01,0xc0,
+0x02,0x44,0x20,0x10,0x88,0x10,0x20,0xc0,0x00,0x48,0x80,0x60,0x58,0x46,0x41,0x47,0x5c,0xf0,0x80,0xc0,0x42,0x02,0x03,0x02,0x04,0x43,0x02,0x03,0x02,0x02,0xc0,
 // 'Atilde'
-195,14,12,14,0,0,45,5,19,0x03,0x40,0x00,0x05,0x80,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x80,0x00,0x02,0x80,0x00,0x02,0xc0,0x00,0x04,0x40,0x00,0x04,0x60,0x00,0x08,0x20,0x00,0x0f,0xe0,0x00,0x10,0x30,0x00,0x10,0x10,0x00,0x38,0x3c,0x00,0x00,0x00,0x00,
+12,2,12,5,14,2,
+0x02,0x44,0x40,0x20,0x60,0x40,0x20,0xc0,0x01,0x46,0xc0,0xb0,0x8c,0x83,0x8e,0xb8,0xe0,0xc0,0x42,0x04,0x07,0x04,0x04,0x43,0x05,0x07,0x04,0x04,0xc0,
+0x02,0x44,0x80,0x40,0xc0,0x80,0x40,0xc0,0x01,0x46,0x80,0x60,0x18,0x06,0x1c,0x70,0xc0,0xc0,0x42,0x08,0x0e,0x09,0x84,0x01,0x43,0x0b,0x0e,0x08,0x08,0xc0,
+0x03,0x43,0x80,0x80,0x00,0x80,0xc0,0x02,0x45,0xc1,0x30,0x0d,0x39,0xe0,0x80,0xc0,0x42,0x10,0x1c,0x13,0x84,0x02,0x43,0x17,0x1c,0x10,0x10,0xc0,
+0x02,0x44,0x82,0x61,0x1b,0x72,0xc1,0xc0,0x43,0x20,0x38,0x26,0x05,0x82,0x04,0x44,0x05,0x2f,0x38,0x20,0x20,0xc0,
+0x02,0x44,0x04,0xc2,0x36,0xe4,0x82,0xc0,0x43,0x40,0x70,0x4c,0x0b,0x82,0x08,0x44,0x0b,0x5e,0x70,0x40,0x40,0xc0,
+0x02,0x44,0x08,0x84,0x6c,0xc8,0x04,0xc0,0x4b,0x80,0xe0,0x98,0x16,0x11,0x10,0x11,0x17,0xbc,0xe0,0x80,0x80,0xc0,
+0x02,0x44,0x10,0x08,0xd8,0x90,0x08,0xc0,0x00,0x48,0xc0,0x30,0x2c,0x23,0x20,0x23,0x2e,0x78,0xc0,0xc0,0x82,0x01,0x04,0x83,0x01,0xc0,
+0x02,0x44,0x20,0x10,0xb0,0x20,0x10,0xc0,0x00,0x48,0x80,0x60,0x58,0x46,0x41,0x47,0x5c,0xf0,0x80,0xc0,0x42,0x02,0x03,0x02,0x04,0x43,0x02,0x03,0x02,0x02,0xc0,
 // 'Adieresis'
-196,14,12,14,0,0,45,5,19,0x02,0x40,0x00,0x02,0x40,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x80,0x00,0x02,0x80,0x00,0x02,0xc0,0x00,0x04,0x40,0x00,0x04,0x60,0x00,0x08,0x20,0x00,0x0f,0xe0,0x00,0x10,0x30,0x00,0x10,0x10,0x00,0x38,0x3c,0x00,0x00,0x00,0x00,
+12,2,12,5,14,2,
+0x03,0x40,0x60,0x01,0x40,0x60,0xc0,0x01,0x46,0xc0,0xb0,0x8c,0x83,0x8e,0xb8,0xe0,0xc0,0x42,0x04,0x07,0x04,0x04,0x43,0x05,0x07,0x04,0x04,0xc0,
+0x03,0x40,0xc0,0x01,0x40,0xc0,0xc0,0x01,0x46,0x80,0x60,0x18,0x06,0x1c,0x70,0xc0,0xc0,0x42,0x08,0x0e,0x09,0x84,0x01,0x43,0x0b,0x0e,0x08,0x08,0xc0,
+0x03,0x40,0x80,0x01,0x40,0x80,0xc0,0x02,0x45,0xc0,0x31,0x0c,0x38,0xe1,0x80,0xc0,0x42,0x10,0x1c,0x13,0x84,0x02,0x43,0x17,0x1c,0x10,0x10,0xc0,
+0x02,0x44,0x80,0x63,0x18,0x70,0xc3,0xc0,0x43,0x20,0x38,0x26,0x05,0x82,0x04,0x44,0x05,0x2f,0x38,0x20,0x20,0xc0,
+0x03,0x43,0xc6,0x30,0xe0,0x86,0xc0,0x43,0x40,0x70,0x4c,0x0b,0x82,0x08,0x44,0x0b,0x5e,0x70,0x40,0x40,0xc0,
+0x03,0x43,0x8c,0x60,0xc0,0x0c,0xc0,0x4b,0x80,0xe0,0x98,0x16,0x11,0x10,0x11,0x17,0xbc,0xe0,0x80,0x80,0xc0,
+0x03,0x43,0x18,0xc0,0x80,0x18,0xc0,0x00,0x48,0xc0,0x30,0x2c,0x23,0x20,0x23,0x2e,0x78,0xc0,0xc0,0x82,0x01,0x04,0x83,0x01,0xc0,
+0x03,0x43,0x30,0x80,0x00,0x30,0xc0,0x00,0x48,0x80,0x60,0x58,0x46,0x41,0x47,0x5c,0xf0,0x80,0xc0,0x42,0x02,0x03,0x02,0x04,0x43,0x02,0x03,0x02,0x02,0xc0,
 // 'Aring'
-197,14,12,14,0,0,45,5,19,0x01,0x80,0x00,0x02,0x40,0x00,0x02,0x40,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x02,0x80,0x00,0x02,0xc0,0x00,0x04,0x40,0x00,0x04,0x60,0x00,0x08,0x20,0x00,0x0f,0xe0,0x00,0x10,0x30,0x00,0x10,0x10,0x00,0x38,0x3c,0x00,0x00,0x00,0x00,
+12,2,12,5,14,2,
+0x03,0x43,0xc0,0x20,0x20,0xc0,0xc0,0x01,0x46,0xc0,0xb0,0x8c,0x83,0x8f,0xb8,0xe0,0xc0,0x42,0x04,0x07,0x04,0x04,0x43,0x05,0x07,0x04,0x04,0xc0,
+0x03,0x43,0x80,0x40,0x40,0x80,0xc0,0x01,0x46,0x80,0x60,0x19,0x06,0x1e,0x71,0xc0,0xc0,0x42,0x08,0x0e,0x09,0x84,0x01,0x43,0x0b,0x0e,0x08,0x08,0xc0,
+0x04,0x41,0x80,0x80,0xc0,0x02,0x45,0xc0,0x33,0x0c,0x3c,0xe3,0x80,0xc0,0x42,0x10,0x1c,0x13,0x84,0x02,0x43,0x17,0x1c,0x10,0x10,0xc0,
+0x02,0x44,0x80,0x66,0x19,0x79,0xc6,0xc0,0x43,0x20,0x38,0x26,0x05,0x82,0x04,0x44,0x05,0x2f,0x38,0x20,0x20,0xc0,
+0x03,0x43,0xcc,0x32,0xf2,0x8c,0xc0,0x43,0x40,0x70,0x4c,0x0b,0x82,0x08,0x44,0x0b,0x5e,0x70,0x40,0x40,0xc0,
+0x03,0x43,0x98,0x64,0xe4,0x18,0xc0,0x4b,0x80,0xe0,0x98,0x16,0x11,0x10,0x11,0x17,0xbc,0xe0,0x80,0x80,0xc0,
+0x03,0x43,0x30,0xc8,0xc8,0x30,0xc0,0x00,0x48,0xc0,0x30,0x2c,0x23,0x20,0x23,0x2e,0x78,0xc0,0xc0,0x82,0x01,0x04,0x83,0x01,0xc0,
+0x03,0x43,0x60,0x90,0x90,0x60,0xc0,0x00,0x48,0x80,0x60,0x58,0x46,0x41,0x47,0x5c,0xf0,0x80,0xc0,0x42,0x02,0x03,0x02,0x04,0x43,0x02,0x03,0x02,0x02,0xc0,
 // 'AE'
-198,17,14,11,0,0,36,8,19,0x01,0xfe,0x00,0x00,0xc2,0x00,0x01,0x42,0x00,0x02,0x40,0x00,0x02,0x44,0x00,0x04,0x7c,0x00,0x07,0xc4,0x00,0x08,0x40,0x00,0x08,0x40,0x00,0x10,0x41,0x00,0x3c,0xfe,0x00,0x00,0x00,0x00,
+15,2,14,8,11,2,
+0x01,0x45,0x80,0x60,0x58,0x45,0x43,0xff,0x82,0x21,0x41,0x71,0x07,0xc0,0x43,0x04,0x06,0x05,0x04,0x01,0x41,0x04,0x07,0x84,0x04,0x40,0x02,0xc0,
+0x02,0x44,0xc0,0xb0,0x8a,0x86,0xfe,0x82,0x42,0x41,0xe2,0x0e,0xc0,0x43,0x08,0x0c,0x0b,0x08,0x01,0x41,0x08,0x0f,0x84,0x08,0x40,0x04,0xc0,
+0x02,0x44,0x80,0x60,0x14,0x0c,0xfc,0x82,0x84,0x41,0xc4,0x1c,0xc0,0x47,0x10,0x18,0x16,0x11,0x01,0x01,0x11,0x1f,0x82,0x10,0x42,0x11,0x10,0x08,0xc0,
+0x03,0x43,0xc0,0x28,0x18,0xf8,0x82,0x08,0x41,0x88,0x38,0xc0,0x47,0x20,0x30,0x2c,0x23,0x02,0x02,0x22,0x3f,0x82,0x21,0x42,0x23,0x20,0x10,0xc0,
+0x03,0x43,0x80,0x50,0x30,0xf0,0x83,0x10,0x40,0x70,0xc0,0x47,0x40,0x60,0x58,0x46,0x05,0x04,0x44,0x7f,0x82,0x42,0x42,0x47,0x40,0x20,0xc0,
+0x04,0x42,0xa0,0x60,0xe0,0x83,0x20,0x40,0xe0,0xc0,0x47,0x80,0xc0,0xb0,0x8c,0x0b,0x08,0x88,0xff,0x82,0x84,0x42,0x8e,0x80,0x40,0xc0,
+0x04,0x42,0x40,0xc0,0xc0,0x83,0x40,0x40,0xc0,0xc0,0x00,0x46,0x80,0x60,0x18,0x16,0x11,0x10,0xff,0x82,0x08,0x42,0x1c,0x01,0x80,0xc0,0x83,0x01,0x01,0x86,0x01,0xc0,
+0x04,0x87,0x80,0xc0,0x01,0x45,0xc0,0x30,0x2c,0x22,0x21,0xff,0x82,0x10,0x41,0x38,0x03,0xc0,0x43,0x02,0x03,0x02,0x02,0x01,0x41,0x02,0x03,0x84,0x02,0x40,0x01,0xc0,
 // 'Ccedilla'
-199,13,10,15,0,-4,48,8,23,0x03,0xd0,0x00,0x0c,0x30,0x00,0x10,0x10,0x00,0x20,0x10,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x10,0x10,0x00,0x0c,0x60,0x00,0x03,0x80,0x00,0x01,0x00,0x00,0x03,0x80,0x00,0x00,0x80,0x00,0x07,0x00,0x00,0x00,0x00,0x00,
+11,2,10,8,15,2,
+0x43,0xf8,0x04,0x02,0x02,0x83,0x01,0x41,0x02,0x0f,0xc0,0x00,0x48,0x01,0x02,0x42,0x54,0x5c,0x34,0x02,0x02,0x01,0xc0,
+0x43,0xf0,0x08,0x04,0x04,0x83,0x02,0x41,0x04,0x1e,0xc0,0x49,0x01,0x02,0x04,0x84,0xa8,0xb8,0x68,0x04,0x04,0x02,0xc0,
+0x43,0xe0,0x10,0x08,0x08,0x83,0x04,0x41,0x08,0x3c,0xc0,0x49,0x03,0x04,0x08,0x08,0x50,0x70,0xd0,0x08,0x08,0x04,0xc0,0x02,0x82,0x01,0xc0,
+0x43,0xc0,0x20,0x10,0x10,0x83,0x08,0x41,0x10,0x78,0xc0,0x49,0x07,0x08,0x10,0x10,0xa0,0xe0,0xa0,0x10,0x10,0x08,0xc0,0x02,0x82,0x02,0x40,0x01,0xc0,
+0x43,0x80,0x40,0x20,0x20,0x83,0x10,0x41,0x20,0xf0,0xc0,0x49,0x0f,0x10,0x20,0x20,0x40,0xc0,0x40,0x20,0x20,0x10,0xc0,0x02,0x43,0x04,0x05,0x05,0x03,0xc0,
+0x00,0x42,0x80,0x40,0x40,0x83,0x20,0x41,0x40,0xe0,0xc0,0x43,0x1f,0x20,0x40,0x40,0x82,0x80,0x42,0x40,0x40,0x21,0xc0,0x02,0x43,0x08,0x0a,0x0b,0x06,0xc0,
+0x01,0x41,0x80,0x80,0x83,0x40,0x41,0x80,0xc0,0xc0,0x43,0x3e,0x41,0x80,0x80,0x02,0x42,0x80,0x80,0x43,0xc0,0x02,0x43,0x10,0x15,0x17,0x0d,0xc0,
+0x03,0x83,0x80,0x00,0x40,0x80,0xc0,0x43,0x7c,0x82,0x01,0x01,0x03,0x41,0x01,0x87,0xc0,0x01,0x46,0x01,0x21,0x2a,0x2e,0x1a,0x01,0x01,0xc0,
 // 'Egrave'
-200,12,9,15,0,0,48,4,19,0x08,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x10,0x40,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x80,0x00,0x1f,0x80,0x00,0x10,0x80,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x20,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,
+10,2,9,4,15,2,
+0x01,0x42,0x10,0x20,0x40,0xc0,0x41,0x01,0xff,0x83,0x21,0x41,0x71,0x03,0xc0,0x41,0x04,0x07,0x85,0x04,0x40,0x02,0xc0,
+0x01,0x42,0x20,0x40,0x80,0xc0,0x41,0x02,0xfe,0x83,0x42,0x41,0xe2,0x06,0xc0,0x41,0x08,0x0f,0x85,0x08,0x40,0x04,0xc0,
+0x01,0x41,0x40,0x80,0xc0,0x47,0x04,0xfc,0x84,0x84,0x85,0x84,0xc4,0x0c,0xc0,0x41,0x10,0x1f,0x83,0x10,0x42,0x11,0x10,0x08,0xc0,
+0x01,0x40,0x80,0xc0,0x47,0x08,0xf8,0x08,0x09,0x0a,0x08,0x88,0x18,0xc0,0x41,0x20,0x3f,0x83,0x21,0x42,0x23,0x20,0x10,0xc0,
+0x47,0x10,0xf0,0x11,0x12,0x14,0x10,0x10,0x30,0xc0,0x41,0x40,0x7f,0x83,0x42,0x42,0x47,0x40,0x20,0xc0,
+0x47,0x20,0xe0,0x22,0x24,0x28,0x20,0x20,0x60,0xc0,0x41,0x80,0xff,0x83,0x84,0x42,0x8e,0x80,0x40,0xc0,
+0x47,0x40,0xc0,0x44,0x48,0x50,0x40,0x40,0xc0,0xc0,0x00,0x40,0xff,0x83,0x08,0x42,0x1c,0x00,0x80,0xc0,0x87,0x01,0xc0,
+0x44,0x80,0x80,0x88,0x90,0xa0,0x82,0x80,0xc0,0x00,0x40,0xff,0x83,0x10,0x41,0x38,0x01,0xc0,0x41,0x02,0x03,0x85,0x02,0x40,0x01,0xc0,
 // 'Eacute'
-201,12,9,15,0,0,48,4,19,0x00,0x80,0x00,0x01,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x10,0x40,0x00,0x10,0x40,0x00,0x10,0x00,0x00,0x10,0x80,0x00,0x1f,0x80,0x00,0x10,0x80,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x20,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,
+10,2,9,4,15,2,
+0x03,0x42,0x40,0x20,0x10,0xc0,0x41,0x01,0xff,0x83,0x21,0x41,0x71,0x07,0xc0,0x41,0x04,0x07,0x85,0x04,0x40,0x02,0xc0,
+0x03,0x42,0x80,0x40,0x20,0xc0,0x41,0x02,0xfe,0x83,0x42,0x41,0xe2,0x0e,0xc0,0x41,0x08,0x0f,0x85,0x08,0x40,0x04,0xc0,
+0x04,0x41,0x80,0x40,0xc0,0x47,0x04,0xfc,0x84,0x84,0x85,0x84,0xc4,0x1c,0xc0,0x41,0x10,0x1f,0x83,0x10,0x42,0x11,0x10,0x08,0xc0,
+0x05,0x40,0x80,0xc0,0x47,0x08,0xf8,0x08,0x08,0x0a,0x09,0x88,0x38,0xc0,0x41,0x20,0x3f,0x83,0x21,0x42,0x23,0x20,0x10,0xc0,
+0x47,0x10,0xf0,0x10,0x10,0x14,0x12,0x11,0x70,0xc0,0x41,0x40,0x7f,0x83,0x42,0x42,0x47,0x40,0x20,0xc0,
+0x47,0x20,0xe0,0x20,0x20,0x28,0x24,0x22,0xe0,0xc0,0x41,0x80,0xff,0x83,0x84,0x42,0x8e,0x80,0x40,0xc0,
+0x47,0x40,0xc0,0x40,0x40,0x50,0x48,0x44,0xc0,0xc0,0x00,0x40,0xff,0x83,0x08,0x42,0x1c,0x01,0x80,0xc0,0x87,0x01,0xc0,
+0x83,0x80,0x43,0xa0,0x90,0x88,0x80,0xc0,0x00,0x40,0xff,0x83,0x10,0x41,0x38,0x03,0xc0,0x41,0x02,0x03,0x85,0x02,0x40,0x01,0xc0,
 // 'Ecircumflex'
-202,12,9,15,0,0,48,4,19,0x02,0x00,0x00,0x05,0x00,0x00,0x08,0x80,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x10,0x40,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x80,0x00,0x1f,0x80,0x00,0x10,0x80,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x20,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,
+10,2,9,4,15,2,
+0x01,0x44,0x40,0x20,0x10,0x20,0x40,0xc0,0x41,0x01,0xff,0x83,0x21,0x41,0x71,0x03,0xc0,0x41,0x04,0x07,0x85,0x04,0x40,0x02,0xc0,
+0x01,0x44,0x80,0x40,0x20,0x40,0x80,0xc0,0x41,0x02,0xfe,0x83,0x42,0x41,0xe2,0x06,0xc0,0x41,0x08,0x0f,0x85,0x08,0x40,0x04,0xc0,
+0x02,0x42,0x80,0x40,0x80,0xc0,0x42,0x04,0xfc,0x85,0x82,0x84,0x41,0xc5,0x0c,0xc0,0x41,0x10,0x1f,0x83,0x10,0x42,0x11,0x10,0x08,0xc0,
+0x03,0x40,0x80,0xc0,0x47,0x08,0xf8,0x0a,0x09,0x08,0x09,0x8a,0x18,0xc0,0x41,0x20,0x3f,0x83,0x21,0x42,0x23,0x20,0x10,0xc0,
+0x47,0x10,0xf0,0x14,0x12,0x11,0x12,0x14,0x30,0xc0,0x41,0x40,0x7f,0x83,0x42,0x42,0x47,0x40,0x20,0xc0,
+0x47,0x20,0xe0,0x28,0x24,0x22,0x24,0x28,0x60,0xc0,0x41,0x80,0xff,0x83,0x84,0x42,0x8e,0x80,0x40,0xc0,
+0x47,0x40,0xc0,0x50,0x48,0x44,0x48,0x50,0xc0,0xc0,0x00,0x40,0xff,0x83,0x08,0x42,0x1c,0x00,0x80,0xc0,0x87,0x01,0xc0,
+0x47,0x80,0x80,0xa0,0x90,0x88,0x90,0xa0,0x80,0xc0,0x00,0x40,0xff,0x83,0x10,0x41,0x38,0x01,0xc0,0x41,0x02,0x03,0x85,0x02,0x40,0x01,0xc0,
 // 'Edieresis'
-203,12,9,14,0,0,45,5,19,0x09,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x10,0x40,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x80,0x00,0x1f,0x80,0x00,0x10,0x80,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x20,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,
+10,2,9,5,14,2,
+0x01,0x40,0x60,0x01,0x40,0x60,0xc0,0x41,0x01,0xff,0x83,0x21,0x41,0x71,0x03,0xc0,0x41,0x04,0x07,0x85,0x04,0x40,0x02,0xc0,
+0x01,0x40,0xc0,0x01,0x40,0xc0,0xc0,0x41,0x02,0xfe,0x83,0x42,0x41,0xe2,0x06,0xc0,0x41,0x08,0x0f,0x85,0x08,0x40,0x04,0xc0,
+0x01,0x40,0x80,0x01,0x40,0x80,0xc0,0x47,0x04,0xfc,0x85,0x84,0x84,0x85,0xc4,0x0c,0xc0,0x41,0x10,0x1f,0x83,0x10,0x42,0x11,0x10,0x08,0xc0,
+0x47,0x08,0xf8,0x0b,0x08,0x08,0x0b,0x88,0x18,0xc0,0x41,0x20,0x3f,0x83,0x21,0x42,0x23,0x20,0x10,0xc0,
+0x47,0x10,0xf0,0x16,0x10,0x10,0x16,0x10,0x30,0xc0,0x41,0x40,0x7f,0x83,0x42,0x42,0x47,0x40,0x20,0xc0,
+0x47,0x20,0xe0,0x2c,0x20,0x20,0x2c,0x20,0x60,0xc0,0x41,0x80,0xff,0x83,0x84,0x42,0x8e,0x80,0x40,0xc0,
+0x47,0x40,0xc0,0x58,0x40,0x40,0x58,0x40,0xc0,0xc0,0x00,0x40,0xff,0x83,0x08,0x42,0x1c,0x00,0x80,0xc0,0x87,0x01,0xc0,
+0x47,0x80,0x80,0xb0,0x80,0x80,0xb0,0x80,0x80,0xc0,0x00,0x40,0xff,0x83,0x10,0x41,0x38,0x01,0xc0,0x41,0x02,0x03,0x85,0x02,0x40,0x01,0xc0,
 // 'Igrave'
-204,6,4,15,-1,0,48,4,19,0x40,0x00,0x00,0x20,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+5,1,4,4,15,0,
+0x10,0x20,0x40,0x00,0x00,0x01,0xff,0x01,0x00,0x04,0x07,0x04,
+0x20,0x40,0x80,0x00,0x00,0x02,0xfe,0x02,0x00,0x08,0x0f,0x08,
+0x40,0x80,0x00,0x00,0x00,0x04,0xfd,0x04,0x00,0x10,0x1f,0x10,
+0x80,0x00,0x00,0x00,0x00,0x09,0xfa,0x08,0x00,0x20,0x3f,0x20,
+0x01,0x12,0xf4,0x10,0x00,0x40,0x7f,0x40,
+0x02,0x24,0xe8,0x20,0x00,0x80,0xff,0x80,
+0x04,0x48,0xd0,0x40,0x00,0x00,0xff,0x00,0x00,0x01,0x01,0x01,
+0x08,0x90,0xa0,0x80,0x00,0x00,0xff,0x00,0x00,0x02,0x03,0x02,
 // 'Iacute'
-205,7,5,15,0,0,48,4,19,0x02,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+5,2,5,4,15,0,
+0x00,0x00,0x40,0x20,0x10,0x01,0xff,0x01,0x00,0x00,0x04,0x07,0x04,0x00,0x00,
+0x00,0x00,0x80,0x40,0x20,0x02,0xfe,0x02,0x00,0x00,0x08,0x0f,0x08,0x00,0x00,
+0x00,0x00,0x00,0x80,0x40,0x04,0xfc,0x05,0x00,0x00,0x10,0x1f,0x10,0x00,0x00,
+0x00,0x00,0x00,0x00,0x80,0x08,0xf8,0x0a,0x01,0x00,0x20,0x3f,0x20,0x00,0x00,
+0x10,0xf0,0x14,0x02,0x01,0x40,0x7f,0x40,0x00,0x00,
+0x20,0xe0,0x28,0x04,0x02,0x80,0xff,0x80,0x00,0x00,
+0x40,0xc0,0x50,0x08,0x04,0x00,0xff,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x80,0x80,0xa0,0x10,0x08,0x00,0xff,0x00,0x00,0x00,0x02,0x03,0x02,0x00,0x00,
 // 'Icircumflex'
-206,6,5,15,-1,0,48,4,19,0x10,0x00,0x00,0x28,0x00,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+5,1,5,4,15,0,
+0x40,0x20,0x10,0x20,0x40,0x00,0x01,0xff,0x01,0x00,0x00,0x04,0x07,0x04,0x00,
+0x80,0x40,0x20,0x40,0x80,0x00,0x02,0xfe,0x02,0x00,0x00,0x08,0x0f,0x08,0x00,
+0x00,0x80,0x40,0x80,0x00,0x01,0x04,0xfc,0x04,0x01,0x00,0x10,0x1f,0x10,0x00,
+0x00,0x00,0x80,0x00,0x00,0x02,0x09,0xf8,0x09,0x02,0x00,0x20,0x3f,0x20,0x00,
+0x04,0x12,0xf1,0x12,0x04,0x00,0x40,0x7f,0x40,0x00,
+0x08,0x24,0xe2,0x24,0x08,0x00,0x80,0xff,0x80,0x00,
+0x10,0x48,0xc4,0x48,0x10,0x00,0x00,0xff,0x00,0x00,0x00,0x01,0x01,0x01,0x00,
+0x20,0x90,0x88,0x90,0x20,0x00,0x00,0xff,0x00,0x00,0x00,0x02,0x03,0x02,0x00,
 // 'Idieresis'
-207,7,3,14,0,0,45,5,19,0x28,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+5,2,3,5,14,0,
+0x60,0x00,0x60,0x01,0xff,0x01,0x04,0x07,0x04,
+0xc0,0x00,0xc0,0x02,0xfe,0x02,0x08,0x0f,0x08,
+0x80,0x00,0x80,0x05,0xfc,0x05,0x10,0x1f,0x10,
+0x0b,0xf8,0x0b,0x20,0x3f,0x20,
+0x16,0xf0,0x16,0x40,0x7f,0x40,
+0x2c,0xe0,0x2c,0x80,0xff,0x80,
+0x58,0xc0,0x58,0x00,0xff,0x00,0x01,0x01,0x01,
+0xb0,0x80,0xb0,0x00,0xff,0x00,0x02,0x03,0x02,
 // 'Eth'
-208,15,10,11,1,0,36,8,19,0x1f,0x80,0x00,0x08,0x60,0x00,0x08,0x10,0x00,0x08,0x08,0x00,0x08,0x08,0x00,0x1f,0x08,0x00,0x08,0x08,0x00,0x08,0x08,0x00,0x08,0x10,0x00,0x08,0x60,0x00,0x1f,0x80,0x00,0x00,0x00,0x00,
+12,3,10,8,11,0,
+0x21,0xff,0x21,0x21,0x21,0x01,0x02,0x02,0x04,0xf8,0x04,0x07,0x04,0x04,0x04,0x04,0x02,0x02,0x01,0x00,
+0x42,0xfe,0x42,0x42,0x42,0x02,0x04,0x04,0x08,0xf0,0x08,0x0f,0x08,0x08,0x08,0x08,0x04,0x04,0x02,0x01,
+0x84,0xfc,0x84,0x84,0x84,0x04,0x08,0x08,0x10,0xe0,0x10,0x1f,0x10,0x10,0x10,0x10,0x08,0x08,0x04,0x03,
+0x08,0xf8,0x08,0x08,0x08,0x08,0x10,0x10,0x20,0xc0,0x21,0x3f,0x21,0x21,0x21,0x20,0x10,0x10,0x08,0x07,
+0x10,0xf0,0x10,0x10,0x10,0x10,0x20,0x20,0x40,0x80,0x42,0x7f,0x42,0x42,0x42,0x40,0x20,0x20,0x10,0x0f,
+0x20,0xe0,0x20,0x20,0x20,0x20,0x40,0x40,0x80,0x00,0x84,0xff,0x84,0x84,0x84,0x80,0x40,0x40,0x20,0x1f,
+0x40,0xc0,0x40,0x40,0x40,0x40,0x80,0x80,0x00,0x00,0x08,0xff,0x08,0x08,0x08,0x00,0x80,0x80,0x41,0x3e,0x01,0x01,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,
+0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x00,0x00,0x00,0x10,0xff,0x10,0x10,0x10,0x00,0x01,0x01,0x82,0x7c,0x02,0x03,0x02,0x02,0x02,0x02,0x01,0x01,0x00,0x00,
 // 'Ntilde'
-209,14,10,14,0,0,45,5,19,0x03,0x40,0x00,0x05,0x80,0x00,0x00,0x00,0x00,0x38,0x70,0x00,0x18,0x20,0x00,0x14,0x20,0x00,0x14,0x20,0x00,0x12,0x20,0x00,0x12,0x20,0x00,0x11,0x20,0x00,0x10,0xa0,0x00,0x10,0xa0,0x00,0x10,0x60,0x00,0x3c,0x20,0x00,0x00,0x00,0x00,
+12,2,10,5,14,0,
+0x00,0x00,0x00,0x40,0x20,0x60,0x40,0x20,0x00,0x00,0x01,0xff,0x03,0x0c,0x30,0x40,0x80,0x01,0xff,0x01,0x04,0x07,0x04,0x04,0x00,0x00,0x01,0x02,0x07,0x00,
+0x00,0x00,0x00,0x80,0x40,0xc0,0x80,0x40,0x00,0x00,0x02,0xfe,0x06,0x18,0x60,0x80,0x00,0x02,0xfe,0x02,0x08,0x0f,0x08,0x08,0x00,0x00,0x03,0x04,0x0f,0x00,
+0x00,0x00,0x00,0x00,0x80,0x80,0x00,0x80,0x00,0x00,0x04,0xfc,0x0c,0x31,0xc0,0x01,0x01,0x04,0xfc,0x04,0x10,0x1f,0x10,0x10,0x00,0x01,0x06,0x08,0x1f,0x00,
+0x08,0xf8,0x18,0x62,0x81,0x03,0x02,0x09,0xf8,0x08,0x20,0x3f,0x20,0x20,0x01,0x02,0x0c,0x10,0x3f,0x00,
+0x10,0xf0,0x30,0xc4,0x02,0x06,0x04,0x12,0xf0,0x10,0x40,0x7f,0x40,0x40,0x03,0x04,0x18,0x20,0x7f,0x00,
+0x20,0xe0,0x60,0x88,0x04,0x0c,0x08,0x24,0xe0,0x20,0x80,0xff,0x80,0x81,0x06,0x08,0x30,0x40,0xff,0x00,
+0x40,0xc0,0xc0,0x10,0x08,0x18,0x10,0x48,0xc0,0x40,0x00,0xff,0x00,0x03,0x0c,0x10,0x60,0x80,0xff,0x00,0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x01,0x00,
+0x80,0x80,0x80,0x20,0x10,0x30,0x20,0x90,0x80,0x80,0x00,0xff,0x01,0x06,0x18,0x20,0xc0,0x00,0xff,0x00,0x02,0x03,0x02,0x02,0x00,0x00,0x00,0x01,0x03,0x00,
 // 'Ograve'
-210,15,9,15,1,0,48,4,19,0x04,0x00,0x00,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x0c,0x60,0x00,0x08,0x20,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x08,0x20,0x00,0x0c,0x60,0x00,0x03,0x80,0x00,0x00,0x00,0x00,
+12,3,9,4,15,0,
+0x00,0x00,0x10,0x20,0x40,0x00,0x00,0x00,0x00,0xf8,0x06,0x02,0x01,0x01,0x01,0x02,0x06,0xf8,0x00,0x03,0x02,0x04,0x04,0x04,0x02,0x03,0x00,
+0x00,0x00,0x20,0x40,0x80,0x00,0x00,0x00,0x00,0xf0,0x0c,0x04,0x02,0x02,0x02,0x04,0x0c,0xf0,0x01,0x06,0x04,0x08,0x08,0x08,0x04,0x06,0x01,
+0x00,0x00,0x40,0x80,0x00,0x00,0x00,0x00,0x00,0xe0,0x18,0x08,0x04,0x05,0x04,0x08,0x18,0xe0,0x03,0x0c,0x08,0x10,0x10,0x10,0x08,0x0c,0x03,
+0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x30,0x10,0x09,0x0a,0x08,0x10,0x30,0xc0,0x07,0x18,0x10,0x20,0x20,0x20,0x10,0x18,0x07,
+0x80,0x60,0x21,0x12,0x14,0x10,0x20,0x60,0x80,0x0f,0x30,0x20,0x40,0x40,0x40,0x20,0x30,0x0f,
+0x00,0xc0,0x42,0x24,0x28,0x20,0x40,0xc0,0x00,0x1f,0x60,0x40,0x80,0x80,0x80,0x40,0x60,0x1f,
+0x00,0x80,0x84,0x48,0x50,0x40,0x80,0x80,0x00,0x3e,0xc1,0x80,0x00,0x00,0x00,0x80,0xc1,0x3e,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,
+0x00,0x00,0x08,0x90,0xa0,0x80,0x00,0x00,0x00,0x7c,0x83,0x01,0x00,0x00,0x00,0x01,0x83,0x7c,0x00,0x01,0x01,0x02,0x02,0x02,0x01,0x01,0x00,
 // 'Oacute'
-211,15,9,15,1,0,48,4,19,0x00,0x40,0x00,0x00,0x80,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x0c,0x60,0x00,0x08,0x20,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x08,0x20,0x00,0x0c,0x60,0x00,0x03,0x80,0x00,0x00,0x00,0x00,
+12,3,9,4,15,0,
+0x00,0x00,0x00,0x00,0x40,0x20,0x10,0x00,0x00,0xf8,0x06,0x02,0x01,0x01,0x01,0x02,0x06,0xf8,0x00,0x03,0x02,0x04,0x04,0x04,0x02,0x03,0x00,
+0x00,0x00,0x00,0x00,0x80,0x40,0x20,0x00,0x00,0xf0,0x0c,0x04,0x02,0x02,0x02,0x04,0x0c,0xf0,0x01,0x06,0x04,0x08,0x08,0x08,0x04,0x06,0x01,
+0x00,0x00,0x00,0x00,0x00,0x80,0x40,0x00,0x00,0xe0,0x18,0x08,0x04,0x05,0x04,0x08,0x18,0xe0,0x03,0x0c,0x08,0x10,0x10,0x10,0x08,0x0c,0x03,
+0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0xc0,0x30,0x10,0x08,0x0a,0x09,0x10,0x30,0xc0,0x07,0x18,0x10,0x20,0x20,0x20,0x10,0x18,0x07,
+0x80,0x60,0x20,0x10,0x14,0x12,0x21,0x60,0x80,0x0f,0x30,0x20,0x40,0x40,0x40,0x20,0x30,0x0f,
+0x00,0xc0,0x40,0x20,0x28,0x24,0x42,0xc0,0x00,0x1f,0x60,0x40,0x80,0x80,0x80,0x40,0x60,0x1f,
+0x00,0x80,0x80,0x40,0x50,0x48,0x84,0x80,0x00,0x3e,0xc1,0x80,0x00,0x00,0x00,0x80,0xc1,0x3e,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,
+0x00,0x00,0x00,0x80,0xa0,0x90,0x08,0x00,0x00,0x7c,0x83,0x01,0x00,0x00,0x00,0x01,0x83,0x7c,0x00,0x01,0x01,0x02,0x02,0x02,0x01,0x01,0x00,
 // 'Ocircumflex'
-212,15,9,15,1,0,48,4,19,0x01,0x00,0x00,0x02,0x80,0x00,0x04,0x40,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x0c,0x60,0x00,0x08,0x20,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x08,0x20,0x00,0x0c,0x60,0x00,0x03,0x80,0x00,0x00,0x00,0x00,
+12,3,9,4,15,0,
+0x00,0x00,0x40,0x20,0x10,0x20,0x40,0x00,0x00,0xf8,0x06,0x02,0x01,0x01,0x01,0x02,0x06,0xf8,0x00,0x03,0x02,0x04,0x04,0x04,0x02,0x03,0x00,
+0x00,0x00,0x80,0x40,0x20,0x40,0x80,0x00,0x00,0xf0,0x0c,0x04,0x02,0x02,0x02,0x04,0x0c,0xf0,0x01,0x06,0x04,0x08,0x08,0x08,0x04,0x06,0x01,
+0x00,0x00,0x00,0x80,0x40,0x80,0x00,0x00,0x00,0xe0,0x18,0x09,0x04,0x04,0x04,0x09,0x18,0xe0,0x03,0x0c,0x08,0x10,0x10,0x10,0x08,0x0c,0x03,
+0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0xc0,0x30,0x12,0x09,0x08,0x09,0x12,0x30,0xc0,0x07,0x18,0x10,0x20,0x20,0x20,0x10,0x18,0x07,
+0x80,0x60,0x24,0x12,0x11,0x12,0x24,0x60,0x80,0x0f,0x30,0x20,0x40,0x40,0x40,0x20,0x30,0x0f,
+0x00,0xc0,0x48,0x24,0x22,0x24,0x48,0xc0,0x00,0x1f,0x60,0x40,0x80,0x80,0x80,0x40,0x60,0x1f,
+0x00,0x80,0x90,0x48,0x44,0x48,0x90,0x80,0x00,0x3e,0xc1,0x80,0x00,0x00,0x00,0x80,0xc1,0x3e,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,
+0x00,0x00,0x20,0x90,0x88,0x90,0x20,0x00,0x00,0x7c,0x83,0x01,0x00,0x00,0x00,0x01,0x83,0x7c,0x00,0x01,0x01,0x02,0x02,0x02,0x01,0x01,0x00,
 // 'Otilde'
-213,15,9,14,1,0,45,5,19,0x03,0x40,0x00,0x05,0x80,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x0c,0x60,0x00,0x08,0x20,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x08,0x20,0x00,0x0c,0x60,0x00,0x03,0x80,0x00,0x00,0x00,0x00,
+12,3,9,5,14,0,
+0x00,0x00,0x40,0x20,0x60,0x40,0x20,0x00,0x00,0xf8,0x06,0x02,0x01,0x01,0x01,0x02,0x06,0xf8,0x00,0x03,0x02,0x04,0x04,0x04,0x02,0x03,0x00,
+0x00,0x00,0x80,0x40,0xc0,0x80,0x40,0x00,0x00,0xf0,0x0c,0x04,0x02,0x02,0x02,0x04,0x0c,0xf0,0x01,0x06,0x04,0x08,0x08,0x08,0x04,0x06,0x01,
+0x00,0x00,0x00,0x80,0x80,0x00,0x80,0x00,0x00,0xe0,0x18,0x09,0x04,0x05,0x05,0x08,0x18,0xe0,0x03,0x0c,0x08,0x10,0x10,0x10,0x08,0x0c,0x03,
+0xc0,0x30,0x12,0x09,0x0b,0x0a,0x11,0x30,0xc0,0x07,0x18,0x10,0x20,0x20,0x20,0x10,0x18,0x07,
+0x80,0x60,0x24,0x12,0x16,0x14,0x22,0x60,0x80,0x0f,0x30,0x20,0x40,0x40,0x40,0x20,0x30,0x0f,
+0x00,0xc0,0x48,0x24,0x2c,0x28,0x44,0xc0,0x00,0x1f,0x60,0x40,0x80,0x80,0x80,0x40,0x60,0x1f,
+0x00,0x80,0x90,0x48,0x58,0x50,0x88,0x80,0x00,0x3e,0xc1,0x80,0x00,0x00,0x00,0x80,0xc1,0x3e,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,
+0x00,0x00,0x20,0x90,0xb0,0xa0,0x10,0x00,0x00,0x7c,0x83,0x01,0x00,0x00,0x00,0x01,0x83,0x7c,0x00,0x01,0x01,0x02,0x02,0x02,0x01,0x01,0x00,
 // 'Odieresis'
-214,15,9,14,1,0,45,5,19,0x04,0x40,0x00,0x04,0x40,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x0c,0x60,0x00,0x08,0x20,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x10,0x10,0x00,0x08,0x20,0x00,0x0c,0x60,0x00,0x03,0x80,0x00,0x00,0x00,0x00,
+12,3,9,5,14,0,
+0x00,0x00,0x60,0x00,0x00,0x00,0x60,0x00,0x00,0xf8,0x06,0x02,0x01,0x01,0x01,0x02,0x06,0xf8,0x00,0x03,0x02,0x04,0x04,0x04,0x02,0x03,0x00,
+0x00,0x00,0xc0,0x00,0x00,0x00,0xc0,0x00,0x00,0xf0,0x0c,0x04,0x02,0x02,0x02,0x04,0x0c,0xf0,0x01,0x06,0x04,0x08,0x08,0x08,0x04,0x06,0x01,
+0x00,0x00,0x80,0x00,0x00,0x00,0x80,0x00,0x00,0xe0,0x18,0x09,0x04,0x04,0x04,0x09,0x18,0xe0,0x03,0x0c,0x08,0x10,0x10,0x10,0x08,0x0c,0x03,
+0xc0,0x30,0x13,0x08,0x08,0x08,0x13,0x30,0xc0,0x07,0x18,0x10,0x20,0x20,0x20,0x10,0x18,0x07,
+0x80,0x60,0x26,0x10,0x10,0x10,0x26,0x60,0x80,0x0f,0x30,0x20,0x40,0x40,0x40,0x20,0x30,0x0f,
+0x00,0xc0,0x4c,0x20,0x20,0x20,0x4c,0xc0,0x00,0x1f,0x60,0x40,0x80,0x80,0x80,0x40,0x60,0x1f,
+0x00,0x80,0x98,0x40,0x40,0x40,0x98,0x80,0x00,0x3e,0xc1,0x80,0x00,0x00,0x00,0x80,0xc1,0x3e,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,
+0x00,0x00,0x30,0x80,0x80,0x80,0x30,0x00,0x00,0x7c,0x83,0x01,0x00,0x00,0x00,0x01,0x83,0x7c,0x00,0x01,0x01,0x02,0x02,0x02,0x01,0x01,0x00,
 // 'multiply'
-215,12,7,7,1,0,24,12,19,0x10,0x40,0x00,0x08,0x80,0x00,0x05,0x00,0x00,0x02,0x00,0x00,0x05,0x00,0x00,0x08,0x80,0x00,0x10,0x40,0x00,0x00,0x00,0x00,
+9,3,7,12,7,0,
+0x10,0x20,0x40,0x80,0x40,0x20,0x10,0x04,0x02,0x01,0x00,0x01,0x02,0x04,
+0x20,0x40,0x80,0x00,0x80,0x40,0x20,0x08,0x04,0x02,0x01,0x02,0x04,0x08,
+0x40,0x80,0x00,0x00,0x00,0x80,0x40,0x10,0x08,0x05,0x02,0x05,0x08,0x10,
+0x80,0x00,0x00,0x00,0x00,0x00,0x80,0x20,0x11,0x0a,0x04,0x0a,0x11,0x20,
+0x41,0x22,0x14,0x08,0x14,0x22,0x41,
+0x82,0x44,0x28,0x10,0x28,0x44,0x82,
+0x04,0x88,0x50,0x20,0x50,0x88,0x04,0x01,0x00,0x00,0x00,0x00,0x00,0x01,
+0x08,0x10,0xa0,0x40,0xa0,0x10,0x08,0x02,0x01,0x00,0x00,0x00,0x01,0x02,
 // 'Oslash'
-216,14,11,13,0,-1,42,7,20,0x00,0x10,0x00,0x03,0x90,0x00,0x0c,0x60,0x00,0x10,0x50,0x00,0x20,0x88,0x00,0x21,0x08,0x00,0x21,0x08,0x00,0x22,0x08,0x00,0x24,0x08,0x00,0x14,0x10,0x00,0x0c,0x60,0x00,0x13,0x80,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+12,2,11,7,13,0,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x00,0xf8,0x04,0x02,0x82,0x41,0x31,0x09,0x06,0x02,0x05,0xf8,0x00,0x0d,0x02,0x03,0x04,0x04,0x04,0x02,0x02,0x01,0x00,
+0xf0,0x08,0x04,0x04,0x82,0x62,0x12,0x0c,0x04,0x0b,0xf0,0x01,0x1a,0x04,0x07,0x08,0x08,0x08,0x04,0x04,0x02,0x01,
+0xe0,0x10,0x08,0x08,0x04,0xc4,0x24,0x18,0x08,0x16,0xe0,0x03,0x34,0x08,0x0e,0x11,0x10,0x10,0x08,0x08,0x04,0x03,
+0xc0,0x20,0x10,0x10,0x08,0x88,0x48,0x30,0x10,0x2c,0xc0,0x07,0x68,0x10,0x1c,0x22,0x21,0x20,0x10,0x10,0x08,0x07,
+0x80,0x40,0x20,0x20,0x10,0x10,0x90,0x60,0x20,0x58,0x80,0x0f,0xd0,0x20,0x38,0x44,0x43,0x40,0x20,0x20,0x10,0x0f,
+0x00,0x80,0x40,0x40,0x20,0x20,0x20,0xc0,0x40,0xb0,0x00,0x1f,0xa0,0x40,0x70,0x88,0x86,0x81,0x40,0x40,0x20,0x1f,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x80,0x80,0x40,0x40,0x40,0x80,0x80,0x60,0x00,0x3e,0x41,0x80,0xe0,0x10,0x0c,0x02,0x81,0x80,0x41,0x3e,0x00,0x03,0x00,0x00,0x01,0x01,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x80,0x80,0x80,0x00,0x00,0xc0,0x00,0x7c,0x82,0x01,0xc1,0x20,0x18,0x04,0x03,0x01,0x82,0x7c,0x00,0x06,0x01,0x01,0x02,0x02,0x02,0x01,0x01,0x00,0x00,
 // 'Ugrave'
-217,14,10,15,0,0,48,4,19,0x04,0x00,0x00,0x02,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x38,0x70,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x08,0x40,0x00,0x07,0x80,0x00,0x00,0x00,0x00,
+12,2,10,4,15,2,
+0x02,0x42,0x10,0x20,0x40,0xc0,0x42,0x01,0xff,0x01,0x03,0x42,0x01,0xff,0x01,0xc0,0x00,0x41,0x01,0x02,0x83,0x04,0x41,0x02,0x01,0xc0,
+0x02,0x42,0x20,0x40,0x80,0xc0,0x42,0x02,0xfe,0x02,0x03,0x42,0x02,0xfe,0x02,0xc0,0x00,0x41,0x03,0x04,0x83,0x08,0x41,0x04,0x03,0xc0,
+0x02,0x41,0x40,0x80,0xc0,0x42,0x04,0xfc,0x04,0x01,0x44,0x01,0x00,0x04,0xfc,0x04,0xc0,0x00,0x41,0x07,0x08,0x83,0x10,0x41,0x08,0x07,0xc0,
+0x02,0x40,0x80,0xc0,0x49,0x08,0xf8,0x08,0x00,0x01,0x02,0x00,0x08,0xf8,0x08,0xc0,0x00,0x41,0x0f,0x10,0x83,0x20,0x41,0x10,0x0f,0xc0,
+0x49,0x10,0xf0,0x10,0x01,0x02,0x04,0x00,0x10,0xf0,0x10,0xc0,0x00,0x41,0x1f,0x20,0x83,0x40,0x41,0x20,0x1f,0xc0,
+0x49,0x20,0xe0,0x20,0x02,0x04,0x08,0x00,0x20,0xe0,0x20,0xc0,0x00,0x41,0x3f,0x40,0x83,0x80,0x41,0x40,0x3f,0xc0,
+0x49,0x40,0xc0,0x40,0x04,0x08,0x10,0x00,0x40,0xc0,0x40,0xc0,0x00,0x41,0x7f,0x80,0x03,0x41,0x80,0x7f,0xc0,0x02,0x83,0x01,0xc0,
+0x82,0x80,0x43,0x08,0x10,0x20,0x00,0x82,0x80,0xc0,0x00,0x40,0xff,0x05,0x40,0xff,0xc0,0x01,0x40,0x01,0x83,0x02,0x40,0x01,0xc0,
 // 'Uacute'
-218,14,10,15,0,0,48,4,19,0x00,0x40,0x00,0x00,0x80,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x38,0x70,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x08,0x40,0x00,0x07,0x80,0x00,0x00,0x00,0x00,
+12,2,10,4,15,2,
+0x04,0x42,0x40,0x20,0x10,0xc0,0x42,0x01,0xff,0x01,0x03,0x42,0x01,0xff,0x01,0xc0,0x00,0x41,0x01,0x02,0x83,0x04,0x41,0x02,0x01,0xc0,
+0x04,0x42,0x80,0x40,0x20,0xc0,0x42,0x02,0xfe,0x02,0x03,0x42,0x02,0xfe,0x02,0xc0,0x00,0x41,0x03,0x04,0x83,0x08,0x41,0x04,0x03,0xc0,
+0x05,0x41,0x80,0x40,0xc0,0x42,0x04,0xfc,0x04,0x01,0x44,0x01,0x00,0x04,0xfc,0x04,0xc0,0x00,0x41,0x07,0x08,0x83,0x10,0x41,0x08,0x07,0xc0,
+0x06,0x40,0x80,0xc0,0x42,0x08,0xf8,0x08,0x01,0x44,0x02,0x01,0x08,0xf8,0x08,0xc0,0x00,0x41,0x0f,0x10,0x83,0x20,0x41,0x10,0x0f,0xc0,
+0x42,0x10,0xf0,0x10,0x01,0x44,0x04,0x02,0x11,0xf0,0x10,0xc0,0x00,0x41,0x1f,0x20,0x83,0x40,0x41,0x20,0x1f,0xc0,
+0x42,0x20,0xe0,0x20,0x01,0x44,0x08,0x04,0x22,0xe0,0x20,0xc0,0x00,0x41,0x3f,0x40,0x83,0x80,0x41,0x40,0x3f,0xc0,
+0x42,0x40,0xc0,0x40,0x01,0x44,0x10,0x08,0x44,0xc0,0x40,0xc0,0x00,0x41,0x7f,0x80,0x03,0x41,0x80,0x7f,0xc0,0x02,0x83,0x01,0xc0,
+0x82,0x80,0x01,0x44,0x20,0x10,0x88,0x80,0x80,0xc0,0x00,0x40,0xff,0x05,0x40,0xff,0xc0,0x01,0x40,0x01,0x83,0x02,0x40,0x01,0xc0,
 // 'Ucircumflex'
-219,14,10,15,0,0,48,4,19,0x01,0x00,0x00,0x02,0x80,0x00,0x04,0x40,0x00,0x00,0x00,0x00,0x38,0x70,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x08,0x40,0x00,0x07,0x80,0x00,0x00,0x00,0x00,
+12,2,10,4,15,2,
+0x02,0x44,0x40,0x20,0x10,0x20,0x40,0xc0,0x42,0x01,0xff,0x01,0x03,0x42,0x01,0xff,0x01,0xc0,0x00,0x41,0x01,0x02,0x83,0x04,0x41,0x02,0x01,0xc0,
+0x02,0x44,0x80,0x40,0x20,0x40,0x80,0xc0,0x42,0x02,0xfe,0x02,0x03,0x42,0x02,0xfe,0x02,0xc0,0x00,0x41,0x03,0x04,0x83,0x08,0x41,0x04,0x03,0xc0,
+0x03,0x42,0x80,0x40,0x80,0xc0,0x43,0x04,0xfc,0x04,0x01,0x02,0x42,0x05,0xfc,0x04,0xc0,0x00,0x41,0x07,0x08,0x83,0x10,0x41,0x08,0x07,0xc0,
+0x04,0x40,0x80,0xc0,0x49,0x08,0xf8,0x08,0x02,0x01,0x00,0x01,0x0a,0xf8,0x08,0xc0,0x00,0x41,0x0f,0x10,0x83,0x20,0x41,0x10,0x0f,0xc0,
+0x49,0x10,0xf0,0x10,0x04,0x02,0x01,0x02,0x14,0xf0,0x10,0xc0,0x00,0x41,0x1f,0x20,0x83,0x40,0x41,0x20,0x1f,0xc0,
+0x49,0x20,0xe0,0x20,0x08,0x04,0x02,0x04,0x28,0xe0,0x20,0xc0,0x00,0x41,0x3f,0x40,0x83,0x80,0x41,0x40,0x3f,0xc0,
+0x49,0x40,0xc0,0x40,0x10,0x08,0x04,0x08,0x50,0xc0,0x40,0xc0,0x00,0x41,0x7f,0x80,0x03,0x41,0x80,0x7f,0xc0,0x02,0x83,0x01,0xc0,
+0x82,0x80,0x46,0x20,0x10,0x08,0x10,0xa0,0x80,0x80,0xc0,0x00,0x40,0xff,0x05,0x40,0xff,0xc0,0x01,0x40,0x01,0x83,0x02,0x40,0x01,0xc0,
 // 'Udieresis'
-220,14,10,14,0,0,45,5,19,0x04,0x80,0x00,0x04,0x80,0x00,0x00,0x00,0x00,0x38,0x70,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x10,0x20,0x00,0x08,0x40,0x00,0x07,0x80,0x00,0x00,0x00,0x00,
+12,2,10,5,14,2,
+0x02,0x40,0x60,0x01,0x40,0x60,0xc0,0x42,0x01,0xff,0x01,0x03,0x42,0x01,0xff,0x01,0xc0,0x00,0x41,0x01,0x02,0x83,0x04,0x41,0x02,0x01,0xc0,
+0x02,0x40,0xc0,0x01,0x40,0xc0,0xc0,0x42,0x02,0xfe,0x02,0x03,0x42,0x02,0xfe,0x02,0xc0,0x00,0x41,0x03,0x04,0x83,0x08,0x41,0x04,0x03,0xc0,
+0x02,0x40,0x80,0x01,0x40,0x80,0xc0,0x43,0x04,0xfc,0x04,0x01,0x01,0x43,0x01,0x04,0xfc,0x04,0xc0,0x00,0x41,0x07,0x08,0x83,0x10,0x41,0x08,0x07,0xc0,
+0x43,0x08,0xf8,0x08,0x03,0x01,0x43,0x03,0x08,0xf8,0x08,0xc0,0x00,0x41,0x0f,0x10,0x83,0x20,0x41,0x10,0x0f,0xc0,
+0x43,0x10,0xf0,0x10,0x06,0x01,0x43,0x06,0x10,0xf0,0x10,0xc0,0x00,0x41,0x1f,0x20,0x83,0x40,0x41,0x20,0x1f,0xc0,
+0x43,0x20,0xe0,0x20,0x0c,0x01,0x43,0x0c,0x20,0xe0,0x20,0xc0,0x00,0x41,0x3f,0x40,0x83,0x80,0x41,0x40,0x3f,0xc0,
+0x43,0x40,0xc0,0x40,0x18,0x01,0x43,0x18,0x40,0xc0,0x40,0xc0,0x00,0x41,0x7f,0x80,0x03,0x41,0x80,0x7f,0xc0,0x02,0x83,0x01,0xc0,
+0x82,0x80,0x40,0x30,0x01,0x40,0x30,0x82,0x80,0xc0,0x00,0x40,0xff,0x05,0x40,0xff,0xc0,0x01,0x40,0x01,0x83,0x02,0x40,0x01,0xc0,
 // 'Yacute'
-221,14,11,15,0,0,48,4,19,0x00,0x20,0x00,0x00,0x40,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x38,0x38,0x00,0x10,0x10,0x00,0x08,0x20,0x00,0x04,0x40,0x00,0x04,0x40,0x00,0x02,0x80,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x01,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,
+12,2,11,4,15,2,
+0x05,0x42,0x40,0x20,0x10,0xc0,0x4a,0x01,0x03,0x05,0x18,0x20,0xc0,0x20,0x18,0x05,0x03,0x01,0xc0,0x03,0x42,0x04,0x07,0x04,0xc0,
+0x05,0x42,0x80,0x40,0x20,0xc0,0x4a,0x02,0x06,0x0a,0x30,0x40,0x80,0x40,0x30,0x0a,0x06,0x02,0xc0,0x03,0x42,0x08,0x0f,0x08,0xc0,
+0x06,0x41,0x80,0x40,0xc0,0x4a,0x04,0x0c,0x14,0x60,0x80,0x00,0x81,0x60,0x14,0x0c,0x04,0xc0,0x03,0x42,0x10,0x1f,0x10,0xc0,
+0x07,0x40,0x80,0xc0,0x43,0x08,0x18,0x28,0xc0,0x01,0x44,0x02,0xc1,0x28,0x18,0x08,0xc0,0x03,0x42,0x21,0x3e,0x21,0xc0,
+0x43,0x10,0x30,0x50,0x80,0x01,0x44,0x04,0x82,0x51,0x30,0x10,0xc0,0x02,0x44,0x01,0x42,0x7c,0x42,0x01,0xc0,
+0x42,0x20,0x60,0xa0,0x02,0x44,0x08,0x04,0xa2,0x60,0x20,0xc0,0x02,0x44,0x03,0x84,0xf8,0x84,0x03,0xc0,
+0x42,0x40,0xc0,0x40,0x02,0x44,0x10,0x08,0x44,0xc0,0x40,0xc0,0x01,0x46,0x01,0x06,0x08,0xf0,0x08,0x06,0x01,0xc0,0x03,0x82,0x01,0xc0,
+0x82,0x80,0x02,0x44,0x20,0x10,0x88,0x80,0x80,0xc0,0x00,0x48,0x01,0x02,0x0c,0x10,0xe0,0x10,0x0c,0x02,0x01,0xc0,0x03,0x42,0x02,0x03,0x02,0xc0,
 // 'Thorn'
-222,11,8,11,0,0,36,8,19,0x38,0x00,0x00,0x10,0x00,0x00,0x1f,0x00,0x00,0x10,0x80,0x00,0x10,0x40,0x00,0x10,0x40,0x00,0x10,0x80,0x00,0x1f,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+9,2,8,8,11,2,
+0x42,0x01,0xff,0x85,0x82,0x84,0x41,0x48,0x30,0xc0,0x42,0x04,0x07,0x04,0xc0,
+0x42,0x02,0xfe,0x0a,0x82,0x08,0x41,0x90,0x60,0xc0,0x42,0x08,0x0f,0x09,0x82,0x01,0xc0,
+0x42,0x04,0xfc,0x14,0x82,0x10,0x41,0x20,0xc0,0xc0,0x42,0x10,0x1f,0x12,0x82,0x02,0x40,0x01,0xc0,
+0x42,0x08,0xf8,0x28,0x82,0x20,0x41,0x40,0x80,0xc0,0x42,0x20,0x3f,0x24,0x82,0x04,0x41,0x02,0x01,0xc0,
+0x42,0x10,0xf0,0x50,0x82,0x40,0x40,0x80,0xc0,0x42,0x40,0x7f,0x48,0x82,0x08,0x41,0x04,0x03,0xc0,
+0x42,0x20,0xe0,0xa0,0x82,0x80,0xc0,0x42,0x80,0xff,0x90,0x82,0x10,0x41,0x09,0x06,0xc0,
+0x42,0x40,0xc0,0x40,0xc0,0x00,0x40,0xff,0x83,0x21,0x41,0x12,0x0c,0xc0,0x82,0x01,0xc0,
+0x82,0x80,0xc0,0x00,0x40,0xff,0x83,0x42,0x41,0x24,0x18,0xc0,0x42,0x02,0x03,0x02,0xc0,
 // 'germandbls'
-223,10,7,11,0,0,36,8,19,0x0e,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x12,0x00,0x00,0x16,0x00,0x00,0x11,0x00,0x00,0x10,0x80,0x00,0x10,0x80,0x00,0x14,0x80,0x00,0x33,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,11,0,
+0x00,0xfe,0x01,0x21,0x31,0x4e,0x80,0x04,0x07,0x00,0x02,0x04,0x04,0x03,
+0x00,0xfc,0x02,0x42,0x62,0x9c,0x00,0x08,0x0f,0x00,0x04,0x08,0x08,0x07,
+0x00,0xf8,0x04,0x84,0xc4,0x38,0x00,0x10,0x1f,0x00,0x08,0x10,0x11,0x0e,
+0x00,0xf0,0x08,0x08,0x88,0x70,0x00,0x20,0x3f,0x00,0x11,0x21,0x22,0x1c,
+0x00,0xe0,0x10,0x10,0x10,0xe0,0x00,0x40,0x7f,0x00,0x22,0x43,0x44,0x38,
+0x00,0xc0,0x20,0x20,0x20,0xc0,0x00,0x80,0xff,0x00,0x44,0x86,0x89,0x70,
+0x00,0x80,0x40,0x40,0x40,0x80,0x00,0x00,0xff,0x00,0x88,0x0c,0x13,0xe0,0x01,0x01,0x00,0x00,0x01,0x01,0x00,
+0x00,0x00,0x80,0x80,0x80,0x00,0x00,0x00,0xff,0x00,0x10,0x18,0x27,0xc0,0x02,0x03,0x00,0x01,0x02,0x02,0x01,
 // 'agrave'
-224,10,7,12,1,0,39,7,19,0x08,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x07,0x00,0x00,0x19,0x00,0x00,0x11,0x00,0x00,0x13,0x40,0x00,0x0c,0x80,0x00,0x00,0x00,0x00,
+7,3,7,7,12,0,
+0x00,0x80,0x00,0x00,0x00,0x00,0x00,0xb0,0x88,0x49,0x4a,0xf0,0x00,0x00,0x03,0x04,0x04,0x02,0x03,0x04,0x02,
+0x60,0x11,0x92,0x94,0xe0,0x00,0x00,0x07,0x09,0x08,0x04,0x07,0x08,0x04,
+0xc0,0x22,0x24,0x28,0xc0,0x00,0x00,0x0e,0x12,0x11,0x09,0x0f,0x10,0x08,
+0x80,0x44,0x48,0x50,0x80,0x00,0x00,0x1d,0x24,0x22,0x12,0x1f,0x20,0x10,
+0x00,0x88,0x90,0xa0,0x00,0x00,0x00,0x3b,0x48,0x44,0x24,0x3f,0x40,0x20,
+0x00,0x10,0x20,0x40,0x00,0x00,0x00,0x76,0x91,0x89,0x49,0x7e,0x80,0x40,
+0x00,0x20,0x40,0x80,0x00,0x00,0x00,0xec,0x22,0x12,0x92,0xfc,0x00,0x80,0x00,0x01,0x01,0x00,0x00,0x01,0x00,
+0x00,0x40,0x80,0x00,0x00,0x00,0x00,0xd8,0x44,0x24,0x25,0xf8,0x00,0x00,0x01,0x02,0x02,0x01,0x01,0x02,0x01,
 // 'aacute'
-225,10,7,12,1,0,39,7,19,0x01,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x07,0x00,0x00,0x19,0x00,0x00,0x11,0x00,0x00,0x13,0x40,0x00,0x0c,0x80,0x00,0x00,0x00,0x00,
+7,3,7,7,12,0,
+0x00,0x00,0x00,0x00,0x80,0x00,0x00,0xb0,0x88,0x4a,0x49,0xf0,0x00,0x00,0x03,0x04,0x04,0x02,0x03,0x04,0x02,
+0x60,0x10,0x94,0x92,0xe1,0x00,0x00,0x07,0x09,0x08,0x04,0x07,0x08,0x04,
+0xc0,0x20,0x28,0x24,0xc2,0x00,0x00,0x0e,0x12,0x11,0x09,0x0f,0x10,0x08,
+0x80,0x40,0x50,0x48,0x84,0x00,0x00,0x1d,0x24,0x22,0x12,0x1f,0x20,0x10,
+0x00,0x80,0xa0,0x90,0x08,0x00,0x00,0x3b,0x48,0x44,0x24,0x3f,0x40,0x20,
+0x00,0x00,0x40,0x20,0x10,0x00,0x00,0x76,0x91,0x89,0x49,0x7e,0x80,0x40,
+0x00,0x00,0x80,0x40,0x20,0x00,0x00,0xec,0x22,0x12,0x92,0xfc,0x00,0x80,0x00,0x01,0x01,0x00,0x00,0x01,0x00,
+0x00,0x00,0x00,0x80,0x40,0x00,0x00,0xd8,0x44,0x25,0x24,0xf8,0x00,0x00,0x01,0x02,0x02,0x01,0x01,0x02,0x01,
 // 'acircumflex'
-226,10,7,12,1,0,39,7,19,0x04,0x00,0x00,0x0a,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x07,0x00,0x00,0x19,0x00,0x00,0x11,0x00,0x00,0x13,0x40,0x00,0x0c,0x80,0x00,0x00,0x00,0x00,
+7,3,7,7,12,0,
+0x00,0x00,0x80,0x00,0x00,0x00,0x00,0xb2,0x89,0x48,0x49,0xf2,0x00,0x00,0x03,0x04,0x04,0x02,0x03,0x04,0x02,
+0x64,0x12,0x91,0x92,0xe4,0x00,0x00,0x07,0x09,0x08,0x04,0x07,0x08,0x04,
+0xc8,0x24,0x22,0x24,0xc8,0x00,0x00,0x0e,0x12,0x11,0x09,0x0f,0x10,0x08,
+0x90,0x48,0x44,0x48,0x90,0x00,0x00,0x1d,0x24,0x22,0x12,0x1f,0x20,0x10,
+0x20,0x90,0x88,0x90,0x20,0x00,0x00,0x3b,0x48,0x44,0x24,0x3f,0x40,0x20,
+0x40,0x20,0x10,0x20,0x40,0x00,0x00,0x76,0x91,0x89,0x49,0x7e,0x80,0x40,
+0x80,0x40,0x20,0x40,0x80,0x00,0x00,0xec,0x22,0x12,0x92,0xfc,0x00,0x80,0x00,0x01,0x01,0x00,0x00,0x01,0x00,
+0x00,0x80,0x40,0x80,0x00,0x00,0x00,0xd9,0x44,0x24,0x24,0xf9,0x00,0x00,0x01,0x02,0x02,0x01,0x01,0x02,0x01,
 // 'atilde'
-227,10,7,11,1,0,36,8,19,0x0d,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x07,0x00,0x00,0x19,0x00,0x00,0x11,0x00,0x00,0x13,0x40,0x00,0x0c,0x80,0x00,0x00,0x00,0x00,
+7,3,7,8,11,0,
+0xb2,0x89,0x4b,0x4a,0xf1,0x00,0x00,0x03,0x04,0x04,0x02,0x03,0x04,0x02,
+0x64,0x12,0x96,0x94,0xe2,0x00,0x00,0x07,0x09,0x08,0x04,0x07,0x08,0x04,
+0xc8,0x24,0x2c,0x28,0xc4,0x00,0x00,0x0e,0x12,0x11,0x09,0x0f,0x10,0x08,
+0x90,0x48,0x58,0x50,0x88,0x00,0x00,0x1d,0x24,0x22,0x12,0x1f,0x20,0x10,
+0x20,0x90,0xb0,0xa0,0x10,0x00,0x00,0x3b,0x48,0x44,0x24,0x3f,0x40,0x20,
+0x40,0x20,0x60,0x40,0x20,0x00,0x00,0x76,0x91,0x89,0x49,0x7e,0x80,0x40,
+0x80,0x40,0xc0,0x80,0x40,0x00,0x00,0xec,0x22,0x12,0x92,0xfc,0x00,0x80,0x00,0x01,0x01,0x00,0x00,0x01,0x00,
+0x00,0x80,0x80,0x00,0x80,0x00,0x00,0xd9,0x44,0x25,0x25,0xf8,0x00,0x00,0x01,0x02,0x02,0x01,0x01,0x02,0x01,
 // 'adieresis'
-228,10,7,11,1,0,36,8,19,0x09,0x00,0x00,0x09,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x07,0x00,0x00,0x19,0x00,0x00,0x11,0x00,0x00,0x13,0x40,0x00,0x0c,0x80,0x00,0x00,0x00,0x00,
+7,3,7,8,11,0,
+0xb0,0x8b,0x48,0x48,0xf3,0x00,0x00,0x03,0x04,0x04,0x02,0x03,0x04,0x02,
+0x60,0x16,0x90,0x90,0xe6,0x00,0x00,0x07,0x09,0x08,0x04,0x07,0x08,0x04,
+0xc0,0x2c,0x20,0x20,0xcc,0x00,0x00,0x0e,0x12,0x11,0x09,0x0f,0x10,0x08,
+0x80,0x58,0x40,0x40,0x98,0x00,0x00,0x1d,0x24,0x22,0x12,0x1f,0x20,0x10,
+0x00,0xb0,0x80,0x80,0x30,0x00,0x00,0x3b,0x48,0x44,0x24,0x3f,0x40,0x20,
+0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x76,0x91,0x89,0x49,0x7e,0x80,0x40,
+0x00,0xc0,0x00,0x00,0xc0,0x00,0x00,0xec,0x22,0x12,0x92,0xfc,0x00,0x80,0x00,0x01,0x01,0x00,0x00,0x01,0x00,
+0x00,0x80,0x00,0x00,0x80,0x00,0x00,0xd8,0x45,0x24,0x24,0xf9,0x00,0x00,0x01,0x02,0x02,0x01,0x01,0x02,0x01,
 // 'aring'
-229,10,7,12,1,0,39,7,19,0x04,0x00,0x00,0x0a,0x00,0x00,0x0a,0x00,0x00,0x04,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x11,0x00,0x00,0x07,0x00,0x00,0x19,0x00,0x00,0x11,0x00,0x00,0x13,0x40,0x00,0x0c,0x80,0x00,0x00,0x00,0x00,
+7,3,7,7,12,0,
+0x00,0x00,0x80,0x00,0x00,0x00,0x00,0xb0,0x8b,0x4c,0x4b,0xf0,0x00,0x00,0x03,0x04,0x04,0x02,0x03,0x04,0x02,
+0x60,0x16,0x99,0x96,0xe0,0x00,0x00,0x07,0x09,0x08,0x04,0x07,0x08,0x04,
+0xc0,0x2c,0x32,0x2c,0xc0,0x00,0x00,0x0e,0x12,0x11,0x09,0x0f,0x10,0x08,
+0x80,0x58,0x64,0x58,0x80,0x00,0x00,0x1d,0x24,0x22,0x12,0x1f,0x20,0x10,
+0x00,0xb0,0xc8,0xb0,0x00,0x00,0x00,0x3b,0x48,0x44,0x24,0x3f,0x40,0x20,
+0x00,0x60,0x90,0x60,0x00,0x00,0x00,0x76,0x91,0x89,0x49,0x7e,0x80,0x40,
+0x00,0xc0,0x20,0xc0,0x00,0x00,0x00,0xec,0x22,0x13,0x92,0xfc,0x00,0x80,0x00,0x01,0x01,0x00,0x00,0x01,0x00,
+0x00,0x80,0x40,0x80,0x00,0x00,0x00,0xd8,0x45,0x26,0x25,0xf8,0x00,0x00,0x01,0x02,0x02,0x01,0x01,0x02,0x01,
 // 'ae'
-230,14,9,8,1,0,27,11,19,0x0e,0x60,0x00,0x11,0x90,0x00,0x11,0x10,0x00,0x07,0xf0,0x00,0x19,0x00,0x00,0x11,0x00,0x00,0x13,0x90,0x00,0x0c,0x60,0x00,0x00,0x00,0x00,
+11,3,9,11,8,0,
+0xb0,0x88,0x48,0x48,0xf0,0x50,0x48,0x48,0x70,0x03,0x04,0x04,0x02,0x03,0x02,0x04,0x04,0x02,
+0x60,0x10,0x90,0x90,0xe0,0xa0,0x90,0x90,0xe0,0x07,0x09,0x08,0x04,0x07,0x04,0x08,0x08,0x04,
+0xc0,0x20,0x20,0x20,0xc0,0x40,0x20,0x20,0xc0,0x0e,0x12,0x11,0x09,0x0f,0x09,0x11,0x11,0x09,
+0x80,0x40,0x40,0x40,0x80,0x80,0x40,0x40,0x80,0x1d,0x24,0x22,0x12,0x1f,0x12,0x22,0x22,0x13,
+0x00,0x80,0x80,0x80,0x00,0x00,0x80,0x80,0x00,0x3b,0x48,0x44,0x24,0x3f,0x25,0x44,0x44,0x27,
+0x76,0x91,0x89,0x49,0x7e,0x4a,0x89,0x89,0x4e,
+0xec,0x22,0x12,0x92,0xfc,0x94,0x12,0x12,0x9c,0x00,0x01,0x01,0x00,0x00,0x00,0x01,0x01,0x00,
+0xd8,0x44,0x24,0x24,0xf8,0x28,0x24,0x24,0x38,0x01,0x02,0x02,0x01,0x01,0x01,0x02,0x02,0x01,
 // 'ccedilla'
-231,9,6,12,0,-4,39,11,23,0x0e,0x00,0x00,0x11,0x00,0x00,0x21,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x04,0x00,0x00,0x0e,0x00,0x00,0x02,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,
+7,2,6,11,12,0,
+0xe0,0x10,0x08,0x08,0x08,0x30,0x01,0x42,0x54,0x5c,0x34,0x02,
+0xc0,0x20,0x10,0x10,0x10,0x60,0x03,0x84,0xa8,0xb8,0x68,0x04,
+0x80,0x40,0x20,0x20,0x20,0xc0,0x07,0x08,0x50,0x70,0xd0,0x08,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x80,0x40,0x40,0x40,0x80,0x0f,0x10,0xa0,0xe0,0xa0,0x11,0x00,0x02,0x02,0x02,0x01,0x00,
+0x00,0x00,0x80,0x80,0x80,0x00,0x1e,0x21,0x40,0xc0,0x40,0x23,0x00,0x04,0x05,0x05,0x03,0x00,
+0x3c,0x42,0x81,0x81,0x81,0x46,0x00,0x08,0x0a,0x0b,0x06,0x00,
+0x78,0x84,0x02,0x02,0x02,0x8c,0x00,0x10,0x15,0x17,0x0d,0x00,
+0xf0,0x08,0x04,0x04,0x04,0x18,0x00,0x21,0x2a,0x2e,0x1a,0x01,
 // 'egrave'
-232,9,6,12,0,0,39,7,19,0x10,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x21,0x00,0x00,0x3f,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+7,2,6,7,12,0,
+0x00,0x80,0x00,0x00,0x00,0x00,0xe0,0x50,0x49,0x4a,0x48,0x70,0x01,0x02,0x04,0x04,0x04,0x02,
+0xc0,0xa1,0x92,0x94,0x90,0xe0,0x03,0x04,0x08,0x08,0x08,0x04,
+0x80,0x42,0x24,0x28,0x20,0xc0,0x07,0x09,0x11,0x11,0x11,0x09,
+0x00,0x84,0x48,0x50,0x40,0x80,0x0f,0x12,0x22,0x22,0x22,0x13,
+0x00,0x08,0x90,0xa0,0x80,0x00,0x1e,0x25,0x44,0x44,0x44,0x27,
+0x00,0x10,0x20,0x40,0x00,0x00,0x3c,0x4a,0x89,0x89,0x89,0x4e,
+0x00,0x20,0x40,0x80,0x00,0x00,0x78,0x94,0x12,0x12,0x12,0x9c,0x00,0x00,0x01,0x01,0x01,0x00,
+0x00,0x40,0x80,0x00,0x00,0x00,0xf0,0x28,0x24,0x25,0x24,0x38,0x00,0x01,0x02,0x02,0x02,0x01,
 // 'eacute'
-233,9,6,12,0,0,39,7,19,0x01,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x21,0x00,0x00,0x3f,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+7,2,6,7,12,0,
+0x00,0x00,0x00,0x00,0x00,0x80,0xe0,0x50,0x48,0x4a,0x49,0x70,0x01,0x02,0x04,0x04,0x04,0x02,
+0xc0,0xa0,0x90,0x94,0x92,0xe1,0x03,0x04,0x08,0x08,0x08,0x04,
+0x80,0x40,0x20,0x28,0x24,0xc2,0x07,0x09,0x11,0x11,0x11,0x09,
+0x00,0x80,0x40,0x50,0x48,0x84,0x0f,0x12,0x22,0x22,0x22,0x13,
+0x00,0x00,0x80,0xa0,0x90,0x08,0x1e,0x25,0x44,0x44,0x44,0x27,
+0x00,0x00,0x00,0x40,0x20,0x10,0x3c,0x4a,0x89,0x89,0x89,0x4e,
+0x00,0x00,0x00,0x80,0x40,0x20,0x78,0x94,0x12,0x12,0x12,0x9c,0x00,0x00,0x01,0x01,0x01,0x00,
+0x00,0x00,0x00,0x00,0x80,0x40,0xf0,0x28,0x24,0x25,0x24,0x38,0x00,0x01,0x02,0x02,0x02,0x01,
 // 'ecircumflex'
-234,9,6,12,0,0,39,7,19,0x04,0x00,0x00,0x0a,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x21,0x00,0x00,0x3f,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+7,2,6,7,12,0,
+0x00,0x00,0x00,0x80,0x00,0x00,0xe0,0x52,0x49,0x48,0x49,0x72,0x01,0x02,0x04,0x04,0x04,0x02,
+0xc0,0xa4,0x92,0x91,0x92,0xe4,0x03,0x04,0x08,0x08,0x08,0x04,
+0x80,0x48,0x24,0x22,0x24,0xc8,0x07,0x09,0x11,0x11,0x11,0x09,
+0x00,0x90,0x48,0x44,0x48,0x90,0x0f,0x12,0x22,0x22,0x22,0x13,
+0x00,0x20,0x90,0x88,0x90,0x20,0x1e,0x25,0x44,0x44,0x44,0x27,
+0x00,0x40,0x20,0x10,0x20,0x40,0x3c,0x4a,0x89,0x89,0x89,0x4e,
+0x00,0x80,0x40,0x20,0x40,0x80,0x78,0x94,0x12,0x12,0x12,0x9c,0x00,0x00,0x01,0x01,0x01,0x00,
+0x00,0x00,0x80,0x40,0x80,0x00,0xf0,0x29,0x24,0x24,0x24,0x39,0x00,0x01,0x02,0x02,0x02,0x01,
 // 'edieresis'
-235,9,6,11,0,0,36,8,19,0x12,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x21,0x00,0x00,0x3f,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+7,2,6,8,11,0,
+0xe0,0x53,0x48,0x48,0x4b,0x70,0x01,0x02,0x04,0x04,0x04,0x02,
+0xc0,0xa6,0x90,0x90,0x96,0xe0,0x03,0x04,0x08,0x08,0x08,0x04,
+0x80,0x4c,0x20,0x20,0x2c,0xc0,0x07,0x09,0x11,0x11,0x11,0x09,
+0x00,0x98,0x40,0x40,0x58,0x80,0x0f,0x12,0x22,0x22,0x22,0x13,
+0x00,0x30,0x80,0x80,0xb0,0x00,0x1e,0x25,0x44,0x44,0x44,0x27,
+0x00,0x60,0x00,0x00,0x60,0x00,0x3c,0x4a,0x89,0x89,0x89,0x4e,
+0x00,0xc0,0x00,0x00,0xc0,0x00,0x78,0x94,0x12,0x12,0x12,0x9c,0x00,0x00,0x01,0x01,0x01,0x00,
+0x00,0x80,0x00,0x00,0x80,0x00,0xf0,0x29,0x24,0x24,0x25,0x38,0x00,0x01,0x02,0x02,0x02,0x01,
 // 'igrave'
-236,7,3,12,0,0,39,7,19,0x20,0x00,0x00,0x10,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+5,2,3,7,12,0,
+0x80,0x00,0x00,0x10,0xf9,0x02,0x04,0x07,0x04,
+0x21,0xf2,0x04,0x08,0x0f,0x08,
+0x42,0xe4,0x08,0x10,0x1f,0x10,
+0x84,0xc8,0x10,0x20,0x3f,0x20,
+0x08,0x90,0x20,0x41,0x7f,0x40,
+0x10,0x20,0x40,0x82,0xff,0x80,
+0x20,0x40,0x80,0x04,0xfe,0x00,0x01,0x01,0x01,
+0x40,0x80,0x00,0x08,0xfc,0x01,0x02,0x03,0x02,
 // 'iacute'
-237,7,3,12,0,0,39,7,19,0x08,0x00,0x00,0x10,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+5,2,3,7,12,0,
+0x00,0x00,0x80,0x12,0xf9,0x00,0x04,0x07,0x04,
+0x24,0xf2,0x01,0x08,0x0f,0x08,
+0x48,0xe4,0x02,0x10,0x1f,0x10,
+0x90,0xc8,0x04,0x20,0x3f,0x20,
+0x20,0x90,0x08,0x41,0x7f,0x40,
+0x40,0x20,0x10,0x82,0xff,0x80,
+0x80,0x40,0x20,0x04,0xfe,0x00,0x01,0x01,0x01,
+0x00,0x80,0x40,0x09,0xfc,0x00,0x02,0x03,0x02,
 // 'icircumflex'
-238,6,5,12,-1,0,39,7,19,0x10,0x00,0x00,0x28,0x00,0x00,0x44,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+5,1,5,7,12,0,
+0x00,0x00,0x80,0x00,0x00,0x02,0x11,0xf8,0x01,0x02,0x00,0x04,0x07,0x04,0x00,
+0x04,0x22,0xf1,0x02,0x04,0x00,0x08,0x0f,0x08,0x00,
+0x08,0x44,0xe2,0x04,0x08,0x00,0x10,0x1f,0x10,0x00,
+0x10,0x88,0xc4,0x08,0x10,0x00,0x20,0x3f,0x20,0x00,
+0x20,0x10,0x88,0x10,0x20,0x00,0x41,0x7f,0x40,0x00,
+0x40,0x20,0x10,0x20,0x40,0x00,0x82,0xff,0x80,0x00,
+0x80,0x40,0x20,0x40,0x80,0x00,0x04,0xfe,0x00,0x00,0x00,0x01,0x01,0x01,0x00,
+0x00,0x80,0x40,0x80,0x00,0x01,0x08,0xfc,0x00,0x01,0x00,0x02,0x03,0x02,0x00,
 // 'idieresis'
-239,7,3,11,0,0,36,8,19,0x28,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x30,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,
+5,2,3,8,11,0,
+0x13,0xf8,0x03,0x04,0x07,0x04,
+0x26,0xf0,0x06,0x08,0x0f,0x08,
+0x4c,0xe0,0x0c,0x10,0x1f,0x10,
+0x98,0xc0,0x18,0x20,0x3f,0x20,
+0x30,0x80,0x30,0x41,0x7f,0x40,
+0x60,0x00,0x60,0x82,0xff,0x80,
+0xc0,0x00,0xc0,0x04,0xfe,0x00,0x01,0x01,0x01,
+0x80,0x00,0x80,0x09,0xfc,0x01,0x02,0x03,0x02,
 // 'eth'
-240,10,7,11,0,0,36,8,19,0x1b,0x00,0x00,0x0c,0x00,0x00,0x32,0x00,0x00,0x0f,0x00,0x00,0x11,0x00,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,11,0,
+0xe4,0x15,0x0b,0x0a,0x0d,0x19,0xe0,0x01,0x02,0x04,0x04,0x04,0x02,0x01,
+0xc8,0x2a,0x16,0x14,0x1a,0x32,0xc0,0x03,0x04,0x08,0x08,0x08,0x04,0x03,
+0x90,0x54,0x2c,0x28,0x34,0x64,0x80,0x07,0x08,0x10,0x10,0x10,0x08,0x07,
+0x20,0xa8,0x58,0x50,0x68,0xc8,0x00,0x0f,0x10,0x20,0x20,0x20,0x10,0x0f,
+0x40,0x50,0xb0,0xa0,0xd0,0x90,0x00,0x1e,0x21,0x40,0x40,0x40,0x21,0x1e,
+0x80,0xa0,0x60,0x40,0xa0,0x20,0x00,0x3c,0x42,0x81,0x81,0x81,0x43,0x3c,
+0x00,0x40,0xc0,0x80,0x40,0x40,0x00,0x79,0x85,0x02,0x02,0x03,0x86,0x78,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x80,0x80,0x00,0x80,0x80,0x00,0xf2,0x0a,0x05,0x05,0x06,0x0c,0xf0,0x00,0x01,0x02,0x02,0x02,0x01,0x00,
 // 'ntilde'
-241,9,8,11,-1,0,36,8,19,0x1a,0x00,0x00,0x2c,0x00,0x00,0x00,0x00,0x00,0x2e,0x00,0x00,0x73,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x73,0x80,0x00,0x00,0x00,0x00,
+8,1,8,8,11,0,
+0x10,0xfa,0x11,0x0b,0x0a,0x19,0xf0,0x00,0x04,0x07,0x04,0x00,0x00,0x04,0x07,0x04,
+0x20,0xf4,0x22,0x16,0x14,0x32,0xe0,0x00,0x08,0x0f,0x08,0x00,0x00,0x08,0x0f,0x08,
+0x40,0xe8,0x44,0x2c,0x28,0x64,0xc0,0x00,0x10,0x1f,0x10,0x00,0x00,0x10,0x1f,0x10,
+0x80,0xd0,0x88,0x58,0x50,0xc8,0x80,0x00,0x20,0x3f,0x20,0x00,0x00,0x20,0x3f,0x20,
+0x00,0xa0,0x10,0xb0,0xa0,0x90,0x00,0x00,0x41,0x7f,0x41,0x00,0x00,0x41,0x7f,0x40,
+0x00,0x40,0x20,0x60,0x40,0x20,0x00,0x00,0x82,0xff,0x82,0x01,0x01,0x83,0xfe,0x80,
+0x00,0x80,0x40,0xc0,0x80,0x40,0x00,0x00,0x04,0xfe,0x04,0x02,0x02,0x06,0xfc,0x00,0x01,0x01,0x01,0x00,0x00,0x01,0x01,0x01,
+0x00,0x00,0x80,0x80,0x00,0x80,0x00,0x00,0x08,0xfd,0x08,0x05,0x05,0x0c,0xf8,0x00,0x02,0x03,0x02,0x00,0x00,0x02,0x03,0x02,
 // 'ograve'
-242,10,7,12,0,0,39,7,19,0x08,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,7,12,0,
+0x00,0x00,0x80,0x00,0x00,0x00,0x00,0xe0,0x10,0x08,0x09,0x0a,0x10,0xe0,0x01,0x02,0x04,0x04,0x04,0x02,0x01,
+0xc0,0x20,0x11,0x12,0x14,0x20,0xc0,0x03,0x04,0x08,0x08,0x08,0x04,0x03,
+0x80,0x40,0x22,0x24,0x28,0x40,0x80,0x07,0x08,0x10,0x10,0x10,0x08,0x07,
+0x00,0x80,0x44,0x48,0x50,0x80,0x00,0x0f,0x10,0x20,0x20,0x20,0x10,0x0f,
+0x00,0x00,0x88,0x90,0xa0,0x00,0x00,0x1e,0x21,0x40,0x40,0x40,0x21,0x1e,
+0x00,0x00,0x10,0x20,0x40,0x00,0x00,0x3c,0x42,0x81,0x81,0x81,0x42,0x3c,
+0x00,0x00,0x20,0x40,0x80,0x00,0x00,0x78,0x84,0x02,0x02,0x02,0x84,0x78,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x00,0x40,0x80,0x00,0x00,0x00,0xf0,0x08,0x04,0x04,0x05,0x08,0xf0,0x00,0x01,0x02,0x02,0x02,0x01,0x00,
 // 'oacute'
-243,10,7,12,0,0,39,7,19,0x01,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,7,12,0,
+0x00,0x00,0x00,0x00,0x00,0x80,0x00,0xe0,0x10,0x08,0x0a,0x09,0x10,0xe0,0x01,0x02,0x04,0x04,0x04,0x02,0x01,
+0xc0,0x20,0x10,0x14,0x12,0x21,0xc0,0x03,0x04,0x08,0x08,0x08,0x04,0x03,
+0x80,0x40,0x20,0x28,0x24,0x42,0x80,0x07,0x08,0x10,0x10,0x10,0x08,0x07,
+0x00,0x80,0x40,0x50,0x48,0x84,0x00,0x0f,0x10,0x20,0x20,0x20,0x10,0x0f,
+0x00,0x00,0x80,0xa0,0x90,0x08,0x00,0x1e,0x21,0x40,0x40,0x40,0x21,0x1e,
+0x00,0x00,0x00,0x40,0x20,0x10,0x00,0x3c,0x42,0x81,0x81,0x81,0x42,0x3c,
+0x00,0x00,0x00,0x80,0x40,0x20,0x00,0x78,0x84,0x02,0x02,0x02,0x84,0x78,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x00,0x00,0x00,0x80,0x40,0x00,0xf0,0x08,0x04,0x05,0x04,0x08,0xf0,0x00,0x01,0x02,0x02,0x02,0x01,0x00,
 // 'ocircumflex'
-244,10,7,12,0,0,39,7,19,0x04,0x00,0x00,0x0a,0x00,0x00,0x11,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,7,12,0,
+0x00,0x00,0x00,0x80,0x00,0x00,0x00,0xe0,0x12,0x09,0x08,0x09,0x12,0xe0,0x01,0x02,0x04,0x04,0x04,0x02,0x01,
+0xc0,0x24,0x12,0x11,0x12,0x24,0xc0,0x03,0x04,0x08,0x08,0x08,0x04,0x03,
+0x80,0x48,0x24,0x22,0x24,0x48,0x80,0x07,0x08,0x10,0x10,0x10,0x08,0x07,
+0x00,0x90,0x48,0x44,0x48,0x90,0x00,0x0f,0x10,0x20,0x20,0x20,0x10,0x0f,
+0x00,0x20,0x90,0x88,0x90,0x20,0x00,0x1e,0x21,0x40,0x40,0x40,0x21,0x1e,
+0x00,0x40,0x20,0x10,0x20,0x40,0x00,0x3c,0x42,0x81,0x81,0x81,0x42,0x3c,
+0x00,0x80,0x40,0x20,0x40,0x80,0x00,0x78,0x84,0x02,0x02,0x02,0x84,0x78,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x00,0x80,0x40,0x80,0x00,0x00,0xf0,0x09,0x04,0x04,0x04,0x09,0xf0,0x00,0x01,0x02,0x02,0x02,0x01,0x00,
 // 'otilde'
-245,10,7,11,0,0,36,8,19,0x0d,0x00,0x00,0x16,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,11,0,
+0xe0,0x12,0x09,0x0b,0x0a,0x11,0xe0,0x01,0x02,0x04,0x04,0x04,0x02,0x01,
+0xc0,0x24,0x12,0x16,0x14,0x22,0xc0,0x03,0x04,0x08,0x08,0x08,0x04,0x03,
+0x80,0x48,0x24,0x2c,0x28,0x44,0x80,0x07,0x08,0x10,0x10,0x10,0x08,0x07,
+0x00,0x90,0x48,0x58,0x50,0x88,0x00,0x0f,0x10,0x20,0x20,0x20,0x10,0x0f,
+0x00,0x20,0x90,0xb0,0xa0,0x10,0x00,0x1e,0x21,0x40,0x40,0x40,0x21,0x1e,
+0x00,0x40,0x20,0x60,0x40,0x20,0x00,0x3c,0x42,0x81,0x81,0x81,0x42,0x3c,
+0x00,0x80,0x40,0xc0,0x80,0x40,0x00,0x78,0x84,0x02,0x02,0x02,0x84,0x78,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x00,0x80,0x80,0x00,0x80,0x00,0xf0,0x09,0x04,0x05,0x05,0x08,0xf0,0x00,0x01,0x02,0x02,0x02,0x01,0x00,
 // 'odieresis'
-246,10,7,11,0,0,36,8,19,0x12,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x11,0x00,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x11,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,
+8,2,7,8,11,0,
+0xe0,0x13,0x08,0x08,0x0b,0x10,0xe0,0x01,0x02,0x04,0x04,0x04,0x02,0x01,
+0xc0,0x26,0x10,0x10,0x16,0x20,0xc0,0x03,0x04,0x08,0x08,0x08,0x04,0x03,
+0x80,0x4c,0x20,0x20,0x2c,0x40,0x80,0x07,0x08,0x10,0x10,0x10,0x08,0x07,
+0x00,0x98,0x40,0x40,0x58,0x80,0x00,0x0f,0x10,0x20,0x20,0x20,0x10,0x0f,
+0x00,0x30,0x80,0x80,0xb0,0x00,0x00,0x1e,0x21,0x40,0x40,0x40,0x21,0x1e,
+0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x3c,0x42,0x81,0x81,0x81,0x42,0x3c,
+0x00,0xc0,0x00,0x00,0xc0,0x00,0x00,0x78,0x84,0x02,0x02,0x02,0x84,0x78,0x00,0x00,0x01,0x01,0x01,0x00,0x00,
+0x00,0x80,0x00,0x00,0x80,0x00,0x00,0xf0,0x09,0x04,0x04,0x05,0x08,0xf0,0x00,0x01,0x02,0x02,0x02,0x01,0x00,
 // 'divide'
-247,10,9,9,-1,0,30,10,19,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,
+9,1,9,10,9,2,
+0x83,0x40,0x40,0x4c,0x83,0x40,0xc0,0x03,0x40,0x06,0xc0,
+0x83,0x80,0x40,0x98,0x83,0x80,0xc0,0x03,0x40,0x0c,0xc0,
+0x03,0x40,0x30,0xc0,0x83,0x01,0x40,0x19,0x83,0x01,0xc0,
+0x03,0x40,0x60,0xc0,0x83,0x02,0x40,0x32,0x83,0x02,0xc0,
+0x03,0x40,0xc0,0xc0,0x83,0x04,0x40,0x64,0x83,0x04,0xc0,
+0x03,0x40,0x80,0xc0,0x83,0x08,0x40,0xc9,0x83,0x08,0xc0,
+0x83,0x10,0x40,0x93,0x83,0x10,0xc0,0x03,0x40,0x01,0xc0,
+0x83,0x20,0x40,0x26,0x83,0x20,0xc0,0x03,0x40,0x03,0xc0,
 // 'oslash'
-248,10,7,12,0,-2,39,9,21,0x00,0x80,0x00,0x00,0x80,0x00,0x0f,0x00,0x00,0x11,0x00,0x00,0x22,0x80,0x00,0x24,0x80,0x00,0x24,0x80,0x00,0x28,0x80,0x00,0x19,0x00,0x00,0x0e,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,
+8,2,7,9,12,0,
+0xe0,0x10,0x08,0xc8,0x28,0x18,0xe6,0x01,0x1a,0x07,0x04,0x04,0x02,0x01,
+0xc0,0x20,0x10,0x90,0x50,0x30,0xcc,0x03,0x34,0x0e,0x09,0x08,0x04,0x03,
+0x80,0x40,0x20,0x20,0xa0,0x60,0x98,0x07,0x68,0x1c,0x13,0x10,0x08,0x07,
+0x00,0x80,0x40,0x40,0x40,0xc0,0x30,0x0f,0xd0,0x38,0x26,0x21,0x10,0x0f,
+0x00,0x00,0x80,0x80,0x80,0x80,0x60,0x1e,0xa1,0x70,0x4c,0x42,0x21,0x1e,0x00,0x01,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x3c,0x42,0xe1,0x99,0x85,0x43,0x3c,0x00,0x03,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x78,0x84,0xc2,0x32,0x0a,0x86,0x79,0x00,0x06,0x01,0x01,0x01,0x00,0x00,
+0xf0,0x08,0x84,0x64,0x14,0x0c,0xf3,0x00,0x0d,0x03,0x02,0x02,0x01,0x00,
 // 'ugrave'
-249,9,8,12,-1,0,39,7,19,0x10,0x00,0x00,0x08,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x23,0x00,0x00,0x1d,0x80,0x00,0x00,0x00,0x00,
+8,1,8,7,12,0,
+0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x00,0x08,0xf8,0x00,0x01,0x02,0x08,0xf8,0x00,0x00,0x03,0x04,0x04,0x04,0x02,0x07,0x04,
+0x10,0xf0,0x01,0x02,0x04,0x10,0xf0,0x00,0x00,0x07,0x08,0x08,0x08,0x04,0x0f,0x08,
+0x20,0xe0,0x02,0x04,0x08,0x20,0xe0,0x00,0x00,0x0f,0x10,0x10,0x10,0x08,0x1f,0x10,
+0x40,0xc0,0x04,0x08,0x10,0x40,0xc0,0x00,0x00,0x1f,0x20,0x20,0x20,0x10,0x3f,0x20,
+0x80,0x80,0x08,0x10,0x20,0x80,0x80,0x00,0x00,0x3f,0x40,0x40,0x40,0x20,0x7f,0x40,
+0x00,0x00,0x10,0x20,0x40,0x00,0x00,0x00,0x01,0x7f,0x80,0x80,0x80,0x41,0xff,0x80,
+0x00,0x00,0x20,0x40,0x80,0x00,0x00,0x00,0x02,0xfe,0x00,0x00,0x00,0x82,0xfe,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0x00,0x40,0x80,0x00,0x00,0x00,0x00,0x04,0xfc,0x00,0x00,0x01,0x04,0xfc,0x00,0x00,0x01,0x02,0x02,0x02,0x01,0x03,0x02,
 // 'uacute'
-250,9,8,12,-1,0,39,7,19,0x02,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x23,0x00,0x00,0x1d,0x80,0x00,0x00,0x00,0x00,
+8,1,8,7,12,0,
+0x00,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x08,0xf8,0x00,0x02,0x01,0x08,0xf8,0x00,0x00,0x03,0x04,0x04,0x04,0x02,0x07,0x04,
+0x10,0xf0,0x00,0x04,0x02,0x11,0xf0,0x00,0x00,0x07,0x08,0x08,0x08,0x04,0x0f,0x08,
+0x20,0xe0,0x00,0x08,0x04,0x22,0xe0,0x00,0x00,0x0f,0x10,0x10,0x10,0x08,0x1f,0x10,
+0x40,0xc0,0x00,0x10,0x08,0x44,0xc0,0x00,0x00,0x1f,0x20,0x20,0x20,0x10,0x3f,0x20,
+0x80,0x80,0x00,0x20,0x10,0x88,0x80,0x00,0x00,0x3f,0x40,0x40,0x40,0x20,0x7f,0x40,
+0x00,0x00,0x00,0x40,0x20,0x10,0x00,0x00,0x01,0x7f,0x80,0x80,0x80,0x41,0xff,0x80,
+0x00,0x00,0x00,0x80,0x40,0x20,0x00,0x00,0x02,0xfe,0x00,0x00,0x00,0x82,0xfe,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0x00,0x00,0x00,0x80,0x40,0x00,0x00,0x04,0xfc,0x00,0x01,0x00,0x04,0xfc,0x00,0x00,0x01,0x02,0x02,0x02,0x01,0x03,0x02,
 // 'ucircumflex'
-251,9,8,12,-1,0,39,7,19,0x08,0x00,0x00,0x14,0x00,0x00,0x22,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x23,0x00,0x00,0x1d,0x80,0x00,0x00,0x00,0x00,
+8,1,8,7,12,0,
+0x00,0x00,0x00,0x80,0x00,0x00,0x00,0x00,0x08,0xfa,0x01,0x00,0x01,0x0a,0xf8,0x00,0x00,0x03,0x04,0x04,0x04,0x02,0x07,0x04,
+0x10,0xf4,0x02,0x01,0x02,0x14,0xf0,0x00,0x00,0x07,0x08,0x08,0x08,0x04,0x0f,0x08,
+0x20,0xe8,0x04,0x02,0x04,0x28,0xe0,0x00,0x00,0x0f,0x10,0x10,0x10,0x08,0x1f,0x10,
+0x40,0xd0,0x08,0x04,0x08,0x50,0xc0,0x00,0x00,0x1f,0x20,0x20,0x20,0x10,0x3f,0x20,
+0x80,0xa0,0x10,0x08,0x10,0xa0,0x80,0x00,0x00,0x3f,0x40,0x40,0x40,0x20,0x7f,0x40,
+0x00,0x40,0x20,0x10,0x20,0x40,0x00,0x00,0x01,0x7f,0x80,0x80,0x80,0x41,0xff,0x80,
+0x00,0x80,0x40,0x20,0x40,0x80,0x00,0x00,0x02,0xfe,0x00,0x00,0x00,0x82,0xfe,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0x00,0x80,0x40,0x80,0x00,0x00,0x00,0x04,0xfd,0x00,0x00,0x00,0x05,0xfc,0x00,0x00,0x01,0x02,0x02,0x02,0x01,0x03,0x02,
 // 'udieresis'
-252,9,8,11,-1,0,36,8,19,0x12,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x63,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x23,0x00,0x00,0x1d,0x80,0x00,0x00,0x00,0x00,
+8,1,8,8,11,0,
+0x08,0xf8,0x03,0x00,0x00,0x0b,0xf8,0x00,0x00,0x03,0x04,0x04,0x04,0x02,0x07,0x04,
+0x10,0xf0,0x06,0x00,0x00,0x16,0xf0,0x00,0x00,0x07,0x08,0x08,0x08,0x04,0x0f,0x08,
+0x20,0xe0,0x0c,0x00,0x00,0x2c,0xe0,0x00,0x00,0x0f,0x10,0x10,0x10,0x08,0x1f,0x10,
+0x40,0xc0,0x18,0x00,0x00,0x58,0xc0,0x00,0x00,0x1f,0x20,0x20,0x20,0x10,0x3f,0x20,
+0x80,0x80,0x30,0x00,0x00,0xb0,0x80,0x00,0x00,0x3f,0x40,0x40,0x40,0x20,0x7f,0x40,
+0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x01,0x7f,0x80,0x80,0x80,0x41,0xff,0x80,
+0x00,0x00,0xc0,0x00,0x00,0xc0,0x00,0x00,0x02,0xfe,0x00,0x00,0x00,0x82,0xfe,0x00,0x00,0x00,0x01,0x01,0x01,0x00,0x01,0x01,
+0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x04,0xfc,0x01,0x00,0x00,0x05,0xfc,0x00,0x00,0x01,0x02,0x02,0x02,0x01,0x03,0x02,
 // 'yacute'
-253,9,8,16,-1,-4,51,7,23,0x01,0x00,0x00,0x02,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x7b,0x80,0x00,0x21,0x00,0x00,0x21,0x00,0x00,0x12,0x00,0x00,0x12,0x00,0x00,0x0a,0x00,0x00,0x04,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x50,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,
+8,1,8,7,16,2,
+0x05,0x40,0x80,0xc0,0x47,0x08,0x38,0xc8,0x08,0x02,0xc9,0x38,0x08,0xc0,0x45,0x60,0x40,0x20,0x19,0x06,0x01,0xc0,
+0x47,0x10,0x70,0x90,0x10,0x04,0x92,0x71,0x10,0xc0,0x45,0xc0,0x80,0x41,0x32,0x0c,0x03,0xc0,
+0x47,0x20,0xe0,0x20,0x20,0x08,0x24,0xe2,0x20,0xc0,0x45,0x80,0x00,0x83,0x64,0x18,0x07,0xc0,0x41,0x01,0x01,0xc0,
+0x47,0x40,0xc0,0x40,0x40,0x10,0x48,0xc4,0x40,0xc0,0x00,0x45,0x01,0x06,0xc8,0x30,0x0e,0x01,0xc0,0x42,0x03,0x02,0x01,0xc0,
+0x83,0x80,0x43,0x20,0x90,0x88,0x80,0xc0,0x00,0x45,0x03,0x0c,0x90,0x60,0x1c,0x03,0xc0,0x43,0x06,0x04,0x02,0x01,0xc0,
+0x03,0x42,0x40,0x20,0x10,0xc0,0x47,0x01,0x07,0x19,0x21,0xc0,0x39,0x07,0x01,0xc0,0x43,0x0c,0x08,0x04,0x03,0xc0,
+0x03,0x42,0x80,0x40,0x20,0xc0,0x47,0x02,0x0e,0x32,0x42,0x80,0x72,0x0e,0x02,0xc0,0x44,0x18,0x10,0x08,0x06,0x01,0xc0,
+0x04,0x41,0x80,0x40,0xc0,0x47,0x04,0x1c,0x64,0x84,0x01,0xe4,0x1c,0x04,0xc0,0x44,0x30,0x20,0x10,0x0c,0x03,0xc0,
 // 'thorn'
-254,9,8,15,-1,-4,48,8,23,0x20,0x00,0x00,0x60,0x00,0x00,0x20,0x00,0x00,0x2e,0x00,0x00,0x31,0x00,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x20,0x80,0x00,0x31,0x00,0x00,0x2e,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x20,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,
+8,1,8,8,15,2,
+0x42,0x02,0xff,0x10,0x82,0x08,0x41,0x10,0xe0,0xc0,0x42,0x40,0x7f,0x42,0x82,0x04,0x41,0x02,0x01,0xc0,
+0x42,0x04,0xfe,0x20,0x82,0x10,0x41,0x20,0xc0,0xc0,0x42,0x80,0xff,0x84,0x82,0x08,0x41,0x04,0x03,0xc0,
+0x42,0x08,0xfc,0x40,0x82,0x20,0x41,0x40,0x80,0xc0,0x00,0x41,0xff,0x08,0x82,0x10,0x41,0x08,0x07,0xc0,0x82,0x01,0xc0,
+0x42,0x10,0xf8,0x80,0x82,0x40,0x40,0x80,0xc0,0x00,0x41,0xff,0x10,0x82,0x20,0x41,0x10,0x0f,0xc0,0x42,0x02,0x03,0x02,0xc0,
+0x42,0x20,0xf0,0x00,0x82,0x80,0xc0,0x00,0x41,0xff,0x21,0x82,0x40,0x41,0x21,0x1e,0xc0,0x42,0x04,0x07,0x04,0xc0,
+0x41,0x40,0xe0,0xc0,0x00,0x41,0xff,0x42,0x82,0x81,0x41,0x42,0x3c,0xc0,0x42,0x08,0x0f,0x08,0xc0,
+0x41,0x80,0xc0,0xc0,0x00,0x41,0xff,0x84,0x82,0x02,0x41,0x84,0x78,0xc0,0x42,0x10,0x1f,0x10,0x82,0x01,0xc0,
+0x00,0x40,0x80,0xc0,0x42,0x01,0xff,0x08,0x82,0x04,0x41,0x08,0xf0,0xc0,0x42,0x20,0x3f,0x21,0x82,0x02,0x40,0x01,0xc0,
 // 'ydieresis'
-255,9,8,15,-1,-4,48,8,23,0x12,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x7b,0x80,0x00,0x21,0x00,0x00,0x31,0x00,0x00,0x12,0x00,0x00,0x1a,0x00,0x00,0x0a,0x00,0x00,0x0c,0x00,0x00,0x04,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x50,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,
-// EOF
-0,0,0,0,0,0,0,0,0
+8,1,8,8,15,0,
+0x08,0x38,0xeb,0x88,0x00,0xcb,0x38,0x08,0x60,0x40,0x20,0x1b,0x06,0x01,0x00,0x00,
+0x10,0x70,0xd6,0x10,0x00,0x96,0x70,0x10,0xc0,0x80,0x41,0x37,0x0c,0x03,0x00,0x00,
+0x20,0xe0,0xac,0x20,0x00,0x2c,0xe0,0x20,0x80,0x00,0x83,0x6e,0x18,0x07,0x00,0x00,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,
+0x40,0xc0,0x58,0x40,0x00,0x58,0xc0,0x40,0x00,0x01,0x07,0xdc,0x30,0x0e,0x01,0x00,0x03,0x02,0x01,0x00,0x00,0x00,0x00,0x00,
+0x80,0x80,0xb0,0x80,0x00,0xb0,0x80,0x80,0x00,0x03,0x0e,0xb8,0x60,0x1c,0x03,0x00,0x06,0x04,0x02,0x01,0x00,0x00,0x00,0x00,
+0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x01,0x07,0x1d,0x71,0xc0,0x39,0x07,0x01,0x0c,0x08,0x04,0x03,0x00,0x00,0x00,0x00,
+0x00,0x00,0xc0,0x00,0x00,0xc0,0x00,0x00,0x02,0x0e,0x3a,0xe2,0x80,0x72,0x0e,0x02,0x18,0x10,0x08,0x06,0x01,0x00,0x00,0x00,
+0x00,0x00,0x80,0x00,0x00,0x80,0x00,0x00,0x04,0x1c,0x75,0xc4,0x00,0xe5,0x1c,0x04,0x30,0x20,0x10,0x0d,0x03,0x00,0x00,0x00,
+};
+
+// glyph index for each encoding
+const unsigned int __timR12_index__[] = {
+// direct, first encoding, number of encodings
+0,0,256,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+170,184,208,254,404,550,754,967,983,1073,1163,1234,1320,1346,1376,1391,
+1496,1628,1706,1838,1970,2112,2244,2376,2503,2617,2749,2770,2808,2942,2981,3115,
+3211,3503,3686,3836,4018,4198,4353,4492,4696,4876,4936,5032,5218,5332,5572,5758,
+5926,6064,6279,6459,6609,6759,6929,7096,7340,7544,7711,7879,7948,8053,8122,8226,
+8256,8292,8403,8535,8631,8763,8859,8955,9094,9244,9304,9376,9508,9568,9739,9865,
+9976,10115,10254,10335,10416,10490,10616,10742,10927,11038,11196,11292,11382,11406,11496,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+170,11582,11606,11745,11895,12029,12190,12214,12367,12409,12613,12671,12775,1346,12835,13039,
+13069,13135,13236,13312,13402,13438,13588,13748,13763,13813,13861,13919,14023,14227,14449,14685,
+14781,14988,15196,15415,15631,15841,16049,16284,16507,16697,16886,17082,17273,17367,17483,17599,
+17668,17854,18070,18274,18478,18682,18877,19072,19176,19402,19607,19812,20022,20227,20425,20572,
+20704,20843,20982,21121,21253,21385,21524,21665,21785,21905,22025,22145,22259,22322,22385,22486,
+22546,22678,22828,22967,23106,23245,23377,23509,23603,23742,23900,24058,24216,24366,24548,24726,
 };
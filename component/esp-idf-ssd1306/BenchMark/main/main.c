@@ -9,6 +9,8 @@
 #include "rom/ets_sys.h" // ets_get_cpu_frequency()
 
 #include "ssd1306.h"
+#include "ssd1306_anim.h"
+#include "monkey_anim.h"
 
 /*
  You have to set this config value with menuconfig
@@ -783,6 +785,35 @@ void app_main(void)
 #endif
 	ESP_LOGI(TAG, "diffTime=%"PRIi32" us. Frame Rate=%4.1f fps", diffTime, frameRate);
 
+	// Same animation from the delta-compressed stream.
+	// Only the changed columns are sent.
+	ssd1306_clear_screen(&dev, false);
+	ssd1306_anim_player_t player;
+	ssd1306_anim_init(&player, &monkey, 0, 0);
+	int64_t decodeTime = 0;
+	int32_t busBytes = 0;
+	frameCount = 0;
+	startTime = esp_timer_get_time();
+	for (int loop=0;loop<10;loop++) {
+		for (int count=9;count>=0;count--) {
+			int64_t decodeStart = esp_timer_get_time();
+			ssd1306_anim_next(&dev, &player);
+			decodeTime = decodeTime + (esp_timer_get_time() - decodeStart);
+			busBytes = busBytes + ssd1306_flush(&dev);
+			frameCount++;
+		}
+	} // end for
+	endTime = esp_timer_get_time();
+	diffTime = endTime - startTime;
+	frameRate = (float)diffTime / (float)frameCount;
+	frameRate = frameRate / 1000000.0;
+	frameRate = 1.0 / frameRate;
+	ESP_LOGI(TAG, "Raw frames: %d bytes of flash, 1024 bytes per frame", (int)sizeof(monkeyAnimation));
+	ESP_LOGI(TAG, "Delta stream: %d bytes of flash, %"PRIi32" bytes per frame",
+		(int)(sizeof(monkey_data) + sizeof(monkey_offsets)), busBytes / frameCount);
+	ESP_LOGI(TAG, "Delta stream: decode=%"PRIi32" us per frame", (int32_t)(decodeTime / frameCount));
+	ESP_LOGI(TAG, "Delta stream: diffTime=%"PRIi32" us. Frame Rate=%4.1f fps", diffTime, frameRate);
+
 	while(1) {
 		for (int count=9;count>=0;count--) {
 			for (int page=0;page<8;page++) {
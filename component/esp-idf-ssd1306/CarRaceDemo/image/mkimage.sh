@@ -44,3 +44,7 @@ convert highway_width.jpg _highway71.jpg -gravity northwest -geometry +83+0 -com
 convert highway_width.jpg -crop 128x64+0+0 highway_width0.jpg
 
 rm _highway*.jpg
+
+# Cut the background into deduplicated 8x8 tiles
+cc -o mktiles ../../tools/mktiles.c
+./mktiles -n highway_width highway_width2.jpg highway_width1.jpg > ../main/highway_width_tiles.h
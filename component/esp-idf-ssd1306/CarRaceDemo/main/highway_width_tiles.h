@@ -0,0 +1,145 @@
+// Generated by mktiles. Do not edit.
+// 'highway_width2.jpg', 128x64px
+// 'highway_width1.jpg', 128x64px
+#include "ssd1306_tilemap.h"
+
+const uint8_t highway_width_tiles[] = {
+0xff, 0xff, 0xff, 0x7f, 0xbf, 0xdf, 0xef, 0xf7, // 0
+0xfb, 0xfd, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, // 1
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 2
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, 0x00, // 3
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x1e, // 4
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, // 5
+0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 6
+0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 7
+0x1c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 8
+0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xfd, 0xfb, // 9
+0xf7, 0xef, 0xdf, 0xbf, 0x7f, 0xff, 0xff, 0xff, // 10
+0xff, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0x7f, 0xbf, // 11
+0xdf, 0xef, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, // 12
+0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00, // 13
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, // 14
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, // 15
+0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 16
+0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 17
+0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xef, 0xdf, // 18
+0xbf, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0xfd, 0xff, // 19
+0xff, 0xef, 0xf7, 0xfb, 0xfd, 0xfe, 0xff, 0xff, // 20
+0xff, 0x7f, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, // 21
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, 0xe0, // 22
+0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x00, 0x00, // 23
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1f, // 24
+0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x00, // 25
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, // 26
+0x1f, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, // 27
+0x1f, 0x1f, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, // 28
+0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff, // 29
+0xff, 0xff, 0xfe, 0xfd, 0xf9, 0xf3, 0xe7, 0xcf, // 30
+0xff, 0x7f, 0xbf, 0xdf, 0xef, 0xf7, 0xfb, 0xfd, // 31
+0xfe, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, // 32
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, // 33
+0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xe0, 0x0f, // 34
+0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0xc0, // 35
+0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xe0, // 36
+0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, // 37
+0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, // 38
+0xf0, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, // 39
+0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, // 40
+0xe0, 0xe0, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, // 41
+0x0f, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, // 42
+0xe0, 0xf0, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, // 43
+0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 44
+0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xfe, // 45
+0xfd, 0xfb, 0xf3, 0xef, 0xcf, 0x9f, 0x3f, 0xff, // 46
+0xff, 0xff, 0xff, 0xff, 0x7f, 0xbf, 0xdf, 0xef, // 47
+0xf7, 0xfb, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, // 48
+0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x00, // 49
+0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, // 50
+0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 51
+0x00, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, // 52
+0x1f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 53
+0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xf7, // 54
+0xef, 0xdf, 0x9f, 0x7f, 0x7f, 0xff, 0xff, 0xfe, // 55
+0xff, 0xfb, 0xfd, 0xfe, 0xff, 0xff, 0xff, 0xff, // 56
+0x7f, 0xbf, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, // 57
+0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0x00, // 58
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, // 59
+0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 60
+0xe0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 61
+0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xdf, 0xbf, // 62
+0x7f, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf9, 0xf7, // 63
+0xff, 0xbf, 0xdf, 0xef, 0xf7, 0xfb, 0xfd, 0xfe, // 64
+0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, // 65
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x00, // 66
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, // 67
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, // 68
+0x0f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 69
+0xff, 0xfe, 0xfc, 0xfb, 0xf3, 0xe7, 0xcf, 0xbf, // 70
+0xfb, 0xfd, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, // 71
+0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x00, // 72
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, // 73
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, // 74
+0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 75
+0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfe, 0xfc, // 76
+0xf9, 0xf3, 0xe7, 0xdf, 0x9f, 0x3f, 0x7f, 0xff, // 77
+0xff, 0xff, 0x7f, 0x3f, 0x9f, 0xcf, 0xe7, 0xf3, // 78
+0xf9, 0xfd, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, // 79
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1e, 0x00, // 80
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1e, // 81
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, // 82
+0x0e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 83
+0x00, 0x00, 0xfe, 0xfe, 0xfe, 0x00, 0xfd, 0xf9, // 84
+0xf3, 0xe7, 0xcf, 0x9f, 0x3f, 0x7f, 0xff, 0xff, // 85
+0xf9, 0xfc, 0xfe, 0xff, 0xff, 0x7f, 0x3f, 0x9f, // 86
+0xcf, 0xef, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, // 87
+0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xef, 0xcf, // 88
+0x9f, 0x3f, 0x7f, 0xff, 0xff, 0xfe, 0xfc, 0xf9, // 89
+0xcf, 0xe7, 0xf3, 0xf9, 0xfc, 0xfe, 0xff, 0xff, // 90
+0x7f, 0x7f, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, // 91
+0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x7f, 0x7f, // 92
+0xff, 0xff, 0xfe, 0xfc, 0xf9, 0xf3, 0xe7, 0xcf, // 93
+0x7f, 0x3f, 0x9f, 0xcf, 0xe7, 0xf3, 0xf9, 0xfc, // 94
+0xfc, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x3f, 0x7f, // 95
+0xfe, 0xff, 0xff, 0x7f, 0x3f, 0x9f, 0xcf, 0xe7, // 96
+0xf3, 0xfb, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, // 97
+0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xfb, 0xf3, // 98
+0xe7, 0xcf, 0x9f, 0x3f, 0x7f, 0xff, 0xff, 0xfe, // 99
+0xf3, 0xf9, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0x7f, // 100
+0x3f, 0xbf, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, // 101
+0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0xdf, 0x9f, // 102
+0x3f, 0x7f, 0xff, 0xff, 0xfe, 0xfc, 0xf9, 0xf3, // 103
+0x3f, 0x9f, 0xcf, 0xe7, 0xf3, 0xf9, 0xfc, 0xfe, // 104
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, // 105
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, // 106
+0x0f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 107
+0xff, 0xfe, 0xfc, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, // 108
+0xf9, 0xfd, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00, // 109
+0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x3f, 0x7f, 0xff, // 110
+};
+
+const uint16_t highway_width_map[] = {
+0, 1, 2, 3, 2, 4, 2, 5, 6, 2, 7, 2, 8, 2, 9, 10, 
+11, 12, 2, 13, 2, 14, 2, 15, 16, 2, 17, 2, 17, 2, 18, 19, 
+20, 21, 2, 22, 23, 24, 25, 26, 27, 2, 28, 16, 28, 16, 29, 30, 
+31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 
+47, 48, 24, 49, 26, 50, 2, 50, 51, 52, 53, 52, 53, 2, 54, 55, 
+56, 57, 2, 58, 2, 59, 2, 15, 60, 2, 61, 2, 61, 2, 62, 63, 
+64, 65, 2, 66, 2, 67, 2, 68, 51, 2, 69, 2, 69, 2, 29, 70, 
+0, 71, 2, 72, 2, 73, 2, 74, 60, 2, 75, 2, 75, 2, 76, 77, 
+78, 79, 2, 80, 2, 81, 2, 82, 6, 2, 83, 2, 8, 2, 84, 85, 
+86, 87, 2, 13, 2, 14, 2, 15, 16, 2, 17, 2, 17, 2, 88, 89, 
+90, 91, 2, 66, 2, 67, 2, 68, 51, 2, 69, 2, 69, 2, 92, 93, 
+94, 32, 2, 13, 2, 14, 2, 15, 16, 2, 17, 2, 17, 2, 45, 95, 
+96, 97, 2, 66, 2, 67, 2, 68, 51, 2, 69, 2, 69, 2, 98, 99, 
+100, 101, 2, 13, 2, 14, 2, 15, 16, 2, 17, 2, 17, 2, 102, 103, 
+104, 65, 2, 105, 2, 106, 2, 68, 44, 2, 107, 2, 107, 2, 29, 108, 
+78, 109, 2, 58, 2, 59, 2, 15, 60, 2, 61, 2, 61, 2, 76, 110, 
+};
+
+const ssd1306_tilemap_t highway_width = {
+	.tiles = highway_width_tiles,
+	.tile_count = 111,
+	.map = highway_width_map,
+	.map_width = 16,
+	.map_height = 16,
+};
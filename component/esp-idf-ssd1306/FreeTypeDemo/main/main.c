@@ -7,6 +7,7 @@
 #include <stdio.h>
 #include <inttypes.h>
 #include <stdlib.h>
+#include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
@@ -16,130 +17,192 @@
 #include FT_FREETYPE_H
 
 #include "ssd1306.h"
+#include "ssd1306_image.h"
 
 static const char *tag = "MAIN";
 
-#define BITMAP_WIDTH  20
-#define BITMAP_HEIGHT 16
+#define FONT_SIZE 16 // Height of a line in pixels. A multiple of 8.
 
-static FT_Library  s_library;
-static FT_Face s_face;
-static uint8_t s_bitmap[BITMAP_HEIGHT][BITMAP_WIDTH];
+// The cache holds glyphs in the SSD1306 page layout, ready for ssd1306_image_draw().
+// Least recently used glyphs are freed when the cache is over GLYPH_CACHE_BYTES.
+#define GLYPH_CACHE_BYTES 4096
+#define GLYPH_CACHE_HASH 64
 
-static void load_font(char *font)
+typedef struct glyph_t {
+	// Key. The character code is used instead of the glyph index,
+	// so a hit does not need FT_Get_Char_Index.
+	FT_Face face;
+	int size;
+	FT_ULong code;
+	int threshold;
+	int advance;
+	ssd1306_image_t image;
+	struct glyph_t * chain; // Same hash
+	struct glyph_t * prev;  // LRU list. The head is the most recent.
+	struct glyph_t * next;
+	uint8_t data[];
+} glyph_t;
+
+typedef struct {
+	glyph_t * hash[GLYPH_CACHE_HASH];
+	glyph_t * head;
+	glyph_t * tail;
+	size_t bytes;
+	uint32_t hits;
+	uint32_t misses;
+} glyph_cache_t;
+
+// The faces stay loaded, because the cache is keyed by the face.
+static FT_Library s_library;
+static glyph_cache_t s_cache;
+
+static FT_Face load_font(char *font)
 {
-	FT_Error error = FT_New_Face( s_library, font, 0, &s_face );
+	FT_Face face;
+	FT_Error error = FT_New_Face( s_library, font, 0, &face );
 	if (error) {
 		ESP_LOGE(tag, "Error loading font: %d", error);
 		abort();
 	}
 	ESP_LOGI(tag, "Font [%s] loaded", font);
+	return face;
+}
+
+static int glyph_hash(FT_Face face, int size, FT_ULong code, int threshold)
+{
+	uintptr_t wk = (uintptr_t)face ^ (size * 31) ^ (code * 131) ^ (threshold * 7);
+	return (wk ^ (wk >> 6)) % GLYPH_CACHE_HASH;
+}
+
+static void glyph_unlink(glyph_t * glyph)
+{
+	if (glyph->prev) glyph->prev->next = glyph->next; else s_cache.head = glyph->next;
+	if (glyph->next) glyph->next->prev = glyph->prev; else s_cache.tail = glyph->prev;
+	glyph->prev = NULL;
+	glyph->next = NULL;
+}
+
+static void glyph_push(glyph_t * glyph)
+{
+	glyph->next = s_cache.head;
+	if (s_cache.head) s_cache.head->prev = glyph;
+	s_cache.head = glyph;
+	if (s_cache.tail == NULL) s_cache.tail = glyph;
+}
+
+static void glyph_evict(glyph_t * glyph)
+{
+	glyph_t ** link = &s_cache.hash[glyph_hash(glyph->face, glyph->size, glyph->code, glyph->threshold)];
+	while (*link != glyph) link = &(*link)->chain;
+	*link = glyph->chain;
+	glyph_unlink(glyph);
+	s_cache.bytes = s_cache.bytes - sizeof(glyph_t) - glyph->image.size;
+	free(glyph);
 }
 
-static void render_text(SSD1306_t * dev, int xpos, int ypos, int threshold, char *text)
+// Rasterize one glyph into a line of FONT_SIZE pixels.
+// threshold 0 uses the FreeType monochrome rasterizer.
+// Otherwise the anti-aliased coverage is compared with threshold.
+static glyph_t * glyph_render(FT_Face face, int size, FT_ULong code, int threshold)
 {
-	/* Configure character size. */
-	//const int font_size = 14;
-	const int font_size = 16;
-	const int freetype_scale = 64;
-	FT_Error error = FT_Set_Char_Size(s_face, 0, font_size * freetype_scale, 0, 0 );
+	FT_Error error = FT_Set_Char_Size(face, 0, size * 64, 0, 0);
 	if (error) {
 		ESP_LOGE(tag, "Error setting font size: %d", error);
-		abort();
+		return NULL;
+	}
+	FT_UInt glyph_index = FT_Get_Char_Index(face, code);
+	FT_Int32 flags = FT_LOAD_RENDER;
+	if (threshold == 0) flags |= FT_LOAD_TARGET_MONO;
+	error = FT_Load_Glyph(face, glyph_index, flags);
+	if (error) {
+		ESP_LOGE(tag, "Error loading glyph: %d", error);
+		return NULL;
 	}
 
-	int num_chars = strlen(text);
-
-	/* current drawing position */
-	int x = 0;
-	int y = 12;
+	FT_GlyphSlot slot = face->glyph;
+	FT_Bitmap * bitmap = &slot->bitmap;
+	int advance = slot->advance.x >> 6;
+	int width = slot->bitmap_left + bitmap->width;
+	if (width < advance) width = advance;
+	if (width > 128) width = 128;
+	if (width < 1) width = 1;
+	int pages = size / 8;
+	int baseline = face->size->metrics.ascender >> 6;
+	if (baseline > size) baseline = size;
+	ESP_LOGD(tag, "code=0x%"PRIx32" rows=%d width=%d top=%d left=%d advance=%d",
+		(uint32_t)code, bitmap->rows, bitmap->width, slot->bitmap_top, slot->bitmap_left, advance);
 
-	for (int n = 0; n < num_chars; n++) {
-		memset(s_bitmap, 0, BITMAP_WIDTH*BITMAP_HEIGHT);
-		ESP_LOGI(tag, "Rendering char: '%c'", text[n]);
-
-		/* retrieve glyph index from character code */
-		FT_UInt  glyph_index = FT_Get_Char_Index( s_face, text[n] );
-
-		/* load glyph image into the slot (erase previous one) */
-		error = FT_Load_Glyph( s_face, glyph_index, FT_LOAD_DEFAULT );
-		//error = FT_Load_Glyph( s_face, glyph_index, FT_LOAD_MONOCHROME  | FT_LOAD_TARGET_MONO);
-		if (error) {
-			ESP_LOGE(tag, "Error loading glyph: %d", error);
-			abort();
+	glyph_t * glyph = calloc(1, sizeof(glyph_t) + width * pages);
+	if (glyph == NULL) return NULL;
+	for (int iy = 0; iy < bitmap->rows; iy++) {
+		int y = baseline + iy - slot->bitmap_top;
+		if (y < 0 || y >= size) continue;
+		const uint8_t * row = &bitmap->buffer[iy * bitmap->pitch];
+		for (int ix = 0; ix < bitmap->width; ix++) {
+			int x = slot->bitmap_left + ix;
+			if (x < 0 || x >= width) continue;
+			bool on;
+			if (bitmap->pixel_mode == FT_PIXEL_MODE_MONO) {
+				on = (row[ix >> 3] & (0x80 >> (ix & 7))) != 0;
+			} else {
+				on = row[ix] > threshold;
+			}
+			// Page layout. bit0 is the top pixel.
+			if (on) glyph->data[(y / 8) * width + x] |= 1 << (y % 8);
 		}
+	}
+	glyph->face = face;
+	glyph->size = size;
+	glyph->code = code;
+	glyph->threshold = threshold;
+	glyph->advance = advance;
+	glyph->image.width = width;
+	glyph->image.pages = pages;
+	glyph->image.flags = 0;
+	glyph->image.size = width * pages;
+	glyph->image.data = glyph->data;
+	return glyph;
+}
 
-		/* convert to a bitmap */
-		error = FT_Render_Glyph( s_face->glyph, FT_RENDER_MODE_NORMAL );
-		if (error) {
-			ESP_LOGE(tag, "Error rendering glyph: %d", error);
-			abort();
+// A hit makes no FreeType calls.
+static glyph_t * glyph_get(FT_Face face, int size, FT_ULong code, int threshold)
+{
+	int hash = glyph_hash(face, size, code, threshold);
+	for (glyph_t * glyph = s_cache.hash[hash]; glyph; glyph = glyph->chain) {
+		if (glyph->face == face && glyph->size == size && glyph->code == code && glyph->threshold == threshold) {
+			s_cache.hits++;
+			glyph_unlink(glyph);
+			glyph_push(glyph);
+			return glyph;
 		}
+	}
 
-		/* copy the glyph bitmap into the overall bitmap */
-		FT_GlyphSlot slot = s_face->glyph;
-		ESP_LOGD(tag, "font_size=%d", font_size);
-		ESP_LOGD(tag, "slot->bitmap.rows=%d", slot->bitmap.rows);
-		ESP_LOGD(tag, "slot->bitmap.width=%d", slot->bitmap.width);
-		ESP_LOGD(tag, "slot->bitmap_top=%d", slot->bitmap_top);
-		ESP_LOGD(tag, "slot->bitmap_left=%d", slot->bitmap_left);
-		ESP_LOGD(tag, "slot->advance.x/64=%"PRIi32, slot->advance.x/64);
-		int width = 0;
-		for (int iy = 0; iy < slot->bitmap.rows; iy++) {
-			for (int ix = 0; ix < slot->bitmap.width; ix++) {
-				/* bounds check */
-				//int res_x = ix + x;
-				int res_x = ix + x + slot->bitmap_left;
-				if (res_x < 0) res_x = 0;
-				int res_y = y + iy - slot->bitmap_top;
-				if (res_y < 0) res_y = 0;
-				ESP_LOGD(tag,"res_x=%d res_y=%d", res_x, res_y);
-				if (res_x >= BITMAP_WIDTH || res_y >= BITMAP_HEIGHT) {
-					ESP_LOGW(tag, "bitmap size too large. res_x=%d res_y=%d", res_x, res_y);
-					continue;
-				}
-				ESP_LOGD(tag, "iy=%d ix=%d res_y=%d res_x=%d", iy, ix, res_y, res_x);
-				s_bitmap[res_y][res_x] = slot->bitmap.buffer[ix + iy * slot->bitmap.width];
-				if (res_x > width) width = res_x;
-			}
-		}
+	s_cache.misses++;
+	glyph_t * glyph = glyph_render(face, size, code, threshold);
+	if (glyph == NULL) return NULL;
+	size_t bytes = sizeof(glyph_t) + glyph->image.size;
+	while (s_cache.tail && s_cache.bytes + bytes > GLYPH_CACHE_BYTES) {
+		glyph_evict(s_cache.tail);
+	}
+	glyph->chain = s_cache.hash[hash];
+	s_cache.hash[hash] = glyph;
+	glyph_push(glyph);
+	s_cache.bytes = s_cache.bytes + bytes;
+	return glyph;
+}
 
-		uint8_t bitmap[BITMAP_HEIGHT];
-		memset(bitmap, 0, BITMAP_HEIGHT);
-		ESP_LOGD(tag, "width=%d", width);
-		for (int iy = 0; iy < BITMAP_HEIGHT; iy++) {
-			for (int ix = 0; ix < width; ix++) {
-				int val = s_bitmap[iy][ix];
-				ESP_LOGD(tag, "val=%d", val);
-				if (val > 128) {
-					putchar('#');
-				} else if (val > 64) {
-					putchar('+');
-				} else if (val > 32) {
-					putchar('.');
-				} else {
-					putchar('_');
-				}
-
-				uint8_t wk = 0;
-				if (val > threshold) wk = 1;
-				wk = wk << ix;
-				bitmap[iy] = bitmap[iy] | wk;
-				ESP_LOGD(tag, "val=%d threshold=%d ix=%d iy=%d wk=0x%x bitmap[iy]=0x%x", val, threshold, ix, iy, wk, bitmap[iy]);
-				
-			}
-			putchar('\n');
-		}
-		
-		//ESP_LOG_BUFFER_HEXDUMP(tag, bitmap, BITMAP_HEIGHT, ESP_LOG_INFO);
-		for (int i=0;i<BITMAP_HEIGHT;i++) {
-			bitmap[i] = ssd1306_rotate_byte(bitmap[i]);
-		}
-		//ESP_LOG_BUFFER_HEXDUMP(tag, bitmap, BITMAP_HEIGHT, ESP_LOG_INFO);
-		_ssd1306_bitmaps(dev, xpos, ypos, bitmap, 8, BITMAP_HEIGHT, false);
-		xpos += slot->advance.x / 64;
+// Draw text in a line of FONT_SIZE pixels from page.
+// Only the changed columns are sent by ssd1306_flush().
+static int render_text(SSD1306_t * dev, FT_Face face, int xpos, int page, int threshold, char *text)
+{
+	int num_chars = strlen(text);
+	for (int n = 0; n < num_chars; n++) {
+		glyph_t * glyph = glyph_get(face, FONT_SIZE, (unsigned char)text[n], threshold);
+		if (glyph == NULL) continue;
+		ssd1306_image_draw(dev, &glyph->image, page, xpos);
+		xpos += glyph->advance;
 	}
-	ssd1306_show_buffer(dev);
+	return xpos;
 }
 
 void app_main(void)
@@ -199,26 +262,37 @@ void app_main(void)
 	ssd1306_clear_screen(&dev, false);
 	ssd1306_contrast(&dev, 0xff);
 
-	// Bold style
-	load_font("/fonts/consola.ttf");
-	render_text(&dev, 0, 0, 32, "FreeType");
-	FT_Done_Face( s_face );
+	FT_Face consola = load_font("/fonts/consola.ttf");
+	FT_Face monof55 = load_font("/fonts/monof55.ttf");
+	FT_Face firamono = load_font("/fonts/FiraMono-Regular.ttf");
+
+	// Monochrome rasterizer
+	render_text(&dev, consola, 0, 0, 0, "FreeType");
 
 	// Slim style
-	load_font("/fonts/consola.ttf");
-	render_text(&dev, 0, 16, 128, "FreeType");
-	FT_Done_Face( s_face );
+	render_text(&dev, consola, 0, 2, 128, "FreeType");
 
 #if CONFIG_SSD1306_128x64
-	//load_font("/fonts/FiraMono-Regular.ttf");
-	load_font("/fonts/monof55.ttf");
-	render_text(&dev, 0, 32, 32, "FreeType");
-	FT_Done_Face( s_face );
-
-	load_font("/fonts/FiraMono-Regular.ttf");
-	render_text(&dev, 0, 48, 64, "FreeType");
-	FT_Done_Face( s_face );
+	// Bold style
+	render_text(&dev, monof55, 0, 4, 32, "FreeType");
+
+	render_text(&dev, firamono, 0, 6, 64, "FreeType");
 #endif
+	ssd1306_flush(&dev);
+	vTaskDelay(500);
 
-	FT_Done_FreeType( s_library );
+	// Clock. A digit that has been drawn once comes from the cache.
+	ssd1306_clear_screen(&dev, false);
+	while (1) {
+		uint32_t seconds = xTaskGetTickCount() / configTICK_RATE_HZ;
+		char clock[16];
+		snprintf(clock, sizeof(clock), "%02"PRIu32":%02"PRIu32":%02"PRIu32, (seconds / 3600) % 24, (seconds / 60) % 60, seconds % 60);
+		render_text(&dev, consola, 0, 0, 0, clock);
+		int sent = ssd1306_flush(&dev);
+		ESP_LOGD(tag, "%s sent=%d hits=%"PRIu32" misses=%"PRIu32" cache=%d bytes", clock, sent, s_cache.hits, s_cache.misses, (int)s_cache.bytes);
+		if ((seconds % 10) == 0) {
+			ESP_LOGI(tag, "glyph cache hits=%"PRIu32" misses=%"PRIu32" %d bytes", s_cache.hits, s_cache.misses, (int)s_cache.bytes);
+		}
+		vTaskDelay(pdMS_TO_TICKS(1000));
+	}
 }
@@ -50,3 +50,8 @@ convert _highway42.jpg -distort Affine '33,0 0,0' _highway4.jpg
 convert _highway4.jpg -crop 128x64+0+0 highway41.jpg
 convert _highway4.jpg -crop 128x64+0+64 highway42.jpg
 
+
+# Cut the background into deduplicated 8x8 tiles
+# Frames are stacked from top to bottom in the order they scroll into view
+cc -o mktiles ../../tools/mktiles.c
+./mktiles -n highway highway21.jpg highway22.jpg highway31.jpg highway32.jpg highway41.jpg highway42.jpg highway11.jpg highway12.jpg > ../main/highway_tiles.h
@@ -0,0 +1,282 @@
+// Generated by mktiles. Do not edit.
+// 'highway21.jpg', 128x64px
+// 'highway22.jpg', 128x64px
+// 'highway31.jpg', 128x64px
+// 'highway32.jpg', 128x64px
+// 'highway41.jpg', 128x64px
+// 'highway42.jpg', 128x64px
+// 'highway11.jpg', 128x64px
+// 'highway12.jpg', 128x64px
+#include "ssd1306_tilemap.h"
+
+const uint8_t highway_tiles[] = {
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, // 0
+0xff, 0xff, 0xff, 0x00, 0xfc, 0xfe, 0xfe, 0xfe, // 1
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 2
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, // 3
+0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 4
+0xfc, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0xff, 0xff, // 5
+0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xff, // 6
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, // 7
+0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 8
+0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, // 9
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, // 10
+0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 11
+0x07, 0x67, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, // 12
+0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, // 13
+0xf7, 0xf7, 0xf7, 0xf0, 0xf3, 0xf7, 0xf7, 0xf7, // 14
+0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, // 15
+0xf3, 0xf7, 0xf7, 0xf7, 0xf0, 0xf0, 0xf7, 0xf7, // 16
+0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0x07, // 17
+0x00, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, // 18
+0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, // 19
+0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, // 20
+0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, // 21
+0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, // 22
+0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, // 23
+0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, // 24
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, // 25
+0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, // 26
+0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, // 27
+0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, // 28
+0xe0, 0xe6, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, // 29
+0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, // 30
+0xef, 0xef, 0xef, 0x0f, 0xcf, 0xef, 0xef, 0xef, // 31
+0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, // 32
+0xcf, 0xef, 0xef, 0xef, 0x0f, 0x0f, 0xef, 0xef, // 33
+0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, 0xe0, // 34
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, // 35
+0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 36
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, // 37
+0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 38
+0xff, 0xff, 0xff, 0x00, 0x3f, 0x7f, 0x7f, 0x7f, // 39
+0x3f, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0xff, 0xff, // 40
+0xff, 0xff, 0xff, 0x00, 0x80, 0xff, 0xff, 0xff, // 41
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, // 42
+0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 43
+0xff, 0xff, 0xff, 0x3f, 0x00, 0xff, 0xff, 0xff, // 44
+0xff, 0x1f, 0x81, 0xf0, 0xff, 0xff, 0x1f, 0x01, // 45
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xfc, // 46
+0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 47
+0xff, 0xff, 0x7f, 0x00, 0xe0, 0xff, 0xff, 0xff, // 48
+0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0f, 0xc3, // 49
+0xf0, 0xfc, 0x7f, 0x1f, 0x07, 0x00, 0x00, 0x00, // 50
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, // 51
+0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xfc, 0xff, // 52
+0x7f, 0x0f, 0x80, 0xf8, 0xff, 0xff, 0xff, 0xff, // 53
+0x3f, 0x1f, 0x87, 0xe3, 0xf8, 0xfc, 0x3f, 0x1f, // 54
+0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 55
+0xe0, 0x78, 0x1e, 0x06, 0x00, 0x00, 0x00, 0x00, // 56
+0x00, 0x00, 0x80, 0xf0, 0xfe, 0xff, 0x1f, 0x07, // 57
+0xe0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, // 58
+0xff, 0x7f, 0x3f, 0x1f, 0xcf, 0xe7, 0xf1, 0xf8, // 59
+0x7e, 0x1f, 0x0f, 0x07, 0x01, 0x00, 0x00, 0x00, // 60
+0x00, 0x00, 0x00, 0xc0, 0x80, 0x00, 0x00, 0x00, // 61
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, // 62
+0xf8, 0xfe, 0x7f, 0x1f, 0x83, 0xf0, 0xfc, 0xff, // 63
+0x7f, 0x3f, 0x3f, 0x9f, 0xcf, 0xe7, 0xe3, 0xf1, // 64
+0x78, 0x3c, 0x1e, 0x0f, 0x07, 0x03, 0x01, 0x00, // 65
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, // 66
+0x38, 0x1e, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, // 67
+0x00, 0x00, 0xc0, 0xe0, 0xf8, 0xfe, 0x3f, 0x0f, // 68
+0xc7, 0xf1, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0xff, // 69
+0x7f, 0x3f, 0x9f, 0xcf, 0xe7, 0xf3, 0xf9, 0x7c, // 70
+0x3e, 0x1e, 0x0f, 0x07, 0x03, 0x03, 0x01, 0x00, // 71
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, // 72
+0x60, 0x38, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, // 73
+0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xf0, 0xf8, // 74
+0x7e, 0x3f, 0x9f, 0xc7, 0xe1, 0xf8, 0xfe, 0xff, // 75
+0xff, 0x7f, 0x1f, 0x8f, 0xc7, 0xe3, 0xf9, 0x7c, // 76
+0x3e, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00, // 77
+0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0x40, // 78
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, // 79
+0xf0, 0xf8, 0x7c, 0x3e, 0x9f, 0xc7, 0xe3, 0xf1, // 80
+0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, // 81
+0xf8, 0x7e, 0x3f, 0x0f, 0x07, 0x03, 0x01, 0x00, // 82
+0x00, 0x04, 0x0e, 0x07, 0x03, 0x01, 0x00, 0x00, // 83
+0xe0, 0xf0, 0x78, 0x7c, 0x3e, 0x9f, 0xc7, 0xe3, // 84
+0xf1, 0xf8, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, // 85
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 86
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, // 87
+0x70, 0x38, 0x1c, 0x0e, 0x03, 0x00, 0x00, 0x00, // 88
+0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xf0, // 89
+0xf0, 0x78, 0x3c, 0x1e, 0x9f, 0xcf, 0xe7, 0xf3, // 90
+0xf1, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, // 91
+0x00, 0x80, 0xe0, 0x60, 0x00, 0x00, 0x00, 0x00, // 92
+0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, // 93
+0xf0, 0xfc, 0x3e, 0x1f, 0x8f, 0xe7, 0xf3, 0xf9, // 94
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, // 95
+0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 96
+0x80, 0xe0, 0xf0, 0xfc, 0x3e, 0x1f, 0x87, 0xe3, // 97
+0xf1, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, // 98
+0x00, 0x00, 0xe0, 0xf8, 0x18, 0x00, 0x00, 0x00, // 99
+0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0x7f, // 100
+0x1f, 0x87, 0xe3, 0xf8, 0xfc, 0xff, 0xff, 0xff, // 101
+0x00, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, // 102
+0x00, 0xc0, 0xf8, 0xff, 0x7f, 0x0f, 0xc3, 0xf0, // 103
+0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, // 104
+0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 105
+0xfe, 0xff, 0xff, 0x07, 0x00, 0xfc, 0xff, 0xff, // 106
+0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, // 107
+0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0xff, // 108
+0xfc, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 109
+0x01, 0x1f, 0xff, 0xff, 0xf0, 0x81, 0x1f, 0xff, // 110
+0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, // 111
+0x00, 0x00, 0x00, 0x07, 0x1f, 0x7f, 0xfc, 0xf0, // 112
+0xc3, 0x0f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, // 113
+0x00, 0x00, 0x00, 0x00, 0x06, 0x1e, 0x78, 0xe0, // 114
+0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 115
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, // 116
+0x1f, 0x3f, 0xfc, 0xf8, 0xe3, 0x87, 0x1f, 0x3f, // 117
+0x00, 0x00, 0x00, 0x80, 0xc0, 0x00, 0x00, 0x00, // 118
+0x00, 0x00, 0x00, 0x01, 0x07, 0x0f, 0x1f, 0x7e, // 119
+0xf8, 0xf1, 0xe7, 0xcf, 0x1f, 0x3f, 0x7f, 0xff, // 120
+0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x1e, 0x38, // 121
+0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 122
+0x00, 0x01, 0x03, 0x07, 0x0f, 0x1e, 0x3c, 0x78, // 123
+0xf1, 0xe3, 0xe7, 0xcf, 0x9f, 0x3f, 0x3f, 0x7f, // 124
+0xf8, 0xf0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, // 125
+0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x38, 0x60, // 126
+0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 127
+0x00, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x1e, 0x3e, // 128
+0x7c, 0xf9, 0xf3, 0xe7, 0xcf, 0x9f, 0x3f, 0x7f, // 129
+0xf1, 0xe3, 0xc7, 0x9f, 0x3f, 0x7c, 0xf8, 0xf0, // 130
+0xe0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 131
+0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // 132
+0x40, 0xc0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, // 133
+0x00, 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3e, // 134
+0x7c, 0xf9, 0xe3, 0xc7, 0x8f, 0x1f, 0x7f, 0xff, // 135
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf8, 0xf1, // 136
+0xe3, 0xc7, 0x9f, 0x3e, 0x7c, 0x78, 0xf0, 0xe0, // 137
+0x00, 0x00, 0x01, 0x03, 0x07, 0x0e, 0x04, 0x00, // 138
+0x00, 0x01, 0x03, 0x07, 0x0f, 0x3f, 0x7e, 0xf8, // 139
+0xf1, 0xc7, 0x8f, 0x1f, 0x7f, 0xff, 0xff, 0xff, // 140
+0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf1, // 141
+0xf3, 0xe7, 0xcf, 0x9f, 0x1e, 0x3c, 0x78, 0xf0, // 142
+0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, // 143
+0x00, 0x00, 0x00, 0x03, 0x0e, 0x1c, 0x38, 0x70, // 144
+0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 145
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, // 146
+0x03, 0x0f, 0x1f, 0x7f, 0xfc, 0xf0, 0xe3, 0x8f, // 147
+0x1f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, // 148
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, // 149
+0xf9, 0xf3, 0xe7, 0x8f, 0x1f, 0x3e, 0xfc, 0xf0, // 150
+0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, // 151
+0x00, 0x00, 0x00, 0x00, 0x60, 0xe0, 0x80, 0x00, // 152
+0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0f, 0x3f, // 153
+0xfe, 0xf8, 0xe1, 0x87, 0x1f, 0x7f, 0xff, 0xff, // 154
+0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf1, // 155
+0xe3, 0x87, 0x1f, 0x3e, 0xfc, 0xf0, 0xe0, 0x80, // 156
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, // 157
+0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 158
+0x00, 0x03, 0x1f, 0x7f, 0xfe, 0xf8, 0xc1, 0x0f, // 159
+0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, // 160
+0xff, 0xff, 0xff, 0xfc, 0xf8, 0xe3, 0x87, 0x1f, // 161
+0x7f, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00, // 162
+0x00, 0x00, 0x00, 0x18, 0xf8, 0xe0, 0x00, 0x00, // 163
+0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0xff, 0xff, // 164
+0xf0, 0x81, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, // 165
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, // 166
+0xf0, 0xc3, 0x0f, 0x7f, 0xff, 0xf8, 0xc0, 0x00, // 167
+0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x07, 0x00, // 168
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1f, // 169
+0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0xff, 0xff, // 170
+0xff, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xfe, // 171
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, // 172
+0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 173
+0x3f, 0xff, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xff, // 174
+0xe0, 0xff, 0xff, 0xff, 0x00, 0xf0, 0xff, 0xff, // 175
+0xff, 0xff, 0xff, 0x00, 0x00, 0xfe, 0xfe, 0xfe, // 176
+0x00, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0xff, 0xff, // 177
+0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, // 178
+0x07, 0x07, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, // 179
+0xf7, 0xf7, 0xf7, 0x00, 0x00, 0xff, 0xff, 0xff, // 180
+0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xf7, 0xf7, // 181
+0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, // 182
+0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, // 183
+0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, // 184
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, // 185
+0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, // 186
+0xe0, 0xe0, 0xef, 0xef, 0xef, 0xef, 0xef, 0xef, // 187
+0xef, 0xef, 0xef, 0x00, 0x00, 0xff, 0xff, 0xff, // 188
+0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0xef, 0xef, // 189
+0xff, 0xff, 0xff, 0x00, 0x00, 0x7f, 0x7f, 0x7f, // 190
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, // 191
+0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 192
+0x00, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0xff, 0xff, // 193
+};
+
+const uint16_t highway_map[] = {
+0, 0, 0, 0, 0, 1, 2, 3, 4, 2, 5, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 6, 2, 7, 8, 2, 9, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 6, 2, 10, 11, 2, 9, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 6, 2, 7, 8, 2, 9, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 6, 2, 10, 11, 2, 9, 0, 0, 0, 0, 0, 
+12, 13, 13, 13, 13, 14, 15, 15, 15, 15, 16, 13, 13, 13, 13, 17, 
+2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+18, 19, 20, 19, 20, 19, 21, 19, 21, 19, 21, 22, 21, 22, 21, 23, 
+24, 25, 26, 25, 26, 27, 26, 27, 26, 27, 28, 27, 28, 27, 28, 27, 
+2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 
+29, 30, 30, 30, 30, 31, 32, 32, 32, 32, 33, 30, 30, 30, 30, 34, 
+0, 0, 0, 0, 0, 6, 2, 35, 36, 2, 9, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 6, 2, 37, 38, 2, 9, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 6, 2, 35, 36, 2, 9, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 6, 2, 37, 38, 2, 9, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 39, 2, 35, 36, 2, 40, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 41, 2, 42, 43, 2, 44, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 45, 2, 46, 47, 35, 48, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 49, 50, 2, 51, 2, 52, 53, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 54, 55, 2, 56, 2, 57, 58, 0, 0, 0, 0, 0, 
+0, 0, 0, 59, 60, 2, 61, 2, 62, 63, 0, 0, 0, 0, 0, 0, 
+0, 0, 64, 65, 2, 66, 67, 2, 68, 69, 0, 0, 0, 0, 0, 0, 
+0, 70, 71, 2, 72, 73, 2, 74, 75, 0, 0, 0, 0, 0, 0, 0, 
+76, 77, 2, 78, 79, 2, 62, 80, 81, 0, 0, 0, 0, 0, 0, 0, 
+82, 2, 2, 83, 2, 72, 84, 85, 0, 0, 0, 0, 0, 0, 0, 0, 
+86, 87, 88, 2, 89, 90, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+2, 92, 2, 93, 94, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+95, 96, 2, 97, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+99, 2, 100, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+102, 2, 103, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+105, 2, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+2, 2, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+43, 2, 108, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+109, 2, 110, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+111, 2, 112, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+114, 115, 116, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+2, 118, 2, 119, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+2, 121, 122, 2, 123, 124, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+125, 2, 126, 127, 2, 128, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+130, 131, 2, 132, 133, 2, 134, 135, 0, 0, 0, 0, 0, 0, 0, 0, 
+136, 137, 127, 2, 138, 2, 2, 139, 140, 0, 0, 0, 0, 0, 0, 0, 
+0, 141, 142, 143, 2, 144, 145, 146, 147, 148, 0, 0, 0, 0, 0, 0, 
+0, 0, 149, 150, 151, 2, 152, 2, 153, 154, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 155, 156, 2, 157, 158, 2, 159, 160, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 161, 162, 2, 163, 2, 164, 165, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 166, 167, 2, 168, 2, 169, 170, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 171, 2, 172, 173, 2, 174, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 107, 2, 2, 43, 2, 175, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 176, 2, 3, 4, 2, 177, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 107, 2, 7, 8, 2, 178, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 107, 2, 10, 11, 2, 178, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 107, 2, 7, 36, 2, 178, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 107, 2, 10, 11, 2, 178, 0, 0, 0, 0, 0, 
+179, 13, 13, 13, 13, 180, 2, 7, 36, 2, 181, 13, 13, 13, 13, 17, 
+2, 2, 2, 2, 2, 182, 2, 37, 11, 2, 183, 2, 2, 2, 2, 2, 
+184, 185, 20, 19, 20, 182, 2, 35, 36, 2, 183, 19, 21, 22, 21, 22, 
+186, 25, 26, 25, 26, 182, 2, 37, 11, 2, 183, 27, 26, 27, 28, 27, 
+2, 2, 2, 2, 2, 182, 2, 35, 36, 2, 183, 2, 2, 2, 2, 2, 
+187, 30, 30, 30, 30, 188, 2, 37, 38, 2, 189, 30, 30, 30, 30, 34, 
+0, 0, 0, 0, 0, 107, 2, 35, 36, 2, 178, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 107, 2, 37, 38, 2, 178, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 107, 2, 35, 36, 2, 178, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 107, 2, 37, 38, 2, 178, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 190, 2, 191, 192, 2, 193, 0, 0, 0, 0, 0, 
+};
+
+const ssd1306_tilemap_t highway = {
+	.tiles = highway_tiles,
+	.tile_count = 194,
+	.map = highway_map,
+	.map_width = 16,
+	.map_height = 64,
+};
@@ -7,6 +7,10 @@
 #include "esp_log.h"
 
 #include "ssd1306.h"
+#include "ssd1306_image.h"
+
+// Generated from images/cute-cat-*.pbm at build time
+#include "cute_cat.h"
 
 /*
  You have to set this config value with menuconfig
@@ -30,296 +34,6 @@
 
 int imageOffset[IMAGES] = {31, 31, 31, 31, 31, 31, 31, 31};
 
-uint8_t cute_cat[IMAGES][512] = {
-{
-// 'cute-cat-000', 64x64px
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x30, 
-0x0f, 0x80, 0x07, 0xff, 0xff, 0xe0, 0x00, 0xf0, 0x07, 0xe0, 0x1f, 0xff, 0xff, 0xf8, 0x03, 0xf0, 
-0x07, 0xf8, 0x7f, 0xff, 0xff, 0xfe, 0x0f, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe0, 
-0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 
-0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 
-0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xe0, 0xff, 0xff, 0x07, 0xff, 0xc0, 
-0x03, 0xff, 0x80, 0x7f, 0xfe, 0x01, 0xff, 0xc0, 0x03, 0xff, 0x00, 0x1f, 0xf8, 0x00, 0xff, 0xc0, 
-0x01, 0xfe, 0x00, 0x1f, 0xf8, 0x00, 0x7f, 0xc0, 0x03, 0xfc, 0x20, 0x0f, 0xf0, 0x04, 0x3f, 0xc0, 
-0x03, 0xfc, 0x40, 0x0f, 0xf0, 0x02, 0x3f, 0xc0, 0x07, 0xf8, 0xc0, 0x07, 0xe0, 0x03, 0x1f, 0xe0, 
-0x07, 0xf8, 0xc0, 0x07, 0xe0, 0x03, 0x1f, 0xe0, 0x07, 0xf8, 0xe0, 0x17, 0xe8, 0x07, 0x1f, 0xe0, 
-0x0f, 0xf8, 0xe0, 0x37, 0xec, 0x07, 0x1f, 0xf0, 0x0f, 0xf8, 0xf0, 0x77, 0xee, 0x0f, 0x1f, 0xf0, 
-0x0f, 0xfc, 0xff, 0xf7, 0xef, 0xff, 0x3f, 0xf0, 0x0f, 0xfc, 0x7f, 0xef, 0xf7, 0xfe, 0x3f, 0xf0, 
-0x1f, 0xfe, 0x7f, 0xcf, 0xf3, 0xfe, 0x7f, 0xf8, 0x1f, 0xfe, 0x3f, 0x9f, 0xf9, 0xfc, 0x7f, 0xf8, 
-0x1f, 0xff, 0x0f, 0x3f, 0xfc, 0xf0, 0xff, 0xf8, 0x1f, 0xff, 0xc0, 0xff, 0xff, 0x03, 0xff, 0xf8, 
-0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 
-0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 
-0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xf8, 
-0x0f, 0xff, 0xff, 0x80, 0x03, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0x8f, 0xe3, 0xff, 0xff, 0xf0, 
-0x0f, 0xff, 0xff, 0xcf, 0xe3, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xc7, 0xe7, 0xff, 0xff, 0xe0, 
-0x07, 0xfe, 0xff, 0xe7, 0xc7, 0xfd, 0xff, 0xe0, 0x07, 0xfe, 0x7f, 0xe3, 0xcf, 0xfc, 0xff, 0xe0, 
-0x03, 0xfe, 0x7f, 0xf1, 0x8f, 0xfc, 0xff, 0xc0, 0x03, 0xfe, 0x7f, 0xf9, 0x1f, 0xf9, 0xff, 0xc0, 
-0x01, 0xfe, 0x3f, 0xf8, 0x3f, 0xf9, 0xff, 0x80, 0x01, 0xff, 0x3f, 0xfc, 0x7f, 0xf9, 0xff, 0x80, 
-0x00, 0xff, 0x1f, 0xf8, 0x3f, 0xf3, 0xff, 0x00, 0x00, 0x7f, 0x8f, 0xf0, 0x1f, 0xe3, 0xfe, 0x00, 
-0x00, 0x3f, 0xc3, 0x83, 0x83, 0x87, 0xfc, 0x00, 0x00, 0x1f, 0xe0, 0x07, 0xe0, 0x0f, 0xf8, 0x00, 
-0x00, 0x0f, 0xf8, 0x3f, 0xf8, 0x3f, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 
-0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 
-0x00, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x00, 0x00, 
-0x00, 0x00, 0x07, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-},
-
-{
-// 'cute-cat-045', 64x64px
-0x00, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x1f, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf8, 0x00, 0x00, 
-0x00, 0x01, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x07, 0xff, 0xf0, 0x7f, 0xff, 0x80, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x00, 
-0x00, 0x1f, 0xff, 0x80, 0x0f, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0xff, 0x0e, 0x07, 0xff, 0xf0, 0x00, 
-0x00, 0x7f, 0xfe, 0x1c, 0x03, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xfe, 0x38, 0x03, 0xff, 0xfc, 0x00, 
-0x01, 0xff, 0xfc, 0x78, 0x03, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xfc, 0xf0, 0x03, 0xff, 0xfe, 0x00, 
-0x03, 0xff, 0xfc, 0xf0, 0x03, 0xff, 0xff, 0x00, 0x03, 0xff, 0xfc, 0xf0, 0x03, 0xff, 0xff, 0x80, 
-0x07, 0xff, 0xfc, 0xf8, 0x03, 0xff, 0xff, 0x80, 0x07, 0xff, 0xfc, 0xfc, 0x03, 0xff, 0xff, 0xc0, 
-0x07, 0xff, 0xfe, 0x7e, 0x07, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xfe, 0x7f, 0xef, 0xff, 0xff, 0xc0, 
-0x0f, 0xff, 0xff, 0x3f, 0xdf, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0x8e, 0x3f, 0xff, 0xff, 0xe0, 
-0x0f, 0xff, 0xff, 0xf3, 0xff, 0xc0, 0x3f, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xf0, 
-0x1f, 0xe7, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xf0, 0x1f, 0xc7, 0xff, 0xff, 0xfe, 0x80, 0x07, 0xfc, 
-0x1f, 0xcf, 0xff, 0xff, 0xfd, 0x80, 0x07, 0xff, 0x1f, 0xcf, 0xff, 0xff, 0xfd, 0x80, 0x03, 0xff, 
-0x1f, 0x9f, 0xfc, 0x7f, 0xfd, 0x80, 0x03, 0xff, 0x1f, 0x9f, 0xfc, 0x3f, 0xfb, 0xc0, 0x23, 0xff, 
-0x1f, 0x9f, 0xf8, 0x1f, 0xfb, 0xe0, 0x63, 0xff, 0x1f, 0x9f, 0xf9, 0x8f, 0xfb, 0xf1, 0xe3, 0xff, 
-0x1f, 0x9f, 0xf9, 0xc7, 0xfd, 0xff, 0xc7, 0xff, 0x0f, 0x8f, 0xf1, 0xe3, 0xfd, 0xff, 0x87, 0xff, 
-0x0f, 0xcf, 0xf3, 0xf1, 0xfc, 0xff, 0x0f, 0xfe, 0x0f, 0xc7, 0xf3, 0xf8, 0xfe, 0x3e, 0x1f, 0xf8, 
-0x0f, 0xe1, 0xf3, 0xf0, 0xff, 0x00, 0x3f, 0xf0, 0x07, 0xf0, 0x73, 0x01, 0xff, 0xc0, 0xff, 0xe0, 
-0x07, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xc0, 
-0x03, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x80, 
-0x01, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x7f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x7f, 0xf9, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x3f, 0xf8, 0xff, 0x1f, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0xfc, 0x3e, 0x1f, 0xff, 0xf8, 0x00, 
-0x00, 0x0f, 0xfe, 0x00, 0x7f, 0xff, 0xf0, 0x00, 0x00, 0x07, 0xff, 0x81, 0xff, 0xff, 0xe0, 0x00, 
-0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 
-0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x00, 
-0x00, 0x00, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-},
-
-{
-// 'cute-cat-090', 64x64px
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0x60, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xe0, 0x0f, 0xe0, 
-0x00, 0x00, 0x3f, 0xff, 0xff, 0xfb, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 
-0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x1f, 0xfe, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xf0, 0x07, 0xfe, 0x00, 0x00, 0xff, 0x83, 0xff, 0xc0, 0x03, 0xfe, 0x00, 
-0x00, 0xfe, 0x07, 0xff, 0x87, 0xe1, 0xfe, 0x00, 0x01, 0xfc, 0x3f, 0xff, 0x9f, 0xf0, 0xff, 0x00, 
-0x03, 0xf8, 0xff, 0xff, 0x3f, 0x88, 0xff, 0x00, 0x03, 0xf1, 0xff, 0xff, 0x3e, 0x00, 0x7f, 0x80, 
-0x03, 0xf3, 0xff, 0xff, 0x7c, 0x00, 0x7f, 0x80, 0x07, 0xe3, 0xff, 0xff, 0x7c, 0x00, 0x7f, 0xc0, 
-0x07, 0xe7, 0xff, 0xff, 0x7c, 0x00, 0x7f, 0xc0, 0x0f, 0xe7, 0xff, 0xff, 0x7c, 0x00, 0x7f, 0xc0, 
-0x0f, 0xe7, 0xff, 0xff, 0xbc, 0x00, 0xff, 0xe0, 0x0f, 0xe3, 0xff, 0x3f, 0x9e, 0x01, 0xff, 0xe0, 
-0x0f, 0xf3, 0xfc, 0x1f, 0xcf, 0x01, 0xff, 0xe0, 0x0f, 0xf3, 0xf0, 0x1f, 0xe7, 0x87, 0xff, 0xe0, 
-0x1f, 0xf1, 0xe1, 0x9f, 0xf8, 0x1f, 0xff, 0xe0, 0x1f, 0xf8, 0x87, 0x9f, 0xff, 0xff, 0xff, 0xe0, 
-0x1f, 0xfc, 0x0f, 0x9f, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xfc, 0x3f, 0x9f, 0xff, 0xff, 0xff, 0xf0, 
-0x1f, 0xfc, 0x1f, 0x9f, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xf8, 0x8f, 0x9f, 0xff, 0xff, 0xff, 0xe0, 
-0x1f, 0xf9, 0xc3, 0x9f, 0xff, 0xff, 0xff, 0xe0, 0x1f, 0xf3, 0xe0, 0x1f, 0xf8, 0x1f, 0xff, 0xe0, 
-0x0f, 0xf3, 0xf8, 0x1f, 0xe7, 0x87, 0xff, 0xe0, 0x0f, 0xe3, 0xfe, 0x3f, 0xcf, 0x01, 0xff, 0xe0, 
-0x0f, 0xe7, 0xff, 0xff, 0x9e, 0x01, 0xff, 0xe0, 0x0f, 0xe7, 0xff, 0xff, 0xbc, 0x00, 0xff, 0xe0, 
-0x0f, 0xe7, 0xff, 0xff, 0x7c, 0x00, 0x7f, 0xc0, 0x07, 0xe3, 0xff, 0xff, 0x7c, 0x00, 0x7f, 0xc0, 
-0x07, 0xf3, 0xff, 0xff, 0x7c, 0x00, 0x7f, 0xc0, 0x03, 0xf1, 0xff, 0xff, 0x7c, 0x00, 0x7f, 0x80, 
-0x03, 0xf8, 0xff, 0xff, 0x3e, 0x00, 0x7f, 0x80, 0x01, 0xfc, 0x1f, 0xff, 0x3f, 0x88, 0xff, 0x00, 
-0x01, 0xff, 0x03, 0xff, 0x9f, 0xf0, 0xff, 0x00, 0x00, 0xff, 0xe7, 0xff, 0x87, 0xe1, 0xfe, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xfc, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf0, 0x07, 0xfc, 0x00, 
-0x00, 0x3f, 0xff, 0xff, 0xfc, 0x1f, 0xfe, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-0x00, 0x00, 0x0f, 0xff, 0xff, 0xe0, 0x3f, 0xe0, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00, 0xe0, 
-0x00, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-},
-
-{
-// 'cute-cat-135', 64x64px
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 
-0x00, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x03, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0x00, 
-0x00, 0x07, 0xff, 0x00, 0x1f, 0xff, 0xe0, 0x00, 0x00, 0x0f, 0xfe, 0x1f, 0x0f, 0xff, 0xf0, 0x00, 
-0x00, 0x1f, 0xfc, 0x7f, 0xcf, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0x00, 
-0x00, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x80, 
-0x01, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x03, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-0x03, 0xfe, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xf8, 0x00, 0x03, 0xff, 0xff, 0xff, 0xc0, 
-0x07, 0xf0, 0xf3, 0xc0, 0xff, 0xc0, 0xff, 0xe0, 0x0f, 0xe3, 0xf3, 0xf8, 0xff, 0x00, 0x3f, 0xf0, 
-0x0f, 0xe7, 0xf1, 0xf8, 0xfe, 0x3e, 0x1f, 0xf8, 0x0f, 0xc7, 0xf9, 0xf1, 0xfc, 0xff, 0x0f, 0xfc, 
-0x0f, 0xcf, 0xf9, 0xe3, 0xfd, 0xff, 0x87, 0xff, 0x1f, 0xcf, 0xf9, 0xc7, 0xfd, 0xff, 0xc7, 0xff, 
-0x1f, 0xcf, 0xf8, 0x8f, 0xfb, 0xf1, 0xe3, 0xff, 0x1f, 0xcf, 0xfc, 0x1f, 0xfb, 0xe0, 0x63, 0xff, 
-0x1f, 0xcf, 0xfc, 0x3f, 0xff, 0xc0, 0x23, 0xff, 0x1f, 0xe7, 0xfe, 0x7f, 0xfd, 0x80, 0x03, 0xff, 
-0x1f, 0xe3, 0xff, 0xff, 0xfd, 0x80, 0x03, 0xff, 0x1f, 0xf3, 0xff, 0xff, 0xfd, 0x80, 0x07, 0xff, 
-0x1f, 0xf3, 0xff, 0xff, 0xfe, 0x80, 0x07, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xf8, 
-0x1f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x1f, 0xf0, 0x0f, 0xff, 0xff, 0xf1, 0xff, 0xc0, 0x3f, 0xe0, 
-0x0f, 0xff, 0xff, 0x8e, 0x3f, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0x3f, 0xdf, 0xff, 0xff, 0xe0, 
-0x0f, 0xff, 0xfe, 0x7f, 0xef, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xfe, 0x7e, 0x07, 0xff, 0xff, 0xc0, 
-0x07, 0xff, 0xfc, 0xfc, 0x03, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xfc, 0xf8, 0x03, 0xff, 0xff, 0x80, 
-0x03, 0xff, 0xfc, 0xf0, 0x03, 0xff, 0xff, 0x80, 0x03, 0xff, 0xfc, 0xf0, 0x03, 0xff, 0xff, 0x00, 
-0x01, 0xff, 0xfc, 0xf0, 0x03, 0xff, 0xfe, 0x00, 0x01, 0xff, 0xfc, 0x78, 0x03, 0xff, 0xfe, 0x00, 
-0x00, 0xff, 0xfe, 0x38, 0x03, 0xff, 0xfc, 0x00, 0x00, 0x7f, 0xfe, 0x1c, 0x03, 0xff, 0xf8, 0x00, 
-0x00, 0x3f, 0xff, 0x0e, 0x07, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x0f, 0xff, 0xe0, 0x00, 
-0x00, 0x0f, 0xff, 0xc0, 0x1f, 0xff, 0xc0, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x7f, 0xff, 0x80, 0x00, 
-0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 
-0x00, 0x00, 0x7f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xe0, 0x00, 0x00, 
-0x00, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00
-},
-
-{
-// 'cute-cat-180', 64x64px
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xe0, 0x00, 0x00, 
-0x00, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xfe, 0x00, 0x00, 
-0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 
-0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x0f, 0xfc, 0x1f, 0xfc, 0x1f, 0xf0, 0x00, 
-0x00, 0x1f, 0xf0, 0x07, 0xe0, 0x07, 0xf8, 0x00, 0x00, 0x3f, 0xe1, 0xc1, 0xc1, 0xc3, 0xfc, 0x00, 
-0x00, 0x7f, 0xc7, 0xf8, 0x0f, 0xf1, 0xfe, 0x00, 0x00, 0xff, 0xcf, 0xfc, 0x1f, 0xf8, 0xff, 0x00, 
-0x01, 0xff, 0x9f, 0xfe, 0x3f, 0xfc, 0xff, 0x80, 0x01, 0xff, 0x9f, 0xfc, 0x1f, 0xfc, 0x7f, 0x80, 
-0x03, 0xff, 0x9f, 0xf8, 0x9f, 0xfe, 0x7f, 0xc0, 0x03, 0xff, 0x3f, 0xf1, 0x8f, 0xfe, 0x7f, 0xc0, 
-0x07, 0xff, 0x3f, 0xf3, 0xc7, 0xfe, 0x7f, 0xe0, 0x07, 0xff, 0xbf, 0xe3, 0xe7, 0xff, 0x7f, 0xe0, 
-0x07, 0xff, 0xff, 0xe7, 0xe3, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xc7, 0xf3, 0xff, 0xff, 0xf0, 
-0x0f, 0xff, 0xff, 0xc7, 0xf1, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xf0, 
-0x1f, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 
-0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 
-0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 
-0x1f, 0xff, 0xc0, 0xff, 0xff, 0x03, 0xff, 0xf8, 0x1f, 0xff, 0x0f, 0x3f, 0xfc, 0xf0, 0xff, 0xf8, 
-0x1f, 0xfe, 0x3f, 0x9f, 0xf9, 0xfc, 0x7f, 0xf8, 0x1f, 0xfe, 0x7f, 0xcf, 0xf3, 0xfe, 0x7f, 0xf8, 
-0x0f, 0xfc, 0x7f, 0xef, 0xf7, 0xfe, 0x3f, 0xf0, 0x0f, 0xfc, 0xff, 0xf7, 0xef, 0xff, 0x3f, 0xf0, 
-0x0f, 0xf8, 0xf0, 0x77, 0xee, 0x0f, 0x1f, 0xf0, 0x0f, 0xf8, 0xe0, 0x37, 0xec, 0x07, 0x1f, 0xf0, 
-0x07, 0xf8, 0xe0, 0x17, 0xe8, 0x07, 0x1f, 0xe0, 0x07, 0xf8, 0xc0, 0x07, 0xe0, 0x03, 0x1f, 0xe0, 
-0x07, 0xf8, 0xc0, 0x07, 0xe0, 0x03, 0x1f, 0xe0, 0x03, 0xfc, 0x40, 0x0f, 0xf0, 0x02, 0x3f, 0xc0, 
-0x03, 0xfc, 0x20, 0x0f, 0xf0, 0x04, 0x3f, 0xc0, 0x03, 0xfe, 0x00, 0x1f, 0xf8, 0x00, 0x7f, 0x80, 
-0x03, 0xff, 0x00, 0x1f, 0xf8, 0x00, 0xff, 0xc0, 0x03, 0xff, 0x80, 0x7f, 0xfe, 0x01, 0xff, 0xc0, 
-0x03, 0xff, 0xe0, 0xff, 0xff, 0x07, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 
-0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 
-0x07, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xf0, 0x7f, 0xff, 0xff, 0xfe, 0x1f, 0xe0, 
-0x0f, 0xc0, 0x1f, 0xff, 0xff, 0xf8, 0x07, 0xe0, 0x0f, 0x00, 0x07, 0xff, 0xff, 0xe0, 0x01, 0xf0, 
-0x0c, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-},
-
-{
-// 'cute-cat-225', 64x64px
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xe0, 0x00, 0x00, 
-0x00, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 
-0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 
-0x00, 0x07, 0xff, 0xff, 0x81, 0xff, 0xe0, 0x00, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x7f, 0xf0, 0x00, 
-0x00, 0x1f, 0xff, 0xf8, 0x7c, 0x3f, 0xf8, 0x00, 0x00, 0x3f, 0xff, 0xf8, 0xff, 0x1f, 0xfc, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0x9f, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xfe, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x80, 
-0x01, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x80, 0x03, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xc0, 
-0x03, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x3f, 0xe0, 
-0x07, 0xff, 0x03, 0xff, 0x80, 0xce, 0x0f, 0xe0, 0x0f, 0xfc, 0x00, 0xff, 0x0f, 0xcf, 0x87, 0xf0, 
-0x1f, 0xf8, 0x7c, 0x7f, 0x1f, 0xcf, 0xe3, 0xf0, 0x7f, 0xf0, 0xff, 0x3f, 0x8f, 0xcf, 0xf3, 0xf0, 
-0xff, 0xe1, 0xff, 0xbf, 0xc7, 0x8f, 0xf1, 0xf0, 0xff, 0xe3, 0xff, 0xbf, 0xe3, 0x9f, 0xf9, 0xf8, 
-0xff, 0xc7, 0x8f, 0xdf, 0xf1, 0x9f, 0xf9, 0xf8, 0xff, 0xc6, 0x07, 0xdf, 0xf8, 0x1f, 0xf9, 0xf8, 
-0xff, 0xc4, 0x03, 0xdf, 0xfc, 0x3f, 0xf9, 0xf8, 0xff, 0xc0, 0x01, 0xbf, 0xfe, 0x3f, 0xf9, 0xf8, 
-0xff, 0xc0, 0x01, 0xbf, 0xff, 0xff, 0xf3, 0xf8, 0xff, 0xe0, 0x01, 0xbf, 0xff, 0xff, 0xf3, 0xf8, 
-0x3f, 0xe0, 0x01, 0x7f, 0xff, 0xff, 0xe3, 0xf8, 0x0f, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xe7, 0xf8, 
-0x0f, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xfc, 0x03, 0xff, 0xcf, 0xff, 0xff, 0xf0, 
-0x07, 0xff, 0xff, 0xfc, 0x71, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xf0, 
-0x03, 0xff, 0xff, 0xf7, 0xfe, 0x7f, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xe0, 0x7e, 0x7f, 0xff, 0xe0, 
-0x03, 0xff, 0xff, 0xc0, 0x3f, 0x3f, 0xff, 0xe0, 0x01, 0xff, 0xff, 0xc0, 0x1f, 0x3f, 0xff, 0xe0, 
-0x01, 0xff, 0xff, 0xc0, 0x0f, 0x3f, 0xff, 0xc0, 0x00, 0xff, 0xff, 0xc0, 0x0f, 0x3f, 0xff, 0xc0, 
-0x00, 0x7f, 0xff, 0xc0, 0x0f, 0x3f, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xc0, 0x1e, 0x3f, 0xff, 0x80, 
-0x00, 0x3f, 0xff, 0xc0, 0x1c, 0x7f, 0xff, 0x00, 0x00, 0x1f, 0xff, 0xc0, 0x38, 0x7f, 0xfe, 0x00, 
-0x00, 0x0f, 0xff, 0xe0, 0x70, 0xff, 0xfc, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x01, 0xff, 0xf8, 0x00, 
-0x00, 0x03, 0xff, 0xf8, 0x03, 0xff, 0xf0, 0x00, 0x00, 0x01, 0xff, 0xfe, 0x0f, 0xff, 0xe0, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x00, 
-0x00, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xff, 0xf8, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00
-},
-
-{
-// 'cute-cat-270', 64x64px
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x00, 
-0x07, 0x00, 0x00, 0xff, 0xff, 0x80, 0x00, 0x00, 0x07, 0xfc, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 
-0x03, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 
-0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x7f, 0xf8, 0x3f, 0xff, 0xff, 0xfc, 0x00, 
-0x00, 0x3f, 0xe0, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x3f, 0xc0, 0x03, 0xff, 0xff, 0xff, 0x00, 
-0x00, 0x7f, 0x87, 0xe1, 0xff, 0xe7, 0xff, 0x00, 0x00, 0xff, 0x0f, 0xf9, 0xff, 0xc0, 0xff, 0x80, 
-0x00, 0xff, 0x11, 0xfc, 0xff, 0xf8, 0x3f, 0x80, 0x01, 0xfe, 0x00, 0x7c, 0xff, 0xff, 0x1f, 0xc0, 
-0x01, 0xfe, 0x00, 0x3e, 0xff, 0xff, 0x8f, 0xc0, 0x03, 0xfe, 0x00, 0x3e, 0xff, 0xff, 0xcf, 0xe0, 
-0x03, 0xfe, 0x00, 0x3e, 0xff, 0xff, 0xc7, 0xe0, 0x03, 0xfe, 0x00, 0x3e, 0xff, 0xff, 0xe7, 0xf0, 
-0x07, 0xff, 0x00, 0x3d, 0xff, 0xff, 0xe7, 0xf0, 0x07, 0xff, 0x80, 0x79, 0xff, 0xff, 0xe7, 0xf0, 
-0x07, 0xff, 0x80, 0xf3, 0xfc, 0x7f, 0xc7, 0xf0, 0x07, 0xff, 0xe1, 0xe7, 0xf8, 0x1f, 0xcf, 0xf0, 
-0x07, 0xff, 0xf8, 0x1f, 0xf8, 0x07, 0xcf, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xf9, 0xc3, 0x9f, 0xf8, 
-0x07, 0xff, 0xff, 0xff, 0xf9, 0xf1, 0x1f, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xf9, 0xf8, 0x3f, 0xf8, 
-0x0f, 0xff, 0xff, 0xff, 0xf9, 0xfc, 0x3f, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xf9, 0xf0, 0x3f, 0xf8, 
-0x07, 0xff, 0xff, 0xff, 0xf9, 0xe1, 0x1f, 0xf8, 0x07, 0xff, 0xf8, 0x1f, 0xf9, 0x87, 0x8f, 0xf8, 
-0x07, 0xff, 0xe1, 0xe7, 0xf8, 0x0f, 0xcf, 0xf0, 0x07, 0xff, 0x80, 0xf3, 0xf8, 0x3f, 0xcf, 0xf0, 
-0x07, 0xff, 0x80, 0x79, 0xfc, 0xff, 0xc7, 0xf0, 0x07, 0xff, 0x00, 0x3d, 0xff, 0xff, 0xe7, 0xf0, 
-0x03, 0xfe, 0x00, 0x3e, 0xff, 0xff, 0xe7, 0xf0, 0x03, 0xfe, 0x00, 0x3e, 0xff, 0xff, 0xe7, 0xe0, 
-0x03, 0xfe, 0x00, 0x3e, 0xff, 0xff, 0xc7, 0xe0, 0x01, 0xfe, 0x00, 0x3e, 0xff, 0xff, 0xcf, 0xc0, 
-0x01, 0xfe, 0x00, 0x7c, 0xff, 0xff, 0x8f, 0xc0, 0x00, 0xff, 0x11, 0xfc, 0xff, 0xff, 0x1f, 0xc0, 
-0x00, 0xff, 0x0f, 0xf9, 0xff, 0xfc, 0x3f, 0x80, 0x00, 0x7f, 0x87, 0xe1, 0xff, 0xe0, 0x7f, 0x00, 
-0x00, 0x7f, 0xc0, 0x03, 0xff, 0xc1, 0xff, 0x00, 0x00, 0x7f, 0xe0, 0x0f, 0xff, 0xff, 0xfe, 0x00, 
-0x00, 0x7f, 0xf8, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 
-0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 
-0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x07, 0xff, 0xdf, 0xff, 0xff, 0xfc, 0x00, 0x00, 
-0x07, 0xf0, 0x07, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x06, 0x00, 0x00, 0xff, 0xff, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-},
-
-{
-// 'cute-cat-315', 64x64px
-0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 
-0x00, 0x00, 0x07, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x00, 
-0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 
-0x00, 0x01, 0xff, 0xfe, 0x0f, 0xff, 0xe0, 0x00, 0x00, 0x03, 0xff, 0xf8, 0x03, 0xff, 0xf0, 0x00, 
-0x00, 0x07, 0xff, 0xf0, 0x01, 0xff, 0xf8, 0x00, 0x00, 0x0f, 0xff, 0xe0, 0x70, 0xff, 0xfc, 0x00, 
-0x00, 0x1f, 0xff, 0xc0, 0x38, 0x7f, 0xfe, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x1c, 0x7f, 0xff, 0x00, 
-0x00, 0x7f, 0xff, 0xc0, 0x1e, 0x3f, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xc0, 0x0f, 0x3f, 0xff, 0x80, 
-0x00, 0xff, 0xff, 0xc0, 0x0f, 0x3f, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xc0, 0x0f, 0x3f, 0xff, 0xc0, 
-0x01, 0xff, 0xff, 0xc0, 0x1f, 0x3f, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xc0, 0x3f, 0x3f, 0xff, 0xe0, 
-0x03, 0xff, 0xff, 0xe0, 0x7e, 0x7f, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xf7, 0xfe, 0x7f, 0xff, 0xf0, 
-0x07, 0xff, 0xff, 0xfb, 0xfc, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xfc, 0x71, 0xff, 0xff, 0xf0, 
-0x07, 0xfc, 0x03, 0xff, 0x8f, 0xff, 0xff, 0xf0, 0x0f, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf8, 
-0x1f, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x7f, 0xe0, 0x01, 0x7f, 0xff, 0xff, 0xcf, 0xf8, 
-0xff, 0xe0, 0x01, 0xbf, 0xff, 0xff, 0xcf, 0xf8, 0xff, 0xc0, 0x01, 0xbf, 0xff, 0xff, 0xc7, 0xf8, 
-0xff, 0xc0, 0x01, 0xbf, 0xfe, 0x7f, 0xe7, 0xf8, 0xff, 0xc4, 0x03, 0xff, 0xfc, 0x3f, 0xf3, 0xf8, 
-0xff, 0xc6, 0x07, 0xdf, 0xf8, 0x3f, 0xf3, 0xf8, 0xff, 0xc7, 0x8f, 0xdf, 0xf1, 0x1f, 0xf3, 0xf8, 
-0xff, 0xe3, 0xff, 0xbf, 0xe3, 0x9f, 0xf3, 0xf8, 0xff, 0xe1, 0xff, 0xbf, 0xc7, 0x9f, 0xf3, 0xf0, 
-0x3f, 0xf0, 0xff, 0x3f, 0x8f, 0x9f, 0xe3, 0xf0, 0x1f, 0xf8, 0x7c, 0x7f, 0x1f, 0x8f, 0xe7, 0xf0, 
-0x0f, 0xfc, 0x00, 0xff, 0x1f, 0xcf, 0xc7, 0xf0, 0x07, 0xff, 0x03, 0xff, 0x03, 0xcf, 0x0f, 0xe0, 
-0x03, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x1f, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x7f, 0xc0, 
-0x03, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x80, 
-0x01, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0x00, 
-0x00, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x1f, 0xfe, 0x00, 
-0x00, 0x3f, 0xff, 0xff, 0xff, 0x3f, 0xfc, 0x00, 0x00, 0x1f, 0xff, 0xf3, 0xfe, 0x3f, 0xf8, 0x00, 
-0x00, 0x0f, 0xff, 0xf0, 0xf8, 0x7f, 0xf0, 0x00, 0x00, 0x07, 0xff, 0xf8, 0x00, 0xff, 0xe0, 0x00, 
-0x00, 0x03, 0xff, 0xff, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 
-0x00, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x00, 0x00, 
-0x00, 0x00, 0x0f, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-}
-};
-
 void app_main(void)
 {
 	SSD1306_t dev;
@@ -359,35 +73,13 @@ void app_main(void)
 #endif // CONFIG_SSD1306_128x32
 	ssd1306_contrast(&dev, 0xff);
 
-	// Allocate memory
-	uint8_t *buffer = (uint8_t *)malloc(8*128); // 8 page 128 pixel
-	if (buffer == NULL) {
-		ESP_LOGE(TAG, "malloc failed");
-		while(1) { vTaskDelay(1); }
-	}
-	uint8_t *segmentImage = (uint8_t *)malloc(IMAGES*8*128); // IMAGES * 8 page 128 pixel
-	if (segmentImage == NULL) {
-		ESP_LOGE(TAG, "malloc failed");
-		while(1) { vTaskDelay(1); }
-	}
-
-	// Convert from segmentDisplay to segmentImage
-	for (int imageIndex=0;imageIndex<IMAGES;imageIndex++) {
-		ssd1306_clear_screen(&dev, false);
-		ssd1306_bitmaps(&dev, imageOffset[imageIndex], 0, cute_cat[imageIndex], 64, 64, false);
-		ssd1306_get_buffer(&dev, buffer);
-		int segmentImageIndex = imageIndex * 8 * 128;
-		for (int page=0;page<8;page++) {
-			memcpy(&segmentImage[segmentImageIndex+page*128], &buffer[page*128], 128);
-		}
-		vTaskDelay(100);
-	}
-
+	ssd1306_clear_screen(&dev, false);
 	while (1) {
 		for (int imageIndex=0;imageIndex<IMAGES;imageIndex++) {
-			int segmentImageIndex = imageIndex * 8 * 128;
-			ssd1306_set_buffer(&dev, &segmentImage[segmentImageIndex]);
-			ssd1306_show_buffer(&dev);
+			// The images are already in the page layout, so no conversion is needed.
+			// Only the columns of the image are sent.
+			ssd1306_image_draw(&dev, &cute_cat[imageIndex], 0, imageOffset[imageIndex]);
+			ssd1306_flush(&dev);
 			vTaskDelay(10);
 		}
 	}
@@ -25,7 +25,9 @@ void ssd1306_init(SSD1306_t * dev, int width, int height)
 	// Initialize internal buffer
 	for (int i=0;i<dev->_pages;i++) {
 		memset(dev->_page[i]._segs, 0, 128);
+		dev->_page[i]._dirtyCount = 0;
 	}
+	dev->_frame = false;
 }
 
 int ssd1306_get_width(SSD1306_t * dev)
@@ -54,6 +56,10 @@ void ssd1306_show_buffer(SSD1306_t * dev)
 			i2c_display_image(dev, page, 0, dev->_page[page]._segs, dev->_width);
 		}
 	}
+	// Nothing left to flush
+	for (int page=0; page<dev->_pages;page++) {
+		dev->_page[page]._dirtyCount = 0;
+	}
 }
 
 void ssd1306_set_buffer(SSD1306_t * dev, const uint8_t * buffer)
@@ -84,8 +90,91 @@ void ssd1306_get_page(SSD1306_t * dev, int page, uint8_t * buffer)
 	memcpy(buffer, &dev->_page[page]._segs, 128);
 }
 
+// Record that columns seg to {seg+width-1} of the internal buffer have changed.
+// They are sent by ssd1306_flush().
+void ssd1306_mark_dirty(SSD1306_t * dev, int page, int seg, int width)
+{
+	if (page < 0 || page >= dev->_pages) return;
+	if (seg < 0) {
+		width = width + seg;
+		seg = 0;
+	}
+	if (seg + width > dev->_width) width = dev->_width - seg;
+	if (width <= 0) return;
+
+	PAGE_t * _page = &dev->_page[page];
+	int start = seg;
+	int end = seg + width;
+
+	// Merge with every span that overlaps or is close to this one
+	int index = 0;
+	while (index < _page->_dirtyCount) {
+		SPAN_t * span = &_page->_dirty[index];
+		if (start <= span->_end + SSD1306_DIRTY_GAP && span->_start <= end + SSD1306_DIRTY_GAP) {
+			if (span->_start < start) start = span->_start;
+			if (span->_end > end) end = span->_end;
+			_page->_dirty[index] = _page->_dirty[--_page->_dirtyCount];
+			index = 0;
+			continue;
+		}
+		index++;
+	}
+
+	if (_page->_dirtyCount == SSD1306_DIRTY_SPANS) {
+		// No room. Widen the nearest span.
+		int nearest = 0;
+		int distance = dev->_width;
+		for (index=0;index<_page->_dirtyCount;index++) {
+			SPAN_t * span = &_page->_dirty[index];
+			int _distance = (span->_start > end) ? span->_start - end : start - span->_end;
+			if (_distance < distance) {
+				distance = _distance;
+				nearest = index;
+			}
+		}
+		SPAN_t * span = &_page->_dirty[nearest];
+		if (span->_start < start) start = span->_start;
+		if (span->_end > end) end = span->_end;
+		_page->_dirty[nearest] = _page->_dirty[--_page->_dirtyCount];
+		ssd1306_mark_dirty(dev, page, start, end - start);
+		return;
+	}
+
+	_page->_dirty[_page->_dirtyCount]._start = start;
+	_page->_dirty[_page->_dirtyCount]._end = end;
+	_page->_dirtyCount++;
+}
+
+// Send only the changed columns of the internal buffer.
+// Returns the number of data bytes sent.
+int ssd1306_flush(SSD1306_t * dev)
+{
+	int bytes = 0;
+	for (int page=0;page<dev->_pages;page++) {
+		PAGE_t * _page = &dev->_page[page];
+		for (int index=0;index<_page->_dirtyCount;index++) {
+			int seg = _page->_dirty[index]._start;
+			int width = _page->_dirty[index]._end - seg;
+			if (dev->_address == SPI_ADDRESS) {
+				spi_display_image(dev, page, seg, &_page->_segs[seg], width);
+			} else {
+				i2c_display_image(dev, page, seg, &_page->_segs[seg], width);
+			}
+			bytes = bytes + width;
+		}
+		_page->_dirtyCount = 0;
+	}
+	return bytes;
+}
+
 void ssd1306_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width)
 {
+	if (dev->_frame) {
+		// Sent with the rest of the frame by ssd1306_frame_end()
+		memcpy(&dev->_page[page]._segs[seg], images, width);
+		ssd1306_mark_dirty(dev, page, seg, width);
+		return;
+	}
 	if (dev->_address == SPI_ADDRESS) {
 		spi_display_image(dev, page, seg, images, width);
 	} else {
@@ -278,6 +367,23 @@ void ssd1306_contrast(SSD1306_t * dev, int contrast)
 	}
 }
 
+// Set the display clock (D5).
+// divide is 1 to 16 and frequency is the oscillator setting 0 to 15. The reset value is 1 and 8.
+// The panel refreshes at Fosc / (divide * 54 * mux), about 105Hz for 128x64 at the reset value.
+void ssd1306_clock(SSD1306_t * dev, int divide, int frequency)
+{
+	if (divide < 1 || divide > 16 || frequency < 0 || frequency > 15) {
+		ESP_LOGE(__FUNCTION__, "wrong clock divide=%d frequency=%d", divide, frequency);
+		return;
+	}
+	uint8_t clock = (frequency << 4) | (divide - 1);
+	if (dev->_address == SPI_ADDRESS) {
+		spi_clock(dev, clock);
+	} else {
+		i2c_clock(dev, clock);
+	}
+}
+
 void ssd1306_software_scroll(SSD1306_t * dev, int start, int end)
 {
 	ESP_LOGD(__FUNCTION__, "software_scroll start=%d end=%d _pages=%d", start, end, dev->_pages);
@@ -92,10 +92,23 @@ typedef enum {
 	SCROLL_STOP = 7
 } ssd1306_scroll_type_t;
 
+// Number of changed column ranges kept for each page.
+// Ranges closer than SSD1306_DIRTY_GAP columns are merged,
+// because the page/column address commands cost about as much as the gap.
+#define SSD1306_DIRTY_SPANS 4
+#define SSD1306_DIRTY_GAP 6
+
+typedef struct {
+	uint8_t _start;
+	uint8_t _end; // Not included
+} SPAN_t;
+
 typedef struct {
 	bool _valid; // Not using it anymore
 	int _segLen; // Not using it anymore
 	uint8_t _segs[128];
+	int _dirtyCount;
+	SPAN_t _dirty[SSD1306_DIRTY_SPANS];
 } PAGE_t;
 
 typedef struct {
@@ -110,6 +123,7 @@ typedef struct {
 	int _scDirection;
 	PAGE_t _page[8];
 	bool _flip;
+	bool _frame; // ssd1306_display_image() only marks the columns dirty. See ssd1306_frame.h
 	i2c_port_t _i2c_num;
 	spi_device_handle_t _spi_device_handle;
 #if (ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 2, 0))
@@ -131,6 +145,8 @@ void ssd1306_show_buffer(SSD1306_t * dev);
 void ssd1306_set_buffer(SSD1306_t * dev, const uint8_t * buffer);
 void ssd1306_get_buffer(SSD1306_t * dev, uint8_t * buffer);
 void ssd1306_set_page(SSD1306_t * dev, int page, const uint8_t * buffer);
+void ssd1306_mark_dirty(SSD1306_t * dev, int page, int seg, int width);
+int ssd1306_flush(SSD1306_t * dev);
 void ssd1306_get_page(SSD1306_t * dev, int page, uint8_t * buffer);
 void ssd1306_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width);
 void ssd1306_display_text(SSD1306_t * dev, int page, const char * text, int text_len, bool invert);
@@ -140,6 +156,7 @@ void ssd1306_display_text_x3(SSD1306_t * dev, int page, const char * text, int t
 void ssd1306_clear_screen(SSD1306_t * dev, bool invert);
 void ssd1306_clear_line(SSD1306_t * dev, int page, bool invert);
 void ssd1306_contrast(SSD1306_t * dev, int contrast);
+void ssd1306_clock(SSD1306_t * dev, int divide, int frequency);
 void ssd1306_software_scroll(SSD1306_t * dev, int start, int end);
 void ssd1306_scroll_text(SSD1306_t * dev, const char * text, int text_len, bool invert);
 void ssd1306_scroll_clear(SSD1306_t * dev);
@@ -167,6 +184,7 @@ void i2c_device_add(SSD1306_t * dev, i2c_port_t i2c_num, int16_t reset, uint16_t
 void i2c_init(SSD1306_t * dev, int width, int height);
 void i2c_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width);
 void i2c_contrast(SSD1306_t * dev, int contrast);
+void i2c_clock(SSD1306_t * dev, uint8_t clock);
 void i2c_hardware_scroll(SSD1306_t * dev, ssd1306_scroll_type_t scroll);
 
 void spi_clock_speed(int speed);
@@ -179,6 +197,7 @@ bool spi_master_write_data(SSD1306_t * dev, const uint8_t* Data, size_t DataLeng
 void spi_init(SSD1306_t * dev, int width, int height);
 void spi_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width);
 void spi_contrast(SSD1306_t * dev, int contrast);
+void spi_clock(SSD1306_t * dev, uint8_t clock);
 void spi_hardware_scroll(SSD1306_t * dev, ssd1306_scroll_type_t scroll);
 
 #ifdef __cplusplus
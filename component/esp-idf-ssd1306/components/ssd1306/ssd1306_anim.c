@@ -0,0 +1,118 @@
+#include <string.h>
+
+#include "esp_log.h"
+
+#include "ssd1306.h"
+#include "ssd1306_image.h"
+#include "ssd1306_anim.h"
+
+// Apply one frame to internal buffer and mark the changed columns as dirty.
+static void anim_apply(SSD1306_t * dev, ssd1306_anim_player_t * player, const uint8_t * frame)
+{
+	const ssd1306_anim_t * anim = player->anim;
+	uint8_t flags = *frame++;
+	uint8_t mask = *frame++;
+	bool keyframe = (flags & SSD1306_ANIM_KEYFRAME);
+	uint8_t row[128];
+
+	for (int page=0;page<anim->pages;page++) {
+		if (mask & (1 << page)) {
+			frame = ssd1306_rle_decode(frame, row, anim->width);
+			if (frame == NULL) {
+				ESP_LOGE(__FUNCTION__, "broken frame page=%d", page);
+				return;
+			}
+		} else if (keyframe) {
+			memset(row, 0, anim->width);
+		} else {
+			continue;
+		}
+
+		// Only the columns that really changed are sent by ssd1306_flush()
+		int _page = player->page + page;
+		uint8_t * segs = &dev->_page[_page]._segs[player->seg];
+		int start = -1;
+		for (int seg=0;seg<=anim->width;seg++) {
+			bool changed = false;
+			if (seg < anim->width) {
+				uint8_t wk = row[seg];
+				if (dev->_flip) wk = ssd1306_rotate_byte(wk);
+				if (keyframe == false) wk = segs[seg] ^ wk;
+				changed = (segs[seg] != wk);
+				segs[seg] = wk;
+			}
+			if (changed && start < 0) start = seg;
+			if (changed == false && start >= 0) {
+				ssd1306_mark_dirty(dev, _page, player->seg+start, seg-start);
+				start = -1;
+			}
+		}
+	}
+}
+
+static bool anim_fits(SSD1306_t * dev, ssd1306_anim_player_t * player)
+{
+	const ssd1306_anim_t * anim = player->anim;
+	if (player->page < 0 || player->page + anim->pages > dev->_pages ||
+		player->seg < 0 || player->seg + anim->width > dev->_width) {
+		ESP_LOGE(__FUNCTION__, "animation does not fit page=%d seg=%d", player->page, player->seg);
+		return false;
+	}
+	return true;
+}
+
+void ssd1306_anim_init(ssd1306_anim_player_t * player, const ssd1306_anim_t * anim, int page, int seg)
+{
+	player->anim = anim;
+	player->page = page;
+	player->seg = seg;
+	player->frame = -1;
+}
+
+// Set next frame to internal buffer. Not show it.
+// Use ssd1306_flush() to send only the changed columns.
+// Returns the frame index, or -1 on error.
+int ssd1306_anim_next(SSD1306_t * dev, ssd1306_anim_player_t * player)
+{
+	const ssd1306_anim_t * anim = player->anim;
+	if (anim_fits(dev, player) == false) return -1;
+
+	int frame = player->frame + 1;
+	if (frame >= anim->frames) frame = 0;
+	if (frame == 0 && player->frame > 0 && anim->loop) {
+		// Delta from the last frame to the first frame
+		anim_apply(dev, player, &anim->data[anim->offsets[anim->frames]]);
+	} else if (frame == 0 || player->frame < 0) {
+		frame = 0;
+		anim_apply(dev, player, &anim->data[anim->offsets[0]]);
+	} else {
+		anim_apply(dev, player, &anim->data[anim->offsets[frame]]);
+	}
+	player->frame = frame;
+	return frame;
+}
+
+// Set any frame to internal buffer. Not show it.
+// Decoding starts from the nearest keyframe, or from the current frame when it is closer.
+int ssd1306_anim_seek(SSD1306_t * dev, ssd1306_anim_player_t * player, int frame)
+{
+	const ssd1306_anim_t * anim = player->anim;
+	if (frame < 0 || frame >= anim->frames) return -1;
+	if (anim_fits(dev, player) == false) return -1;
+
+	int key = frame;
+	while (key > 0 && (anim->data[anim->offsets[key]] & SSD1306_ANIM_KEYFRAME) == 0) key--;
+
+	int start = key;
+	if (player->frame >= key && player->frame <= frame) {
+		start = player->frame + 1;
+	} else {
+		anim_apply(dev, player, &anim->data[anim->offsets[key]]);
+		start = key + 1;
+	}
+	for (int index=start;index<=frame;index++) {
+		anim_apply(dev, player, &anim->data[anim->offsets[index]]);
+	}
+	player->frame = frame;
+	return frame;
+}
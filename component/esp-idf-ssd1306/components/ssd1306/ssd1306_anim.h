@@ -0,0 +1,52 @@
+#ifndef MAIN_SSD1306_ANIM_H_
+#define MAIN_SSD1306_ANIM_H_
+
+#include "ssd1306.h"
+#include "ssd1306_image.h"
+
+/* Animation stream
+Frames are stored page-major, in the same layout as the SSD1306 GDDRAM.
+Every frame is XORed into the internal buffer.
+A keyframe is XORed against a blank frame, so it holds the whole image.
+Use tools/mkanim to create an animation from images.
+
+frame:
+  flags     1 byte. bit0 = keyframe
+  page mask 1 byte. bit n = page n has changes
+  runs for each page in the mask, until the end of page token
+
+runs are the run-length coding of ssd1306_image.h.
+A skip run leaves the columns unchanged.
+*/
+#define SSD1306_ANIM_KEYFRAME 0x01
+
+typedef struct {
+	int width;  // Width in pixels
+	int pages;  // Height in pages
+	int frames; // Number of frames
+	bool loop;  // offsets[frames] is a delta from the last frame to the first frame
+	const uint32_t * offsets; // Start of each frame in data
+	const uint8_t * data;
+} ssd1306_anim_t;
+
+typedef struct {
+	const ssd1306_anim_t * anim;
+	int page;  // Position on the screen
+	int seg;
+	int frame; // Frame in the internal buffer. -1 is none.
+} ssd1306_anim_player_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void ssd1306_anim_init(ssd1306_anim_player_t * player, const ssd1306_anim_t * anim, int page, int seg);
+int ssd1306_anim_next(SSD1306_t * dev, ssd1306_anim_player_t * player);
+int ssd1306_anim_seek(SSD1306_t * dev, ssd1306_anim_player_t * player, int frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_SSD1306_ANIM_H_ */
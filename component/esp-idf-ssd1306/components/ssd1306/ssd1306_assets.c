@@ -0,0 +1,181 @@
+#include <string.h>
+#include <inttypes.h>
+
+#include "esp_log.h"
+
+#include "esp_idf_version.h"
+#include "esp_partition.h"
+#if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 1, 0)
+#include "spi_flash_mmap.h"
+#endif
+
+#include "ssd1306.h"
+#include "ssd1306_assets.h"
+
+static uint16_t assets_read16(const uint8_t * p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+static uint32_t assets_read32(const uint8_t * p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Map the asset partition.
+bool ssd1306_assets_mount(ssd1306_assets_t * assets, const char * label)
+{
+	memset(assets, 0, sizeof(ssd1306_assets_t));
+	const void * data = NULL;
+	size_t size = 0;
+	const esp_partition_t * partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+	if (partition == NULL) {
+		ESP_LOGE(__FUNCTION__, "partition %s not found", label);
+		return false;
+	}
+	size = partition->size;
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+	esp_partition_mmap_handle_t handle;
+	esp_err_t ret = esp_partition_mmap(partition, 0, size, ESP_PARTITION_MMAP_DATA, &data, &handle);
+#else
+	spi_flash_mmap_handle_t handle;
+	esp_err_t ret = esp_partition_mmap(partition, 0, size, SPI_FLASH_MMAP_DATA, &data, &handle);
+#endif
+	if (ret != ESP_OK) {
+		ESP_LOGE(__FUNCTION__, "esp_partition_mmap failed %s", esp_err_to_name(ret));
+		return false;
+	}
+	assets->_handle = handle;
+	assets->_mapped = true;
+	assets->base = data;
+	if (ssd1306_assets_open(assets, data, size) == false) {
+		ssd1306_assets_unmount(assets);
+		return false;
+	}
+	ESP_LOGD(__FUNCTION__, "%s: %d assets, %d bytes", label, assets->count, (int)assets->size);
+	return true;
+}
+
+void ssd1306_assets_unmount(ssd1306_assets_t * assets)
+{
+	if (assets->_mapped) {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+		esp_partition_munmap(assets->_handle);
+#else
+		spi_flash_munmap(assets->_handle);
+#endif
+	}
+	memset(assets, 0, sizeof(ssd1306_assets_t));
+}
+
+// Use a pack that is already in memory, such as an embedded file.
+// The data is not copied, so it must stay valid.
+bool ssd1306_assets_open(ssd1306_assets_t * assets, const void * data, size_t size)
+{
+	const uint8_t * base = data;
+	if (size < SSD1306_ASSETS_HEADER || memcmp(base, "SSDA", 4) != 0) {
+		ESP_LOGE(__FUNCTION__, "not an asset pack");
+		return false;
+	}
+	int version = assets_read16(&base[4]);
+	int count = assets_read16(&base[6]);
+	uint32_t pack_size = assets_read32(&base[8]);
+	if (version != SSD1306_ASSETS_VERSION || pack_size > size ||
+		SSD1306_ASSETS_HEADER + count * sizeof(ssd1306_asset_t) > pack_size) {
+		ESP_LOGE(__FUNCTION__, "broken asset pack version=%d count=%d size=%"PRIu32, version, count, pack_size);
+		return false;
+	}
+
+	const ssd1306_asset_t * index = (const ssd1306_asset_t *)&base[SSD1306_ASSETS_HEADER];
+	for (int i=0;i<count;i++) {
+		const ssd1306_asset_t * asset = &index[i];
+		if (memchr(asset->name, 0, sizeof(asset->name)) == NULL ||
+			(asset->offset & 3) != 0 || asset->offset > pack_size || asset->size > pack_size - asset->offset) {
+			ESP_LOGE(__FUNCTION__, "broken asset %d", i);
+			return false;
+		}
+	}
+	assets->base = base;
+	assets->size = pack_size;
+	assets->count = count;
+	assets->index = index;
+	return true;
+}
+
+// Returns NULL when there is no such asset.
+const ssd1306_asset_t * ssd1306_assets_find(const ssd1306_assets_t * assets, const char * name)
+{
+	// The index is sorted by name
+	int low = 0;
+	int high = assets->count - 1;
+	while (low <= high) {
+		int mid = (low + high) / 2;
+		int cmp = strncmp(name, assets->index[mid].name, sizeof(assets->index[mid].name));
+		if (cmp == 0) return &assets->index[mid];
+		if (cmp < 0) {
+			high = mid - 1;
+		} else {
+			low = mid + 1;
+		}
+	}
+	return NULL;
+}
+
+const uint8_t * ssd1306_assets_data(const ssd1306_assets_t * assets, const ssd1306_asset_t * asset)
+{
+	return &assets->base[asset->offset];
+}
+
+// The image data stays in the pack.
+bool ssd1306_assets_image(const ssd1306_assets_t * assets, const char * name, ssd1306_image_t * image)
+{
+	const ssd1306_asset_t * asset = ssd1306_assets_find(assets, name);
+	if (asset == NULL || asset->format != SSD1306_ASSET_IMAGE) {
+		ESP_LOGE(__FUNCTION__, "image %s not found", name);
+		return false;
+	}
+	if (asset->width == 0 || asset->width > 128 || asset->height == 0 || asset->height > 64) {
+		ESP_LOGE(__FUNCTION__, "broken image %s", name);
+		return false;
+	}
+	image->width = asset->width;
+	image->pages = (asset->height + 7) / 8;
+	image->flags = asset->flags;
+	image->size = asset->size;
+	image->data = ssd1306_assets_data(assets, asset);
+	return true;
+}
+
+// The offsets and the stream stay in the pack.
+bool ssd1306_assets_anim(const ssd1306_assets_t * assets, const char * name, ssd1306_anim_t * anim)
+{
+	const ssd1306_asset_t * asset = ssd1306_assets_find(assets, name);
+	if (asset == NULL || asset->format != SSD1306_ASSET_ANIM) {
+		ESP_LOGE(__FUNCTION__, "animation %s not found", name);
+		return false;
+	}
+	bool loop = (asset->flags & SSD1306_ASSET_LOOP) != 0;
+	uint32_t entries = asset->count + (loop ? 1 : 0);
+	if (asset->count == 0 || asset->width > 128 || asset->height > 64 ||
+		asset->size < entries * sizeof(uint32_t)) {
+		ESP_LOGE(__FUNCTION__, "broken animation %s", name);
+		return false;
+	}
+	const uint8_t * data = ssd1306_assets_data(assets, asset);
+	const uint32_t * offsets = (const uint32_t *)data;
+	// Every frame must start inside the stream, or ssd1306_anim_next() reads past the asset
+	uint32_t stream = asset->size - entries * sizeof(uint32_t);
+	for (uint32_t i=0;i<entries;i++) {
+		if (offsets[i] >= stream) {
+			ESP_LOGE(__FUNCTION__, "broken animation %s, frame %"PRIu32" at %"PRIu32, name, i, offsets[i]);
+			return false;
+		}
+	}
+	anim->width = asset->width;
+	anim->pages = asset->height / 8;
+	anim->frames = asset->count;
+	anim->loop = loop;
+	anim->offsets = offsets;
+	anim->data = &data[entries * sizeof(uint32_t)];
+	return true;
+}
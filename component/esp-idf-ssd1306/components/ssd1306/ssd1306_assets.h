@@ -0,0 +1,68 @@
+#ifndef MAIN_SSD1306_ASSETS_H_
+#define MAIN_SSD1306_ASSETS_H_
+
+#include "ssd1306.h"
+#include "ssd1306_image.h"
+#include "ssd1306_anim.h"
+
+/* Asset pack
+Fonts, images and animations in a data partition.
+The partition is memory mapped, so assets are read in place without copying to RAM.
+Use tools/mkassets to create a pack, little endian.
+
+header:
+  0 'S' 'S' 'D' 'A'
+  4 version, 16 bits
+  6 number of assets, 16 bits
+  8 size of the pack, 32 bits
+ 12 reserved
+index: one ssd1306_asset_t for each asset, sorted by name
+data: each asset is aligned to 4 bytes
+*/
+#define SSD1306_ASSETS_VERSION 1
+#define SSD1306_ASSETS_HEADER 16
+
+#define SSD1306_ASSET_FILE 0  // Any file, such as a font
+#define SSD1306_ASSET_IMAGE 1 // ssd1306_image_t. flags are SSD1306_IMAGE_FLIP/RLE
+#define SSD1306_ASSET_ANIM 2  // ssd1306_anim_t. offsets followed by the stream
+
+#define SSD1306_ASSET_LOOP 0x01 // Animation has a loop delta
+
+typedef struct {
+	char name[16]; // NUL terminated
+	uint32_t offset; // From the start of the pack
+	uint32_t size;
+	uint8_t format;
+	uint8_t flags;
+	uint16_t width;
+	uint16_t height;
+	uint16_t count; // Number of frames
+} ssd1306_asset_t;
+
+typedef struct {
+	const uint8_t * base;
+	size_t size;
+	int count;
+	const ssd1306_asset_t * index;
+	bool _mapped;
+	uint32_t _handle;
+} ssd1306_assets_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+bool ssd1306_assets_mount(ssd1306_assets_t * assets, const char * label);
+void ssd1306_assets_unmount(ssd1306_assets_t * assets);
+bool ssd1306_assets_open(ssd1306_assets_t * assets, const void * data, size_t size);
+const ssd1306_asset_t * ssd1306_assets_find(const ssd1306_assets_t * assets, const char * name);
+const uint8_t * ssd1306_assets_data(const ssd1306_assets_t * assets, const ssd1306_asset_t * asset);
+bool ssd1306_assets_image(const ssd1306_assets_t * assets, const char * name, ssd1306_image_t * image);
+bool ssd1306_assets_anim(const ssd1306_assets_t * assets, const char * name, ssd1306_anim_t * anim);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_SSD1306_ASSETS_H_ */
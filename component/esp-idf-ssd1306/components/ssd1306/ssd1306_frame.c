@@ -0,0 +1,94 @@
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "ssd1306.h"
+#include "ssd1306_frame.h"
+
+// Address commands sent for each dirty span, counted as data bytes
+#define FRAME_SPAN_COST 6
+
+// Start frame pacing at fps. budget_us is the time for drawing and flush in a frame.
+// 0 uses the whole frame.
+void ssd1306_frame_init(SSD1306_t * dev, ssd1306_frame_t * frame, int fps, int budget_us)
+{
+	memset(frame, 0, sizeof(ssd1306_frame_t));
+	if (fps <= 0) fps = 1;
+	frame->period = 1000000 / fps;
+	frame->budget = (budget_us > 0 && budget_us < frame->period) ? budget_us : frame->period;
+	frame->byte_cost = 16 * 25; // 400kHz I2C
+	frame->start = esp_timer_get_time() - frame->period;
+	dev->_frame = true;
+}
+
+// Wait for the start of the next frame.
+// Returns the number of frames skipped since the last one.
+int ssd1306_frame_begin(SSD1306_t * dev, ssd1306_frame_t * frame)
+{
+	int64_t now = esp_timer_get_time();
+	int64_t start = frame->start + frame->period;
+	int skipped = 0;
+	if (now >= start + frame->period) {
+		skipped = (now - start) / frame->period;
+		start = start + skipped * frame->period;
+		frame->skipped = frame->skipped + skipped;
+	}
+	// Round up, so that drawing never begins before the start
+	int64_t tick = portTICK_PERIOD_MS * 1000;
+	TickType_t ticks = (start - now + tick - 1) / tick;
+	if (ticks > 0) vTaskDelay(ticks);
+	frame->start = start;
+	frame->begin = esp_timer_get_time();
+	return skipped;
+}
+
+// Send the changes of this frame with one flush, unless it would run past the budget.
+// Returns the number of bytes sent.
+int ssd1306_frame_end(SSD1306_t * dev, ssd1306_frame_t * frame)
+{
+	int bytes = 0;
+	int spans = 0;
+	for (int page=0;page<dev->_pages;page++) {
+		PAGE_t * _page = &dev->_page[page];
+		for (int index=0;index<_page->_dirtyCount;index++) {
+			bytes = bytes + _page->_dirty[index]._end - _page->_dirty[index]._start;
+		}
+		spans = spans + _page->_dirtyCount;
+	}
+
+	int64_t now = esp_timer_get_time();
+	int64_t cost = (int64_t)(bytes + spans * FRAME_SPAN_COST) * frame->byte_cost / 16;
+	if (bytes > 0 && frame->held == false && now + cost > frame->start + frame->budget) {
+		// Keep the dirty spans. They are merged with the changes of the next frame.
+		ESP_LOGD(__FUNCTION__, "hold %d bytes, %d us over budget", bytes, (int)(now + cost - frame->start - frame->budget));
+		frame->held = true;
+		frame->held_count++;
+		frame->cpu_us = now - frame->begin;
+		frame->bytes = 0;
+		return 0;
+	}
+
+	bytes = ssd1306_flush(dev);
+	int64_t end = esp_timer_get_time();
+	if (bytes > 0) {
+		// Moving average of the flush time per byte
+		int byte_cost = (end - now) * 16 / (bytes + spans * FRAME_SPAN_COST);
+		frame->byte_cost = (frame->byte_cost * 7 + byte_cost) / 8;
+	}
+	frame->held = false;
+	frame->frames++;
+	frame->cpu_us = end - frame->begin;
+	frame->bytes = bytes;
+	return bytes;
+}
+
+// Stop frame pacing. The remaining changes are sent.
+void ssd1306_frame_stop(SSD1306_t * dev, ssd1306_frame_t * frame)
+{
+	dev->_frame = false;
+	ssd1306_flush(dev);
+}
@@ -0,0 +1,46 @@
+#ifndef MAIN_SSD1306_FRAME_H_
+#define MAIN_SSD1306_FRAME_H_
+
+#include "ssd1306.h"
+
+/* Frame pacing
+Drawing between ssd1306_frame_begin() and ssd1306_frame_end() only changes the internal buffer.
+ssd1306_display_image() and the functions built on it mark the columns dirty instead of sending them,
+and ssd1306_frame_end() sends all of them with one ssd1306_flush().
+
+Each frame has a budget from its start. When the flush is not expected to finish within the budget,
+the changes are kept for the next frame, at most one frame in a row.
+When a frame runs past the start of the next one, the missed frames are skipped.
+
+Use ssd1306_clock() to raise the panel refresh rate above the frame rate.
+*/
+
+typedef struct {
+	int64_t period;   // Microseconds of a frame
+	int64_t start;    // Start of the current frame
+	int64_t begin;    // When drawing of the current frame began
+	int budget;       // Microseconds for drawing and flush in a frame
+	int byte_cost;    // Measured flush time in 1/16 microseconds per byte
+	bool held;        // The last frame kept its changes
+	uint32_t frames;  // Frames sent
+	uint32_t skipped; // Frames missed because of overload
+	uint32_t held_count; // Frames whose changes went to the next frame
+	int cpu_us;       // Drawing and flush time of the last frame
+	int bytes;        // Bytes sent by the last frame
+} ssd1306_frame_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void ssd1306_frame_init(SSD1306_t * dev, ssd1306_frame_t * frame, int fps, int budget_us);
+int ssd1306_frame_begin(SSD1306_t * dev, ssd1306_frame_t * frame);
+int ssd1306_frame_end(SSD1306_t * dev, ssd1306_frame_t * frame);
+void ssd1306_frame_stop(SSD1306_t * dev, ssd1306_frame_t * frame);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_SSD1306_FRAME_H_ */
@@ -0,0 +1,88 @@
+#include <string.h>
+
+#include "esp_log.h"
+
+#include "ssd1306.h"
+#include "ssd1306_image.h"
+
+// Decode the runs of one page into row.
+// Returns the start of the next page, or NULL when the data is broken.
+const uint8_t * ssd1306_rle_decode(const uint8_t * src, uint8_t * row, int width)
+{
+	int seg = 0;
+	memset(row, 0, width);
+	while (1) {
+		uint8_t run = *src++;
+		uint8_t type = run & 0xC0;
+		int length = (run & 0x3F) + 1;
+		if (type == SSD1306_RLE_END) break;
+		if (seg + length > width) return NULL;
+		if (type == SSD1306_RLE_LITERAL) {
+			memcpy(&row[seg], src, length);
+			src = src + length;
+		} else if (type == SSD1306_RLE_REPEAT) {
+			memset(&row[seg], *src++, length);
+		}
+		seg = seg + length;
+	}
+	return src;
+}
+
+// Set up image from a binary image made by mkbitmap -o.
+// The data is not copied, so blob must stay valid.
+bool ssd1306_image_load(ssd1306_image_t * image, const uint8_t * blob, size_t blob_size)
+{
+	if (blob_size < SSD1306_IMAGE_HEADER || blob[0] != 'S' || blob[1] != 'I') {
+		ESP_LOGE(__FUNCTION__, "not a binary image");
+		return false;
+	}
+	image->width = blob[2];
+	image->pages = blob[3];
+	image->flags = blob[4];
+	image->size = blob[6] | (blob[7] << 8);
+	image->data = &blob[SSD1306_IMAGE_HEADER];
+	if (image->width == 0 || image->width > 128 || image->pages == 0 || image->pages > 8 ||
+		SSD1306_IMAGE_HEADER + image->size > blob_size) {
+		ESP_LOGE(__FUNCTION__, "broken binary image width=%d pages=%d size=%d", image->width, image->pages, image->size);
+		return false;
+	}
+	return true;
+}
+
+// Set image to internal buffer. Not show it.
+// page and seg are the upper left position. The image is clipped to the screen.
+// The changed columns are sent by ssd1306_flush() or ssd1306_show_buffer().
+void ssd1306_image_draw(SSD1306_t * dev, const ssd1306_image_t * image, int page, int seg)
+{
+	bool rotate = ((image->flags & SSD1306_IMAGE_FLIP) != 0) != dev->_flip;
+	int start = 0;
+	int end = image->width;
+	if (seg < 0) start = -seg;
+	if (seg + end > dev->_width) end = dev->_width - seg;
+
+	const uint8_t * src = image->data;
+	uint8_t row[128];
+	for (int _page=0;_page<image->pages;_page++) {
+		const uint8_t * segs = src;
+		if (image->flags & SSD1306_IMAGE_RLE) {
+			src = ssd1306_rle_decode(src, row, image->width);
+			if (src == NULL) {
+				ESP_LOGE(__FUNCTION__, "broken image page=%d", _page);
+				return;
+			}
+			segs = row;
+		} else {
+			src = src + image->width;
+		}
+
+		int dpage = page + _page;
+		if (dpage < 0 || dpage >= dev->_pages || start >= end) continue;
+		uint8_t * dst = dev->_page[dpage]._segs;
+		if (rotate) {
+			for (int i=start;i<end;i++) dst[seg+i] = ssd1306_rotate_byte(segs[i]);
+		} else {
+			memcpy(&dst[seg+start], &segs[start], end - start);
+		}
+		ssd1306_mark_dirty(dev, dpage, seg + start, end - start);
+	}
+}
@@ -0,0 +1,57 @@
+#ifndef MAIN_SSD1306_IMAGE_H_
+#define MAIN_SSD1306_IMAGE_H_
+
+#include "ssd1306.h"
+
+// Image in the SSD1306 GDDRAM layout.
+// One byte per column, bit0 is the top pixel, page by page.
+// It is copied to the internal buffer without any bit conversion.
+// Use tools/mkbitmap to create images from PBM/PNG files.
+#define SSD1306_IMAGE_FLIP 0x01 // Bytes are already rotated for dev->_flip
+#define SSD1306_IMAGE_RLE 0x02  // Every page is run-length coded
+
+typedef struct {
+	int width;  // Width in pixels
+	int pages;  // Height in pages
+	int flags;
+	int size;   // Size of data in bytes
+	const uint8_t * data;
+} ssd1306_image_t;
+
+/* Binary image (mkbitmap -o)
+  0 'S' 'I'
+  2 width
+  3 pages
+  4 flags
+  5 reserved
+  6 size of data, little endian 16 bits
+  8 data
+*/
+#define SSD1306_IMAGE_HEADER 8
+
+/* Run-length coding of one page
+  00nnnnnn             n+1 columns of 0x00
+  01nnnnnn byte*(n+1)  n+1 columns of these bytes
+  10nnnnnn byte        n+1 columns of this byte
+  11000000             end of page. The rest of the page is 0x00.
+*/
+#define SSD1306_RLE_SKIP 0x00
+#define SSD1306_RLE_LITERAL 0x40
+#define SSD1306_RLE_REPEAT 0x80
+#define SSD1306_RLE_END 0xC0
+#define SSD1306_RLE_MAX 64
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+bool ssd1306_image_load(ssd1306_image_t * image, const uint8_t * blob, size_t blob_size);
+void ssd1306_image_draw(SSD1306_t * dev, const ssd1306_image_t * image, int page, int seg);
+const uint8_t * ssd1306_rle_decode(const uint8_t * src, uint8_t * row, int width);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_SSD1306_IMAGE_H_ */
@@ -0,0 +1,203 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "ssd1306.h"
+#include "ssd1306_manager.h"
+
+typedef struct {
+	ssd1306_panel_config_t config;
+	SSD1306_t shadow; // Committed frame and its dirty spans. Same transport as config.dev
+	SemaphoreHandle_t lock; // Protects shadow
+	bool pending;
+	ssd1306_panel_stats_t stats;
+	int frames; // Flushes in this second
+} PANEL_t;
+
+typedef struct {
+	TaskHandle_t task;
+	int last; // Last panel sent
+	int64_t busy; // Microseconds sent in this second
+	ssd1306_bus_stats_t stats;
+} BUS_t;
+
+static ssd1306_schedule_t manager_schedule;
+static SemaphoreHandle_t manager_lock; // Protects pending and the panel count
+static PANEL_t panels[SSD1306_MANAGER_PANELS];
+static int panel_count;
+static BUS_t buses[SSD1306_MANAGER_BUSES];
+
+// Pick the next committed panel of bus. Returns -1 when there is none.
+static int manager_next(int bus)
+{
+	int next = -1;
+	xSemaphoreTake(manager_lock, portMAX_DELAY);
+	for (int i=1;i<=panel_count;i++) {
+		// Start after the last one for round robin
+		int id = (buses[bus].last + i) % panel_count;
+		PANEL_t * panel = &panels[id];
+		if (panel->config.bus != bus || panel->pending == false) continue;
+		if (next < 0) next = id;
+		if (manager_schedule == SSD1306_SCHEDULE_ROUND_ROBIN) break;
+		if (panel->config.priority > panels[next].config.priority) next = id;
+	}
+	if (next >= 0) {
+		panels[next].pending = false;
+		buses[bus].last = next;
+	}
+	xSemaphoreGive(manager_lock);
+	return next;
+}
+
+static void manager_bus_task(void * pvParameters)
+{
+	int bus = (int)(intptr_t)pvParameters;
+	BUS_t * _bus = &buses[bus];
+	int64_t second = esp_timer_get_time();
+	while (1) {
+		int id = manager_next(bus);
+		if (id < 0) {
+			// Wait for a commit, but wake up to update the statistics
+			ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+		} else {
+			PANEL_t * panel = &panels[id];
+			int64_t start = esp_timer_get_time();
+			xSemaphoreTake(panel->lock, portMAX_DELAY);
+			if (panel->config.select) panel->config.select(panel->config.dev, true, panel->config.arg);
+			int bytes = ssd1306_flush(&panel->shadow);
+			if (panel->config.select) panel->config.select(panel->config.dev, false, panel->config.arg);
+			xSemaphoreGive(panel->lock);
+			_bus->busy = _bus->busy + esp_timer_get_time() - start;
+			_bus->stats.bytes = _bus->stats.bytes + bytes;
+			panel->stats.bytes = panel->stats.bytes + bytes;
+			panel->stats.frames++;
+			panel->frames++;
+		}
+
+		int64_t now = esp_timer_get_time();
+		if (now - second >= 1000000) {
+			_bus->stats.busy = _bus->busy * 100 / (now - second);
+			_bus->busy = 0;
+			for (int i=0;i<panel_count;i++) {
+				if (panels[i].config.bus != bus) continue;
+				panels[i].stats.fps = panels[i].frames * 1000000LL / (now - second);
+				panels[i].frames = 0;
+				ESP_LOGD(__FUNCTION__, "bus=%d panel=%d fps=%d", bus, i, panels[i].stats.fps);
+			}
+			ESP_LOGD(__FUNCTION__, "bus=%d busy=%d%%", bus, _bus->stats.busy);
+			second = now;
+		}
+	}
+}
+
+bool ssd1306_manager_init(ssd1306_schedule_t schedule)
+{
+	if (manager_lock != NULL) {
+		ESP_LOGE(__FUNCTION__, "already initialized");
+		return false;
+	}
+	manager_lock = xSemaphoreCreateMutex();
+	if (manager_lock == NULL) {
+		ESP_LOGE(__FUNCTION__, "xSemaphoreCreateMutex fail");
+		return false;
+	}
+	manager_schedule = schedule;
+	return true;
+}
+
+// Add an initialized panel. The internal buffer of dev is taken as what the panel shows.
+// Returns the id of the panel, or -1.
+int ssd1306_manager_add(const ssd1306_panel_config_t * config)
+{
+	if (manager_lock == NULL) {
+		ESP_LOGE(__FUNCTION__, "not initialized");
+		return -1;
+	}
+	if (config->bus < 0 || config->bus >= SSD1306_MANAGER_BUSES) {
+		ESP_LOGE(__FUNCTION__, "wrong bus %d", config->bus);
+		return -1;
+	}
+	if (panel_count == SSD1306_MANAGER_PANELS) {
+		ESP_LOGE(__FUNCTION__, "too many panels");
+		return -1;
+	}
+	int id = panel_count;
+	PANEL_t * panel = &panels[id];
+	memset(panel, 0, sizeof(PANEL_t));
+	panel->config = *config;
+	panel->shadow = *config->dev;
+	for (int page=0;page<panel->shadow._pages;page++) {
+		panel->shadow._page[page]._dirtyCount = 0;
+	}
+	panel->lock = xSemaphoreCreateMutex();
+	if (panel->lock == NULL) {
+		ESP_LOGE(__FUNCTION__, "xSemaphoreCreateMutex fail");
+		return -1;
+	}
+
+	BUS_t * bus = &buses[config->bus];
+	if (bus->task == NULL) {
+		char name[16];
+		sprintf(name, "Panels%d", config->bus);
+		if (xTaskCreate(manager_bus_task, name, 1024*3, (void *)(intptr_t)config->bus, 5, &bus->task) != pdPASS) {
+			ESP_LOGE(__FUNCTION__, "xTaskCreate fail");
+			bus->task = NULL;
+			vSemaphoreDelete(panel->lock);
+			return -1;
+		}
+	}
+
+	xSemaphoreTake(manager_lock, portMAX_DELAY);
+	panel_count++;
+	xSemaphoreGive(manager_lock);
+	return id;
+}
+
+// Hand the dirty columns of the panel to its bus task and clear them.
+// This only waits while the same panel is being sent.
+void ssd1306_manager_commit(int id)
+{
+	if (id < 0 || id >= panel_count) return;
+	PANEL_t * panel = &panels[id];
+	SSD1306_t * dev = panel->config.dev;
+	bool dirty = false;
+
+	xSemaphoreTake(panel->lock, portMAX_DELAY);
+	for (int page=0;page<dev->_pages;page++) {
+		PAGE_t * _page = &dev->_page[page];
+		for (int index=0;index<_page->_dirtyCount;index++) {
+			int seg = _page->_dirty[index]._start;
+			int width = _page->_dirty[index]._end - seg;
+			memcpy(&panel->shadow._page[page]._segs[seg], &_page->_segs[seg], width);
+			ssd1306_mark_dirty(&panel->shadow, page, seg, width);
+			dirty = true;
+		}
+		_page->_dirtyCount = 0;
+	}
+	xSemaphoreGive(panel->lock);
+	if (dirty == false) return;
+
+	xSemaphoreTake(manager_lock, portMAX_DELAY);
+	if (panel->pending) panel->stats.merged++;
+	panel->pending = true;
+	xSemaphoreGive(manager_lock);
+	xTaskNotifyGive(buses[panel->config.bus].task);
+}
+
+void ssd1306_manager_get_panel_stats(int id, ssd1306_panel_stats_t * stats)
+{
+	if (id < 0 || id >= panel_count) return;
+	*stats = panels[id].stats;
+}
+
+void ssd1306_manager_get_bus_stats(int bus, ssd1306_bus_stats_t * stats)
+{
+	if (bus < 0 || bus >= SSD1306_MANAGER_BUSES) return;
+	*stats = buses[bus].stats;
+}
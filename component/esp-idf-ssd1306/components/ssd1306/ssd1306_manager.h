@@ -0,0 +1,60 @@
+#ifndef MAIN_SSD1306_MANAGER_H_
+#define MAIN_SSD1306_MANAGER_H_
+
+#include "ssd1306.h"
+
+/* Display manager
+Several panels on one or more buses.
+The application draws into each SSD1306_t as usual and calls ssd1306_manager_commit().
+The commit copies only the dirty columns to a second buffer of the panel and returns,
+so the next frame can be drawn while the bus task of the panel sends the committed one.
+A panel committed again before it was sent is merged, and only the latest content is sent.
+
+Each bus has one task. It sends the committed panels of the bus one at a time,
+in turn or by priority, so panels on different buses are sent in parallel.
+*/
+#define SSD1306_MANAGER_PANELS 4
+#define SSD1306_MANAGER_BUSES 2
+
+typedef enum {
+	SSD1306_SCHEDULE_ROUND_ROBIN = 0,
+	SSD1306_SCHEDULE_PRIORITY, // Highest priority first, in turn among the same priority
+} ssd1306_schedule_t;
+
+typedef struct {
+	SSD1306_t * dev;
+	int bus;      // 0 to SSD1306_MANAGER_BUSES-1. Panels on the same I2C or SPI bus must use the same bus.
+	int priority; // Used by SSD1306_SCHEDULE_PRIORITY
+	// Called around each transfer for panels that share one SPI device with their own CS pins, or NULL
+	void (*select)(SSD1306_t * dev, bool select, void * arg);
+	void * arg;
+} ssd1306_panel_config_t;
+
+typedef struct {
+	uint32_t frames; // Flushes sent
+	uint32_t bytes;  // Bytes sent
+	int fps;         // Flushes in the last second
+	uint32_t merged; // Commits merged into a later one before they were sent
+} ssd1306_panel_stats_t;
+
+typedef struct {
+	uint32_t bytes; // Bytes sent
+	int busy;       // Percent of the last second spent sending
+} ssd1306_bus_stats_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+bool ssd1306_manager_init(ssd1306_schedule_t schedule);
+int ssd1306_manager_add(const ssd1306_panel_config_t * config);
+void ssd1306_manager_commit(int id);
+void ssd1306_manager_get_panel_stats(int id, ssd1306_panel_stats_t * stats);
+void ssd1306_manager_get_bus_stats(int bus, ssd1306_bus_stats_t * stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_SSD1306_MANAGER_H_ */
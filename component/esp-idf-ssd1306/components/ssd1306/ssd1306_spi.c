@@ -250,6 +250,11 @@ void spi_contrast(SSD1306_t * dev, int contrast) {
 	spi_master_write_command(dev, _contrast);
 }
 
+void spi_clock(SSD1306_t * dev, uint8_t clock) {
+	spi_master_write_command(dev, OLED_CMD_SET_DISPLAY_CLK_DIV);	// D5
+	spi_master_write_command(dev, clock);
+}
+
 void spi_hardware_scroll(SSD1306_t * dev, ssd1306_scroll_type_t scroll)
 {
 
@@ -0,0 +1,134 @@
+#include <string.h>
+
+#include "esp_log.h"
+
+#include "ssd1306.h"
+#include "ssd1306_tilemap.h"
+
+// Wrap position into 0 to {size-1}
+static int tilemap_wrap(int pos, int size)
+{
+	pos = pos % size;
+	if (pos < 0) pos = pos + size;
+	return pos;
+}
+
+// Shortest distance from old to new position on the wrapped map
+static int tilemap_delta(int from, int to, int size)
+{
+	int delta = tilemap_wrap(to - from, size);
+	if (delta > size / 2) delta = delta - size;
+	return delta;
+}
+
+// Render columns seg_start to {seg_end-1} of one page into internal buffer and mark them dirty.
+// x and y are already wrapped.
+static void tilemap_render_span(SSD1306_t * dev, const ssd1306_tilemap_t * tm, int x, int y, int page, int seg_start, int seg_end)
+{
+	int map_pixel_width = tm->map_width * 8;
+	int fine = y & 7;
+	int row0 = ((y >> 3) + page) % tm->map_height;
+	int row1 = (row0 + 1) % tm->map_height;
+	const uint16_t * map0 = &tm->map[row0 * tm->map_width];
+	const uint16_t * map1 = &tm->map[row1 * tm->map_width];
+
+	int mx = (x + seg_start) % map_pixel_width;
+	uint8_t * segs = dev->_page[page]._segs;
+	for (int seg=seg_start;seg<seg_end;seg++) {
+		int col = mx >> 3;
+		int bit = mx & 7;
+		uint8_t wk = tm->tiles[map0[col] * 8 + bit];
+		if (fine) {
+			// Lower part of this page comes from the next tile row
+			uint8_t wk1 = tm->tiles[map1[col] * 8 + bit];
+			wk = (wk >> fine) | (wk1 << (8 - fine));
+		}
+		if (dev->_flip) wk = ssd1306_rotate_byte(wk);
+		segs[seg] = wk;
+		mx++;
+		if (mx == map_pixel_width) mx = 0;
+	}
+	ssd1306_mark_dirty(dev, page, seg_start, seg_end - seg_start);
+}
+
+void ssd1306_tilemap_init(ssd1306_tilemap_view_t * view, const ssd1306_tilemap_t * tilemap)
+{
+	view->tilemap = tilemap;
+	view->x = 0;
+	view->y = 0;
+	view->valid = false;
+}
+
+// Next render draws the whole screen.
+// Call this when something other than the tilemap has changed the internal buffer.
+void ssd1306_tilemap_invalidate(ssd1306_tilemap_view_t * view)
+{
+	view->valid = false;
+}
+
+// Set tilemap to internal buffer. Not show it.
+// The changed columns are marked dirty for ssd1306_flush().
+// x and y are the upper left position of the screen in the map, in pixels.
+// The map wraps around in both directions.
+void ssd1306_tilemap_render(SSD1306_t * dev, ssd1306_tilemap_view_t * view, int x, int y)
+{
+	const ssd1306_tilemap_t * tm = view->tilemap;
+	int width = dev->_width;
+	int pages = dev->_pages;
+	int _x = tilemap_wrap(x, tm->map_width * 8);
+	int _y = tilemap_wrap(y, tm->map_height * 8);
+
+	int dx = 0;
+	int dy = 0;
+	if (view->valid) {
+		dx = tilemap_delta(view->x, _x, tm->map_width * 8);
+		dy = tilemap_delta(view->y, _y, tm->map_height * 8);
+	}
+	ESP_LOGD(__FUNCTION__, "x=%d y=%d dx=%d dy=%d valid=%d", _x, _y, dx, dy, view->valid);
+
+	if (view->valid && dx == 0 && (dy % 8) == 0 && (dy / 8) < pages && (-dy / 8) < pages) {
+		// Page scroll. Move pages and render the pages that came into view.
+		int shift = dy / 8;
+		if (shift > 0) {
+			for (int page=0;page<pages-shift;page++) {
+				memcpy(dev->_page[page]._segs, dev->_page[page+shift]._segs, width);
+				ssd1306_mark_dirty(dev, page, 0, width);
+			}
+			for (int page=pages-shift;page<pages;page++) {
+				tilemap_render_span(dev, tm, _x, _y, page, 0, width);
+			}
+		} else if (shift < 0) {
+			for (int page=pages-1;page>=-shift;page--) {
+				memcpy(dev->_page[page]._segs, dev->_page[page+shift]._segs, width);
+				ssd1306_mark_dirty(dev, page, 0, width);
+			}
+			for (int page=0;page<-shift;page++) {
+				tilemap_render_span(dev, tm, _x, _y, page, 0, width);
+			}
+		}
+
+	} else if (view->valid && dy == 0 && dx < width && -dx < width) {
+		// Horizontal scroll. Move columns and render the columns that came into view.
+		for (int page=0;page<pages;page++) {
+			uint8_t * segs = dev->_page[page]._segs;
+			if (dx > 0) {
+				memmove(&segs[0], &segs[dx], width - dx);
+				ssd1306_mark_dirty(dev, page, 0, width - dx);
+				tilemap_render_span(dev, tm, _x, _y, page, width - dx, width);
+			} else if (dx < 0) {
+				memmove(&segs[-dx], &segs[0], width + dx);
+				ssd1306_mark_dirty(dev, page, -dx, width + dx);
+				tilemap_render_span(dev, tm, _x, _y, page, 0, -dx);
+			}
+		}
+
+	} else {
+		for (int page=0;page<pages;page++) {
+			tilemap_render_span(dev, tm, _x, _y, page, 0, width);
+		}
+	}
+
+	view->x = _x;
+	view->y = _y;
+	view->valid = true;
+}
@@ -0,0 +1,42 @@
+#ifndef MAIN_SSD1306_TILEMAP_H_
+#define MAIN_SSD1306_TILEMAP_H_
+
+#include "ssd1306.h"
+
+// Tilemap made of 8x8 page-aligned tiles.
+// Each tile is 8 bytes, one byte per column, bit0 is the top pixel.
+// This is the same layout as the SSD1306 GDDRAM, so a tile column can be
+// stored to the internal buffer without any bit conversion.
+// The map is indexes into the tile dictionary, map_width x map_height, row-major.
+// Use tools/mktiles to create these tables from images.
+typedef struct {
+	const uint8_t * tiles;
+	int tile_count;
+	const uint16_t * map;
+	int map_width;  // Number of tiles horizontally
+	int map_height; // Number of tiles vertically
+} ssd1306_tilemap_t;
+
+// Position of the last image rendered into the internal buffer.
+// It is used to render only the columns and pages that scrolled into view.
+typedef struct {
+	const ssd1306_tilemap_t * tilemap;
+	int x;
+	int y;
+	bool valid;
+} ssd1306_tilemap_view_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void ssd1306_tilemap_init(ssd1306_tilemap_view_t * view, const ssd1306_tilemap_t * tilemap);
+void ssd1306_tilemap_invalidate(ssd1306_tilemap_view_t * view);
+void ssd1306_tilemap_render(SSD1306_t * dev, ssd1306_tilemap_view_t * view, int x, int y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_SSD1306_TILEMAP_H_ */
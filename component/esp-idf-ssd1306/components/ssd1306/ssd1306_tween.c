@@ -0,0 +1,277 @@
+#include <string.h>
+#include <inttypes.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include "ssd1306.h"
+#include "ssd1306_anim.h"
+#include "ssd1306_tilemap.h"
+#include "ssd1306_tween.h"
+
+typedef struct {
+	bool active;
+	ssd1306_tween_config_t config;
+	int64_t start; // esp_timer_get_time() when added
+	int last;      // Last applied value
+	bool applied;
+} TWEEN_t;
+
+static SSD1306_t * tween_dev;
+static SemaphoreHandle_t tween_lock;
+static TaskHandle_t tween_task;
+static int tween_period;
+static ssd1306_tween_render_t tween_render;
+static void * tween_arg;
+static TWEEN_t tweens[SSD1306_TWEEN_MAX];
+static ssd1306_tween_stats_t tween_stats;
+
+// Easing curves in fixed point. progress and the result are 0 to SSD1306_EASE_ONE.
+int ssd1306_ease(ssd1306_ease_t ease, int progress)
+{
+	const int one = SSD1306_EASE_ONE;
+	int p = progress;
+	if (p <= 0) return 0;
+	if (p >= one) return one;
+	switch (ease) {
+	case SSD1306_EASE_IN_QUAD:
+		return p * p / one;
+	case SSD1306_EASE_OUT_QUAD:
+		return one - (one - p) * (one - p) / one;
+	case SSD1306_EASE_IN_OUT_QUAD:
+		if (p < one / 2) return 2 * p * p / one;
+		return one - 2 * (one - p) * (one - p) / one;
+	case SSD1306_EASE_IN_OUT_CUBIC:
+		if (p < one / 2) return 4 * (int64_t)p * p * p / one / one;
+		return one - 4 * (int64_t)(one - p) * (one - p) * (one - p) / one / one;
+	case SSD1306_EASE_OUT_BOUNCE:
+		// Four parabolas of the usual bounce curve, 7.5625 * p^2 with offsets
+		if (p < one * 4 / 11) return 121 * p * p / (16 * one);
+		if (p < one * 8 / 11) {
+			p = p - one * 6 / 11;
+			return 121 * p * p / (16 * one) + one * 3 / 4;
+		}
+		if (p < one * 10 / 11) {
+			p = p - one * 9 / 11;
+			return 121 * p * p / (16 * one) + one * 15 / 16;
+		}
+		p = p - one * 21 / 22;
+		return 121 * p * p / (16 * one) + one * 63 / 64;
+	default:
+		return p;
+	}
+}
+
+// Advance one tween to now. Returns true when the value changed.
+// *finished is set when the tween ended. Its done is called by the caller.
+static bool tween_advance(int id, int64_t now, bool * finished)
+{
+	TWEEN_t * tween = &tweens[id];
+	ssd1306_tween_config_t * config = &tween->config;
+	*finished = false;
+	int elapsed = (now - tween->start) / 1000 - config->delay;
+	if (elapsed < 0) return false;
+
+	int cycle = 0;
+	int progress = SSD1306_EASE_ONE;
+	if (config->duration > 0) {
+		cycle = elapsed / config->duration;
+		progress = (int64_t)(elapsed % config->duration) * SSD1306_EASE_ONE / config->duration;
+	}
+	if (config->duration <= 0 || (config->repeat >= 0 && cycle > config->repeat)) {
+		// Stop at the end of the last cycle
+		cycle = (config->repeat > 0) ? config->repeat : 0;
+		progress = SSD1306_EASE_ONE;
+		*finished = true;
+	}
+	if (config->yoyo && (cycle & 1)) progress = SSD1306_EASE_ONE - progress;
+
+	int value = config->from + (int64_t)(config->to - config->from) * ssd1306_ease(config->ease, progress) / SSD1306_EASE_ONE;
+	bool changed = false;
+	if (tween->applied == false || value != tween->last) {
+		tween->last = value;
+		tween->applied = true;
+		if (config->value) *config->value = value;
+		if (config->apply) config->apply(tween_dev, value, config->arg);
+		changed = true;
+	}
+	if (*finished) tween->active = false;
+	return changed;
+}
+
+static void tween_loop(void * pvParameters)
+{
+	TickType_t wake = xTaskGetTickCount();
+	int64_t second = esp_timer_get_time();
+	int frames = 0;
+	int cpu_max = 0;
+	while (1) {
+		int64_t start = esp_timer_get_time();
+		xSemaphoreTake(tween_lock, portMAX_DELAY);
+		bool changed = false;
+		int ended = 0;
+		struct {
+			int id;
+			ssd1306_tween_done_t done;
+			void * arg;
+		} done[SSD1306_TWEEN_MAX];
+		for (int id=0;id<SSD1306_TWEEN_MAX;id++) {
+			if (tweens[id].active == false) continue;
+			bool finished;
+			if (tween_advance(id, start, &finished)) changed = true;
+			if (finished && tweens[id].config.done) {
+				done[ended].id = id;
+				done[ended].done = tweens[id].config.done;
+				done[ended].arg = tweens[id].config.arg;
+				ended++;
+			}
+		}
+		if (changed && tween_render) tween_render(tween_dev, tween_arg);
+		int bytes = ssd1306_flush(tween_dev);
+
+		int64_t end = esp_timer_get_time();
+		int cpu = end - start;
+		if (cpu > cpu_max) cpu_max = cpu;
+		frames++;
+		tween_stats.frames++;
+		tween_stats.cpu_us = cpu;
+		tween_stats.bytes = bytes;
+		if (end - second >= 1000000) {
+			tween_stats.fps = frames;
+			tween_stats.cpu_max_us = cpu_max;
+			ESP_LOGD(__FUNCTION__, "fps=%d cpu=%dus max=%dus skipped=%"PRIu32, frames, cpu, cpu_max, tween_stats.skipped);
+			second = end;
+			frames = 0;
+			cpu_max = 0;
+		}
+		xSemaphoreGive(tween_lock);
+
+		// done can chain the next tween, so it runs without tween_lock
+		for (int i=0;i<ended;i++) {
+			done[i].done(done[i].id, done[i].arg);
+		}
+
+		// Skip the frames that are already late instead of running them back to back
+		TickType_t now = xTaskGetTickCount();
+		if ((TickType_t)(now - wake) >= tween_period) {
+			uint32_t late = (now - wake) / tween_period;
+			tween_stats.skipped = tween_stats.skipped + late;
+			wake = wake + late * tween_period;
+		}
+		vTaskDelayUntil(&wake, tween_period);
+	}
+}
+
+// Start the scheduler task. fps is the target frame rate.
+// lock protects dev. NULL creates a new one.
+// render is called once in a frame when any value changed, or NULL.
+bool ssd1306_tween_init(SSD1306_t * dev, SemaphoreHandle_t lock, int fps, ssd1306_tween_render_t render, void * arg)
+{
+	if (tween_task != NULL) {
+		ESP_LOGE(__FUNCTION__, "already initialized");
+		return false;
+	}
+	if (fps <= 0) {
+		ESP_LOGE(__FUNCTION__, "wrong fps %d", fps);
+		return false;
+	}
+	if (lock == NULL) lock = xSemaphoreCreateMutex();
+	if (lock == NULL) {
+		ESP_LOGE(__FUNCTION__, "xSemaphoreCreateMutex fail");
+		return false;
+	}
+	tween_dev = dev;
+	tween_lock = lock;
+	tween_render = render;
+	tween_arg = arg;
+	tween_period = pdMS_TO_TICKS(1000 / fps);
+	if (tween_period == 0) tween_period = 1;
+	if (xTaskCreate(tween_loop, "Tween", 1024*3, NULL, 5, &tween_task) != pdPASS) {
+		ESP_LOGE(__FUNCTION__, "xTaskCreate fail");
+		tween_task = NULL;
+		return false;
+	}
+	return true;
+}
+
+// Add a tween. The delay starts now.
+// Returns the id of the tween, or -1.
+int ssd1306_tween_add(const ssd1306_tween_config_t * config)
+{
+	if (tween_lock == NULL) {
+		ESP_LOGE(__FUNCTION__, "not initialized");
+		return -1;
+	}
+	xSemaphoreTake(tween_lock, portMAX_DELAY);
+	int id;
+	for (id=0;id<SSD1306_TWEEN_MAX;id++) {
+		if (tweens[id].active == false) break;
+	}
+	if (id == SSD1306_TWEEN_MAX) {
+		xSemaphoreGive(tween_lock);
+		ESP_LOGE(__FUNCTION__, "too many tweens");
+		return -1;
+	}
+	tweens[id].config = *config;
+	tweens[id].start = esp_timer_get_time();
+	tweens[id].applied = false;
+	tweens[id].active = true;
+	xSemaphoreGive(tween_lock);
+	return id;
+}
+
+// Stop the tween where it is. done is not called.
+void ssd1306_tween_remove(int id)
+{
+	if (id < 0 || id >= SSD1306_TWEEN_MAX) return;
+	if (tween_lock == NULL) return;
+	xSemaphoreTake(tween_lock, portMAX_DELAY);
+	tweens[id].active = false;
+	xSemaphoreGive(tween_lock);
+}
+
+bool ssd1306_tween_active(int id)
+{
+	if (id < 0 || id >= SSD1306_TWEEN_MAX) return false;
+	return tweens[id].active;
+}
+
+// Returns false before ssd1306_tween_init().
+bool ssd1306_tween_get_stats(ssd1306_tween_stats_t * stats)
+{
+	if (tween_lock == NULL) return false;
+	xSemaphoreTake(tween_lock, portMAX_DELAY);
+	*stats = tween_stats;
+	xSemaphoreGive(tween_lock);
+	return true;
+}
+
+// value is the contrast. arg is not used.
+void ssd1306_tween_apply_contrast(SSD1306_t * dev, int value, void * arg)
+{
+	ssd1306_contrast(dev, value);
+}
+
+// value is the frame index. arg is ssd1306_anim_player_t.
+void ssd1306_tween_apply_frame(SSD1306_t * dev, int value, void * arg)
+{
+	ssd1306_anim_seek(dev, (ssd1306_anim_player_t *)arg, value);
+}
+
+// value is the x of the view. arg is ssd1306_tilemap_view_t.
+void ssd1306_tween_apply_scroll_x(SSD1306_t * dev, int value, void * arg)
+{
+	ssd1306_tilemap_view_t * view = (ssd1306_tilemap_view_t *)arg;
+	ssd1306_tilemap_render(dev, view, value, view->y);
+}
+
+// value is the y of the view. arg is ssd1306_tilemap_view_t.
+void ssd1306_tween_apply_scroll_y(SSD1306_t * dev, int value, void * arg)
+{
+	ssd1306_tilemap_view_t * view = (ssd1306_tilemap_view_t *)arg;
+	ssd1306_tilemap_render(dev, view, view->x, value);
+}
@@ -0,0 +1,78 @@
+#ifndef MAIN_SSD1306_TWEEN_H_
+#define MAIN_SSD1306_TWEEN_H_
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "ssd1306.h"
+
+/* Tween scheduler
+A tween moves an int from one value to another over a duration with an easing curve.
+It can wait for a delay first, so tweens with delays make a timeline.
+One task runs the frames. Each frame it advances every active tween, calls the
+render callback once when any value changed and sends everything with one ssd1306_flush().
+Nothing sleeps in the caller, unlike the delay parameters of the driver.
+
+The apply callback of a tween is called with the new value, with the lock held.
+Built-in apply callbacks drive the contrast, an animation frame and a tilemap scroll.
+*/
+#define SSD1306_TWEEN_MAX 8
+#define SSD1306_EASE_ONE 1024 // Progress 1.0 of ssd1306_ease()
+
+typedef enum {
+	SSD1306_EASE_LINEAR = 0,
+	SSD1306_EASE_IN_QUAD,
+	SSD1306_EASE_OUT_QUAD,
+	SSD1306_EASE_IN_OUT_QUAD,
+	SSD1306_EASE_IN_OUT_CUBIC,
+	SSD1306_EASE_OUT_BOUNCE,
+} ssd1306_ease_t;
+
+typedef void (*ssd1306_tween_apply_t)(SSD1306_t * dev, int value, void * arg);
+typedef void (*ssd1306_tween_done_t)(int id, void * arg);
+typedef void (*ssd1306_tween_render_t)(SSD1306_t * dev, void * arg);
+
+typedef struct {
+	int from;
+	int to;
+	int delay;    // Milliseconds before the start
+	int duration; // Milliseconds of one cycle
+	ssd1306_ease_t ease;
+	int repeat;   // Extra cycles. -1 is forever
+	bool yoyo;    // Every other cycle goes back from to to from
+	int * value;  // Updated with the current value, or NULL
+	ssd1306_tween_apply_t apply; // Called when the value changed, or NULL
+	ssd1306_tween_done_t done;   // Called after the last cycle, or NULL. Can add the next tween.
+	void * arg;   // Argument of apply and done
+} ssd1306_tween_config_t;
+
+typedef struct {
+	uint32_t frames;  // Frames since ssd1306_tween_init()
+	uint32_t skipped; // Frames that missed the deadline
+	int fps;          // Frames in the last second
+	int cpu_us;       // Time of the last frame, without the wait
+	int cpu_max_us;   // Longest frame in the last second
+	int bytes;        // Bytes sent by the last flush
+} ssd1306_tween_stats_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+int ssd1306_ease(ssd1306_ease_t ease, int progress);
+bool ssd1306_tween_init(SSD1306_t * dev, SemaphoreHandle_t lock, int fps, ssd1306_tween_render_t render, void * arg);
+int ssd1306_tween_add(const ssd1306_tween_config_t * config);
+void ssd1306_tween_remove(int id);
+bool ssd1306_tween_active(int id);
+bool ssd1306_tween_get_stats(ssd1306_tween_stats_t * stats);
+void ssd1306_tween_apply_contrast(SSD1306_t * dev, int value, void * arg);
+void ssd1306_tween_apply_frame(SSD1306_t * dev, int value, void * arg);
+void ssd1306_tween_apply_scroll_x(SSD1306_t * dev, int value, void * arg);
+void ssd1306_tween_apply_scroll_y(SSD1306_t * dev, int value, void * arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_SSD1306_TWEEN_H_ */
@@ -0,0 +1,142 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+#include "ssd1306.h"
+#include "ssd1306_image.h"
+#include "ssd1306_manager.h"
+#include "ssd1306_virtual.h"
+#include "font8x8_basic.h"
+
+// Add both panels to the display manager. The panels must be initialized and have the same size.
+bool ssd1306_virtual_init(ssd1306_virtual_t * vdev, ssd1306_virtual_layout_t layout, SSD1306_t * dev0, int bus0, SSD1306_t * dev1, int bus1)
+{
+	if (dev0->_width != dev1->_width || dev0->_pages != dev1->_pages) {
+		ESP_LOGE(__FUNCTION__, "panels of different size");
+		return false;
+	}
+	if (bus0 == bus1) {
+		ESP_LOGW(__FUNCTION__, "both panels on bus %d are not sent in parallel", bus0);
+	}
+	vdev->layout = layout;
+	vdev->panels[0] = dev0;
+	vdev->panels[1] = dev1;
+	vdev->width = dev0->_width;
+	vdev->height = dev0->_height;
+	vdev->pages = dev0->_pages;
+	if (layout == SSD1306_VIRTUAL_SIDE_BY_SIDE) {
+		vdev->width = vdev->width * 2;
+	} else {
+		vdev->height = vdev->height * 2;
+		vdev->pages = vdev->pages * 2;
+	}
+
+	int bus[2] = {bus0, bus1};
+	for (int i=0;i<2;i++) {
+		ssd1306_panel_config_t config = {
+			.dev = vdev->panels[i],
+			.bus = bus[i],
+		};
+		vdev->ids[i] = ssd1306_manager_add(&config);
+		if (vdev->ids[i] < 0) return false;
+	}
+	return true;
+}
+
+void ssd1306_virtual_clear(ssd1306_virtual_t * vdev, bool invert)
+{
+	for (int i=0;i<2;i++) {
+		SSD1306_t * dev = vdev->panels[i];
+		for (int page=0;page<dev->_pages;page++) {
+			memset(dev->_page[page]._segs, invert ? 0xFF : 0x00, dev->_width);
+			ssd1306_mark_dirty(dev, page, 0, dev->_width);
+		}
+	}
+}
+
+// Set pixel to internal buffer. Not show it. Pixels outside the display are ignored.
+void ssd1306_virtual_pixel(ssd1306_virtual_t * vdev, int xpos, int ypos, bool invert)
+{
+	if (xpos < 0 || xpos >= vdev->width || ypos < 0 || ypos >= vdev->height) return;
+	SSD1306_t * dev = vdev->panels[0];
+	if (xpos >= dev->_width) {
+		xpos = xpos - dev->_width;
+		dev = vdev->panels[1];
+	} else if (ypos >= dev->_height) {
+		ypos = ypos - dev->_height;
+		dev = vdev->panels[1];
+	}
+	uint8_t bit = dev->_flip ? 0x80 >> (ypos % 8) : 1 << (ypos % 8);
+	uint8_t * seg = &dev->_page[ypos / 8]._segs[xpos];
+	if (invert) {
+		*seg = *seg & ~bit;
+	} else {
+		*seg = *seg | bit;
+	}
+	ssd1306_mark_dirty(dev, ypos / 8, xpos, 1);
+}
+
+// Set line to internal buffer. Not show it.
+void ssd1306_virtual_line(ssd1306_virtual_t * vdev, int x1, int y1, int x2, int y2, bool invert)
+{
+	int dx = abs(x2 - x1);
+	int dy = -abs(y2 - y1);
+	int sx = (x1 < x2) ? 1 : -1;
+	int sy = (y1 < y2) ? 1 : -1;
+	int err = dx + dy;
+	while (1) {
+		ssd1306_virtual_pixel(vdev, x1, y1, invert);
+		if (x1 == x2 && y1 == y2) break;
+		int e2 = 2 * err;
+		if (e2 >= dy) {
+			err = err + dy;
+			x1 = x1 + sx;
+		}
+		if (e2 <= dx) {
+			err = err + dx;
+			y1 = y1 + sy;
+		}
+	}
+}
+
+// Set image to internal buffer. Not show it.
+// Each panel draws the image at its own position, and ssd1306_image_draw() clips it at the seam.
+void ssd1306_virtual_image(ssd1306_virtual_t * vdev, const ssd1306_image_t * image, int page, int seg)
+{
+	SSD1306_t * dev = vdev->panels[0];
+	ssd1306_image_draw(dev, image, page, seg);
+	if (vdev->layout == SSD1306_VIRTUAL_SIDE_BY_SIDE) {
+		ssd1306_image_draw(vdev->panels[1], image, page, seg - dev->_width);
+	} else {
+		ssd1306_image_draw(vdev->panels[1], image, page - dev->_pages, seg);
+	}
+}
+
+// Set text of the 8x8 font to internal buffer. Not show it.
+// Unlike ssd1306_display_text(), seg is any column and a character can cross the seam.
+void ssd1306_virtual_text(ssd1306_virtual_t * vdev, int page, int seg, const char * text, bool invert)
+{
+	uint8_t glyph[8];
+	ssd1306_image_t image = {
+		.width = 8,
+		.pages = 1,
+		.flags = 0,
+		.size = 8,
+		.data = glyph,
+	};
+	for (int i=0;text[i]!=0 && seg<vdev->width;i++,seg+=8) {
+		uint8_t code = text[i];
+		if (code >= 128) code = ' ';
+		memcpy(glyph, font8x8_basic_tr[code], 8);
+		if (invert) ssd1306_invert(glyph, 8);
+		ssd1306_virtual_image(vdev, &image, page, seg);
+	}
+}
+
+// Send the changes of both panels. Each half is sent by the task of its bus.
+void ssd1306_virtual_commit(ssd1306_virtual_t * vdev)
+{
+	ssd1306_manager_commit(vdev->ids[0]);
+	ssd1306_manager_commit(vdev->ids[1]);
+}
@@ -0,0 +1,47 @@
+#ifndef MAIN_SSD1306_VIRTUAL_H_
+#define MAIN_SSD1306_VIRTUAL_H_
+
+#include "ssd1306.h"
+#include "ssd1306_image.h"
+
+/* Virtual display
+Two panels used as one display, side by side (256x64) or stacked (128x128).
+Drawing takes coordinates of the whole display and is split at the seam.
+ssd1306_virtual_commit() hands both halves to ssd1306_manager, so each half is sent
+by the task of its own bus at the same time. Put the panels on different buses,
+like two I2C ports or I2C and SPI, to get the frame rate of a single panel.
+Call ssd1306_manager_init() before ssd1306_virtual_init().
+*/
+
+typedef enum {
+	SSD1306_VIRTUAL_SIDE_BY_SIDE = 0, // panels[1] is on the right
+	SSD1306_VIRTUAL_STACKED,          // panels[1] is below
+} ssd1306_virtual_layout_t;
+
+typedef struct {
+	ssd1306_virtual_layout_t layout;
+	SSD1306_t * panels[2];
+	int ids[2];  // ssd1306_manager ids
+	int width;   // Size of the whole display
+	int height;
+	int pages;
+} ssd1306_virtual_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+bool ssd1306_virtual_init(ssd1306_virtual_t * vdev, ssd1306_virtual_layout_t layout, SSD1306_t * dev0, int bus0, SSD1306_t * dev1, int bus1);
+void ssd1306_virtual_clear(ssd1306_virtual_t * vdev, bool invert);
+void ssd1306_virtual_pixel(ssd1306_virtual_t * vdev, int xpos, int ypos, bool invert);
+void ssd1306_virtual_line(ssd1306_virtual_t * vdev, int x1, int y1, int x2, int y2, bool invert);
+void ssd1306_virtual_image(ssd1306_virtual_t * vdev, const ssd1306_image_t * image, int page, int seg);
+void ssd1306_virtual_text(ssd1306_virtual_t * vdev, int page, int seg, const char * text, bool invert);
+void ssd1306_virtual_commit(ssd1306_virtual_t * vdev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_SSD1306_VIRTUAL_H_ */
@@ -0,0 +1,136 @@
+//
+// Delta-compressed animation encoder shared by mkanim and mkassets.
+// The stream format is described in components/ssd1306/ssd1306_anim.h.
+//
+#ifndef ANIM_ENCODE_H_
+#define ANIM_ENCODE_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "pbm_image.h"
+#include "page_rle.h"
+
+// Same value as ssd1306_anim.h
+#define ANIM_KEYFRAME 0x01
+
+// Encode the change from prev to next. prev is NULL for a keyframe.
+static void encode_frame(buffer_t * out, const uint8_t * prev, const uint8_t * next, int width, int pages)
+{
+	uint8_t *diff = malloc(width);
+	uint8_t mask = 0;
+	for (int page=0;page<pages;page++) {
+		for (int seg=0;seg<width;seg++) {
+			uint8_t wk = next[page*width+seg];
+			if (prev) wk ^= prev[page*width+seg];
+			if (wk) mask |= (1 << page);
+		}
+	}
+	buffer_put(out, prev ? 0 : ANIM_KEYFRAME);
+	buffer_put(out, mask);
+	for (int page=0;page<pages;page++) {
+		if ((mask & (1 << page)) == 0) continue;
+		for (int seg=0;seg<width;seg++) {
+			diff[seg] = next[page*width+seg];
+			if (prev) diff[seg] ^= prev[page*width+seg];
+		}
+		rle_encode_page(out, diff, width);
+	}
+	free(diff);
+}
+
+typedef struct {
+	int width;
+	int pages;
+	int frames;
+	int loop;      // offsets[frames] is a delta from the last frame to the first frame
+	int keyframes;
+	int entries;   // frames, plus one with loop
+	uint32_t *offsets;
+	buffer_t data;
+} anim_stream_t;
+
+// Encode images into a stream.
+// interval forces a keyframe every interval frames. 0 is the first frame only.
+// A keyframe is also used when it is smaller than the delta.
+static int anim_encode(anim_stream_t * anim, char * const * paths, int frames, int invert, int interval, int loop)
+{
+	int width = 0;
+	int pages = 0;
+	uint8_t *page_data = NULL;
+	for (int i=0;i<frames;i++) {
+		pbm_image_t image;
+		if (pbm_image_load(paths[i], &image) != 0) return 1;
+		if (invert) pbm_image_invert(&image);
+		if (i == 0) {
+			width = image.width;
+			pages = image.height / 8;
+			if ((image.height % 8) != 0 || pages > 8 || width > 128) {
+				fprintf(stderr, "%s: height must be a multiple of 8, up to 128x64\n", paths[i]);
+				return 1;
+			}
+			page_data = malloc(frames * width * pages);
+		}
+		if (image.width != width || image.height != pages * 8) {
+			fprintf(stderr, "%s: all images must have the same size\n", paths[i]);
+			return 1;
+		}
+		uint8_t *frame = &page_data[i * width * pages];
+		for (int page=0;page<pages;page++) {
+			for (int seg=0;seg<width;seg++) {
+				frame[page*width+seg] = pbm_image_column(&image, seg, page*8);
+			}
+		}
+		pbm_image_free(&image);
+	}
+
+	memset(anim, 0, sizeof(anim_stream_t));
+	anim->width = width;
+	anim->pages = pages;
+	anim->frames = frames;
+	anim->loop = loop;
+	anim->entries = frames + (loop ? 1 : 0);
+	anim->offsets = malloc((anim->entries + 1) * sizeof(uint32_t));
+	buffer_t key = {0};
+	buffer_t delta = {0};
+	for (int i=0;i<anim->entries;i++) {
+		const uint8_t *next = &page_data[(i % frames) * width * pages];
+		const uint8_t *prev = (i == 0) ? NULL : &page_data[(i - 1) * width * pages];
+		key.size = 0;
+		delta.size = 0;
+		encode_frame(&key, NULL, next, width, pages);
+		if (prev) encode_frame(&delta, prev, next, width, pages);
+
+		if (i == frames && key.size <= delta.size) {
+			// Frame 0 is a keyframe. Playing it again is cheaper than the loop delta.
+			anim->entries = frames;
+			anim->loop = 0;
+			break;
+		}
+		int use_key = (prev == NULL);
+		if (i < frames && prev) {
+			if (interval > 0 && (i % interval) == 0) use_key = 1;
+			if (key.size <= delta.size) use_key = 1;
+		}
+		buffer_t *frame = use_key ? &key : &delta;
+		if (use_key) anim->keyframes++;
+		anim->offsets[i] = anim->data.size;
+		for (int j=0;j<frame->size;j++) buffer_put(&anim->data, frame->data[j]);
+	}
+	anim->offsets[anim->entries] = anim->data.size;
+
+	free(page_data);
+	free(key.data);
+	free(delta.data);
+	return 0;
+}
+
+static void anim_free(anim_stream_t * anim)
+{
+	free(anim->offsets);
+	free(anim->data.data);
+}
+
+#endif /* ANIM_ENCODE_H_ */
@@ -0,0 +1,77 @@
+//
+// Page layout image encoder shared by mkbitmap and mkassets.
+// The format is described in components/ssd1306/ssd1306_image.h.
+//
+#ifndef BITMAP_ENCODE_H_
+#define BITMAP_ENCODE_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "pbm_image.h"
+#include "page_rle.h"
+
+// Same values as ssd1306_image.h
+#define IMAGE_FLIP 0x01
+#define IMAGE_RLE 0x02
+#define IMAGE_HEADER 8
+
+typedef struct {
+	int width;
+	int pages;
+	int flags;
+	buffer_t data;
+} bitmap_t;
+
+// Same as ssd1306_rotate_byte()
+static uint8_t rotate_byte(uint8_t ch1)
+{
+	uint8_t ch2 = 0;
+	for (int j=0;j<8;j++) {
+		ch2 = (ch2 << 1) + (ch1 & 0x01);
+		ch1 = ch1 >> 1;
+	}
+	return ch2;
+}
+
+// Convert one image. RLE is used only when it is smaller.
+static int bitmap_encode(const char * path, bitmap_t * bitmap, int invert, int flip, int rle)
+{
+	pbm_image_t image;
+	if (pbm_image_load(path, &image) != 0) return 1;
+	if (invert) pbm_image_invert(&image);
+	if (image.width > 128 || image.height > 64) {
+		fprintf(stderr, "%s: image must be up to 128x64\n", path);
+		return 1;
+	}
+	bitmap->width = image.width;
+	bitmap->pages = (image.height + 7) / 8;
+	bitmap->flags = flip ? IMAGE_FLIP : 0;
+
+	buffer_t raw = {0};
+	buffer_t packed = {0};
+	uint8_t row[128];
+	for (int page=0;page<bitmap->pages;page++) {
+		for (int seg=0;seg<image.width;seg++) {
+			row[seg] = pbm_image_column(&image, seg, page*8);
+			if (flip) row[seg] = rotate_byte(row[seg]);
+			buffer_put(&raw, row[seg]);
+		}
+		rle_encode_page(&packed, row, image.width);
+	}
+	pbm_image_free(&image);
+
+	// RLE is used only when it is smaller
+	if (rle && packed.size < raw.size) {
+		bitmap->flags |= IMAGE_RLE;
+		bitmap->data = packed;
+		free(raw.data);
+	} else {
+		bitmap->data = raw;
+		free(packed.data);
+	}
+	return 0;
+}
+
+#endif /* BITMAP_ENCODE_H_ */
@@ -0,0 +1,105 @@
+//
+// mkanim - encode images into a delta-compressed ssd1306_anim stream
+//
+// cc -o mkanim mkanim.c
+// ./mkanim -n monkey -l monkey10.pbm monkey09.pbm ... > main/monkey_anim.h
+//
+// All images must have the same size.
+// Height must be a multiple of 8 and at most 64.
+// The stream format is described in components/ssd1306/ssd1306_anim.h.
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <unistd.h>
+
+#include "anim_encode.h"
+
+static void usage(void)
+{
+	fprintf(stderr,
+		"Usage: mkanim [-n name] [-k interval] [-l] [-i] image...\n"
+		"\t-n name\tname of the animation (default anim)\n"
+		"\t-k interval\tforce a keyframe every interval frames (default 0 = first frame only)\n"
+		"\t-l\tadd a delta from the last frame to the first frame, when it is smaller than the first frame\n"
+		"\t-i\tinvert the images\n"
+		"A keyframe is also used when it is smaller than the delta.\n");
+}
+
+int main(int argc, char *argv[])
+{
+	const char *name = "anim";
+	int interval = 0;
+	int loop = 0;
+	int invert = 0;
+	int opt;
+	while ((opt = getopt(argc, argv, "n:k:lih")) != -1) {
+		switch (opt) {
+			case 'n':
+				name = optarg;
+				break;
+			case 'k':
+				interval = atoi(optarg);
+				break;
+			case 'l':
+				loop = 1;
+				break;
+			case 'i':
+				invert = 1;
+				break;
+			default:
+				usage();
+				return 1;
+		}
+	}
+	if (optind >= argc) {
+		usage();
+		return 1;
+	}
+
+	int frames = argc - optind;
+	anim_stream_t anim;
+	if (anim_encode(&anim, &argv[optind], frames, invert, interval, loop) != 0) return 1;
+
+	printf("// Generated by mkanim. Do not edit.\n");
+	for (int i=0;i<frames;i++) {
+		printf("// '%s', %dx%dpx\n", argv[optind+i], anim.width, anim.pages * 8);
+	}
+	printf("#include \"ssd1306_anim.h\"\n\n");
+
+	printf("const uint8_t %s_data[] = {\n", name);
+	for (int i=0;i<anim.entries;i++) {
+		if (i < frames) {
+			printf("// frame %d%s\n", i, (anim.data.data[anim.offsets[i]] & ANIM_KEYFRAME) ? " keyframe" : "");
+		} else {
+			printf("// loop\n");
+		}
+		for (uint32_t j=anim.offsets[i];j<anim.offsets[i+1];j++) {
+			printf("0x%02x,", anim.data.data[j]);
+			if ((j - anim.offsets[i]) % 16 == 15 || j + 1 == anim.offsets[i+1]) printf("\n");
+		}
+	}
+	printf("};\n\n");
+
+	printf("const uint32_t %s_offsets[] = {\n", name);
+	for (int i=0;i<anim.entries;i++) printf("%"PRIu32", ", anim.offsets[i]);
+	printf("\n};\n\n");
+
+	printf("const ssd1306_anim_t %s = {\n", name);
+	printf("\t.width = %d,\n", anim.width);
+	printf("\t.pages = %d,\n", anim.pages);
+	printf("\t.frames = %d,\n", frames);
+	printf("\t.loop = %s,\n", anim.loop ? "true" : "false");
+	printf("\t.offsets = %s_offsets,\n", name);
+	printf("\t.data = %s_data,\n", name);
+	printf("};\n");
+
+	int original = frames * anim.width * anim.pages;
+	int packed = anim.data.size + anim.entries * (int)sizeof(uint32_t);
+	fprintf(stderr, "%s: %d frames, %d keyframes, %d bytes -> %d bytes\n",
+		name, frames, anim.keyframes, original, packed);
+
+	anim_free(&anim);
+	return 0;
+}
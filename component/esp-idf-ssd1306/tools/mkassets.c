@@ -0,0 +1,293 @@
+//
+// mkassets - pack images, animations and fonts into an asset partition for ssd1306_assets
+//
+// cc -o mkassets mkassets.c
+// ./mkassets -o assets.bin assets.txt
+// ./mkassets -s 0x10000 -o assets.bin assets.txt
+//
+// The manifest has one asset per line. Paths are relative to the manifest.
+//   image name [-i] [-f] [-r] file.pbm
+//   anim name [-i] [-l] [-k interval] frame.pbm...
+//   file name path
+// Options are the same as mkbitmap and mkanim.
+// Names are up to 15 characters. Lines starting with # are comments.
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "bitmap_encode.h"
+#include "anim_encode.h"
+
+// Same values as ssd1306_assets.h
+#define ASSETS_VERSION 1
+#define ASSETS_HEADER 16
+#define ASSET_ENTRY 32
+#define ASSET_NAME 16
+#define ASSET_FILE 0
+#define ASSET_IMAGE 1
+#define ASSET_ANIM 2
+#define ASSET_LOOP 0x01
+
+#define MAX_ARGS 256
+
+typedef struct {
+	char name[ASSET_NAME];
+	int format;
+	int flags;
+	int width;
+	int height;
+	int count;
+	uint32_t offset;
+	buffer_t data;
+} asset_t;
+
+static void put16(uint8_t * p, uint32_t value)
+{
+	p[0] = value & 0xFF;
+	p[1] = (value >> 8) & 0xFF;
+}
+
+static void put32(uint8_t * p, uint32_t value)
+{
+	put16(&p[0], value & 0xFFFF);
+	put16(&p[2], value >> 16);
+}
+
+static void buffer_append(buffer_t * buffer, const uint8_t * data, int size)
+{
+	for (int i=0;i<size;i++) buffer_put(buffer, data[i]);
+}
+
+static int load_file(const char * path, buffer_t * out)
+{
+	FILE *fp = fopen(path, "rb");
+	if (fp == NULL) {
+		fprintf(stderr, "%s: cannot open\n", path);
+		return 1;
+	}
+	uint8_t wk[512];
+	size_t n;
+	while ((n = fread(wk, 1, sizeof(wk), fp)) > 0) buffer_append(out, wk, n);
+	fclose(fp);
+	return 0;
+}
+
+static int make_image(asset_t * asset, int argc, char ** argv)
+{
+	int invert = 0;
+	int flip = 0;
+	int rle = 0;
+	int i = 0;
+	for (;i<argc && argv[i][0] == '-';i++) {
+		if (strcmp(argv[i], "-i") == 0) invert = 1;
+		else if (strcmp(argv[i], "-f") == 0) flip = 1;
+		else if (strcmp(argv[i], "-r") == 0) rle = 1;
+		else {
+			fprintf(stderr, "%s: unknown option %s\n", asset->name, argv[i]);
+			return 1;
+		}
+	}
+	if (argc - i != 1) {
+		fprintf(stderr, "%s: one image is required\n", asset->name);
+		return 1;
+	}
+	bitmap_t bitmap;
+	if (bitmap_encode(argv[i], &bitmap, invert, flip, rle) != 0) return 1;
+	asset->format = ASSET_IMAGE;
+	asset->flags = bitmap.flags;
+	asset->width = bitmap.width;
+	asset->height = bitmap.pages * 8;
+	asset->data = bitmap.data;
+	return 0;
+}
+
+static int make_anim(asset_t * asset, int argc, char ** argv)
+{
+	int invert = 0;
+	int loop = 0;
+	int interval = 0;
+	int i = 0;
+	for (;i<argc && argv[i][0] == '-';i++) {
+		if (strcmp(argv[i], "-i") == 0) invert = 1;
+		else if (strcmp(argv[i], "-l") == 0) loop = 1;
+		else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc) interval = atoi(argv[++i]);
+		else {
+			fprintf(stderr, "%s: unknown option %s\n", asset->name, argv[i]);
+			return 1;
+		}
+	}
+	if (argc - i < 1) {
+		fprintf(stderr, "%s: no frames\n", asset->name);
+		return 1;
+	}
+	anim_stream_t anim;
+	if (anim_encode(&anim, &argv[i], argc - i, invert, interval, loop) != 0) return 1;
+	// Offsets first, then the stream. Both are read in place.
+	uint8_t wk[4];
+	for (int j=0;j<anim.entries;j++) {
+		put32(wk, anim.offsets[j]);
+		buffer_append(&asset->data, wk, 4);
+	}
+	buffer_append(&asset->data, anim.data.data, anim.data.size);
+	asset->format = ASSET_ANIM;
+	asset->flags = anim.loop ? ASSET_LOOP : 0;
+	asset->width = anim.width;
+	asset->height = anim.pages * 8;
+	asset->count = anim.frames;
+	fprintf(stderr, "%s: %d frames, %d keyframes\n", asset->name, anim.frames, anim.keyframes);
+	anim_free(&anim);
+	return 0;
+}
+
+static int compare_asset(const void * a, const void * b)
+{
+	return strncmp(((const asset_t *)a)->name, ((const asset_t *)b)->name, ASSET_NAME);
+}
+
+// Split a line into words and make paths relative to the manifest
+static int split_line(char * line, char ** argv, const char * dir)
+{
+	int argc = 0;
+	for (char *word = strtok(line, " \t\r\n"); word && argc < MAX_ARGS; word = strtok(NULL, " \t\r\n")) {
+		argv[argc++] = word;
+	}
+	// Words after the type and the name are options or paths
+	for (int i=2;i<argc;i++) {
+		if (argv[i][0] == '-' || argv[i][0] == '/' || dir[0] == 0) continue;
+		if (i > 2 && strcmp(argv[i-1], "-k") == 0) continue;
+		char *path = malloc(strlen(dir) + strlen(argv[i]) + 2);
+		sprintf(path, "%s/%s", dir, argv[i]);
+		argv[i] = path;
+	}
+	return argc;
+}
+
+static void usage(void)
+{
+	fprintf(stderr,
+		"Usage: mkassets [-s size] -o file manifest\n"
+		"\t-s size\tsize of the partition. The pack must fit in it\n"
+		"\t-o file\tpack to write\n");
+}
+
+int main(int argc, char *argv[])
+{
+	const char *output = NULL;
+	long partition_size = 0;
+	int opt;
+	while ((opt = getopt(argc, argv, "s:o:h")) != -1) {
+		switch (opt) {
+			case 's':
+				partition_size = strtol(optarg, NULL, 0);
+				break;
+			case 'o':
+				output = optarg;
+				break;
+			default:
+				usage();
+				return 1;
+		}
+	}
+	if (output == NULL || argc - optind != 1) {
+		usage();
+		return 1;
+	}
+	const char *manifest = argv[optind];
+	FILE *fp = fopen(manifest, "r");
+	if (fp == NULL) {
+		fprintf(stderr, "%s: cannot open\n", manifest);
+		return 1;
+	}
+	char dir[1024] = "";
+	const char *slash = strrchr(manifest, '/');
+	if (slash) snprintf(dir, sizeof(dir), "%.*s", (int)(slash - manifest), manifest);
+
+	asset_t *assets = NULL;
+	int count = 0;
+	char line[4096];
+	int lineno = 0;
+	while (fgets(line, sizeof(line), fp)) {
+		lineno++;
+		char *words[MAX_ARGS];
+		int words_count = split_line(line, words, dir);
+		if (words_count == 0 || words[0][0] == '#') continue;
+		if (words_count < 3) {
+			fprintf(stderr, "%s:%d: type, name and files are required\n", manifest, lineno);
+			return 1;
+		}
+		if (strlen(words[1]) >= ASSET_NAME) {
+			fprintf(stderr, "%s:%d: %s is longer than %d characters\n", manifest, lineno, words[1], ASSET_NAME - 1);
+			return 1;
+		}
+		assets = realloc(assets, (count + 1) * sizeof(asset_t));
+		asset_t *asset = &assets[count++];
+		memset(asset, 0, sizeof(asset_t));
+		strcpy(asset->name, words[1]);
+		int ret;
+		if (strcmp(words[0], "image") == 0) {
+			ret = make_image(asset, words_count - 2, &words[2]);
+		} else if (strcmp(words[0], "anim") == 0) {
+			ret = make_anim(asset, words_count - 2, &words[2]);
+		} else if (strcmp(words[0], "file") == 0 && words_count == 3) {
+			asset->format = ASSET_FILE;
+			ret = load_file(words[2], &asset->data);
+		} else {
+			fprintf(stderr, "%s:%d: unknown asset %s\n", manifest, lineno, words[0]);
+			ret = 1;
+		}
+		if (ret != 0) return 1;
+	}
+	fclose(fp);
+
+	// The index is sorted for binary search
+	qsort(assets, count, sizeof(asset_t), compare_asset);
+	uint32_t offset = ASSETS_HEADER + count * ASSET_ENTRY;
+	for (int i=0;i<count;i++) {
+		if (i > 0 && compare_asset(&assets[i-1], &assets[i]) == 0) {
+			fprintf(stderr, "%s: %s is defined twice\n", manifest, assets[i].name);
+			return 1;
+		}
+		assets[i].offset = offset;
+		offset = (offset + assets[i].data.size + 3) & ~3;
+	}
+	uint32_t pack_size = offset;
+	if (partition_size > 0 && pack_size > partition_size) {
+		fprintf(stderr, "%s: %u bytes do not fit in the partition of %ld bytes\n", output, pack_size, partition_size);
+		return 1;
+	}
+
+	uint8_t *pack = calloc(1, pack_size);
+	memcpy(pack, "SSDA", 4);
+	put16(&pack[4], ASSETS_VERSION);
+	put16(&pack[6], count);
+	put32(&pack[8], pack_size);
+	for (int i=0;i<count;i++) {
+		uint8_t *entry = &pack[ASSETS_HEADER + i * ASSET_ENTRY];
+		memcpy(entry, assets[i].name, ASSET_NAME);
+		put32(&entry[16], assets[i].offset);
+		put32(&entry[20], assets[i].data.size);
+		entry[24] = assets[i].format;
+		entry[25] = assets[i].flags;
+		put16(&entry[26], assets[i].width);
+		put16(&entry[28], assets[i].height);
+		put16(&entry[30], assets[i].count);
+		memcpy(&pack[assets[i].offset], assets[i].data.data, assets[i].data.size);
+		fprintf(stderr, "  %-15s %6d bytes at 0x%06x\n", assets[i].name, assets[i].data.size, assets[i].offset);
+		free(assets[i].data.data);
+	}
+	free(assets);
+
+	fp = fopen(output, "wb");
+	if (fp == NULL) {
+		fprintf(stderr, "%s: cannot open\n", output);
+		return 1;
+	}
+	fwrite(pack, 1, pack_size, fp);
+	fclose(fp);
+	free(pack);
+	fprintf(stderr, "%s: %d assets, %u bytes\n", output, count, pack_size);
+	return 0;
+}
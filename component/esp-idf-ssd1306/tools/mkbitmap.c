@@ -0,0 +1,152 @@
+//
+// mkbitmap - convert images into the SSD1306 GDDRAM layout for ssd1306_image
+//
+// cc -o mkbitmap mkbitmap.c
+// ./mkbitmap -n vumeter vumeter.pbm > main/vumeter.h
+// ./mkbitmap -n cute_cat -r cute-cat-000.pbm cute-cat-045.pbm ... > main/cute_cat.h
+// ./mkbitmap -o vumeter.bin vumeter.pbm
+//
+// Width must be up to 128 and height up to 64.
+// Height is padded to a multiple of 8 with unlit pixels.
+// One image makes one ssd1306_image_t. Several images make an array.
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "bitmap_encode.h"
+
+static void print_data(const char * name, const bitmap_t * bitmap)
+{
+	printf("const uint8_t %s[] = {\n", name);
+	for (int i=0;i<bitmap->data.size;i++) {
+		printf("0x%02x,", bitmap->data.data[i]);
+		if ((i % 16) == 15 || i + 1 == bitmap->data.size) printf("\n");
+	}
+	printf("};\n\n");
+}
+
+static void print_image(const char * data_name, const bitmap_t * bitmap, const char * indent)
+{
+	printf("%s.width = %d,\n", indent, bitmap->width);
+	printf("%s.pages = %d,\n", indent, bitmap->pages);
+	const char *flags = "0";
+	if (bitmap->flags == IMAGE_FLIP) flags = "SSD1306_IMAGE_FLIP";
+	if (bitmap->flags == IMAGE_RLE) flags = "SSD1306_IMAGE_RLE";
+	if (bitmap->flags == (IMAGE_FLIP | IMAGE_RLE)) flags = "SSD1306_IMAGE_FLIP | SSD1306_IMAGE_RLE";
+	printf("%s.flags = %s,\n", indent, flags);
+	printf("%s.size = %d,\n", indent, bitmap->data.size);
+	printf("%s.data = %s,\n", indent, data_name);
+}
+
+static int write_blob(const char * path, const bitmap_t * bitmap)
+{
+	FILE *fp = fopen(path, "wb");
+	if (fp == NULL) {
+		fprintf(stderr, "%s: cannot open\n", path);
+		return 1;
+	}
+	uint8_t header[IMAGE_HEADER] = {'S', 'I', bitmap->width, bitmap->pages, bitmap->flags, 0,
+		bitmap->data.size & 0xFF, bitmap->data.size >> 8};
+	fwrite(header, 1, sizeof(header), fp);
+	fwrite(bitmap->data.data, 1, bitmap->data.size, fp);
+	fclose(fp);
+	return 0;
+}
+
+static void usage(void)
+{
+	fprintf(stderr,
+		"Usage: mkbitmap [-n name] [-i] [-f] [-r] [-o file] image...\n"
+		"\t-n name\tname of the image (default image)\n"
+		"\t-i\tinvert the images\n"
+		"\t-f\tstore the images for CONFIG_FLIP\n"
+		"\t-r\trun-length code the images when it is smaller\n"
+		"\t-o file\twrite one image as a binary file instead of C source\n");
+}
+
+int main(int argc, char *argv[])
+{
+	const char *name = "image";
+	const char *blob = NULL;
+	int invert = 0;
+	int flip = 0;
+	int rle = 0;
+	int opt;
+	while ((opt = getopt(argc, argv, "n:ifro:h")) != -1) {
+		switch (opt) {
+			case 'n':
+				name = optarg;
+				break;
+			case 'i':
+				invert = 1;
+				break;
+			case 'f':
+				flip = 1;
+				break;
+			case 'r':
+				rle = 1;
+				break;
+			case 'o':
+				blob = optarg;
+				break;
+			default:
+				usage();
+				return 1;
+		}
+	}
+	int images = argc - optind;
+	if (images < 1 || (blob && images != 1)) {
+		usage();
+		return 1;
+	}
+
+	bitmap_t *bitmap = calloc(images, sizeof(bitmap_t));
+	int original = 0;
+	int packed = 0;
+	for (int i=0;i<images;i++) {
+		if (bitmap_encode(argv[optind+i], &bitmap[i], invert, flip, rle) != 0) return 1;
+		original = original + bitmap[i].width * bitmap[i].pages;
+		packed = packed + bitmap[i].data.size;
+	}
+
+	if (blob) {
+		if (write_blob(blob, &bitmap[0]) != 0) return 1;
+	} else {
+		printf("// Generated by mkbitmap. Do not edit.\n");
+		for (int i=0;i<images;i++) {
+			const char *base = strrchr(argv[optind+i], '/');
+			printf("// '%s', %dx%dpx\n", base ? base + 1 : argv[optind+i], bitmap[i].width, bitmap[i].pages * 8);
+		}
+		printf("#include \"ssd1306_image.h\"\n\n");
+
+		char data_name[256];
+		if (images == 1) {
+			snprintf(data_name, sizeof(data_name), "%s_data", name);
+			print_data(data_name, &bitmap[0]);
+			printf("const ssd1306_image_t %s = {\n", name);
+			print_image(data_name, &bitmap[0], "\t");
+			printf("};\n");
+		} else {
+			for (int i=0;i<images;i++) {
+				snprintf(data_name, sizeof(data_name), "%s_data%d", name, i);
+				print_data(data_name, &bitmap[i]);
+			}
+			printf("const ssd1306_image_t %s[%d] = {\n", name, images);
+			for (int i=0;i<images;i++) {
+				snprintf(data_name, sizeof(data_name), "%s_data%d", name, i);
+				printf("\t{\n");
+				print_image(data_name, &bitmap[i], "\t\t");
+				printf("\t},\n");
+			}
+			printf("};\n");
+		}
+	}
+	fprintf(stderr, "%s: %d images, %d bytes -> %d bytes\n", name, images, original, packed);
+
+	for (int i=0;i<images;i++) free(bitmap[i].data.data);
+	free(bitmap);
+	return 0;
+}
@@ -0,0 +1,174 @@
+//
+// mktiles - cut images into deduplicated 8x8 tiles for ssd1306_tilemap
+//
+// cc -o mktiles mktiles.c
+// ./mktiles -n highway highway21.jpg highway22.jpg ... > main/highway_tiles.h
+//
+// All images must have the same width.
+// Images are stacked from top to bottom and make one map.
+// Width and height must be multiples of 8.
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "pbm_image.h"
+
+#define MAX_TILES 65536
+
+typedef struct {
+	uint64_t *keys;
+	int32_t *values;
+	int size;
+} tile_hash_t;
+
+static uint64_t tile_key(const uint8_t * tile)
+{
+	uint64_t key = 0;
+	for (int i=0;i<8;i++) key |= (uint64_t)tile[i] << (i * 8);
+	return key;
+}
+
+// Returns the tile index, adding the tile when it is new
+static int tile_lookup(tile_hash_t * hash, const uint8_t * tile, uint8_t * tiles, int * tile_count)
+{
+	uint64_t key = tile_key(tile);
+	uint32_t slot = (uint32_t)((key * 0x9E3779B97F4A7C15ULL) >> 40) & (hash->size - 1);
+	while (hash->values[slot] >= 0) {
+		if (hash->keys[slot] == key) return hash->values[slot];
+		slot = (slot + 1) & (hash->size - 1);
+	}
+	if (*tile_count >= MAX_TILES) return -1;
+	hash->keys[slot] = key;
+	hash->values[slot] = *tile_count;
+	memcpy(&tiles[*tile_count * 8], tile, 8);
+	return (*tile_count)++;
+}
+
+static void usage(void)
+{
+	fprintf(stderr,
+		"Usage: mktiles [-n name] [-i] image...\n"
+		"\t-n name\tname of the tilemap (default tilemap)\n"
+		"\t-i\tinvert the images\n"
+		"Images are stacked from top to bottom into one map.\n");
+}
+
+int main(int argc, char *argv[])
+{
+	const char *name = "tilemap";
+	int invert = 0;
+	int opt;
+	while ((opt = getopt(argc, argv, "n:ih")) != -1) {
+		switch (opt) {
+			case 'n':
+				name = optarg;
+				break;
+			case 'i':
+				invert = 1;
+				break;
+			default:
+				usage();
+				return 1;
+		}
+	}
+	if (optind >= argc) {
+		usage();
+		return 1;
+	}
+
+	int images = argc - optind;
+	pbm_image_t *image = calloc(images, sizeof(pbm_image_t));
+	int map_width = 0;
+	int map_height = 0;
+	for (int i=0;i<images;i++) {
+		if (pbm_image_load(argv[optind+i], &image[i]) != 0) return 1;
+		if (invert) pbm_image_invert(&image[i]);
+		if ((image[i].width % 8) != 0 || (image[i].height % 8) != 0) {
+			fprintf(stderr, "%s: width and height must be multiples of 8\n", argv[optind+i]);
+			return 1;
+		}
+		if (i == 0) map_width = image[i].width / 8;
+		if (image[i].width / 8 != map_width) {
+			fprintf(stderr, "%s: all images must have the same width\n", argv[optind+i]);
+			return 1;
+		}
+		map_height = map_height + image[i].height / 8;
+	}
+
+	tile_hash_t hash;
+	hash.size = 1;
+	while (hash.size < map_width * map_height * 2) hash.size = hash.size * 2;
+	hash.keys = calloc(hash.size, sizeof(uint64_t));
+	hash.values = malloc(hash.size * sizeof(int32_t));
+	for (int i=0;i<hash.size;i++) hash.values[i] = -1;
+
+	uint8_t *tiles = malloc(map_width * map_height * 8);
+	uint16_t *map = malloc(map_width * map_height * sizeof(uint16_t));
+	int tile_count = 0;
+	int row = 0;
+	for (int i=0;i<images;i++) {
+		for (int page=0;page<image[i].height/8;page++) {
+			for (int col=0;col<map_width;col++) {
+				uint8_t tile[8];
+				for (int bit=0;bit<8;bit++) {
+					tile[bit] = pbm_image_column(&image[i], col*8+bit, page*8);
+				}
+				int index = tile_lookup(&hash, tile, tiles, &tile_count);
+				if (index < 0) {
+					fprintf(stderr, "Too many tiles\n");
+					return 1;
+				}
+				map[row*map_width+col] = index;
+			}
+			row++;
+		}
+	}
+
+	printf("// Generated by mktiles. Do not edit.\n");
+	for (int i=0;i<images;i++) {
+		printf("// '%s', %dx%dpx\n", argv[optind+i], image[i].width, image[i].height);
+	}
+	printf("#include \"ssd1306_tilemap.h\"\n\n");
+
+	printf("const uint8_t %s_tiles[] = {\n", name);
+	for (int i=0;i<tile_count;i++) {
+		for (int bit=0;bit<8;bit++) {
+			printf("0x%02x, ", tiles[i*8+bit]);
+		}
+		printf("// %d\n", i);
+	}
+	printf("};\n\n");
+
+	printf("const uint16_t %s_map[] = {\n", name);
+	for (int r=0;r<map_height;r++) {
+		for (int col=0;col<map_width;col++) {
+			printf("%d, ", map[r*map_width+col]);
+		}
+		printf("\n");
+	}
+	printf("};\n\n");
+
+	printf("const ssd1306_tilemap_t %s = {\n", name);
+	printf("\t.tiles = %s_tiles,\n", name);
+	printf("\t.tile_count = %d,\n", tile_count);
+	printf("\t.map = %s_map,\n", name);
+	printf("\t.map_width = %d,\n", map_width);
+	printf("\t.map_height = %d,\n", map_height);
+	printf("};\n");
+
+	int original = map_width * map_height * 8;
+	int packed = tile_count * 8 + map_width * map_height * (int)sizeof(uint16_t);
+	fprintf(stderr, "%s: %d tiles of %d, %d bytes -> %d bytes\n",
+		name, tile_count, map_width * map_height, original, packed);
+
+	for (int i=0;i<images;i++) pbm_image_free(&image[i]);
+	free(image);
+	free(tiles);
+	free(map);
+	free(hash.keys);
+	free(hash.values);
+	return 0;
+}
@@ -0,0 +1,77 @@
+//
+// Run-length coding shared by the host tools in this directory.
+// The format is described in components/ssd1306/ssd1306_image.h.
+//
+#ifndef PAGE_RLE_H_
+#define PAGE_RLE_H_
+
+#include <stdlib.h>
+#include <stdint.h>
+
+// Same values as ssd1306_image.h
+#define RLE_SKIP 0x00
+#define RLE_LITERAL 0x40
+#define RLE_REPEAT 0x80
+#define RLE_END 0xC0
+#define RLE_MAX 64
+
+typedef struct {
+	uint8_t *data;
+	int size;
+	int capacity;
+} buffer_t;
+
+static void buffer_put(buffer_t * buffer, uint8_t wk)
+{
+	if (buffer->size == buffer->capacity) {
+		buffer->capacity = buffer->capacity ? buffer->capacity * 2 : 1024;
+		buffer->data = realloc(buffer->data, buffer->capacity);
+	}
+	buffer->data[buffer->size++] = wk;
+}
+
+// Length of the run of the same byte starting at seg
+static int same_run(const uint8_t * row, int seg, int width)
+{
+	int length = 1;
+	while (seg + length < width && row[seg+length] == row[seg]) length++;
+	return length;
+}
+
+// Encode one page. Trailing 0x00 columns are left to the end of page token.
+static void rle_encode_page(buffer_t * out, const uint8_t * row, int width)
+{
+	int last = width - 1;
+	while (last >= 0 && row[last] == 0) last--;
+
+	int seg = 0;
+	while (seg <= last) {
+		int length = same_run(row, seg, width);
+		if (seg + length > last + 1) length = last + 1 - seg;
+		if (row[seg] == 0) {
+			if (length > RLE_MAX) length = RLE_MAX;
+			buffer_put(out, RLE_SKIP | (length - 1));
+			seg = seg + length;
+		} else if (length >= 3) {
+			if (length > RLE_MAX) length = RLE_MAX;
+			buffer_put(out, RLE_REPEAT | (length - 1));
+			buffer_put(out, row[seg]);
+			seg = seg + length;
+		} else {
+			// Literal run ends where a skip or repeat run is cheaper
+			int start = seg;
+			while (seg <= last && seg - start < RLE_MAX) {
+				int _length = same_run(row, seg, width);
+				if (row[seg] == 0 && _length >= 2) break;
+				if (row[seg] != 0 && _length >= 3) break;
+				seg++;
+			}
+			if (seg == start) seg++;
+			buffer_put(out, RLE_LITERAL | (seg - start - 1));
+			for (int i=start;i<seg;i++) buffer_put(out, row[i]);
+		}
+	}
+	buffer_put(out, RLE_END);
+}
+
+#endif /* PAGE_RLE_H_ */
@@ -0,0 +1,141 @@
+//
+// Monochrome image loader shared by the host tools in this directory.
+//
+// PBM (P1/P4) files are read directly.
+// Any other format (PNG, JPEG, BMP...) is converted to PBM with ImageMagick:
+//   convert <file> -monochrome pbm:-
+//
+// Pixels are returned one byte per pixel, 1 = lit pixel.
+// A white pixel in the source image is a lit pixel on the OLED.
+//
+#ifndef PBM_IMAGE_H_
+#define PBM_IMAGE_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+
+typedef struct {
+	int width;
+	int height;
+	uint8_t *pixels;
+} pbm_image_t;
+
+static int pbm_read_int(FILE * fp)
+{
+	int ch;
+	int value = 0;
+	int digits = 0;
+	for (;;) {
+		ch = fgetc(fp);
+		if (ch == '#') {
+			while (ch != '\n' && ch != EOF) ch = fgetc(fp);
+			continue;
+		}
+		if (ch == EOF) return -1;
+		if (!isspace(ch)) break;
+	}
+	while (isdigit(ch)) {
+		value = value * 10 + (ch - '0');
+		digits++;
+		ch = fgetc(fp);
+	}
+	if (digits == 0) return -1;
+	return value;
+}
+
+static int pbm_read(FILE * fp, pbm_image_t * image)
+{
+	if (fgetc(fp) != 'P') return -1;
+	int type = fgetc(fp);
+	if (type != '1' && type != '4') return -1;
+	image->width = pbm_read_int(fp);
+	image->height = pbm_read_int(fp);
+	if (image->width <= 0 || image->height <= 0) return -1;
+	image->pixels = malloc(image->width * image->height);
+	if (image->pixels == NULL) return -1;
+
+	for (int y=0;y<image->height;y++) {
+		if (type == '4') {
+			int byte = 0;
+			for (int x=0;x<image->width;x++) {
+				if ((x % 8) == 0) {
+					byte = fgetc(fp);
+					if (byte == EOF) return -1;
+				}
+				// PBM 1 is black
+				image->pixels[y*image->width+x] = (byte & (0x80 >> (x % 8))) ? 0 : 1;
+			}
+		} else {
+			for (int x=0;x<image->width;x++) {
+				int ch;
+				do {
+					ch = fgetc(fp);
+				} while (ch != EOF && ch != '0' && ch != '1');
+				if (ch == EOF) return -1;
+				image->pixels[y*image->width+x] = (ch == '1') ? 0 : 1;
+			}
+		}
+	}
+	return 0;
+}
+
+static int pbm_image_load(const char * path, pbm_image_t * image)
+{
+	int ret;
+	FILE *fp = fopen(path, "rb");
+	if (fp == NULL) {
+		fprintf(stderr, "Can't open %s\n", path);
+		return -1;
+	}
+	char magic[2];
+	size_t len = fread(magic, 1, 2, fp);
+	if (len == 2 && magic[0] == 'P' && (magic[1] == '1' || magic[1] == '4')) {
+		rewind(fp);
+		ret = pbm_read(fp, image);
+		fclose(fp);
+	} else {
+		fclose(fp);
+		char command[1024];
+		snprintf(command, sizeof(command), "convert '%s' -monochrome pbm:-", path);
+		fp = popen(command, "r");
+		if (fp == NULL) {
+			fprintf(stderr, "Can't run %s\n", command);
+			return -1;
+		}
+		ret = pbm_read(fp, image);
+		pclose(fp);
+	}
+	if (ret != 0) fprintf(stderr, "%s is not a valid image\n", path);
+	return ret;
+}
+
+static void pbm_image_invert(pbm_image_t * image)
+{
+	for (int i=0;i<image->width*image->height;i++) {
+		image->pixels[i] = !image->pixels[i];
+	}
+}
+
+// One SSD1306 page byte: 8 vertical pixels, bit0 is the top pixel.
+// Pixels outside the image are unlit.
+static uint8_t pbm_image_column(const pbm_image_t * image, int x, int y)
+{
+	uint8_t wk = 0;
+	for (int bit=0;bit<8;bit++) {
+		int _y = y + bit;
+		if (x < 0 || x >= image->width || _y < 0 || _y >= image->height) continue;
+		if (image->pixels[_y*image->width+x]) wk |= (1 << bit);
+	}
+	return wk;
+}
+
+static void pbm_image_free(pbm_image_t * image)
+{
+	free(image->pixels);
+	image->pixels = NULL;
+}
+
+#endif /* PBM_IMAGE_H_ */
@@ -0,0 +1,86 @@
+#
+# Build step for the host tools in this directory.
+#
+# include(${CMAKE_CURRENT_LIST_DIR}/../../tools/ssd1306_tools.cmake)
+# ssd1306_add_bitmap(${COMPONENT_LIB} NAME vumeter OPTIONS -r IMAGES ../images/vumeter.pbm)
+#
+# The header {NAME}.h is generated in the build directory when the images change,
+# and the build directory is added to the include path of the target.
+# A host C compiler (cc, gcc or clang) is required.
+# PBM images are read directly. Other formats need ImageMagick.
+#
+# ssd1306_create_asset_partition(assets assets/assets.txt FLASH_IN_PROJECT)
+#
+# Call it in the project CMakeLists.txt after project().
+# {partition}.bin is packed from the manifest with mkassets, and
+# FLASH_IN_PROJECT writes it with idf.py flash. idf.py {partition}-flash writes only the pack.
+#
+set(SSD1306_TOOLS_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+# Build a host tool once for each directory
+function(ssd1306_host_tool tool output)
+	set(exe ${CMAKE_CURRENT_BINARY_DIR}/ssd1306_tools/${tool})
+	get_directory_property(done SSD1306_TOOL_${tool})
+	if(NOT done)
+		find_program(SSD1306_HOST_CC NAMES cc gcc clang)
+		if(NOT SSD1306_HOST_CC)
+			message(FATAL_ERROR "A host C compiler is required to build ${tool}")
+		endif()
+		add_custom_command(OUTPUT ${exe}
+			COMMAND ${CMAKE_COMMAND} -E make_directory ${CMAKE_CURRENT_BINARY_DIR}/ssd1306_tools
+			COMMAND ${SSD1306_HOST_CC} -O2 -o ${exe} ${SSD1306_TOOLS_DIR}/${tool}.c
+			DEPENDS ${SSD1306_TOOLS_DIR}/${tool}.c ${SSD1306_TOOLS_DIR}/pbm_image.h ${SSD1306_TOOLS_DIR}/page_rle.h
+				${SSD1306_TOOLS_DIR}/bitmap_encode.h ${SSD1306_TOOLS_DIR}/anim_encode.h
+			VERBATIM)
+		set_directory_properties(PROPERTIES SSD1306_TOOL_${tool} TRUE)
+	endif()
+	set(${output} ${exe} PARENT_SCOPE)
+endfunction()
+
+# Convert images to ssd1306_image_t with mkbitmap
+function(ssd1306_add_bitmap target)
+	cmake_parse_arguments(arg "" "NAME" "OPTIONS;IMAGES" ${ARGN})
+	ssd1306_host_tool(mkbitmap tool)
+	set(header ${CMAKE_CURRENT_BINARY_DIR}/${arg_NAME}.h)
+	set(images)
+	foreach(image ${arg_IMAGES})
+		get_filename_component(image ${image} ABSOLUTE)
+		list(APPEND images ${image})
+	endforeach()
+	# No VERBATIM. The output is redirected to the header.
+	add_custom_command(OUTPUT ${header}
+		COMMAND ${tool} -n ${arg_NAME} ${arg_OPTIONS} ${images} > ${header}
+		DEPENDS ${tool} ${images})
+	target_sources(${target} PRIVATE ${header})
+	target_include_directories(${target} PRIVATE ${CMAKE_CURRENT_BINARY_DIR})
+endfunction()
+
+# Pack assets into a data partition with mkassets
+function(ssd1306_create_asset_partition partition manifest)
+	cmake_parse_arguments(arg "FLASH_IN_PROJECT" "" "" ${ARGN})
+	partition_table_get_partition_info(size "--partition-name ${partition}" "size")
+	partition_table_get_partition_info(offset "--partition-name ${partition}" "offset")
+	if(NOT size OR NOT offset)
+		message(FATAL_ERROR "Partition ${partition} is not in the partition table")
+	endif()
+	ssd1306_host_tool(mkassets tool)
+	get_filename_component(manifest ${manifest} ABSOLUTE)
+	get_filename_component(asset_dir ${manifest} DIRECTORY)
+	file(GLOB asset_files ${asset_dir}/*)
+	set(image ${CMAKE_BINARY_DIR}/${partition}.bin)
+	add_custom_command(OUTPUT ${image}
+		COMMAND ${tool} -s ${size} -o ${image} ${manifest}
+		DEPENDS ${tool} ${asset_files}
+		VERBATIM)
+	add_custom_target(${partition}_bin ALL DEPENDS ${image})
+
+	idf_component_get_property(main_args esptool_py FLASH_ARGS)
+	idf_component_get_property(sub_args esptool_py FLASH_SUB_ARGS)
+	esptool_py_flash_target(${partition}-flash "${main_args}" "${sub_args}")
+	esptool_py_flash_target_image(${partition}-flash ${partition} "${offset}" "${image}")
+	add_dependencies(${partition}-flash ${partition}_bin)
+	if(arg_FLASH_IN_PROJECT)
+		esptool_py_flash_target_image(flash ${partition} "${offset}" "${image}")
+		add_dependencies(flash ${partition}_bin)
+	endif()
+endfunction()
@@ -1,89 +1,202 @@
 #include "sensor_system.h"
+#include "button_handler.h"
+#include "event_bus.h"
+#include "trace_log.h"
 #include "esp_log.h"
-
-#define DEBOUNCE_TIME_MS 50
-#define LONG_PRESS_TIME_MS 1500
-#define DOUBLE_PRESS_WINDOW_MS 400
+#include <stdatomic.h>
 
 static const char *TAG = "BUTTON";
 
-// This task is now driven by interrupts via a semaphore.
-void task_button_handler(void *pvParameters) {
-    // State machine to handle button logic
-    typedef enum { IDLE, DEBOUNCING, PRESSED, DOUBLE_PRESS_WAIT } state_t;
-    state_t state = IDLE;
-    TickType_t last_press_time = 0;
+// --- Configured buttons ---
+static const button_config_t buttons[] = {
+    { .pin = BUTTON_PIN, .active_low = true, .max_clicks = 2 },
+};
+#define BUTTON_COUNT (sizeof(buttons) / sizeof(buttons[0]))
+
+typedef enum { BUTTON_EDGE, BUTTON_DEADLINE } button_item_kind_t;
+
+typedef struct {
+    uint8_t button;
+    uint8_t kind;       // button_item_kind_t
+    uint8_t level;      // GPIO level after the edge
+    int64_t time_us;
+} button_item_t;
+
+typedef enum {
+    BUTTON_IDLE,
+    BUTTON_PRESSED,     // Down, waiting for release or the long press deadline
+    BUTTON_RELEASED,    // Up after clicks, waiting for the next press or the end of the window
+    BUTTON_LONG_HELD,   // Long press sent, waiting for release
+} button_phase_t;
+
+typedef struct {
+    button_phase_t phase;
+    bool pressed;           // Debounced
+    int clicks;
+    int64_t last_change_us;
+    int64_t resync_us;      // End of debounce: compare with the pin again. 0 = none.
+    int64_t deadline_us;    // Long press or end of the click window. 0 = none.
+    esp_timer_handle_t timer;
+} button_state_t;
+
+static button_state_t button_states[BUTTON_COUNT];
+static QueueHandle_t button_items;
+static atomic_uint button_lost;
+
+static void IRAM_ATTR button_isr_handler(void* arg) {
+    uint32_t id = (uint32_t)arg;
+    button_item_t item = {
+        .button = id,
+        .kind = BUTTON_EDGE,
+        .level = gpio_get_level(buttons[id].pin),
+        .time_us = esp_timer_get_time(),
+    };
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    if (xQueueSendFromISR(button_items, &item, &xHigherPriorityTaskWoken) != pdPASS) {
+        atomic_fetch_add_explicit(&button_lost, 1, memory_order_relaxed);
+    }
+    if (xHigherPriorityTaskWoken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+// esp_timer task: hand the deadline to task_button_handler
+static void button_timer_callback(void *arg) {
+    button_item_t item = {
+        .button = (uint32_t)arg,
+        .kind = BUTTON_DEADLINE,
+        .time_us = esp_timer_get_time(),
+    };
+    if (xQueueSend(button_items, &item, 0) != pdPASS) {
+        atomic_fetch_add_explicit(&button_lost, 1, memory_order_relaxed);
+    }
+}
+
+// Called from init_hardware() after gpio_install_isr_service()
+void button_engine_init(void) {
+    button_items = xQueueCreate(BUTTON_EDGE_QUEUE, sizeof(button_item_t));
+    for (uint32_t id = 0; id < BUTTON_COUNT; id++) {
+        const button_config_t *config = &buttons[id];
+        gpio_config_t io_config = {
+            .pin_bit_mask = (1ULL << config->pin),
+            .mode = GPIO_MODE_INPUT,
+            .pull_up_en = config->active_low ? GPIO_PULLUP_ENABLE : GPIO_PULLUP_DISABLE,
+            .pull_down_en = config->active_low ? GPIO_PULLDOWN_DISABLE : GPIO_PULLDOWN_ENABLE,
+            .intr_type = GPIO_INTR_ANYEDGE // Press and release
+        };
+        gpio_config(&io_config);
+
+        esp_timer_create_args_t timer_args = {
+            .callback = button_timer_callback,
+            .arg = (void *)id,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "button",
+        };
+        ESP_ERROR_CHECK(esp_timer_create(&timer_args, &button_states[id].timer));
+        gpio_isr_handler_add(config->pin, button_isr_handler, (void *)id);
+    }
+    ESP_LOGI(TAG, "%d button(s) configured", (int)BUTTON_COUNT);
+}
 
+static void button_emit(uint32_t id, event_type_t type, int clicks) {
+    event_message_t msg = { .type = type, .value = BUTTON_EVENT_VALUE(id, clicks) };
+    TRACE_LOG(TRACE_BUTTON, id, type, clicks);
+    event_bus_post(&msg);
+}
+
+static void button_clicks_done(uint32_t id, button_state_t *b) {
+    if (b->clicks == 1) {
+        button_emit(id, EVENT_SINGLE_PRESS, 1);
+    } else if (b->clicks == 2) {
+        button_emit(id, EVENT_DOUBLE_PRESS, 2);
+    } else if (b->clicks > 2) {
+        button_emit(id, EVENT_MULTI_PRESS, b->clicks);
+    }
+    b->clicks = 0;
+    b->phase = BUTTON_IDLE;
+    b->deadline_us = 0;
+}
+
+// A debounced change of the button, at the time of its edge
+static void button_change(uint32_t id, button_state_t *b, bool pressed, int64_t time_us) {
+    b->pressed = pressed;
+    b->last_change_us = time_us;
+    b->resync_us = time_us + DEBOUNCE_TIME_MS * 1000LL;
+
+    if (pressed) {
+        b->clicks++;
+        b->phase = BUTTON_PRESSED;
+        b->deadline_us = time_us + LONG_PRESS_TIME_MS * 1000LL;
+    } else if (b->phase == BUTTON_LONG_HELD) {
+        b->phase = BUTTON_IDLE;
+        b->deadline_us = 0;
+    } else if (b->clicks >= buttons[id].max_clicks) {
+        button_clicks_done(id, b);
+    } else {
+        b->phase = BUTTON_RELEASED;
+        b->deadline_us = time_us + DOUBLE_PRESS_WINDOW_MS * 1000LL;
+    }
+}
+
+static void button_edge(uint32_t id, button_state_t *b, int level, int64_t time_us) {
+    bool pressed = (level == 0) == buttons[id].active_low;
+    // Bounce: the pin is read again when the debounce time is over
+    if (time_us - b->last_change_us < DEBOUNCE_TIME_MS * 1000LL) return;
+    if (pressed == b->pressed) return;
+    button_change(id, b, pressed, time_us);
+}
+
+static void button_deadline(uint32_t id, button_state_t *b, int64_t now) {
+    if (b->resync_us && now >= b->resync_us) {
+        b->resync_us = 0;
+        // The last edge of a bounce can be lost in the debounce time
+        bool pressed = (gpio_get_level(buttons[id].pin) == 0) == buttons[id].active_low;
+        if (pressed != b->pressed) button_change(id, b, pressed, now);
+    }
+    if (b->deadline_us && now >= b->deadline_us) {
+        b->deadline_us = 0;
+        if (b->phase == BUTTON_PRESSED) {
+            // Held: a long press replaces the clicks before it
+            b->clicks = 0;
+            b->phase = BUTTON_LONG_HELD;
+            button_emit(id, EVENT_LONG_PRESS, 0);
+        } else if (b->phase == BUTTON_RELEASED) {
+            button_clicks_done(id, b);
+        }
+    }
+}
+
+// Start the timer for the earliest pending deadline of the button
+static void button_arm(button_state_t *b) {
+    int64_t next = b->resync_us;
+    if (b->deadline_us && (next == 0 || b->deadline_us < next)) next = b->deadline_us;
+    esp_timer_stop(b->timer); // Not running is fine
+    if (next == 0) return;
+    int64_t wait = next - esp_timer_get_time();
+    esp_timer_start_once(b->timer, wait > 0 ? wait : 0);
+}
+
+/*
+ * Button handler:
+ * - Sleeps on the edge queue until an ISR edge or a timer deadline arrives
+ * - Classifies single, double, long and N-click presses from the edge timestamps,
+ *   so the time the task waited to run does not count
+ */
+void task_button_handler(void *pvParameters) {
+    button_item_t item;
     while (1) {
-        switch (state) {
-            case IDLE:
-                // Wait indefinitely for a press from the ISR
-                if (xSemaphoreTake(button_press_sem, portMAX_DELAY) == pdTRUE) {
-                    ESP_LOGI("SEM", "Semaphore taken by button handler");
-                    state = DEBOUNCING;
-                }
-                break;
-
-            case DEBOUNCING:
-                vTaskDelay(pdMS_TO_TICKS(DEBOUNCE_TIME_MS));
-                if (gpio_get_level(BUTTON_PIN) == 0) { // Still pressed, it's a valid press
-                    state = PRESSED;
-                    last_press_time = xTaskGetTickCount();
-                } else { // It was a glitch
-                    state = IDLE;
-                }
-                break;
-
-            case PRESSED:
-                // Button is being held down. Check for release or long press.
-                if (gpio_get_level(BUTTON_PIN) == 1) { // Button has been released
-                    // Move to a state to wait for a potential second press
-                    state = DOUBLE_PRESS_WAIT;
-                } else {
-                    // Check if it has been held long enough for a long press
-                    if ((xTaskGetTickCount() - last_press_time) * portTICK_PERIOD_MS > LONG_PRESS_TIME_MS) {
-                        ESP_LOGI(TAG, "Long press detected");
-                        event_message_t msg = { .type = EVENT_LONG_PRESS };
-                        xQueueSend(system_event_queue, &msg, 0);
-                        // Wait for the button to be released before resetting state
-                        while (gpio_get_level(BUTTON_PIN) == 0) {
-                            vTaskDelay(pdMS_TO_TICKS(10));
-                        }
-                        state = IDLE;
-                    }
-                }
-                break;
-
-            case DOUBLE_PRESS_WAIT:
-                if (xSemaphoreTake(button_press_sem, pdMS_TO_TICKS(DOUBLE_PRESS_WINDOW_MS)) == pdTRUE) {
-                    // Semaphore given within window — verify this is a real second press
-                    vTaskDelay(pdMS_TO_TICKS(DEBOUNCE_TIME_MS));
-                    if (gpio_get_level(BUTTON_PIN) == 0) {
-                        // Confirmed: real second press (double press)
-                        ESP_LOGI("BUTTON", "Double press detected");
-                        event_message_t msg = { .type = EVENT_DOUBLE_PRESS };
-                        xQueueSend(system_event_queue, &msg, 0);
-                        // Wait for release before returning to IDLE
-                        while (gpio_get_level(BUTTON_PIN) == 0) {
-                            vTaskDelay(pdMS_TO_TICKS(10));
-                        }
-                        state = IDLE;
-                    } else {
-                        // Spurious semaphore (bounce) — treat as single press
-                        ESP_LOGI("BUTTON", "Spurious press ignored; treating as single press");
-                        event_message_t msg = { .type = EVENT_SINGLE_PRESS };
-                        xQueueSend(system_event_queue, &msg, 0);
-                        state = IDLE;
-                    }
-                } else {
-                    // Hết window: single press
-                    ESP_LOGI("BUTTON", "Single press detected");
-                    event_message_t msg = { .type = EVENT_SINGLE_PRESS };
-                    xQueueSend(system_event_queue, &msg, 0);
-                    state = IDLE;
-                }
-                break;
+        if (xQueueReceive(button_items, &item, portMAX_DELAY) != pdTRUE) continue;
+        button_state_t *b = &button_states[item.button];
+        if (item.kind == BUTTON_EDGE) {
+            button_edge(item.button, b, item.level, item.time_us);
+        } else {
+            button_deadline(item.button, b, item.time_us);
+        }
+        button_arm(b);
+
+        unsigned int lost = atomic_exchange_explicit(&button_lost, 0, memory_order_relaxed);
+        if (lost) {
+            TRACE_LOG(TRACE_BUTTON_LOST, lost);
         }
-        vTaskDelay(pdMS_TO_TICKS(10)); // Prevent busy-waiting in some states
     }
-}
\ No newline at end of file
+}
@@ -3,6 +3,28 @@
 
 #include "sensor_system.h"
 
-void task_button_handler(void *pvParameters);
+// --- Button engine ---
+// The GPIO ISR of every configured button queues the level and esp_timer time of each edge.
+// task_button_handler runs one state machine per button on these timestamps, and each button
+// has a one-shot esp_timer that queues its next deadline (debounce, long press, end of clicks).
+// The task blocks on the queue only, so it never wakes without an edge or a deadline.
 
-#endif
\ No newline at end of file
+#define DEBOUNCE_TIME_MS       50   // Edges closer than this to the last change are bounce
+#define LONG_PRESS_TIME_MS     1500
+#define DOUBLE_PRESS_WINDOW_MS 400  // Release to next press, for double and N-click presses
+#define BUTTON_EDGE_QUEUE      32
+
+typedef struct {
+    gpio_num_t pin;
+    bool active_low;
+    int max_clicks;    // Sent as soon as this many clicks are counted. 1 = single press only.
+} button_config_t;
+
+// event_message_t.value of button events
+#define BUTTON_EVENT_VALUE(id, clicks) (((id) << 8) | (clicks))
+#define BUTTON_EVENT_ID(value)         ((value) >> 8)
+#define BUTTON_EVENT_CLICKS(value)     ((value) & 0xFF)
+
+void button_engine_init(void);
+
+#endif
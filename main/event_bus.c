@@ -0,0 +1,178 @@
+// event_bus.c
+#include "event_bus.h"
+#include "trace_log.h"
+#include <stdatomic.h>
+
+typedef struct {
+    event_lane_t lane;
+    bool coalesce;   // Only the latest pending event of the type is kept
+} event_route_t;
+
+static const event_route_t event_routes[EVENT_TYPE_COUNT] = {
+    [EVENT_SINGLE_PRESS]   = { EVENT_LANE_INPUT, false },
+    [EVENT_DOUBLE_PRESS]   = { EVENT_LANE_INPUT, false },
+    [EVENT_LONG_PRESS]     = { EVENT_LANE_INPUT, false },
+    [EVENT_MULTI_PRESS]    = { EVENT_LANE_INPUT, false },
+    [EVENT_MOTION]         = { EVENT_LANE_SENSOR, true },  // The edges themselves are in the motion ring
+    [EVENT_MOTION_TIMEOUT] = { EVENT_LANE_TIMER, true },
+    [EVENT_LIGHT]          = { EVENT_LANE_SENSOR, true },
+};
+
+static const int event_lane_depths[EVENT_LANE_COUNT] = {
+    [EVENT_LANE_INPUT]  = EVENT_LANE_INPUT_DEPTH,
+    [EVENT_LANE_TIMER]  = EVENT_LANE_TIMER_DEPTH,
+    [EVENT_LANE_SENSOR] = EVENT_LANE_SENSOR_DEPTH,
+};
+
+typedef struct {
+    atomic_uint posted;
+    atomic_uint dropped;
+    atomic_uint coalesced;
+    atomic_uint pending;     // Queued types only. A slot holds 0 or 1.
+    atomic_uint high_water;
+} event_counters_t;
+
+// --- Fixed memory: every queue and the semaphore are allocated statically ---
+#define EVENT_BUS_CAPACITY (EVENT_LANE_INPUT_DEPTH + EVENT_LANE_TIMER_DEPTH + EVENT_LANE_SENSOR_DEPTH + EVENT_TYPE_COUNT)
+
+static uint8_t lane_input_storage[EVENT_LANE_INPUT_DEPTH * sizeof(event_message_t)];
+static uint8_t lane_timer_storage[EVENT_LANE_TIMER_DEPTH * sizeof(event_message_t)];
+static uint8_t lane_sensor_storage[EVENT_LANE_SENSOR_DEPTH * sizeof(event_message_t)];
+static uint8_t *const event_lane_storage[EVENT_LANE_COUNT] = {
+    [EVENT_LANE_INPUT]  = lane_input_storage,
+    [EVENT_LANE_TIMER]  = lane_timer_storage,
+    [EVENT_LANE_SENSOR] = lane_sensor_storage,
+};
+static StaticQueue_t event_lane_buffers[EVENT_LANE_COUNT];
+static QueueHandle_t event_lanes[EVENT_LANE_COUNT];
+
+static uint8_t event_slot_storage[EVENT_TYPE_COUNT][sizeof(event_message_t)];
+static StaticQueue_t event_slot_buffers[EVENT_TYPE_COUNT];
+static QueueHandle_t event_slots[EVENT_TYPE_COUNT]; // Coalesced types only
+
+// Counts posted events. It can run ahead of the events when a slot was overwritten,
+// but never behind, so a waiting receiver always wakes.
+static StaticSemaphore_t event_ready_buffer;
+static SemaphoreHandle_t event_ready;
+
+static event_counters_t event_counters[EVENT_TYPE_COUNT];
+
+bool event_bus_init(void) {
+    for (int lane = 0; lane < EVENT_LANE_COUNT; lane++) {
+        event_lanes[lane] = xQueueCreateStatic(event_lane_depths[lane], sizeof(event_message_t),
+                                               event_lane_storage[lane], &event_lane_buffers[lane]);
+    }
+    for (int type = 0; type < EVENT_TYPE_COUNT; type++) {
+        if (event_routes[type].coalesce) {
+            event_slots[type] = xQueueCreateStatic(1, sizeof(event_message_t),
+                                                   event_slot_storage[type], &event_slot_buffers[type]);
+        }
+    }
+    event_ready = xSemaphoreCreateCountingStatic(EVENT_BUS_CAPACITY, 0, &event_ready_buffer);
+    return event_ready != NULL;
+}
+
+static void event_high_water(event_counters_t *c, unsigned int pending) {
+    unsigned int high = atomic_load_explicit(&c->high_water, memory_order_relaxed);
+    while (pending > high &&
+           !atomic_compare_exchange_weak_explicit(&c->high_water, &high, pending,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+// woken is NULL in a task, and the FreeRTOS FromISR flag in an ISR
+static bool event_bus_send(const event_message_t *msg, BaseType_t *woken) {
+    if ((unsigned int)msg->type >= EVENT_TYPE_COUNT) return false;
+    const event_route_t *route = &event_routes[msg->type];
+    event_counters_t *c = &event_counters[msg->type];
+    atomic_fetch_add_explicit(&c->posted, 1, memory_order_relaxed);
+
+    if (route->coalesce) {
+        QueueHandle_t slot = event_slots[msg->type];
+        if ((woken ? uxQueueMessagesWaitingFromISR(slot) : uxQueueMessagesWaiting(slot)) > 0) {
+            atomic_fetch_add_explicit(&c->coalesced, 1, memory_order_relaxed);
+        }
+        if (woken) {
+            xQueueOverwriteFromISR(slot, msg, woken);
+        } else {
+            xQueueOverwrite(slot, msg);
+        }
+        event_high_water(c, 1);
+    } else {
+        // Counted before the send, so the receiver never sees it below zero
+        unsigned int pending = atomic_fetch_add_explicit(&c->pending, 1, memory_order_relaxed) + 1;
+        QueueHandle_t queue = event_lanes[route->lane];
+        BaseType_t sent = woken ? xQueueSendFromISR(queue, msg, woken) : xQueueSend(queue, msg, 0);
+        if (sent != pdPASS) {
+            atomic_fetch_sub_explicit(&c->pending, 1, memory_order_relaxed);
+            atomic_fetch_add_explicit(&c->dropped, 1, memory_order_relaxed);
+            TRACE_LOG(TRACE_EVENT_DROPPED, msg->type, route->lane);
+            return false;
+        }
+        event_high_water(c, pending);
+    }
+    if (woken) {
+        xSemaphoreGiveFromISR(event_ready, woken);
+    } else {
+        xSemaphoreGive(event_ready);
+    }
+    return true;
+}
+
+bool event_bus_post(const event_message_t *msg) {
+    return event_bus_send(msg, NULL);
+}
+
+bool event_bus_post_from_isr(const event_message_t *msg, BaseType_t *woken) {
+    return event_bus_send(msg, woken);
+}
+
+// Oldest event of the highest priority lane. Queued events of a lane go before its slots.
+static bool event_bus_take(event_message_t *msg) {
+    for (int lane = 0; lane < EVENT_LANE_COUNT; lane++) {
+        if (xQueueReceive(event_lanes[lane], msg, 0) == pdPASS) {
+            atomic_fetch_sub_explicit(&event_counters[msg->type].pending, 1, memory_order_relaxed);
+            return true;
+        }
+        for (int type = 0; type < EVENT_TYPE_COUNT; type++) {
+            if (event_slots[type] != NULL && event_routes[type].lane == lane &&
+                xQueueReceive(event_slots[type], msg, 0) == pdPASS) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool event_bus_receive(event_message_t *msg, TickType_t timeout) {
+    TickType_t start = xTaskGetTickCount();
+    TickType_t wait = timeout;
+    while (xSemaphoreTake(event_ready, wait) == pdTRUE) {
+        if (event_bus_take(msg)) return true;
+        // The count of an overwritten slot. Wait for the rest of the timeout.
+        if (timeout != portMAX_DELAY) {
+            TickType_t elapsed = xTaskGetTickCount() - start;
+            wait = elapsed < timeout ? timeout - elapsed : 0;
+        }
+    }
+    return false;
+}
+
+void event_bus_get_stats(event_type_t type, event_bus_stats_t *stats) {
+    event_counters_t *c = &event_counters[type];
+    stats->posted = atomic_load_explicit(&c->posted, memory_order_relaxed);
+    stats->dropped = atomic_load_explicit(&c->dropped, memory_order_relaxed);
+    stats->coalesced = atomic_load_explicit(&c->coalesced, memory_order_relaxed);
+    stats->pending = event_slots[type] != NULL ? uxQueueMessagesWaiting(event_slots[type])
+                                               : atomic_load_explicit(&c->pending, memory_order_relaxed);
+    stats->high_water = atomic_load_explicit(&c->high_water, memory_order_relaxed);
+}
+
+// Events dropped since boot, all types
+uint32_t event_bus_dropped(void) {
+    uint32_t dropped = 0;
+    for (int type = 0; type < EVENT_TYPE_COUNT; type++) {
+        dropped += atomic_load_explicit(&event_counters[type].dropped, memory_order_relaxed);
+    }
+    return dropped;
+}
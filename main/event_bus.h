@@ -0,0 +1,42 @@
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include "sensor_system.h"
+
+// --- Event bus ---
+// Events travel in priority lanes, each with its own statically allocated queue,
+// so a burst in one lane can never crowd out another.
+// event_bus_receive() always returns the oldest event of the highest priority lane,
+// so a button press waits for at most the event being handled.
+// Replaceable events (the latest light level, the LED off timeout, the motion wake-up) are not queued:
+// each has a one-entry slot that a new post overwrites.
+
+typedef enum {
+    EVENT_LANE_INPUT,   // Buttons
+    EVENT_LANE_TIMER,   // Software timers
+    EVENT_LANE_SENSOR,  // Motion and light
+    EVENT_LANE_COUNT
+} event_lane_t;
+
+#define EVENT_LANE_INPUT_DEPTH   8
+#define EVENT_LANE_TIMER_DEPTH   4
+#define EVENT_LANE_SENSOR_DEPTH  6
+
+typedef struct {
+    uint32_t posted;
+    uint32_t dropped;    // Lane full
+    uint32_t coalesced;  // Replaced a pending event of the same type
+    uint32_t pending;
+    uint32_t high_water; // Most events of the type pending at once
+} event_bus_stats_t;
+
+bool event_bus_init(void);
+// Never blocks. Returns false when the event was dropped.
+bool event_bus_post(const event_message_t *msg);
+// Same from an ISR. Set *woken to pdFALSE first and yield when it is pdTRUE.
+bool event_bus_post_from_isr(const event_message_t *msg, BaseType_t *woken);
+bool event_bus_receive(event_message_t *msg, TickType_t timeout);
+void event_bus_get_stats(event_type_t type, event_bus_stats_t *stats);
+uint32_t event_bus_dropped(void);
+
+#endif
@@ -0,0 +1,349 @@
+// light_sensor.c
+#include "light_sensor.h"
+#include "event_bus.h"
+#include "trace_log.h"
+#include <stdatomic.h>
+#include <math.h>
+#include "esp_adc/adc_continuous.h"
+#include "esp_adc/adc_cali.h"
+#include "esp_adc/adc_cali_scheme.h"
+#include "soc/soc_caps.h"
+
+#if CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP32S2
+#define LIGHT_OUTPUT_TYPE       ADC_DIGI_OUTPUT_FORMAT_TYPE1
+#define LIGHT_GET_CHANNEL(p)    ((p)->type1.channel)
+#define LIGHT_GET_DATA(p)       ((p)->type1.data)
+#else
+#define LIGHT_OUTPUT_TYPE       ADC_DIGI_OUTPUT_FORMAT_TYPE2
+#define LIGHT_GET_CHANNEL(p)    ((p)->type2.channel)
+#define LIGHT_GET_DATA(p)       ((p)->type2.data)
+#endif
+
+#define LIGHT_RAW_MAX       ((1 << SOC_ADC_DIGI_MAX_BITWIDTH) - 1)
+#define LIGHT_FRAME_BYTES   (LIGHT_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES)
+#define LIGHT_LUT_SIZE      ((LIGHT_RAW_MAX + 1) >> LIGHT_LUT_SHIFT) // Segments
+#define LIGHT_LUT_FRAC      (LIGHT_FRAC_BITS + LIGHT_LUT_SHIFT)     // Bits of a filtered value inside a segment
+
+static const char *TAG = "LIGHT";
+
+typedef struct {
+    // Decimation
+    uint32_t sum;
+    uint32_t count;
+    uint32_t decimate;                 // Samples per decimated value
+    // Median
+    uint32_t history[LIGHT_MEDIAN];
+    int filled;
+    int next;
+    // IIR, raw value with LIGHT_FRAC_BITS of fraction
+    uint32_t value;
+    uint32_t innovation;               // |decimated value - filtered value| of the last value
+    bool primed;
+} light_filter_t;
+
+typedef struct {
+    uint32_t lux;   // LIGHT_LUX_SCALE units
+    uint32_t mv;
+} light_lut_entry_t;
+
+static adc_continuous_handle_t light_adc;
+static light_lut_entry_t light_lut[LIGHT_LUT_SIZE + 1];
+static uint32_t light_full_mv = LIGHT_NOMINAL_FULL_MV; // Calibrated voltage of the highest raw value
+static uint32_t light_sample_hz;
+static uint8_t light_frame[LIGHT_FRAME_BYTES];
+static light_sensor_stats_t light_stats = { .interval_ms = LIGHT_INTERVAL_FAST_MS };
+static atomic_uint light_overflows;
+
+static bool IRAM_ATTR light_frame_done(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data) {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR((TaskHandle_t)user_data, &xHigherPriorityTaskWoken);
+    return xHigherPriorityTaskWoken == pdTRUE;
+}
+
+static bool IRAM_ATTR light_pool_overflow(adc_continuous_handle_t handle, const adc_continuous_evt_data_t *edata, void *user_data) {
+    atomic_fetch_add_explicit(&light_overflows, 1, memory_order_relaxed);
+    return false;
+}
+
+// Voltage of the divider -> illuminance, from the LDR power law R = R10 * (lux / 10)^-gamma
+static uint32_t light_mv_to_lux(int mv) {
+    // The ADC saturates below VCC: at full scale the LDR is only known to be at least this dark
+    if (mv >= (int)light_full_mv || mv >= LIGHT_VCC_MV) return 0;
+    if (mv <= 0) return LIGHT_LUX_MAX * LIGHT_LUX_SCALE;
+    float ohms = (float)LIGHT_FIXED_OHMS * mv / (LIGHT_VCC_MV - mv);
+    float lux = 10.0f * powf(LIGHT_LDR_10LUX_OHMS / ohms, 100.0f / LIGHT_LDR_GAMMA_X100);
+    if (lux > LIGHT_LUX_MAX) lux = LIGHT_LUX_MAX;
+    return (uint32_t)(lux * LIGHT_LUX_SCALE + 0.5f);
+}
+
+// Fill light_lut from the calibration of this chip. The handle is only needed here.
+static void light_calibrate(void) {
+    adc_cali_handle_t cali = NULL;
+    esp_err_t ret = ESP_ERR_NOT_SUPPORTED;
+#if ADC_CALI_SCHEME_CURVE_FITTING_SUPPORTED
+    adc_cali_curve_fitting_config_t cali_config = {
+        .unit_id = ADC_UNIT_1,
+        .chan = LIGHT_SENSOR_PIN,
+        .atten = ADC_ATTEN_DB_12,
+        .bitwidth = SOC_ADC_DIGI_MAX_BITWIDTH,
+    };
+    ret = adc_cali_create_scheme_curve_fitting(&cali_config, &cali);
+#elif ADC_CALI_SCHEME_LINE_FITTING_SUPPORTED
+    adc_cali_line_fitting_config_t cali_config = {
+        .unit_id = ADC_UNIT_1,
+        .atten = ADC_ATTEN_DB_12,
+        .bitwidth = SOC_ADC_DIGI_MAX_BITWIDTH,
+    };
+    ret = adc_cali_create_scheme_line_fitting(&cali_config, &cali);
+#endif
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "No ADC calibration (%s), using the nominal range", esp_err_to_name(ret));
+        cali = NULL;
+    }
+
+    for (int i = 0; i <= LIGHT_LUT_SIZE; i++) {
+        int raw = i << LIGHT_LUT_SHIFT;
+        if (raw > LIGHT_RAW_MAX) raw = LIGHT_RAW_MAX;
+        int mv;
+        if (cali == NULL || adc_cali_raw_to_voltage(cali, raw, &mv) != ESP_OK) {
+            mv = raw * LIGHT_NOMINAL_FULL_MV / LIGHT_RAW_MAX;
+        }
+        light_lut[i].mv = mv;
+    }
+    light_full_mv = light_lut[LIGHT_LUT_SIZE].mv;
+    for (int i = 0; i <= LIGHT_LUT_SIZE; i++) {
+        light_lut[i].lux = light_mv_to_lux(light_lut[i].mv);
+    }
+    ESP_LOGI(TAG, "Full scale %lu mV, %lu lux at mid scale", light_full_mv,
+             light_lut[LIGHT_LUT_SIZE / 2].lux / LIGHT_LUX_SCALE);
+
+    if (cali != NULL) {
+#if ADC_CALI_SCHEME_CURVE_FITTING_SUPPORTED
+        adc_cali_delete_scheme_curve_fitting(cali);
+#elif ADC_CALI_SCHEME_LINE_FITTING_SUPPORTED
+        adc_cali_delete_scheme_line_fitting(cali);
+#endif
+    }
+}
+
+// Called once from init_hardware(). Sampling starts in task_light_sensor.
+void light_sensor_init(void) {
+    light_calibrate();
+
+    light_sample_hz = LIGHT_SAMPLE_HZ;
+    if (light_sample_hz < SOC_ADC_SAMPLE_FREQ_THRES_LOW) light_sample_hz = SOC_ADC_SAMPLE_FREQ_THRES_LOW;
+    if (light_sample_hz > SOC_ADC_SAMPLE_FREQ_THRES_HIGH) light_sample_hz = SOC_ADC_SAMPLE_FREQ_THRES_HIGH;
+
+    adc_continuous_handle_cfg_t handle_config = {
+        .max_store_buf_size = LIGHT_FRAME_BYTES * LIGHT_FRAME_POOL,
+        .conv_frame_size = LIGHT_FRAME_BYTES,
+    };
+    ESP_ERROR_CHECK(adc_continuous_new_handle(&handle_config, &light_adc));
+
+    adc_digi_pattern_config_t pattern = {
+        .atten = ADC_ATTEN_DB_12,
+        .channel = LIGHT_SENSOR_PIN,
+        .unit = ADC_UNIT_1,
+        .bit_width = SOC_ADC_DIGI_MAX_BITWIDTH,
+    };
+    adc_continuous_config_t config = {
+        .pattern_num = 1,
+        .adc_pattern = &pattern,
+        .sample_freq_hz = light_sample_hz,
+        .conv_mode = ADC_CONV_SINGLE_UNIT_1,
+        .format = LIGHT_OUTPUT_TYPE,
+    };
+    ESP_ERROR_CHECK(adc_continuous_config(light_adc, &config));
+    ESP_LOGI(TAG, "Sampling at %lu Hz, %lu samples per value", light_sample_hz, light_sample_hz / LIGHT_OUTPUT_HZ);
+}
+
+static uint32_t light_median(const light_filter_t *f) {
+    uint32_t sorted[LIGHT_MEDIAN];
+    for (int i = 0; i < f->filled; i++) {
+        uint32_t v = f->history[i];
+        int j = i;
+        for (; j > 0 && sorted[j - 1] > v; j--) sorted[j] = sorted[j - 1];
+        sorted[j] = v;
+    }
+    return sorted[f->filled / 2];
+}
+
+// Returns true when a decimated value went through the filters into f->value
+static bool light_filter_add(light_filter_t *f, uint32_t raw) {
+    f->sum += raw;
+    if (++f->count < f->decimate) return false;
+
+    uint32_t mean = (f->sum << LIGHT_FRAC_BITS) / f->count;
+    f->sum = 0;
+    f->count = 0;
+
+    f->history[f->next] = mean;
+    f->next = (f->next + 1) % LIGHT_MEDIAN;
+    if (f->filled < LIGHT_MEDIAN) f->filled++;
+    uint32_t median = light_median(f);
+    f->innovation = mean > f->value ? mean - f->value : f->value - mean;
+
+    if (!f->primed) {
+        f->value = median;
+        f->primed = true;
+    } else {
+        // At least one unit per value, so the output settles on the input instead of stopping short
+        int32_t step = ((int32_t)median - (int32_t)f->value) >> LIGHT_IIR_SHIFT;
+        if (step == 0 && median != f->value) step = median > f->value ? 1 : -1;
+        f->value += step;
+    }
+    light_stats.outputs++;
+    return true;
+}
+
+// Filtered raw value -> lux and mV, interpolated between two table entries
+static void light_lookup(uint32_t value, uint32_t *lux, uint32_t *mv) {
+    uint32_t index = value >> LIGHT_LUT_FRAC;
+    int64_t frac = value & ((1 << LIGHT_LUT_FRAC) - 1);
+    if (index >= LIGHT_LUT_SIZE) {
+        index = LIGHT_LUT_SIZE - 1;
+        frac = 1 << LIGHT_LUT_FRAC;
+    }
+    const light_lut_entry_t *a = &light_lut[index];
+    const light_lut_entry_t *b = &light_lut[index + 1];
+    *lux = a->lux + (((int64_t)b->lux - a->lux) * frac >> LIGHT_LUT_FRAC);
+    *mv = a->mv + (((int64_t)b->mv - a->mv) * frac >> LIGHT_LUT_FRAC);
+}
+
+// 0..100, higher = brighter. 0 when the ADC is saturated.
+static uint32_t light_brightness(uint32_t mv) {
+    if (mv >= light_full_mv) return 0;
+    return 100 - (mv * 100 + light_full_mv / 2) / light_full_mv;
+}
+
+static void light_publish(uint32_t value, uint32_t mv, uint32_t lux) {
+    if (xSemaphoreTake(g_state_mutex, portMAX_DELAY) == pdTRUE) {
+        system_state.light_level = light_brightness(mv);
+        system_state.light_lux = lux;
+        TRACE_LOG(TRACE_LIGHT_SAMPLE, value >> LIGHT_FRAC_BITS, mv, lux / LIGHT_LUX_SCALE);
+        system_state_publish();
+        xSemaphoreGive(g_state_mutex);
+    }
+}
+
+// Interval until the next measurement, from how the signal behaves
+static uint32_t light_next_interval(uint32_t interval, const light_filter_t *f, uint32_t lux) {
+    // A lamp was switched, or the filter has not caught up yet
+    if (f->innovation > (LIGHT_CHANGE_RAW << LIGHT_FRAC_BITS)) return LIGHT_INTERVAL_FAST_MS;
+
+    interval *= 2;
+    bool near = lux > LIGHT_DARK_BELOW_LUX * LIGHT_LUX_SCALE / LIGHT_NEAR_FACTOR &&
+                lux < LIGHT_BRIGHT_ABOVE_LUX * LIGHT_LUX_SCALE * LIGHT_NEAR_FACTOR;
+    if (near && interval > LIGHT_INTERVAL_NEAR_MS) interval = LIGHT_INTERVAL_NEAR_MS;
+    if (interval > LIGHT_INTERVAL_SLOW_MS) interval = LIGHT_INTERVAL_SLOW_MS;
+    return interval;
+}
+
+// Stop the converter between measurements. Samples still in the pool are stale by then.
+static void light_stop(light_filter_t *f) {
+    uint32_t length = 0;
+    ESP_ERROR_CHECK(adc_continuous_stop(light_adc));
+    while (adc_continuous_read(light_adc, light_frame, LIGHT_FRAME_BYTES, &length, 0) == ESP_OK) {
+    }
+    f->sum = 0;
+    f->count = 0;
+}
+
+/*
+ * Light sensor task:
+ * - Wakes when the DMA has filled a frame, and filters every sample of it
+ * - Measures continuously while the light changes or is near the dark/bright threshold,
+ *   otherwise stops the ADC and doubles the interval between measurements up to LIGHT_INTERVAL_SLOW_MS
+ * - Publishes light_level when it changed, at most every LIGHT_PUBLISH_MIN_MS
+ * - Sends EVENT_LIGHT only when dark/bright flipped
+ */
+void task_light_sensor(void *pvParameters) {
+    light_filter_t filter = { .decimate = light_sample_hz / LIGHT_OUTPUT_HZ };
+    bool dark = false;
+    uint32_t published = 0;
+    TickType_t last_publish = 0;
+    uint32_t interval = LIGHT_INTERVAL_FAST_MS;
+    bool running = false;
+
+    adc_continuous_evt_cbs_t cbs = {
+        .on_conv_done = light_frame_done,
+        .on_pool_ovf = light_pool_overflow,
+    };
+    ESP_ERROR_CHECK(adc_continuous_register_event_callbacks(light_adc, &cbs, xTaskGetCurrentTaskHandle()));
+
+    while (1) {
+        if (!running) {
+            ESP_ERROR_CHECK(adc_continuous_start(light_adc));
+            running = true;
+            light_stats.bursts++;
+        }
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LIGHT_FRAME_TIMEOUT_MS));
+
+        bool measured = false;
+        uint32_t length = 0;
+        while (adc_continuous_read(light_adc, light_frame, LIGHT_FRAME_BYTES, &length, 0) == ESP_OK) {
+            light_stats.frames++;
+            for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= length; i += SOC_ADC_DIGI_RESULT_BYTES) {
+                adc_digi_output_data_t *p = (adc_digi_output_data_t *)&light_frame[i];
+                if (LIGHT_GET_CHANNEL(p) != LIGHT_SENSOR_PIN) continue;
+                light_stats.samples++;
+                if (!light_filter_add(&filter, LIGHT_GET_DATA(p))) continue;
+                measured = true;
+
+                uint32_t lux, mv;
+                light_lookup(filter.value, &lux, &mv);
+                uint32_t brightness = light_brightness(mv);
+                bool first = light_stats.outputs == 1;
+                bool was_dark = dark;
+                // Hysteresis: the state only flips past the far threshold
+                if (first) {
+                    dark = lux < (LIGHT_DARK_BELOW_LUX + LIGHT_BRIGHT_ABOVE_LUX) * LIGHT_LUX_SCALE / 2;
+                } else if (dark && lux > LIGHT_BRIGHT_ABOVE_LUX * LIGHT_LUX_SCALE) {
+                    dark = false;
+                } else if (!dark && lux < LIGHT_DARK_BELOW_LUX * LIGHT_LUX_SCALE) {
+                    dark = true;
+                }
+
+                TickType_t elapsed = xTaskGetTickCount() - last_publish;
+                if (first || dark != was_dark ||
+                    (brightness != published && elapsed >= pdMS_TO_TICKS(LIGHT_PUBLISH_MIN_MS))) {
+                    light_publish(filter.value, mv, lux);
+                    published = brightness;
+                    last_publish = xTaskGetTickCount();
+                }
+                if (first || dark != was_dark) {
+                    // Notify LED controller about the crossing (1 = dark, 0 = bright)
+                    event_message_t light_msg = {
+                        .type = EVENT_LIGHT,
+                        .value = dark ? 1 : 0,
+                    };
+                    event_bus_post(&light_msg);
+                }
+
+                uint32_t next = light_next_interval(interval, &filter, lux);
+                if (next != interval) {
+                    TRACE_LOG(TRACE_LIGHT_INTERVAL, next, filter.innovation >> LIGHT_FRAC_BITS);
+                    interval = next;
+                    light_stats.interval_ms = interval;
+                }
+            }
+        }
+
+        unsigned int overflows = atomic_exchange_explicit(&light_overflows, 0, memory_order_relaxed);
+        if (overflows) {
+            light_stats.overflows += overflows;
+            TRACE_LOG(TRACE_LIGHT_OVERFLOW, overflows);
+        }
+
+        // One measurement takes 1000 / LIGHT_OUTPUT_HZ ms, the rest of the interval is idle
+        if (measured && interval > LIGHT_INTERVAL_FAST_MS) {
+            light_stop(&filter);
+            running = false;
+            vTaskDelay(pdMS_TO_TICKS(interval - LIGHT_INTERVAL_FAST_MS));
+        }
+    }
+}
+
+void light_sensor_get_stats(light_sensor_stats_t *stats) {
+    *stats = light_stats;
+}
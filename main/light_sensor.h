@@ -0,0 +1,62 @@
+#ifndef LIGHT_SENSOR_H
+#define LIGHT_SENSOR_H
+
+#include "sensor_system.h"
+
+// --- Light acquisition pipeline ---
+// The ADC samples LIGHT_SENSOR_PIN continuously by DMA. task_light_sensor wakes once per frame,
+// averages LIGHT_SAMPLE_HZ / LIGHT_OUTPUT_HZ samples into one value (decimation),
+// takes the median of the last LIGHT_MEDIAN values and smooths it with a first order IIR,
+// all in fixed point. The filtered raw value is converted through a table built at init
+// from the ADC calibration (raw -> mV) and the LDR divider (mV -> lux).
+// The result is published as system_state.light_level and light_lux,
+// and EVENT_LIGHT carries the dark/bright state with hysteresis in lux.
+
+#define LIGHT_SAMPLE_HZ       2000 // Raised to the lowest rate of the target when needed
+#define LIGHT_FRAME_SAMPLES   128  // Results per DMA frame
+#define LIGHT_FRAME_POOL      4    // Frames the driver can hold before the task reads them
+#define LIGHT_OUTPUT_HZ       8    // Decimated values per second
+#define LIGHT_MEDIAN          5    // Odd
+#define LIGHT_IIR_SHIFT       3    // y += (x - y) / 8 for every decimated value
+#define LIGHT_FRAC_BITS       4    // Extra precision of the filtered raw value
+
+// LDR from the ADC input to GND, fixed resistor from the ADC input to VCC.
+// Less light -> higher LDR resistance -> higher voltage.
+#define LIGHT_VCC_MV           3300
+#define LIGHT_FIXED_OHMS       10000
+#define LIGHT_LDR_10LUX_OHMS   10000 // LDR resistance at 10 lux, from the datasheet
+#define LIGHT_LDR_GAMMA_X100   70    // Slope of log(R) over log(lux), times 100
+#define LIGHT_LUX_MAX          100000
+#define LIGHT_NOMINAL_FULL_MV  3100  // Full scale at ADC_ATTEN_DB_12 when the chip has no calibration
+
+#define LIGHT_LUT_SHIFT        5     // Raw counts between table entries
+#define LIGHT_LUX_SCALE        10    // light_lux is in 0.1 lux
+
+#define LIGHT_DARK_BELOW_LUX   10    // Under this it becomes dark
+#define LIGHT_BRIGHT_ABOVE_LUX 20    // Over this it becomes bright again
+
+#define LIGHT_PUBLISH_MIN_MS  250  // A changed brightness is published at most this often
+
+// --- Adaptive measurement interval ---
+// Continuous while the light changes, up to LIGHT_INTERVAL_SLOW_MS when it is stable.
+// The ADC is stopped between measurements.
+#define LIGHT_INTERVAL_FAST_MS (1000 / LIGHT_OUTPUT_HZ) // One measurement after the other
+#define LIGHT_INTERVAL_NEAR_MS 2000   // Longest interval within LIGHT_NEAR_FACTOR of the thresholds
+#define LIGHT_INTERVAL_SLOW_MS 8000   // Longest interval
+#define LIGHT_NEAR_FACTOR      4
+#define LIGHT_CHANGE_RAW       12     // Raw counts between a new value and the filtered one that mean change
+#define LIGHT_FRAME_TIMEOUT_MS 1000
+
+typedef struct {
+    uint32_t frames;
+    uint32_t samples;
+    uint32_t overflows; // Frames lost because the task was late
+    uint32_t outputs;   // Decimated values
+    uint32_t bursts;    // ADC starts
+    uint32_t interval_ms;
+} light_sensor_stats_t;
+
+void light_sensor_init(void);
+void light_sensor_get_stats(light_sensor_stats_t *stats);
+
+#endif
@@ -3,22 +3,30 @@
 #include "freertos/semphr.h"
 #include "freertos/event_groups.h"
 #include "freertos/timers.h"
+#include "trace_log.h"
+#include "event_bus.h"
+#include "esp_log.h"
+#include <stdlib.h>
+
+static const char *TAG = "MAIN";
 
 extern void led_off_timer_callback(TimerHandle_t xTimer);
 
 // --- Global Handles for FreeRTOS objects ---
-QueueHandle_t system_event_queue;
 SemaphoreHandle_t g_state_mutex;
-SemaphoreHandle_t button_press_sem;
 EventGroupHandle_t g_system_event_group;
 TimerHandle_t led_off_timer;
 TaskHandle_t g_oled_task_handle = NULL; // Initialize to NULL
 
 void app_main() {
     // --- Create FreeRTOS Objects BEFORE creating tasks ---
-    system_event_queue = xQueueCreate(10, sizeof(event_message_t));
+    if (!event_bus_init()) {
+        // Every post and receive would run on NULL queues
+        ESP_LOGE(TAG, "Event bus creation failed");
+        abort();
+    }
     g_state_mutex = xSemaphoreCreateMutex();
-    button_press_sem = xSemaphoreCreateBinary();
+    system_state_publish(); // First snapshot for readers
     g_system_event_group = xEventGroupCreate();
     led_off_timer = xTimerCreate("LED_Off_Timer", pdMS_TO_TICKS(10000), pdFALSE, (void *)0, led_off_timer_callback);
 
@@ -32,9 +40,10 @@ void app_main() {
     xTaskCreate(task_button_handler, "Button Handler", 4096, NULL, 10, NULL);
     xTaskCreate(task_led_controller, "LED Controller", 4096, NULL, 8, NULL);
     xTaskCreate(task_light_sensor, "Light Sensor", 4096, NULL, 7, NULL);
-    xTaskCreate(task_motion_sensor, "Motion Sensor", 4096, NULL, 6, NULL);
     // Create OLED task and store its handle for notifications
     xTaskCreate(task_oled_display, "OLED Display", 4096, NULL, 2, &g_oled_task_handle);
+    // Lowest priority: formats the trace records logged by the other tasks
+    xTaskCreate(task_trace_log, "Trace Log", 3072, NULL, 1, NULL);
 
     printf("Waiting for system to initialize...\n");
 
@@ -1,6 +1,9 @@
 #include "sensor_system.h"
 #include "ssd1306.h"
-#include "font8x8_basic.h"
+#include "ssd1306_marquee.h"
+#include "oled_widgets.h"
+#include "event_bus.h"
+#include "light_sensor.h"
 #include "freertos/semphr.h"
 #include "freertos/event_groups.h"
 #include <string.h>
@@ -8,6 +11,50 @@
 
 extern SSD1306_t dev;
 
+// --- Widget bindings ---
+static const char *const mode_names[] = { "AUTO", "MANUAL" };
+static const char *const led_names[] = { "OFF", "ON" };
+
+static uint32_t get_mode(const system_state_t *state) { return state->mode; }
+static uint32_t get_light(const system_state_t *state) { return state->light_level; }
+static uint32_t get_lux(const system_state_t *state) { return state->light_lux / LIGHT_LUX_SCALE; }
+static uint32_t get_motion(const system_state_t *state) { return state->motion_count; }
+static uint32_t get_led(const system_state_t *state) { return state->led_state ? 1 : 0; }
+static uint32_t get_heap(const system_state_t *state) { return esp_get_free_heap_size(); }
+static uint32_t get_dropped(const system_state_t *state) { return event_bus_dropped(); }
+
+// --- Screens, built once ---
+static widget_t normal_widgets[] = {
+    WIDGET_LABEL(0, 0, "Mode:", false),
+    WIDGET_VALUE(0, 48, 6, "%s", OLED_NOTIFY_MODE, get_mode, mode_names),
+    WIDGET_LABEL(2, 0, "Light:", false),
+    WIDGET_VALUE(2, 56, 4, "%3lu%%", OLED_NOTIFY_LIGHT, get_light, NULL),
+    WIDGET_LABEL(3, 0, "Motion:", false),
+    WIDGET_VALUE(3, 64, 3, "%3lu", OLED_NOTIFY_MOTION, get_motion, NULL),
+    WIDGET_LABEL(4, 0, "LED:", false),
+    WIDGET_VALUE(4, 40, 3, "%s", OLED_NOTIFY_LED, get_led, led_names),
+};
+
+static widget_t diagnostic_widgets[] = {
+    WIDGET_LABEL(0, 0, "*DIAGNOSTIC MODE*", true),
+    WIDGET_LABEL(2, 0, "Light Val:", false),
+    WIDGET_VALUE(2, 88, 5, "%lu", OLED_NOTIFY_LIGHT, get_light, NULL),
+    WIDGET_LABEL(3, 0, "Motion Cnt:", false),
+    WIDGET_VALUE(3, 96, 4, "%lu", OLED_NOTIFY_MOTION, get_motion, NULL),
+    WIDGET_LABEL(4, 0, "Lux:", false),
+    WIDGET_VALUE(4, 40, 6, "%lu", OLED_NOTIFY_LIGHT, get_lux, NULL),
+    WIDGET_LABEL(5, 0, "Heap:", false),
+    WIDGET_VALUE(5, 48, 10, "%lu", WIDGET_POLL, get_heap, NULL),
+    WIDGET_LABEL(6, 0, "Drops:", false),
+    WIDGET_VALUE(6, 56, 9, "%lu", WIDGET_POLL, get_dropped, NULL),
+};
+
+// Scrolls once through the last page after start-up
+static const char help_text[] = "Press: LED   Double press: AUTO/MANUAL   Hold: diagnostics";
+
+static widget_screen_t normal_screen = { normal_widgets, sizeof(normal_widgets) / sizeof(normal_widgets[0]) };
+static widget_screen_t diagnostic_screen = { diagnostic_widgets, sizeof(diagnostic_widgets) / sizeof(diagnostic_widgets[0]) };
+
 void task_oled_display(void *pvParameters) {
     // I2C is already initialized by init_oled_i2c() called from app_main
     // Just signal that OLED task is ready
@@ -18,49 +65,77 @@ void task_oled_display(void *pvParameters) {
     ssd1306_display_text(&dev, 0, "SYSTEM READY", 12, false);
     vTaskDelay(pdMS_TO_TICKS(1500));
 
-    char buffer[24];
-    bool diagnostic_mode = false;
+    // The marquee timer only notifies this task, which draws and flushes the line.
+    // After one pass the timer stops and the panel is quiet again.
+    if (ssd1306_marquee_init(&dev, NULL, OLED_MARQUEE_PERIOD_MS, xTaskGetCurrentTaskHandle(), OLED_NOTIFY_MARQUEE)) {
+        ssd1306_marquee_add(&ssd1306_font_8x8, 7, 0, 128, help_text, OLED_MARQUEE_SPEED, false, 1);
+    }
+
+    widget_screen_t *screen = &normal_screen;
+    system_state_t state;
+    uint32_t pending = OLED_NOTIFY_ALL; // First frame draws everything
+    TickType_t last_frame = xTaskGetTickCount() - pdMS_TO_TICKS(OLED_MIN_FRAME_MS);
 
     while (1) {
-        // Wait for a notification OR timeout after 500ms
-        if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(500)) > 0) {
-            ESP_LOGI("TASK_NOTIF", "OLED task received notification, toggling diagnostic mode");
-            // We were woken up by a notification, toggle diagnostic mode
-            diagnostic_mode = !diagnostic_mode;
+        // Sleep until a field changes or the keep-alive is due. Nothing is sent while the state is idle.
+        // Marquee ticks wake the task without a frame, so the wait counts from the last frame.
+        uint32_t notified = 0;
+        TickType_t wait = 0;
+        bool poll = false;
+        if (pending == 0) {
+            TickType_t idle = xTaskGetTickCount() - last_frame;
+            wait = (idle < pdMS_TO_TICKS(OLED_KEEPALIVE_MS)) ? pdMS_TO_TICKS(OLED_KEEPALIVE_MS) - idle : 0;
+            // The WIDGET_POLL values of the diagnostic screen are not notified
+            if (screen == &diagnostic_screen && wait > pdMS_TO_TICKS(OLED_POLL_MS)) {
+                wait = pdMS_TO_TICKS(OLED_POLL_MS);
+                poll = true;
+            }
+        }
+        if (xTaskNotifyWait(0, UINT32_MAX, &notified, wait) == pdTRUE) {
+            pending |= notified;
+        } else if (poll) {
+            // Only the WIDGET_POLL widgets are checked, and only changed characters are sent
+            system_state_snapshot(&state);
+            widget_screen_update(&dev, screen, &state, 0);
+            continue;
+        } else if (pending == 0) {
+            // Keep-alive: redraw in case the panel lost its contents
+            pending = OLED_NOTIFY_ALL;
+        }
+        if (pending & OLED_NOTIFY_MARQUEE) {
+            // Only the columns of the help line are sent
+            ssd1306_marquee_tick();
+            pending &= ~OLED_NOTIFY_MARQUEE;
+            if (pending == 0) continue;
         }
-        
-        // --- Use Mutex to protect access to system_state ---
-        if (xSemaphoreTake(g_state_mutex, portMAX_DELAY) == pdTRUE) {
-            ESP_LOGI("MUTEX", "Mutex taken by OLED task");
-            ssd1306_clear_screen(&dev, false);
 
-            if (diagnostic_mode) {
-                ssd1306_display_text(&dev, 0, "*DIAGNOSTIC MODE*", 17, true);
-                snprintf(buffer, sizeof(buffer), "Light Val: %lu", system_state.light_level);
-                ssd1306_display_text(&dev, 2, buffer, strlen(buffer), false);
-                snprintf(buffer, sizeof(buffer), "Motion Cnt: %lu", system_state.motion_count);
-                ssd1306_display_text(&dev, 3, buffer, strlen(buffer), false);
-                snprintf(buffer, sizeof(buffer), "Heap: %lu", esp_get_free_heap_size());
-                ssd1306_display_text(&dev, 5, buffer, strlen(buffer), false);
+        // Coalesce a burst of changes into one frame. A long press is shown at once.
+        TickType_t elapsed = xTaskGetTickCount() - last_frame;
+        if ((pending & OLED_NOTIFY_DIAGNOSTIC) == 0 && elapsed < pdMS_TO_TICKS(OLED_MIN_FRAME_MS)) {
+            vTaskDelay(pdMS_TO_TICKS(OLED_MIN_FRAME_MS) - elapsed);
+            if (xTaskNotifyWait(0, UINT32_MAX, &notified, 0) == pdTRUE) pending |= notified;
+            if (pending & OLED_NOTIFY_MARQUEE) {
+                ssd1306_marquee_tick();
+                pending &= ~OLED_NOTIFY_MARQUEE;
+            }
+        }
 
-            } else {
-                // Normal display logic
-                const char *mode_str = (system_state.mode == SYSTEM_MODE_AUTO) ? "AUTO" : "MANUAL";
-                snprintf(buffer, sizeof(buffer), "Mode: %s", mode_str);
-                ssd1306_display_text(&dev, 0, buffer, strlen(buffer), false);
+        if (pending & OLED_NOTIFY_DIAGNOSTIC) {
+            ESP_LOGI("TASK_NOTIF", "OLED task received notification, toggling diagnostic mode");
+            // Swap to the other prebuilt screen
+            screen = (screen == &normal_screen) ? &diagnostic_screen : &normal_screen;
+            pending |= OLED_NOTIFY_REDRAW;
+        }
 
-                snprintf(buffer, sizeof(buffer), "Light: %3lu%%", system_state.light_level);
-                ssd1306_display_text(&dev, 2, buffer, strlen(buffer), false);
-                
-                snprintf(buffer, sizeof(buffer), "Motion: %3lu", system_state.motion_count);
-                ssd1306_display_text(&dev, 3, buffer, strlen(buffer), false);
-                
-                snprintf(buffer, sizeof(buffer), "LED: %s", system_state.led_state ? "ON" : "OFF");
-                ssd1306_display_text(&dev, 4, buffer, strlen(buffer), false);
-            }
-            
-            xSemaphoreGive(g_state_mutex);
-            ESP_LOGI("MUTEX", "Mutex released by OLED task");
+        // --- Copy system_state without the mutex, so drawing never blocks the writers ---
+        system_state_snapshot(&state);
+        // Only the widgets of the changed fields are drawn, and only their columns are sent
+        if (pending & OLED_NOTIFY_REDRAW) {
+            widget_screen_show(&dev, screen, &state);
+        } else {
+            widget_screen_update(&dev, screen, &state, pending);
         }
+        pending = 0;
+        last_frame = xTaskGetTickCount();
     }
 }
\ No newline at end of file
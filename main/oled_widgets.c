@@ -0,0 +1,61 @@
+#include "oled_widgets.h"
+#include <string.h>
+#include <stdio.h>
+
+// Draw the characters of text that differ from what the widget shows, and mark them dirty.
+static void widget_draw(SSD1306_t *dev, widget_t *widget, const char *text) {
+    int first = -1;
+    int last = -1;
+    for (int i = 0; i < widget->width; i++) {
+        if (widget->valid && widget->shown[i] == text[i]) continue;
+        char ch[2] = { text[i], 0 };
+        ssd1306_font_text(dev, &ssd1306_font_8x8, widget->page, widget->seg + i * 8, ch, widget->invert);
+        if (first < 0) first = i;
+        last = i;
+    }
+    if (first >= 0) {
+        ssd1306_mark_dirty(dev, widget->page, widget->seg + first * 8, (last - first + 1) * 8);
+    }
+    memcpy(widget->shown, text, widget->width);
+}
+
+// Format the widget into text, padded with spaces to its width.
+static void widget_format(const widget_t *widget, uint32_t value, char *text) {
+    char buffer[WIDGET_CHARS * 2];
+    if (widget->get == NULL) {
+        snprintf(buffer, sizeof(buffer), "%s", widget->text);
+    } else if (widget->names) {
+        snprintf(buffer, sizeof(buffer), widget->text, widget->names[value]);
+    } else {
+        snprintf(buffer, sizeof(buffer), widget->text, (unsigned long)value);
+    }
+    snprintf(text, WIDGET_CHARS + 1, "%-*.*s", widget->width, widget->width, buffer);
+}
+
+// Switch to screen: clear the panel and draw every widget.
+void widget_screen_show(SSD1306_t *dev, widget_screen_t *screen, const system_state_t *state) {
+    ssd1306_clear_screen(dev, false);
+    for (int i = 0; i < screen->count; i++) {
+        screen->widgets[i].valid = false;
+    }
+    widget_screen_update(dev, screen, state, 0);
+}
+
+// Redraw the widgets bound to the changed fields whose value differs from the cache.
+// Returns the number of bytes sent.
+int widget_screen_update(SSD1306_t *dev, widget_screen_t *screen, const system_state_t *state, uint32_t changed) {
+    char text[WIDGET_CHARS + 1];
+    for (int i = 0; i < screen->count; i++) {
+        widget_t *widget = &screen->widgets[i];
+        if (widget->valid && widget->field != WIDGET_POLL && (widget->field & changed) == 0) continue;
+
+        uint32_t value = widget->get ? widget->get(state) : 0;
+        if (widget->valid && value == widget->value) continue;
+
+        widget_format(widget, value, text);
+        widget_draw(dev, widget, text);
+        widget->value = value;
+        widget->valid = true;
+    }
+    return ssd1306_flush(dev);
+}
@@ -0,0 +1,46 @@
+#ifndef OLED_WIDGETS_H
+#define OLED_WIDGETS_H
+
+#include "sensor_system.h"
+#include "ssd1306.h"
+
+// --- Retained widgets for the OLED screens ---
+// A widget is a label or a value bound to a field of system_state.
+// A value is only formatted again when its field was notified and the value really changed,
+// and only the characters that differ from the cached text are drawn and flushed.
+
+#define WIDGET_POLL  0xFFFFFFFF // Bound to something outside system_state. Checked on every update.
+#define WIDGET_CHARS 16         // 8x8 characters in a line
+
+typedef uint32_t (*widget_getter_t)(const system_state_t *state);
+
+typedef struct {
+    int page;
+    int seg;
+    int width;                 // Characters
+    bool invert;
+    const char *text;          // Label text, or printf format of the value
+    uint32_t field;            // OLED_NOTIFY_* bit of the bound field. 0 for labels.
+    widget_getter_t get;       // NULL for labels
+    const char *const *names;  // Value as an index into names, formatted with %s. Or NULL for %lu.
+    // --- Cache ---
+    bool valid;
+    uint32_t value;
+    char shown[WIDGET_CHARS + 1];
+} widget_t;
+
+typedef struct {
+    widget_t *widgets;
+    int count;
+} widget_screen_t;
+
+// A label longer than a line is cut at the panel edge, like ssd1306_display_text()
+#define WIDGET_LABEL(_page, _seg, _text, _invert) \
+    { .page = (_page), .seg = (_seg), .width = (sizeof(_text) - 1 < WIDGET_CHARS) ? sizeof(_text) - 1 : WIDGET_CHARS, .invert = (_invert), .text = (_text) }
+#define WIDGET_VALUE(_page, _seg, _width, _format, _field, _get, _names) \
+    { .page = (_page), .seg = (_seg), .width = (_width), .text = (_format), .field = (_field), .get = (_get), .names = (_names) }
+
+void widget_screen_show(SSD1306_t *dev, widget_screen_t *screen, const system_state_t *state);
+int widget_screen_update(SSD1306_t *dev, widget_screen_t *screen, const system_state_t *state, uint32_t changed);
+
+#endif // OLED_WIDGETS_H
@@ -2,14 +2,16 @@
 #include "sensor_system.h"
 #include "ssd1306.h"
 #include "font8x8_basic.h"
+#include "trace_log.h"
+#include "event_bus.h"
+#include "light_sensor.h"
+#include "button_handler.h"
 #include "esp_log.h"
 #include "freertos/semphr.h"
 #include "freertos/event_groups.h"
 
 static const char *TAG = "SENSOR";
 
-adc_oneshot_unit_handle_t adc1_handle;
-
 // --- Global variable definitions ---
 system_state_t system_state = {
     .light_level = 50,
@@ -18,41 +20,101 @@ system_state_t system_state = {
     .mode = SYSTEM_MODE_AUTO,
     .last_motion_time = 0
 };
+// Published copies of system_state. system_state_seq selects the current one
+// and changes on every publish, so a reader can tell that a copy was overwritten.
+static system_state_t system_state_slots[2];
+static atomic_uint system_state_seq;
+
+// Rising edges of the PIR sensor, written by motion_isr_handler and read by the LED controller
+static int64_t motion_edges[MOTION_EDGE_RING];
+static atomic_uint motion_edge_head;
+static atomic_uint motion_edge_tail;
+static int64_t motion_last_edge = -MOTION_RETRIGGER_MS * 1000LL; // ISR only
+static atomic_uint motion_suppressed;
+static atomic_uint motion_lost;
+
 // SSD1306 device instance used by OLED tasks and drivers
 SSD1306_t dev;
 // Note: Other handles are defined in main.c
 
-// --- ISR Handler ---
-// This function is called from an interrupt. It must be fast.
-void IRAM_ATTR button_isr_handler(void* arg) {
+// Called by writers with g_state_mutex held.
+// The copy goes to the slot readers are not using, then the sequence switches to it.
+void system_state_publish(void) {
+    unsigned int seq = atomic_load_explicit(&system_state_seq, memory_order_relaxed);
+    const system_state_t *last = &system_state_slots[seq & 1];
+    uint32_t changed = 0;
+    if (last->light_level != system_state.light_level || last->light_lux != system_state.light_lux) changed |= OLED_NOTIFY_LIGHT;
+    if (last->motion_count != system_state.motion_count) changed |= OLED_NOTIFY_MOTION;
+    if (last->led_state != system_state.led_state) changed |= OLED_NOTIFY_LED;
+    if (last->mode != system_state.mode) changed |= OLED_NOTIFY_MODE;
+
+    // The last publish must be visible before its old slot is overwritten
+    atomic_thread_fence(memory_order_release);
+    system_state_slots[(seq + 1) & 1] = system_state;
+    atomic_store_explicit(&system_state_seq, seq + 1, memory_order_release);
+
+    if (changed && g_oled_task_handle != NULL) {
+        xTaskNotify(g_oled_task_handle, changed, eSetBits);
+    }
+}
+
+// Copy the latest published system_state. Never blocks.
+// Retries only when a writer published during the copy.
+void system_state_snapshot(system_state_t *out) {
+    unsigned int seq;
+    do {
+        seq = atomic_load_explicit(&system_state_seq, memory_order_acquire);
+        *out = system_state_slots[seq & 1];
+        atomic_thread_fence(memory_order_acquire);
+    } while (seq != atomic_load_explicit(&system_state_seq, memory_order_relaxed));
+}
+
+// Rising edge of the PIR sensor. Stores the time of the edge and wakes the LED controller.
+void IRAM_ATTR motion_isr_handler(void* arg) {
+    int64_t now = esp_timer_get_time();
+    // A chattering sensor retriggers within the window; only the first edge counts
+    if (now - motion_last_edge < MOTION_RETRIGGER_MS * 1000LL) {
+        atomic_fetch_add_explicit(&motion_suppressed, 1, memory_order_relaxed);
+        return;
+    }
+    motion_last_edge = now;
+
+    unsigned int head = atomic_load_explicit(&motion_edge_head, memory_order_relaxed);
+    if (head - atomic_load_explicit(&motion_edge_tail, memory_order_acquire) == MOTION_EDGE_RING) {
+        atomic_fetch_add_explicit(&motion_lost, 1, memory_order_relaxed);
+        return;
+    }
+    motion_edges[head & (MOTION_EDGE_RING - 1)] = now;
+    atomic_store_explicit(&motion_edge_head, head + 1, memory_order_release);
+
+    // Only a wake-up: a pending EVENT_MOTION is replaced, the edges stay in the ring
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    xSemaphoreGiveFromISR(button_press_sem, &xHigherPriorityTaskWoken);
-    // Log chỉ nên thực hiện ở task, không phải trong ISR
+    event_message_t msg = { .type = EVENT_MOTION, .value = 1 };
+    event_bus_post_from_isr(&msg, &xHigherPriorityTaskWoken);
     if (xHigherPriorityTaskWoken) {
         portYIELD_FROM_ISR();
     }
 }
 
+// Oldest edge not handled yet
+static bool motion_edge_pop(int64_t *time_us) {
+    unsigned int tail = atomic_load_explicit(&motion_edge_tail, memory_order_relaxed);
+    if (tail == atomic_load_explicit(&motion_edge_head, memory_order_acquire)) return false;
+    *time_us = motion_edges[tail & (MOTION_EDGE_RING - 1)];
+    atomic_store_explicit(&motion_edge_tail, tail + 1, memory_order_release);
+    return true;
+}
+
 void led_off_timer_callback(TimerHandle_t xTimer) {
-    ESP_LOGI("TIMER", "Timer expired, sending EVENT_MOTION_TIMEOUT");
+    TRACE_LOG(TRACE_TIMER_EXPIRED);
     event_message_t msg = { .type = EVENT_MOTION_TIMEOUT };
-    xQueueSend(system_event_queue, &msg, 0);
+    event_bus_post(&msg);
 }
 
 void init_hardware() {
-    // --- Button (with interrupt) ---
-    gpio_config_t btn_config = {
-        .pin_bit_mask = (1ULL << BUTTON_PIN),
-        .mode = GPIO_MODE_INPUT,
-        .pull_up_en = GPIO_PULLUP_ENABLE,
-        .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        .intr_type = GPIO_INTR_NEGEDGE // Interrupt on falling edge
-    };
-    gpio_config(&btn_config);
-
-    // Install ISR service and add handler for the button pin
+    // --- Buttons (edge interrupts, see button_handler.c) ---
     gpio_install_isr_service(0);
-    gpio_isr_handler_add(BUTTON_PIN, button_isr_handler, NULL);
+    button_engine_init();
 
     // --- Other hardware init (motion, led, adc) ---
     gpio_config_t motion_config = {
@@ -60,9 +122,10 @@ void init_hardware() {
         .mode = GPIO_MODE_INPUT,
         .pull_up_en = GPIO_PULLUP_DISABLE,
         .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        .intr_type = GPIO_INTR_DISABLE
+        .intr_type = GPIO_INTR_POSEDGE // PIR output goes high on motion
     };
     gpio_config(&motion_config);
+    gpio_isr_handler_add(MOTION_SENSOR_PIN, motion_isr_handler, NULL);
 
     gpio_config_t led_config = {
         .pin_bit_mask = (1ULL << LED_PIN),
@@ -73,17 +136,8 @@ void init_hardware() {
     };
     gpio_config(&led_config);
 
-    // --- ADC ---
-    adc_oneshot_unit_init_cfg_t init_config1 = {
-        .unit_id = ADC_UNIT_1,
-    };
-    ESP_ERROR_CHECK(adc_oneshot_new_unit(&init_config1, &adc1_handle));
-
-    adc_oneshot_chan_cfg_t config = {
-        .bitwidth = ADC_BITWIDTH_12,
-        .atten = ADC_ATTEN_DB_12,
-    };
-    ESP_ERROR_CHECK(adc_oneshot_config_channel(adc1_handle, ADC_CHANNEL_0, &config));
+    // --- ADC (continuous, sampled by DMA) ---
+    light_sensor_init();
 
     // --- Signal that sensor hardware is ready ---
     xEventGroupSetBits(g_system_event_group, BIT_SENSORS_INIT_OK);
@@ -102,71 +156,11 @@ void init_oled_i2c(void) {
     ESP_LOGI("EVENT_GROUP", "BIT_OLED_INIT_OK set");
 }
 
-/*
- * Motion task:
- * - Detect rising edge (LOW -> HIGH) only
- * - Send EVENT_MOTION into queue
- * - Does NOT directly modify system_state (to avoid races) —
- *   system_state will be updated in task_led_controller when receiving the event.
- */
-void task_motion_sensor(void *pvParameters) {
-    int last_motion_state = 0;
-
-    while (1) {
-        int motion_state = gpio_get_level(MOTION_SENSOR_PIN);
-
-        if (motion_state == 1 && last_motion_state == 0) {
-            event_message_t msg = {
-                .type = EVENT_MOTION,
-                .value = 1
-            };
-            BaseType_t res = xQueueSend(system_event_queue, &msg, 0);
-            if (res == pdPASS) {
-                ESP_LOGI(TAG, "Motion detected -> event queued");
-            } else {
-                ESP_LOGW(TAG, "Motion detected but queue full");
-            }
-        }
-
-        last_motion_state = motion_state;
-        vTaskDelay(pdMS_TO_TICKS(200)); // debounce / reduce spam
-    }
-}
-
-/*
- * Light sensor task (reads ADC, updates system_state.light_level)
- * We keep updating light_level directly for responsiveness; if you prefer,
- * we can also send EVENT_LIGHT via queue instead.
- */
-void task_light_sensor(void *pvParameters) {
-    int raw_value;
-    while (1) {
-        ESP_ERROR_CHECK(adc_oneshot_read(adc1_handle, ADC_CHANNEL_0, &raw_value));
-        // convert to percentage: 0..100 (higher = brighter)
-        // --- Use Mutex to protect access to system_state ---
-        if (xSemaphoreTake(g_state_mutex, portMAX_DELAY) == pdTRUE) {
-            system_state.light_level = 100 - (raw_value * 100) / 4095;
-            ESP_LOGI(TAG, "ADC raw=%d -> brightness=%lu%%", raw_value, system_state.light_level);
-            xSemaphoreGive(g_state_mutex);
-
-            // Notify LED controller about light level (1 = dark, 0 = bright)
-            event_message_t light_msg = {
-                .type = EVENT_LIGHT,
-                .value = (system_state.light_level < 50) ? 1 : 0,
-            };
-            BaseType_t send_res = xQueueSend(system_event_queue, &light_msg, 0);
-            if (send_res != pdPASS) {
-                ESP_LOGW(TAG, "Light event not queued (queue full)");
-            }
-        }
-        vTaskDelay(pdMS_TO_TICKS(2000));
-    }
-}
-
 /*
  * LED controller:
  * - Receives events from queue (motion, button presses, ...)
- * - Updates system_state.motion_count and last_motion_time on EVENT_MOTION
+ * - Updates system_state.motion_count and last_motion_time on EVENT_MOTION,
+ *   from the edges stored by motion_isr_handler
  * - Uses threshold is_dark = (light_level > 40) as requested
  * - Maps system_state.led_state == true  -> physical GPIO = 1 (ON)
  *   (This ensures log "ON" matches physical LED lit)
@@ -175,24 +169,38 @@ void task_led_controller(void *pvParameters) {
     event_message_t msg;
 
     while (1) {
-        // Wait for any event from the queue
-        if (xQueueReceive(system_event_queue, &msg, portMAX_DELAY) == pdPASS) {
-            ESP_LOGI("QUEUE", "Received event: %d", msg.type);
+        // Wait for the next event, button events first
+        if (event_bus_receive(&msg, portMAX_DELAY)) {
+            TRACE_LOG(TRACE_QUEUE_EVENT, msg.type);
             // --- Use Mutex to protect access to system_state ---
             if (xSemaphoreTake(g_state_mutex, portMAX_DELAY) == pdTRUE) {
-                ESP_LOGI("MUTEX", "Mutex taken by LED controller");
+                TRACE_LOG(TRACE_MUTEX_TAKEN);
                 switch (msg.type) {
-                    case EVENT_MOTION:
-                        if (system_state.mode == SYSTEM_MODE_AUTO) {
-                            system_state.motion_count++;
-                            system_state.last_motion_time = xTaskGetTickCount();
+                    case EVENT_MOTION: {
+                        // One event can stand for several edges; each one is counted
+                        int64_t edge_us;
+                        bool motion = false;
+                        while (motion_edge_pop(&edge_us)) {
+                            int64_t age_us = esp_timer_get_time() - edge_us;
+                            TRACE_LOG(TRACE_MOTION_EDGE, age_us,
+                                      atomic_load_explicit(&motion_suppressed, memory_order_relaxed),
+                                      atomic_load_explicit(&motion_lost, memory_order_relaxed));
+                            if (system_state.mode == SYSTEM_MODE_AUTO) {
+                                system_state.motion_count++;
+                                // Tick of the edge, not of this event
+                                system_state.last_motion_time = xTaskGetTickCount() - pdMS_TO_TICKS(age_us / 1000);
+                                motion = true;
+                            }
+                        }
+                        if (motion) {
                             // Turn LED ON and start/reset the one-shot timer
                             gpio_set_level(LED_PIN, 1);
                             system_state.led_state = true;
                             xTimerReset(led_off_timer, portMAX_DELAY);
-                            ESP_LOGI("TIMER", "Resetting LED off timer");
+                            TRACE_LOG(TRACE_TIMER_RESET);
                         }
                         break;
+                    }
                     case EVENT_LIGHT:
                         if (system_state.mode == SYSTEM_MODE_AUTO) {
                             if (msg.value == 1) {
@@ -201,7 +209,7 @@ void task_led_controller(void *pvParameters) {
                                     gpio_set_level(LED_PIN, 1);
                                     system_state.led_state = true;
                                     xTimerReset(led_off_timer, portMAX_DELAY);
-                                    ESP_LOGI(TAG, "Brightness=%lu%% -> LED ON", system_state.light_level);
+                                    TRACE_LOG(TRACE_LIGHT_LED_ON, system_state.light_level);
                                 }
                             } else {
                                 // It's bright -> turn LED OFF (if currently on)
@@ -209,7 +217,7 @@ void task_led_controller(void *pvParameters) {
                                     gpio_set_level(LED_PIN, 0);
                                     system_state.led_state = false;
                                     xTimerStop(led_off_timer, portMAX_DELAY);
-                                    ESP_LOGI(TAG, "Brightness=%lu%% -> LED OFF", system_state.light_level);
+                                    TRACE_LOG(TRACE_LIGHT_LED_OFF, system_state.light_level);
                                 }
                             }
                         }
@@ -219,13 +227,13 @@ void task_led_controller(void *pvParameters) {
                             // Timer expired, turn LED OFF
                             gpio_set_level(LED_PIN, 0);
                             system_state.led_state = false;
-                            ESP_LOGI("TIMER", "LED off timer expired, turning off LED");
+                            TRACE_LOG(TRACE_TIMER_LED_OFF);
                         }
                         break;
 
                     case EVENT_DOUBLE_PRESS:
                         system_state.mode = (system_state.mode == SYSTEM_MODE_AUTO) ? SYSTEM_MODE_MANUAL : SYSTEM_MODE_AUTO;
-                        ESP_LOGI("MODE", "Double press: switched to %s mode", system_state.mode == SYSTEM_MODE_AUTO ? "AUTO" : "MANUAL");
+                        TRACE_LOG(system_state.mode == SYSTEM_MODE_AUTO ? TRACE_MODE_AUTO : TRACE_MODE_MANUAL);
                         // Khi chuyển sang MANUAL, tắt đèn
                         if (system_state.mode == SYSTEM_MODE_MANUAL) {
                             system_state.led_state = false;
@@ -237,21 +245,22 @@ void task_led_controller(void *pvParameters) {
                         if (system_state.mode == SYSTEM_MODE_MANUAL) {
                             system_state.led_state = !system_state.led_state;
                             gpio_set_level(LED_PIN, system_state.led_state);
-                            ESP_LOGI("LED", "Single press: LED %s", system_state.led_state ? "ON" : "OFF");
+                            TRACE_LOG(system_state.led_state ? TRACE_LED_ON : TRACE_LED_OFF);
                         }
                         break;
                     
                     case EVENT_LONG_PRESS:
                         // Notify the OLED task to enter diagnostic mode
-                        xTaskNotifyGive(g_oled_task_handle);
-                        ESP_LOGI("TASK_NOTIF", "Sending notification to OLED task");
+                        xTaskNotify(g_oled_task_handle, OLED_NOTIFY_DIAGNOSTIC, eSetBits);
+                        TRACE_LOG(TRACE_NOTIFY_OLED);
                         break;
 
                     default:
                         break;
                 }
+                system_state_publish();
                 xSemaphoreGive(g_state_mutex);
-                ESP_LOGI("MUTEX", "Mutex released by LED controller");
+                TRACE_LOG(TRACE_MUTEX_RELEASED);
             }
         }
     }
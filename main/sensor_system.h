@@ -2,6 +2,7 @@
 #define SENSOR_SYSTEM_H
 
 #include <stdio.h>
+#include <stdatomic.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
@@ -9,10 +10,11 @@
 #include "freertos/semphr.h"      // For Semaphores and Mutexes
 #include "freertos/event_groups.h" // For Event Groups
 #include "driver/gpio.h"
-#include "esp_adc/adc_oneshot.h"
+#include "esp_adc/adc_continuous.h"
 #include "esp_adc/adc_cali.h"
 #include "esp_adc/adc_cali_scheme.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 
 // --- Pin Definitions ---
 #define BUTTON_PIN          GPIO_NUM_2
@@ -23,10 +25,31 @@
 #define OLED_SDA_PIN        GPIO_NUM_5
 #define OLED_SCL_PIN        GPIO_NUM_4
 
+// --- PIR Motion Capture ---
+#define MOTION_RETRIGGER_MS 1000 // Rising edges closer than this to the last accepted one are ignored
+#define MOTION_EDGE_RING    8    // Edge timestamps waiting for the LED controller. Power of 2.
+
 // --- Event Group Bits ---
 #define BIT_OLED_INIT_OK (1 << 0)
 #define BIT_SENSORS_INIT_OK (1 << 1)
 
+// --- OLED Task Notification Bits ---
+// Sent with xTaskNotify(eSetBits) to task_oled_display. One bit per field of system_state.
+#define OLED_NOTIFY_DIAGNOSTIC (1 << 0) // Long press: toggle diagnostic mode
+#define OLED_NOTIFY_LIGHT      (1 << 1)
+#define OLED_NOTIFY_MOTION     (1 << 2)
+#define OLED_NOTIFY_LED        (1 << 3)
+#define OLED_NOTIFY_MODE       (1 << 4)
+#define OLED_NOTIFY_REDRAW     (1 << 5) // Clear and draw every line
+#define OLED_NOTIFY_MARQUEE    (1 << 6) // Marquee timer: scroll the help line
+#define OLED_NOTIFY_ALL        (OLED_NOTIFY_LIGHT | OLED_NOTIFY_MOTION | OLED_NOTIFY_LED | OLED_NOTIFY_MODE | OLED_NOTIFY_REDRAW)
+
+#define OLED_MIN_FRAME_MS   100    // Changes closer than this are drawn in one frame
+#define OLED_KEEPALIVE_MS   60000  // Full redraw when nothing changed for this long
+#define OLED_POLL_MS        1000   // Refresh of the values that are not notified, on the diagnostic screen
+#define OLED_MARQUEE_PERIOD_MS 100
+#define OLED_MARQUEE_SPEED     40   // Pixels per second
+
 // --- System Mode ---
 typedef enum {
     SYSTEM_MODE_AUTO,
@@ -35,7 +58,8 @@ typedef enum {
 
 // --- System State Struct ---
 typedef struct {
-    uint32_t light_level;
+    uint32_t light_level;      // 0..100 %, from the calibrated voltage
+    uint32_t light_lux;        // LIGHT_LUX_SCALE units
     uint32_t motion_count;
     bool led_state;
     system_mode_t mode;
@@ -50,6 +74,8 @@ typedef enum {
     EVENT_MOTION,
     EVENT_MOTION_TIMEOUT,
     EVENT_LIGHT,  // New event from software timer
+    EVENT_MULTI_PRESS,     // Three clicks or more, count in the value
+    EVENT_TYPE_COUNT
 } event_type_t;
 
 typedef struct {
@@ -60,17 +86,21 @@ typedef struct {
 
 // --- Global Handles for FreeRTOS objects ---
 extern system_state_t system_state;
-extern QueueHandle_t system_event_queue;
 extern SemaphoreHandle_t g_state_mutex;
-extern SemaphoreHandle_t button_press_sem;
 extern EventGroupHandle_t g_system_event_group;
 extern TimerHandle_t led_off_timer;
 extern TaskHandle_t g_oled_task_handle; // For notifications
 
+// --- Lock-free snapshot of system_state ---
+// Writers change system_state under g_state_mutex and call system_state_publish()
+// before giving the mutex. Readers take a consistent copy without any lock.
+// Publishing notifies task_oled_display of the fields that changed.
+void system_state_publish(void);
+void system_state_snapshot(system_state_t *out);
+
 // --- Function Prototypes ---
 void init_hardware(void);
 void init_oled_i2c(void);
-void task_motion_sensor(void *pvParameters);
 void task_light_sensor(void *pvParameters);
 void task_led_controller(void *pvParameters);
 void task_button_handler(void *pvParameters);
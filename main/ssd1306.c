@@ -6,6 +6,7 @@
 #include "esp_log.h"
 
 #include "ssd1306.h"
+#include "ssd1306_fonts.h" // espressif/ssd1306
 #include "font8x8_basic.h"
 
 #define PACK8 __attribute__((aligned( __alignof__( uint8_t ) ), packed ))
@@ -25,6 +26,7 @@ void ssd1306_init(SSD1306_t * dev, int width, int height)
 	// Initialize internal buffer
 	for (int i=0;i<dev->_pages;i++) {
 		memset(dev->_page[i]._segs, 0, 128);
+		dev->_page[i]._dirtyCount = 0;
 	}
 }
 
@@ -54,6 +56,10 @@ void ssd1306_show_buffer(SSD1306_t * dev)
 			i2c_display_image(dev, page, 0, dev->_page[page]._segs, dev->_width);
 		}
 	}
+	// Nothing left to flush
+	for (int page=0; page<dev->_pages;page++) {
+		dev->_page[page]._dirtyCount = 0;
+	}
 }
 
 void ssd1306_set_buffer(SSD1306_t * dev, const uint8_t * buffer)
@@ -84,6 +90,83 @@ void ssd1306_get_page(SSD1306_t * dev, int page, uint8_t * buffer)
 	memcpy(buffer, &dev->_page[page]._segs, 128);
 }
 
+// Record that columns seg to {seg+width-1} of the internal buffer have changed.
+// They are sent by ssd1306_flush().
+void ssd1306_mark_dirty(SSD1306_t * dev, int page, int seg, int width)
+{
+	if (page < 0 || page >= dev->_pages) return;
+	if (seg < 0) {
+		width = width + seg;
+		seg = 0;
+	}
+	if (seg + width > dev->_width) width = dev->_width - seg;
+	if (width <= 0) return;
+
+	PAGE_t * _page = &dev->_page[page];
+	int start = seg;
+	int end = seg + width;
+
+	// Merge with every span that overlaps or is close to this one
+	int index = 0;
+	while (index < _page->_dirtyCount) {
+		SPAN_t * span = &_page->_dirty[index];
+		if (start <= span->_end + SSD1306_DIRTY_GAP && span->_start <= end + SSD1306_DIRTY_GAP) {
+			if (span->_start < start) start = span->_start;
+			if (span->_end > end) end = span->_end;
+			_page->_dirty[index] = _page->_dirty[--_page->_dirtyCount];
+			index = 0;
+			continue;
+		}
+		index++;
+	}
+
+	if (_page->_dirtyCount == SSD1306_DIRTY_SPANS) {
+		// No room. Widen the nearest span.
+		int nearest = 0;
+		int distance = dev->_width;
+		for (index=0;index<_page->_dirtyCount;index++) {
+			SPAN_t * span = &_page->_dirty[index];
+			int _distance = (span->_start > end) ? span->_start - end : start - span->_end;
+			if (_distance < distance) {
+				distance = _distance;
+				nearest = index;
+			}
+		}
+		SPAN_t * span = &_page->_dirty[nearest];
+		if (span->_start < start) start = span->_start;
+		if (span->_end > end) end = span->_end;
+		_page->_dirty[nearest] = _page->_dirty[--_page->_dirtyCount];
+		ssd1306_mark_dirty(dev, page, start, end - start);
+		return;
+	}
+
+	_page->_dirty[_page->_dirtyCount]._start = start;
+	_page->_dirty[_page->_dirtyCount]._end = end;
+	_page->_dirtyCount++;
+}
+
+// Send only the changed columns of the internal buffer.
+// Returns the number of data bytes sent.
+int ssd1306_flush(SSD1306_t * dev)
+{
+	int bytes = 0;
+	for (int page=0;page<dev->_pages;page++) {
+		PAGE_t * _page = &dev->_page[page];
+		for (int index=0;index<_page->_dirtyCount;index++) {
+			int seg = _page->_dirty[index]._start;
+			int width = _page->_dirty[index]._end - seg;
+			if (dev->_address == SPI_ADDRESS) {
+				spi_display_image(dev, page, seg, &_page->_segs[seg], width);
+			} else {
+				i2c_display_image(dev, page, seg, &_page->_segs[seg], width);
+			}
+			bytes = bytes + width;
+		}
+		_page->_dirtyCount = 0;
+	}
+	return bytes;
+}
+
 void ssd1306_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width)
 {
 	if (dev->_address == SPI_ADDRESS) {
@@ -253,6 +336,237 @@ ssd1306_display_text_x3(SSD1306_t * dev, int page, const char * text, int text_l
 	}
 }
 
+const ssd1306_font_t ssd1306_font_8x8 = {
+	.height = 8, .width = 8, .layout = SSD1306_FONT_PAGES,
+	.first = 0, .count = 128, .data = &font8x8_basic_tr[0][0],
+};
+
+const ssd1306_font_t ssd1306_font_1206 = {
+	.height = 12, .width = 6, .layout = SSD1306_FONT_COLUMNS,
+	.first = ' ', .count = 95, .data = &c_chFont1206[0][0],
+};
+
+const ssd1306_font_t ssd1306_font_1608 = {
+	.height = 16, .width = 8, .layout = SSD1306_FONT_COLUMNS,
+	.first = ' ', .count = 95, .data = &c_chFont1608[0][0],
+};
+
+const ssd1306_font_t ssd1306_font_1616 = {
+	.height = 16, .width = 16, .layout = SSD1306_FONT_COLUMNS,
+	.first = '0', .count = 11, .data = &c_chFont1612[0][0],
+};
+
+const ssd1306_font_t ssd1306_font_3216 = {
+	.height = 32, .width = 16, .layout = SSD1306_FONT_COLUMNS,
+	.first = '0', .count = 11, .data = &c_chFont3216[0][0],
+};
+
+// Find the glyph of code in a table of fixed size glyphs
+const uint8_t * ssd1306_font_lookup(const ssd1306_font_t * font, int code, int * advance)
+{
+	if (code < font->first || code >= font->first + font->count) return NULL;
+	int index = code - font->first;
+	*advance = font->widths ? font->widths[index] : font->width;
+	return &font->data[index * font->width * ((font->height + 7) / 8)];
+}
+
+// Decode one UTF-8 character of text into code, and return the number of bytes.
+static int ssd1306_utf8_decode(const char * text, int * code)
+{
+	const uint8_t * src = (const uint8_t *)text;
+	int length = 1;
+	*code = src[0];
+	if ((src[0] & 0xE0) == 0xC0) {
+		*code = src[0] & 0x1F;
+		length = 2;
+	} else if ((src[0] & 0xF0) == 0xE0) {
+		*code = src[0] & 0x0F;
+		length = 3;
+	} else if ((src[0] & 0xF8) == 0xF0) {
+		*code = src[0] & 0x07;
+		length = 4;
+	}
+	for (int i=1;i<length;i++) {
+		// Broken sequence. Take the lead byte as it is.
+		if ((src[i] & 0xC0) != 0x80) {
+			*code = src[0];
+			return 1;
+		}
+		*code = (*code << 6) | (src[i] & 0x3F);
+	}
+	return length;
+}
+
+// Find the glyph of code with the lookup of font.
+static const uint8_t * ssd1306_font_glyph(const ssd1306_font_t * font, int code, int * advance)
+{
+	if (font->lookup) return font->lookup(font, code, advance);
+	return ssd1306_font_lookup(font, code, advance);
+}
+
+// Column x of page of glyph in the page layout. bit0 is the top.
+static uint8_t ssd1306_font_column(const ssd1306_font_t * font, const uint8_t * glyph, int x, int page)
+{
+	if (font->layout == SSD1306_FONT_PAGES) return glyph[page * font->width + x];
+	return ssd1306_rotate_byte(glyph[x * ((font->height + 7) / 8) + page]);
+}
+
+// Render UTF-8 text to image of (font->height+7)/8 pages of width bytes, in the layout of dev.
+// image can be NULL to only measure the text.
+// Returns the width of the text in pixels.
+int ssd1306_font_render(SSD1306_t * dev, const ssd1306_font_t * font, const char * text, uint8_t * image, int width, bool invert)
+{
+	int pages = (font->height + 7) / 8;
+	int _seg = 0;
+	int i = 0;
+	while (text[i] != 0) {
+		int code;
+		i = i + ssd1306_utf8_decode(&text[i], &code);
+		int advance;
+		const uint8_t * glyph = ssd1306_font_glyph(font, code, &advance);
+		if (glyph == NULL) continue;
+		for (int x=0;image && x<advance && _seg+x<width;x++) {
+			for (int page=0;page<pages;page++) {
+				uint8_t wk0 = (x < font->width) ? ssd1306_font_column(font, glyph, x, page) : 0;
+				if (invert) wk0 = ~wk0;
+				if (dev->_flip) wk0 = ssd1306_rotate_byte(wk0);
+				image[page * width + _seg + x] = wk0;
+			}
+		}
+		_seg = _seg + advance;
+	}
+	return _seg;
+}
+
+// Set UTF-8 text to internal buffer. Not show it.
+// page and seg are the upper left position, and glyphs taller than 8 pixels use the following pages.
+// Every glyph is copied byte by byte. SSD1306_FONT_PAGES is copied as it is,
+// and SSD1306_FONT_COLUMNS only needs the bits of each byte reversed.
+// Returns the seg after the text.
+int ssd1306_font_text(SSD1306_t * dev, const ssd1306_font_t * font, int page, int seg, const char * text, bool invert)
+{
+	int pages = (font->height + 7) / 8;
+	int _seg = seg;
+	int i = 0;
+	while (text[i] != 0 && _seg < dev->_width) {
+		int code;
+		i = i + ssd1306_utf8_decode(&text[i], &code);
+		int advance;
+		const uint8_t * glyph = ssd1306_font_glyph(font, code, &advance);
+		if (glyph == NULL) {
+			ESP_LOGD(__FUNCTION__, "no glyph for %d", code);
+			continue;
+		}
+
+		int width = font->width;
+		if (_seg + width > dev->_width) width = dev->_width - _seg;
+		for (int _page=0;_page<pages;_page++) {
+			if (page + _page >= dev->_pages) break;
+			uint8_t * dst = &dev->_page[page+_page]._segs[_seg];
+			if (font->layout == SSD1306_FONT_PAGES) {
+				const uint8_t * src = &glyph[_page * font->width];
+				if (dev->_flip) {
+					for (int x=0;x<width;x++) dst[x] = ssd1306_rotate_byte(src[x]);
+				} else {
+					memcpy(dst, src, width);
+				}
+			} else {
+				// MSB at the top is already the layout of the flipped panel
+				const uint8_t * src = &glyph[_page];
+				if (dev->_flip) {
+					for (int x=0;x<width;x++) dst[x] = src[x * pages];
+				} else {
+					for (int x=0;x<width;x++) dst[x] = ssd1306_rotate_byte(src[x * pages]);
+				}
+			}
+			if (invert) ssd1306_invert(dst, width);
+		}
+		_seg = _seg + advance;
+	}
+	return _seg;
+}
+
+// Show UTF-8 text with font. Only the columns of the text are sent.
+int ssd1306_display_font_text(SSD1306_t * dev, const ssd1306_font_t * font, int page, int seg, const char * text, bool invert)
+{
+	int _seg = ssd1306_font_text(dev, font, page, seg, text, invert);
+	int width = ((_seg < dev->_width) ? _seg : dev->_width) - seg;
+	if (width <= 0) return _seg;
+	for (int _page=page;_page<page+(font->height+7)/8 && _page<dev->_pages;_page++) {
+		if (dev->_address == SPI_ADDRESS) {
+			spi_display_image(dev, _page, seg, &dev->_page[_page]._segs[seg], width);
+		} else {
+			i2c_display_image(dev, _page, seg, &dev->_page[_page]._segs[seg], width);
+		}
+	}
+	return _seg;
+}
+
+// Write the bits of one column to the two pages around ypos.
+// bits and mask are in the page layout (bit0 is ypos) and only the bits in mask are changed.
+static void ssd1306_put_column(SSD1306_t * dev, int seg, int ypos, uint8_t bits, uint8_t mask)
+{
+	int page = (ypos < 0) ? (ypos - 7) / 8 : ypos / 8;
+	int shift = ypos - page * 8;
+	uint16_t _bits = bits << shift;
+	uint16_t _mask = mask << shift;
+	for (int i=0;i<2;i++,page++) {
+		uint8_t wk0 = _bits >> (i * 8);
+		uint8_t wk1 = _mask >> (i * 8);
+		if (wk1 == 0 || page < 0 || page >= dev->_pages) continue;
+		if (dev->_flip) {
+			wk0 = ssd1306_rotate_byte(wk0);
+			wk1 = ssd1306_rotate_byte(wk1);
+		}
+		uint8_t * dst = &dev->_page[page]._segs[seg];
+		*dst = (*dst & ~wk1) | wk0;
+	}
+}
+
+// Set UTF-8 text to internal buffer at any pixel position. Not show it.
+// xpos and ypos are the upper left corner and may be outside the panel.
+// The glyph boxes are overwritten and marked dirty for ssd1306_flush().
+// Returns the xpos after the text.
+int ssd1306_draw_text(SSD1306_t * dev, const ssd1306_font_t * font, int xpos, int ypos, const char * text, bool invert)
+{
+	int pages = (font->height + 7) / 8;
+	int _xpos = xpos;
+	int right = xpos; // After the last column written. A glyph can be wider than its advance.
+	int i = 0;
+	while (text[i] != 0 && _xpos < dev->_width) {
+		int code;
+		i = i + ssd1306_utf8_decode(&text[i], &code);
+		int advance;
+		const uint8_t * glyph = ssd1306_font_glyph(font, code, &advance);
+		if (glyph == NULL) {
+			ESP_LOGD(__FUNCTION__, "no glyph for %d", code);
+			continue;
+		}
+
+		for (int x=0;x<font->width;x++) {
+			int seg = _xpos + x;
+			if (seg < 0) continue;
+			if (seg >= dev->_width) break;
+			for (int _page=0;_page<pages;_page++) {
+				uint8_t bits = ssd1306_font_column(font, glyph, x, _page);
+				int rows = font->height - _page * 8;
+				uint8_t mask = (rows >= 8) ? 0xFF : (1 << rows) - 1;
+				if (invert) bits = ~bits;
+				ssd1306_put_column(dev, seg, ypos + _page * 8, bits & mask, mask);
+			}
+			if (seg + 1 > right) right = seg + 1;
+		}
+		_xpos = _xpos + advance;
+	}
+
+	// One dirty span for each page of the text
+	int page = (ypos < 0) ? (ypos - 7) / 8 : ypos / 8;
+	for (;page * 8 < ypos + font->height;page++) {
+		ssd1306_mark_dirty(dev, page, xpos, right - xpos);
+	}
+	return _xpos;
+}
+
 void ssd1306_clear_screen(SSD1306_t * dev, bool invert)
 {
 	char space[16];
@@ -92,10 +92,23 @@ typedef enum {
 	SCROLL_STOP = 7
 } ssd1306_scroll_type_t;
 
+// Number of changed column ranges kept for each page.
+// Ranges closer than SSD1306_DIRTY_GAP columns are merged,
+// because the page/column address commands cost about as much as the gap.
+#define SSD1306_DIRTY_SPANS 4
+#define SSD1306_DIRTY_GAP 6
+
+typedef struct {
+	uint8_t _start;
+	uint8_t _end; // Not included
+} SPAN_t;
+
 typedef struct {
 	bool _valid; // Not using it anymore
 	int _segLen; // Not using it anymore
 	uint8_t _segs[128];
+	int _dirtyCount;
+	SPAN_t _dirty[SSD1306_DIRTY_SPANS];
 } PAGE_t;
 
 typedef struct {
@@ -118,6 +131,35 @@ typedef struct {
 #endif
 } SSD1306_t;
 
+// Glyph layout of ssd1306_font_t
+typedef enum {
+	SSD1306_FONT_PAGES = 0, // Page after page, one byte for each column, bit0 is the top (GDDRAM layout)
+	SSD1306_FONT_COLUMNS = 1, // Column after column, (height+7)/8 bytes for each column, MSB is the top
+} ssd1306_font_layout_t;
+
+typedef struct ssd1306_font ssd1306_font_t;
+
+// Font descriptor for ssd1306_font_text()
+struct ssd1306_font {
+	int height; // Glyph height in pixels
+	int width; // Glyph width in pixels. Every glyph has width*(height+7)/8 bytes.
+	ssd1306_font_layout_t layout;
+	int first; // Code of the first glyph in data
+	int count; // Number of glyphs in data
+	const uint8_t * widths; // Advance of each glyph for proportional fonts, or NULL
+	const uint8_t * data;
+	// Find the glyph of code and set its advance. Returns NULL when there is no glyph.
+	// NULL uses ssd1306_font_lookup().
+	const uint8_t * (*lookup)(const ssd1306_font_t * font, int code, int * advance);
+};
+
+extern const ssd1306_font_t ssd1306_font_8x8;
+// Fonts of the espressif/ssd1306 component
+extern const ssd1306_font_t ssd1306_font_1206;
+extern const ssd1306_font_t ssd1306_font_1608;
+extern const ssd1306_font_t ssd1306_font_1616; // '0' to ':' only
+extern const ssd1306_font_t ssd1306_font_3216; // '0' to ':' only
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -131,12 +173,19 @@ void ssd1306_show_buffer(SSD1306_t * dev);
 void ssd1306_set_buffer(SSD1306_t * dev, const uint8_t * buffer);
 void ssd1306_get_buffer(SSD1306_t * dev, uint8_t * buffer);
 void ssd1306_set_page(SSD1306_t * dev, int page, const uint8_t * buffer);
+void ssd1306_mark_dirty(SSD1306_t * dev, int page, int seg, int width);
+int ssd1306_flush(SSD1306_t * dev);
 void ssd1306_get_page(SSD1306_t * dev, int page, uint8_t * buffer);
 void ssd1306_display_image(SSD1306_t * dev, int page, int seg, const uint8_t * images, int width);
 void ssd1306_display_text(SSD1306_t * dev, int page, const char * text, int text_len, bool invert);
 void ssd1306_display_text_box1(SSD1306_t * dev, int page, int seg, const char * text, int box_width, int text_len, bool invert, int delay);
 void ssd1306_display_text_box2(SSD1306_t * dev, int page, int seg, const char * text, int box_width, int text_len, bool invert, int delay);
 void ssd1306_display_text_x3(SSD1306_t * dev, int page, const char * text, int text_len, bool invert);
+const uint8_t * ssd1306_font_lookup(const ssd1306_font_t * font, int code, int * advance);
+int ssd1306_font_render(SSD1306_t * dev, const ssd1306_font_t * font, const char * text, uint8_t * image, int width, bool invert);
+int ssd1306_font_text(SSD1306_t * dev, const ssd1306_font_t * font, int page, int seg, const char * text, bool invert);
+int ssd1306_display_font_text(SSD1306_t * dev, const ssd1306_font_t * font, int page, int seg, const char * text, bool invert);
+int ssd1306_draw_text(SSD1306_t * dev, const ssd1306_font_t * font, int xpos, int ypos, const char * text, bool invert);
 void ssd1306_clear_screen(SSD1306_t * dev, bool invert);
 void ssd1306_clear_line(SSD1306_t * dev, int page, bool invert);
 void ssd1306_contrast(SSD1306_t * dev, int contrast);
@@ -0,0 +1,229 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/timers.h"
+
+#include "esp_log.h"
+
+#include "ssd1306.h"
+#include "ssd1306_marquee.h"
+
+static SSD1306_t * marquee_dev;
+static SemaphoreHandle_t marquee_lock;
+static TimerHandle_t marquee_timer;
+static TaskHandle_t marquee_task;
+static uint32_t marquee_bits;
+static TickType_t marquee_last; // Time of the last tick
+static bool marquee_paused;     // ssd1306_marquee_stop() was called
+static ssd1306_marquee_t marquees[SSD1306_MARQUEE_MAX];
+
+// Copy the visible part of the text to the box.
+// The text enters from the right edge of the box and leaves from the left edge.
+static void marquee_draw(ssd1306_marquee_t * marquee)
+{
+	int pages = (marquee->font->height + 7) / 8;
+	uint8_t blank = marquee->invert ? 0xFF : 0x00;
+	for (int page=0;page<pages;page++) {
+		if (marquee->page + page >= marquee_dev->_pages) break;
+		uint8_t * segs = &marquee_dev->_page[marquee->page+page]._segs[marquee->seg];
+		const uint8_t * image = &marquee->image[page * marquee->length];
+		int x = marquee->offset - marquee->width;
+		for (int seg=0;seg<marquee->width;seg++,x++) {
+			segs[seg] = (x >= 0 && x < marquee->length) ? image[x] : blank;
+		}
+		ssd1306_mark_dirty(marquee_dev, marquee->page+page, marquee->seg, marquee->width);
+	}
+}
+
+static bool marquee_any_active(void)
+{
+	for (int id=0;id<SSD1306_MARQUEE_MAX;id++) {
+		if (marquees[id].active) return true;
+	}
+	return false;
+}
+
+// Runs in the timer service task, so it must not block
+static void marquee_callback(TimerHandle_t xTimer)
+{
+	xTaskNotify(marquee_task, marquee_bits, eSetBits);
+}
+
+// Advance the marquees and send the boxes that moved.
+// Called by the task given to ssd1306_marquee_init() when it is notified.
+// A late tick catches up with the time since the last one.
+// Returns the number of bytes sent.
+int ssd1306_marquee_tick(void)
+{
+	if (marquee_lock == NULL) return 0;
+	xSemaphoreTake(marquee_lock, portMAX_DELAY);
+	TickType_t now = xTaskGetTickCount();
+	int elapsed = (now - marquee_last) * portTICK_PERIOD_MS;
+	marquee_last = now;
+	for (int id=0;id<SSD1306_MARQUEE_MAX;id++) {
+		ssd1306_marquee_t * marquee = &marquees[id];
+		if (marquee->active == false) continue;
+		marquee->step = marquee->step + marquee->speed * elapsed;
+		if (marquee->step < 1000) continue;
+		int offset = marquee->offset + marquee->step / 1000;
+		marquee->step = marquee->step % 1000;
+		marquee->offset = offset % (marquee->width + marquee->length);
+		bool last = (offset >= marquee->width + marquee->length && marquee->passes > 0 && --marquee->passes == 0);
+		// Offset 0 is the empty box
+		if (last) marquee->offset = 0;
+		marquee_draw(marquee);
+		if (last) {
+			// The text has left the box for the last time
+			marquee->active = false;
+			free(marquee->image);
+			marquee->image = NULL;
+		}
+	}
+	// Nothing is sent when no box has moved
+	int bytes = ssd1306_flush(marquee_dev);
+	if (marquee_any_active() == false) xTimerStop(marquee_timer, 0);
+	xSemaphoreGive(marquee_lock);
+	return bytes;
+}
+
+// Render text for the marquee. Called with the lock.
+static bool marquee_render(ssd1306_marquee_t * marquee, const char * text)
+{
+	int pages = (marquee->font->height + 7) / 8;
+	int length = ssd1306_font_render(marquee_dev, marquee->font, text, NULL, 0, marquee->invert);
+	uint8_t * image = malloc(pages * length + 1);
+	if (image == NULL) {
+		ESP_LOGE(__FUNCTION__, "no memory for %d pixels", length);
+		return false;
+	}
+	ssd1306_font_render(marquee_dev, marquee->font, text, image, length, marquee->invert);
+	free(marquee->image);
+	marquee->image = image;
+	marquee->length = length;
+	marquee->offset = 0;
+	marquee->step = 0;
+	return true;
+}
+
+// Start the marquee engine. task is notified with bits every period_ms,
+// and calls ssd1306_marquee_tick().
+// lock protects dev. NULL creates a new one.
+bool ssd1306_marquee_init(SSD1306_t * dev, SemaphoreHandle_t lock, int period_ms, TaskHandle_t task, uint32_t bits)
+{
+	if (marquee_timer != NULL) {
+		ESP_LOGE(__FUNCTION__, "already initialized");
+		return false;
+	}
+	if (lock == NULL) lock = xSemaphoreCreateMutex();
+	if (lock == NULL) {
+		ESP_LOGE(__FUNCTION__, "xSemaphoreCreateMutex fail");
+		return false;
+	}
+	marquee_dev = dev;
+	marquee_task = task;
+	marquee_bits = bits;
+	marquee_last = xTaskGetTickCount();
+	marquee_lock = lock;
+	marquee_timer = xTimerCreate("Marquee", pdMS_TO_TICKS(period_ms), pdTRUE, NULL, marquee_callback);
+	if (marquee_timer == NULL) {
+		ESP_LOGE(__FUNCTION__, "xTimerCreate fail");
+		return false;
+	}
+	// The timer starts with the first marquee
+	return true;
+}
+
+// Add a marquee box of width pixels at page and seg. speed is pixels per second.
+// The text goes through the box passes times and the box is left empty. 0 is forever.
+// Returns the id of the marquee, or -1.
+int ssd1306_marquee_add(const ssd1306_font_t * font, int page, int seg, int width, const char * text, int speed, bool invert, int passes)
+{
+	if (marquee_lock == NULL) {
+		ESP_LOGE(__FUNCTION__, "not initialized");
+		return -1;
+	}
+	if (page < 0 || page + (font->height + 7) / 8 > marquee_dev->_pages || seg < 0 || width <= 0 || seg + width > marquee_dev->_width) {
+		ESP_LOGE(__FUNCTION__, "box out of panel page=%d seg=%d width=%d", page, seg, width);
+		return -1;
+	}
+	xSemaphoreTake(marquee_lock, portMAX_DELAY);
+	int id;
+	for (id=0;id<SSD1306_MARQUEE_MAX;id++) {
+		if (marquees[id].active == false) break;
+	}
+	if (id == SSD1306_MARQUEE_MAX) {
+		xSemaphoreGive(marquee_lock);
+		ESP_LOGE(__FUNCTION__, "too many marquees");
+		return -1;
+	}
+	bool idle = (marquee_any_active() == false);
+	ssd1306_marquee_t * marquee = &marquees[id];
+	memset(marquee, 0, sizeof(ssd1306_marquee_t));
+	marquee->font = font;
+	marquee->page = page;
+	marquee->seg = seg;
+	marquee->width = width;
+	marquee->speed = speed;
+	marquee->invert = invert;
+	marquee->passes = passes;
+	if (marquee_render(marquee, text) == false) {
+		xSemaphoreGive(marquee_lock);
+		return -1;
+	}
+	marquee->active = true;
+	marquee_draw(marquee);
+	if (idle && marquee_paused == false) {
+		marquee_last = xTaskGetTickCount();
+		xTimerStart(marquee_timer, portMAX_DELAY);
+	}
+	xSemaphoreGive(marquee_lock);
+	return id;
+}
+
+// Replace the text of the marquee. It starts again from the right edge.
+bool ssd1306_marquee_set_text(int id, const char * text)
+{
+	if (id < 0 || id >= SSD1306_MARQUEE_MAX || marquee_lock == NULL) return false;
+	xSemaphoreTake(marquee_lock, portMAX_DELAY);
+	bool ret = false;
+	if (marquees[id].active) {
+		ret = marquee_render(&marquees[id], text);
+		if (ret) marquee_draw(&marquees[id]);
+	}
+	xSemaphoreGive(marquee_lock);
+	return ret;
+}
+
+// Remove the marquee. The box is left as it is.
+void ssd1306_marquee_remove(int id)
+{
+	if (id < 0 || id >= SSD1306_MARQUEE_MAX || marquee_lock == NULL) return;
+	xSemaphoreTake(marquee_lock, portMAX_DELAY);
+	marquees[id].active = false;
+	free(marquees[id].image);
+	marquees[id].image = NULL;
+	if (marquee_any_active() == false) xTimerStop(marquee_timer, portMAX_DELAY);
+	xSemaphoreGive(marquee_lock);
+}
+
+// The marquees go on from where they stopped
+void ssd1306_marquee_start(void)
+{
+	if (marquee_timer == NULL) return;
+	xSemaphoreTake(marquee_lock, portMAX_DELAY);
+	marquee_paused = false;
+	marquee_last = xTaskGetTickCount();
+	if (marquee_any_active()) xTimerStart(marquee_timer, portMAX_DELAY);
+	xSemaphoreGive(marquee_lock);
+}
+
+void ssd1306_marquee_stop(void)
+{
+	if (marquee_timer == NULL) return;
+	xSemaphoreTake(marquee_lock, portMAX_DELAY);
+	marquee_paused = true;
+	xTimerStop(marquee_timer, portMAX_DELAY);
+	xSemaphoreGive(marquee_lock);
+}
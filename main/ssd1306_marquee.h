@@ -0,0 +1,57 @@
+#ifndef MAIN_SSD1306_MARQUEE_H_
+#define MAIN_SSD1306_MARQUEE_H_
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include "ssd1306.h"
+
+/* Marquee engine
+Text boxes scroll from right to left without blocking the caller.
+One FreeRTOS timer paces every marquee. The timer callback only notifies a task,
+because the flush blocks on the bus and timer callbacks must not block.
+That task calls ssd1306_marquee_tick(), which advances the marquees by the time since
+the last tick, copies only the columns of the boxes to the internal buffer
+and calls ssd1306_flush() once.
+The text is rendered once when it is set, so a tick is only a copy of the box columns.
+The timer only runs while a marquee is active, so a marquee that ends its passes
+leaves the panel quiet.
+
+Take the same lock when drawing to the device from other tasks.
+*/
+#define SSD1306_MARQUEE_MAX 4
+
+typedef struct {
+	bool active;
+	const ssd1306_font_t * font;
+	int page;     // Box position
+	int seg;
+	int width;    // Box width in pixels
+	int speed;    // Pixels per second
+	bool invert;
+	uint8_t * image; // Rendered text. pages * length bytes
+	int length;   // Text width in pixels
+	int offset;   // Scroll position in {0 .. width+length-1}
+	int step;     // Elapsed pixels in 1/1000
+	int passes;   // Passes left. 0 is forever
+} ssd1306_marquee_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+bool ssd1306_marquee_init(SSD1306_t * dev, SemaphoreHandle_t lock, int period_ms, TaskHandle_t task, uint32_t bits);
+int ssd1306_marquee_tick(void);
+int ssd1306_marquee_add(const ssd1306_font_t * font, int page, int seg, int width, const char * text, int speed, bool invert, int passes);
+bool ssd1306_marquee_set_text(int id, const char * text);
+void ssd1306_marquee_remove(int id);
+void ssd1306_marquee_start(void);
+void ssd1306_marquee_stop(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAIN_SSD1306_MARQUEE_H_ */
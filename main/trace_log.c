@@ -0,0 +1,143 @@
+// trace_log.c
+#include "trace_log.h"
+#include <stdatomic.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+
+// Bounded multi-producer ring. Each slot has a sequence number, based on
+// lap = position & ~(TRACE_RING_SIZE - 1): the slot is free for a producer when seq == lap,
+// and holds a record for the consumer when seq == lap + 1.
+// The consumer frees it for the next lap. A zeroed ring is empty, so no init is needed.
+typedef struct {
+    atomic_uint seq;
+    trace_record_t rec;
+} trace_slot_t;
+
+typedef struct {
+    atomic_uint window;  // Rate limit window, esp_timer_get_time() >> 20
+    atomic_uint count;   // Records in the window
+    atomic_uint limited; // Dropped by the rate limit since the last report
+} trace_rate_t;
+
+static trace_slot_t trace_ring[TRACE_RING_SIZE];
+static atomic_uint trace_head;      // Next position for producers
+static unsigned int trace_tail;     // Next position for task_trace_log
+static atomic_uint trace_overflow;  // Dropped because the ring was full
+static trace_rate_t trace_rates[TRACE_COUNT];
+
+#define TRACE_LAP(pos) ((pos) & ~(unsigned int)(TRACE_RING_SIZE - 1))
+
+// Returns false when the message already used its records for this window
+static IRAM_ATTR bool trace_rate_ok(trace_id_t id, int64_t now) {
+    uint32_t rate = trace_messages[id].rate;
+    if (rate == 0) return true;
+
+    trace_rate_t *r = &trace_rates[id];
+    unsigned int window = (unsigned int)(now >> 20);
+    if (atomic_load_explicit(&r->window, memory_order_relaxed) != window) {
+        // Two writers can both restart the window. That only lets a few extra records through.
+        atomic_store_explicit(&r->window, window, memory_order_relaxed);
+        atomic_store_explicit(&r->count, 0, memory_order_relaxed);
+    }
+    if (atomic_fetch_add_explicit(&r->count, 1, memory_order_relaxed) >= rate) {
+        atomic_fetch_add_explicit(&r->limited, 1, memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+// Store one record. Never blocks; drops the record when the ring is full.
+void IRAM_ATTR trace_log(trace_id_t id, int32_t a0, int32_t a1, int32_t a2) {
+    int64_t now = esp_timer_get_time();
+    if (!trace_rate_ok(id, now)) return;
+
+    unsigned int pos = atomic_load_explicit(&trace_head, memory_order_relaxed);
+    trace_slot_t *slot;
+    while (1) {
+        slot = &trace_ring[pos & (TRACE_RING_SIZE - 1)];
+        unsigned int seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        int diff = (int)(seq - TRACE_LAP(pos));
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&trace_head, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // The consumer has not freed this slot yet
+            atomic_fetch_add_explicit(&trace_overflow, 1, memory_order_relaxed);
+            return;
+        } else {
+            pos = atomic_load_explicit(&trace_head, memory_order_relaxed);
+        }
+    }
+
+    slot->rec.time_us = (uint32_t)now;
+    slot->rec.id = id;
+    slot->rec.seq = (uint16_t)pos;
+    slot->rec.args[0] = a0;
+    slot->rec.args[1] = a1;
+    slot->rec.args[2] = a2;
+    atomic_store_explicit(&slot->seq, TRACE_LAP(pos) + 1, memory_order_release);
+}
+
+static void trace_emit(const trace_record_t *rec) {
+#if CONFIG_TRACE_LOG_BINARY
+    const uint8_t *bytes = (const uint8_t *)rec;
+    char line[sizeof(TRACE_BINARY_PREFIX) + sizeof(*rec) * 2];
+    int len = snprintf(line, sizeof(line), "%s", TRACE_BINARY_PREFIX);
+    for (size_t i = 0; i < sizeof(*rec); i++) {
+        len += snprintf(line + len, sizeof(line) - len, "%02x", bytes[i]);
+    }
+    printf("%s\n", line);
+#else
+    char text[96];
+    trace_format(rec, text, sizeof(text));
+    ESP_LOGI(trace_messages[rec->id].tag, "(%lu) %s", (unsigned long)(rec->time_us / 1000), text);
+#endif
+}
+
+// Report the drop counters as records of their own, so the binary log keeps them too
+static void trace_report_drops(void) {
+    trace_record_t rec = { .time_us = (uint32_t)esp_timer_get_time() };
+    for (int id = 0; id < TRACE_COUNT; id++) {
+        unsigned int limited = atomic_exchange_explicit(&trace_rates[id].limited, 0, memory_order_relaxed);
+        if (limited) {
+            rec.id = TRACE_LIMITED;
+            rec.args[0] = id;
+            rec.args[1] = (int32_t)limited;
+            trace_emit(&rec);
+        }
+    }
+    unsigned int overflow = atomic_exchange_explicit(&trace_overflow, 0, memory_order_relaxed);
+    if (overflow) {
+        rec.id = TRACE_OVERFLOW;
+        rec.args[0] = (int32_t)overflow;
+        rec.args[1] = 0;
+        trace_emit(&rec);
+    }
+}
+
+/*
+ * Trace emitter:
+ * - Runs below every other task, so formatting and UART output never delay them
+ * - Drains the ring every TRACE_FLUSH_MS, then reports what was dropped
+ */
+void task_trace_log(void *pvParameters) {
+    while (1) {
+        while (1) {
+            trace_slot_t *slot = &trace_ring[trace_tail & (TRACE_RING_SIZE - 1)];
+            unsigned int lap = TRACE_LAP(trace_tail);
+            if (atomic_load_explicit(&slot->seq, memory_order_acquire) != lap + 1) break;
+            trace_record_t rec = slot->rec;
+            atomic_store_explicit(&slot->seq, lap + TRACE_RING_SIZE, memory_order_release);
+            trace_tail++;
+            trace_emit(&rec);
+        }
+        trace_report_drops();
+        vTaskDelay(pdMS_TO_TICKS(TRACE_FLUSH_MS));
+    }
+}
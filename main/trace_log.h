@@ -0,0 +1,96 @@
+#ifndef TRACE_LOG_H
+#define TRACE_LOG_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+// --- Deferred trace log ---
+// TRACE_LOG() stores a fixed-size binary record (message id, timestamp, up to 3 arguments)
+// in a lock-free ring and returns. It never blocks and does no formatting, so it is safe
+// with g_state_mutex held, in timer callbacks and in ISRs.
+// task_trace_log formats the records at low priority and writes them to the console.
+// With CONFIG_TRACE_LOG_BINARY the records are written as hex lines for tools/trace_decode.c.
+
+#define TRACE_RING_SIZE    64  // Records. Power of 2.
+#define TRACE_ARGS         3
+#define TRACE_FLUSH_MS     50  // Emitter poll period
+#define TRACE_BINARY_PREFIX "TRC:"
+
+// X(id, tag, rate, format)
+// rate is the most records of the message kept per second (about 1.05 s). 0 keeps all.
+// Arguments are int32_t, so formats use %ld or %lu.
+#define TRACE_MESSAGES(X) \
+    X(TRACE_LIMITED,        "TRACE",  0,  "%s: %ld records rate limited") \
+    X(TRACE_OVERFLOW,       "TRACE",  0,  "%ld records lost, ring full") \
+    X(TRACE_QUEUE_EVENT,    "QUEUE",  10, "Received event: %ld") \
+    X(TRACE_MUTEX_TAKEN,    "MUTEX",  10, "Mutex taken by LED controller") \
+    X(TRACE_MUTEX_RELEASED, "MUTEX",  10, "Mutex released by LED controller") \
+    X(TRACE_TIMER_EXPIRED,  "TIMER",  0,  "Timer expired, sending EVENT_MOTION_TIMEOUT") \
+    X(TRACE_TIMER_RESET,    "TIMER",  0,  "Resetting LED off timer") \
+    X(TRACE_TIMER_LED_OFF,  "TIMER",  0,  "LED off timer expired, turning off LED") \
+    X(TRACE_LIGHT_SAMPLE,   "SENSOR", 0,  "ADC raw=%ld -> %ld mV -> %ld lux") \
+    X(TRACE_LIGHT_LED_ON,   "SENSOR", 0,  "Brightness=%lu%% -> LED ON") \
+    X(TRACE_LIGHT_LED_OFF,  "SENSOR", 0,  "Brightness=%lu%% -> LED OFF") \
+    X(TRACE_MODE_AUTO,      "MODE",   0,  "Double press: switched to AUTO mode") \
+    X(TRACE_MODE_MANUAL,    "MODE",   0,  "Double press: switched to MANUAL mode") \
+    X(TRACE_LED_ON,         "LED",    0,  "Single press: LED ON") \
+    X(TRACE_LED_OFF,        "LED",    0,  "Single press: LED OFF") \
+    X(TRACE_NOTIFY_OLED,    "TASK_NOTIF", 0, "Sending notification to OLED task") \
+    X(TRACE_EVENT_DROPPED,  "BUS",    5,  "Event %ld dropped, lane %ld full") \
+    X(TRACE_LIGHT_OVERFLOW, "SENSOR", 1,  "ADC pool full, %ld frames lost") \
+    X(TRACE_LIGHT_INTERVAL, "SENSOR", 2,  "Light measured every %ld ms, change %ld") \
+    X(TRACE_MOTION_EDGE,    "SENSOR", 0,  "Motion edge handled after %ld us, %ld suppressed, %ld lost") \
+    X(TRACE_BUTTON,         "BUTTON", 0,  "Button %ld: event %ld, %ld clicks") \
+    X(TRACE_BUTTON_LOST,    "BUTTON", 1,  "Edge queue full, %ld edges lost")
+
+#define TRACE_ENUM(id, tag, rate, format) id,
+typedef enum {
+    TRACE_MESSAGES(TRACE_ENUM)
+    TRACE_COUNT
+} trace_id_t;
+#undef TRACE_ENUM
+
+typedef struct {
+    const char *name;
+    const char *tag;
+    uint32_t rate;
+    const char *format;
+} trace_message_t;
+
+#define TRACE_ENTRY(id, tag, rate, format) { #id, tag, rate, format },
+static const trace_message_t trace_messages[TRACE_COUNT] = {
+    TRACE_MESSAGES(TRACE_ENTRY)
+};
+#undef TRACE_ENTRY
+
+// 20 bytes, little endian on the wire
+typedef struct {
+    uint32_t time_us;   // esp_timer_get_time(), wraps after 71 minutes
+    uint16_t id;        // trace_id_t
+    uint16_t seq;       // Ring position, so the decoder can see lines lost on the way
+    int32_t args[TRACE_ARGS];
+} trace_record_t;
+
+// Format the message of a record without the tag and timestamp.
+// Shared by the emitter and the host decoder.
+static inline int trace_format(const trace_record_t *rec, char *out, size_t size) {
+    if (rec->id >= TRACE_COUNT) {
+        return snprintf(out, size, "unknown message %u", rec->id);
+    }
+    if (rec->id == TRACE_LIMITED) {
+        uint32_t limited = (uint32_t)rec->args[0];
+        const char *name = limited < TRACE_COUNT ? trace_messages[limited].name : "?";
+        return snprintf(out, size, trace_messages[rec->id].format, name, (long)rec->args[1]);
+    }
+    return snprintf(out, size, trace_messages[rec->id].format,
+                    (long)rec->args[0], (long)rec->args[1], (long)rec->args[2]);
+}
+
+#define TRACE_LOG(...) TRACE_LOG_(__VA_ARGS__, 0, 0, 0, 0)
+#define TRACE_LOG_(id, a0, a1, a2, ...) trace_log((id), (int32_t)(a0), (int32_t)(a1), (int32_t)(a2))
+
+void trace_log(trace_id_t id, int32_t a0, int32_t a1, int32_t a2);
+void task_trace_log(void *pvParameters);
+
+#endif
@@ -0,0 +1,100 @@
+//
+// trace_decode - format the binary trace records of main/trace_log.c
+//
+// cc -I main -o trace_decode tools/trace_decode.c
+// idf.py monitor | tee monitor.log
+// ./trace_decode monitor.log
+//
+// Build the firmware with CONFIG_TRACE_LOG_BINARY, and the decoder from the same tree,
+// so the message table matches.
+// Lines starting with TRC: are decoded. Other lines are copied as they are.
+// A jump in the record sequence means lines were lost between the board and the log.
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "trace_log.h"
+
+static int hex_value(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static uint32_t get_le(const uint8_t *p, int bytes)
+{
+    uint32_t value = 0;
+    for (int i = bytes - 1; i >= 0; i--) value = (value << 8) | p[i];
+    return value;
+}
+
+// Returns 0 when the hex text holds one record
+static int parse_record(const char *hex, trace_record_t *rec)
+{
+    uint8_t bytes[sizeof(trace_record_t)];
+    for (size_t i = 0; i < sizeof(bytes); i++) {
+        int hi = hex_value(hex[i * 2]);
+        int lo = hi < 0 ? -1 : hex_value(hex[i * 2 + 1]);
+        if (lo < 0) return -1;
+        bytes[i] = (uint8_t)(hi << 4 | lo);
+    }
+    rec->time_us = get_le(&bytes[0], 4);
+    rec->id = (uint16_t)get_le(&bytes[4], 2);
+    rec->seq = (uint16_t)get_le(&bytes[6], 2);
+    for (int i = 0; i < TRACE_ARGS; i++) {
+        rec->args[i] = (int32_t)get_le(&bytes[8 + i * 4], 4);
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *in = stdin;
+    if (argc > 2) {
+        fprintf(stderr, "usage: %s [log]\n", argv[0]);
+        return 1;
+    }
+    if (argc == 2) {
+        in = fopen(argv[1], "r");
+        if (in == NULL) {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    char line[512];
+    char text[128];
+    int have_seq = 0;
+    uint16_t next_seq = 0;
+    unsigned long records = 0, lost = 0;
+    const size_t prefix = strlen(TRACE_BINARY_PREFIX);
+    while (fgets(line, sizeof(line), in)) {
+        const char *p = strstr(line, TRACE_BINARY_PREFIX);
+        trace_record_t rec;
+        if (p == NULL || parse_record(p + prefix, &rec) != 0) {
+            fputs(line, stdout);
+            continue;
+        }
+        // Drop reports are made by the emitter and are not in the ring sequence
+        if (rec.id != TRACE_LIMITED && rec.id != TRACE_OVERFLOW) {
+            if (have_seq && rec.seq != next_seq) {
+                uint16_t missing = (uint16_t)(rec.seq - next_seq);
+                printf("--- %u records missing from the log\n", missing);
+                lost += missing;
+            }
+            have_seq = 1;
+            next_seq = (uint16_t)(rec.seq + 1);
+        }
+        trace_format(&rec, text, sizeof(text));
+        const char *tag = rec.id < TRACE_COUNT ? trace_messages[rec.id].tag : "?";
+        printf("%10.3f %-10s %s\n", rec.time_us / 1000.0, tag, text);
+        records++;
+    }
+    if (in != stdin) fclose(in);
+    fprintf(stderr, "%lu records, %lu missing\n", records, lost);
+    return 0;
+}